@@ -0,0 +1,22 @@
+unsigned nondet_unsigned();
+
+int main()
+{
+  unsigned a[4];
+  unsigned i=nondet_unsigned(), x=nondet_unsigned(), y=x;
+
+  __CPROVER_assume(i<4);
+
+  a[i]=x;
+  a[(i+1)%4]=x^y;
+
+  // multiplexers over the same inputs get merged
+  unsigned s=(x>10)?a[i]:y;
+  unsigned t=(x>10)?y:a[i];
+
+  assert(s==t);
+  assert(a[(i+1)%4]==0);
+  assert((x^y)+(y^x)==0);
+
+  return 0;
+}
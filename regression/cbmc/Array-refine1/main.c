@@ -0,0 +1,18 @@
+int main()
+{
+  // too large to be flattened
+  int a[2000], b[2000], c[2000];
+  unsigned i;
+
+  __CPROVER_assume(i<2000);
+
+  // the element-wise constraints do not give transitivity
+  if(__CPROVER_array_equal(a, b) &&
+     __CPROVER_array_equal(b, c))
+  {
+    assert(__CPROVER_array_equal(a, c));
+    assert(a[i]==c[i]);
+  }
+
+  return 0;
+}
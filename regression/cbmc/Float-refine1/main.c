@@ -0,0 +1,16 @@
+#include <assert.h>
+
+int main()
+{
+  double x, y, z;
+
+  __CPROVER_assume(x>=1.0 && x<=2.0);
+  __CPROVER_assume(y>=1.0 && y<=2.0);
+
+  z=x*y;
+
+  assert(z>=1.0 && z<=4.0);
+  assert(z==y*x);
+
+  return 0;
+}
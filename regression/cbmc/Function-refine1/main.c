@@ -0,0 +1,16 @@
+int __CPROVER_uninterpreted_f(int, int);
+
+int main()
+{
+  int x, y, z;
+
+  __CPROVER_assume(x==y);
+
+  int a=__CPROVER_uninterpreted_f(x, z);
+  int b=__CPROVER_uninterpreted_f(y, z);
+  int c=__CPROVER_uninterpreted_f(z, x+1);
+
+  assert(a==b);
+
+  return 0;
+}
@@ -0,0 +1,17 @@
+#include <assert.h>
+#include <stdlib.h>
+
+// more objects than fit into 8 bits
+#define N 260
+
+int main()
+{
+  int *p[N];
+
+  for(int i=0; i<N; i++)
+    p[i]=malloc(sizeof(int));
+
+  assert(p[0]!=p[256]);
+
+  return 0;
+}
@@ -0,0 +1,26 @@
+#include <assert.h>
+#include <stdlib.h>
+
+int main()
+{
+  unsigned n, i;
+  __CPROVER_assume(n>0 && n<100);
+  __CPROVER_assume(i>=1 && i<4);
+
+  // the size is not constant, and thus the writes below are
+  // lowered by flatten_byte_operators
+  int *a=malloc(n*sizeof(int));
+
+  // a constant offset
+  a[0]=0x11223344;
+  ((char *)a)[1]=0x55;
+  assert(a[0]==0x11225544);
+
+  // a variable offset, the lowest byte stays
+  a[0]=0x11223344;
+  ((char *)a)[i]=0x66;
+  assert((a[0]&0xff)==0x44);
+  assert(i!=2 || a[0]==0x11663344);
+
+  return 0;
+}
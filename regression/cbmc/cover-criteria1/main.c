@@ -0,0 +1,11 @@
+int main()
+{
+  int x;
+
+  if(x>0)
+    x=1;
+  else
+    x=2;
+
+  return x;
+}
@@ -0,0 +1,14 @@
+#include <assert.h>
+
+int main()
+{
+  int x;
+
+  if(x>10)
+    assert(x>5);
+
+  if(x<0 && x>0)
+    assert(0);
+
+  return 0;
+}
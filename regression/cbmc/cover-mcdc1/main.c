@@ -0,0 +1,15 @@
+int main()
+{
+  int a, b, x, y;
+
+  if(a && b)
+    x=1;
+  else
+    x=2;
+
+  // y>0 cannot be false while it determines the outcome
+  if(y>0 && y>5)
+    x=3;
+
+  return x;
+}
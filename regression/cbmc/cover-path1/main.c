@@ -0,0 +1,9 @@
+int main()
+{
+  int x;
+
+  if(x>0)
+    x=1;
+
+  return x;
+}
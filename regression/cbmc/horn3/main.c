@@ -0,0 +1,11 @@
+int main()
+{
+  unsigned x=0;
+
+  while(x<10)
+    x++;
+
+  __CPROVER_assert(x==11, "wrong loop bound");
+
+  return 0;
+}
@@ -0,0 +1,15 @@
+int nondet_int();
+
+int main()
+{
+  int x=nondet_int();
+
+  __CPROVER_assume(x>0 && x<100);
+
+  __CPROVER_assert(x!=0, "nonzero");
+  __CPROVER_assert(x<100, "upper bound");
+  __CPROVER_assert(x!=50, "not fifty");
+  __CPROVER_assert(x+1>x, "no overflow");
+
+  return 0;
+}
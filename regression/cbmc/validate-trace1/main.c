@@ -0,0 +1,7 @@
+int main()
+{
+  unsigned char x;
+  x=x+1;
+  __CPROVER_assert(x!=0, "wrap-around");
+  return 0;
+}
@@ -0,0 +1,12 @@
+int nondet_int();
+
+int main()
+{
+  int x=nondet_int();
+  int y=nondet_int();
+
+  __CPROVER_assert(x!=10, "x");
+  __CPROVER_assert(y<x, "y");
+
+  return 0;
+}
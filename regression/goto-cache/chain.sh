@@ -0,0 +1,52 @@
+#!/bin/sh
+
+# Runs the tool twice on a copy of the test, with a fresh cache
+# directory that both runs share, and removes both afterwards.
+#
+#   chain.sh tool [options of the first run] -- [options of the second run] file
+#
+# The file is given to both runs. If the test has a directory
+# 'then', its files are copied over those of the test before
+# the second run. The output and the exit code are those of
+# the second run.
+
+tool=`cd \`dirname $1\` && pwd`/`basename $1`
+shift
+
+first=""
+second=""
+in_second=0
+
+for a in "$@"
+do
+  if [ "$a" = "--" ]; then
+    in_second=1
+  elif [ $in_second = 0 ]; then
+    first="$first $a"
+  else
+    second="$second $a"
+    file=$a
+  fi
+done
+
+work=`mktemp -d`
+trap 'rm -rf "$work"' EXIT
+
+cp -R . "$work/test"
+cd "$work/test"
+
+$tool --goto-cache "$work/cache" $first $file >"$work/first.out" 2>&1
+retcode=$?
+
+if [ $retcode -ne 0 ] && [ $retcode -ne 10 ]; then
+  cat "$work/first.out"
+  echo "first run failed with exit code $retcode"
+  exit $retcode
+fi
+
+if [ -d then ]; then
+  cp -R then/. .
+fi
+
+$tool --goto-cache "$work/cache" $second
+exit $?
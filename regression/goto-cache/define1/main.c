@@ -0,0 +1,16 @@
+#include <assert.h>
+
+#ifndef N
+#define N 2
+#endif
+
+int twice(int x)
+{
+  return x*N;
+}
+
+int main()
+{
+  assert(twice(3)==6);
+  return 0;
+}
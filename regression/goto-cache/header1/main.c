@@ -0,0 +1,18 @@
+#include <assert.h>
+
+#include "square.h"
+
+int cube(int x)
+{
+  return x*x*x;
+}
+
+int main()
+{
+  assert(cube(2)==8);
+
+  // the second run has a different square
+  assert(square(3)==9);
+
+  return 0;
+}
@@ -0,0 +1,15 @@
+#include <assert.h>
+#include <ctype.h>
+
+int main()
+{
+  int c;
+
+  assert(isdigit('7'));
+  assert(!isdigit('x'));
+
+  if(isdigit(c))
+    assert(c>='0' && c<='9');
+
+  return 0;
+}
@@ -0,0 +1,16 @@
+#include <assert.h>
+#include <stdlib.h>
+
+int square(int x)
+{
+  return x*x;
+}
+
+int main()
+{
+  int *p=malloc(sizeof(int));
+  *p=square(3);
+  assert(*p==9);
+  free(p);
+  return 0;
+}
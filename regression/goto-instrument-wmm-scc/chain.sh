@@ -0,0 +1,74 @@
+#!/bin/sh
+
+# Instruments a test for a weak memory model twice, collecting the
+# cycles over the whole event graph and per SCC (--scc), and
+# compares the cycles and the fences that the two runs report.
+#
+#   chain.sh goto-cc goto-instrument [options of goto-instrument] file
+#
+# Prints the fences of the first run, their number, and whether
+# the second run agrees.
+
+goto_cc=`cd \`dirname $1\` && pwd`/`basename $1`
+goto_instrument=`cd \`dirname $2\` && pwd`/`basename $2`
+shift 2
+
+options=""
+file=""
+
+for a in "$@"
+do
+  options="$options $file"
+  file=$a
+done
+
+work=`mktemp -d`
+trap 'rm -rf "$work"' EXIT
+
+$goto_cc -o "$work/test.gb" $file || exit $?
+
+for run in whole scc
+do
+  if [ $run = scc ]; then
+    flag=--scc
+  else
+    flag=
+  fi
+
+  $goto_instrument $options $flag "$work/test.gb" "$work/$run.gb" \
+    >"$work/$run.out" 2>&1
+  retcode=$?
+
+  if [ $retcode -ne 0 ]; then
+    cat "$work/$run.out"
+    echo "goto-instrument $flag failed with exit code $retcode"
+    exit $retcode
+  fi
+
+  grep '^fence, ' "$work/$run.out" | sort >"$work/$run.fences"
+done
+
+cat "$work/whole.fences"
+echo "fences: `wc -l <"$work/whole.fences"`"
+
+if cmp -s "$work/whole.fences" "$work/scc.fences"; then
+  echo "same fences"
+else
+  echo "different fences"
+  diff "$work/whole.fences" "$work/scc.fences"
+fi
+
+whole=`sed -n 's/^cycles collected: \([0-9]*\) cycles found$/\1/p' \
+  "$work/whole.out"`
+scc=`sed -n 's/^SCC #[0-9]*: \([0-9]*\) cycles found$/\1/p' \
+  "$work/scc.out" | awk '{ n+=$1 } END { print n+0 }'`
+
+echo "cycles: $whole"
+
+if [ "$whole" = "$scc" ]; then
+  echo "same cycles"
+else
+  echo "different cycles: $scc per SCC"
+fi
+
+exit 0
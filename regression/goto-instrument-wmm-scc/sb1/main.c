@@ -0,0 +1,25 @@
+int __unbuffered_cnt=0;
+int __unbuffered_p0_r1=0;
+int __unbuffered_p1_r1=0;
+int x=0;
+int y=0;
+
+void * P0(void * arg) {
+  x = 1;
+  __unbuffered_p0_r1 = y;
+  __unbuffered_cnt++;
+}
+
+void * P1(void * arg) {
+  y = 1;
+  __unbuffered_p1_r1 = x;
+  __unbuffered_cnt++;
+}
+
+int main() {
+  __CPROVER_ASYNC_0: P0(0);
+  __CPROVER_ASYNC_1: P1(0);
+  __CPROVER_assume(__unbuffered_cnt==2);
+  __CPROVER_assert(!(__unbuffered_p0_r1==0 && __unbuffered_p1_r1==0), "store buffering");
+  return 0;
+}
@@ -25,6 +25,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "trans_unit.h"
 #include "c_preprocess.h"
 #include "ansi_c_internal_additions.h"
+#include "builtin_snapshot.h"
 #include "type2name.h"
 
 /*******************************************************************\
@@ -117,57 +118,52 @@ bool ansi_c_languaget::parse(
 
   std::istringstream i_preprocessed(o_preprocessed.str());
 
-  // parsing
+  bool result;
 
-  std::string code;
-  ansi_c_internal_additions(code);
-  std::istringstream codestr(code);
+  if(builtin_snapshot_directory.empty())
+  {
+    // parsing, after the internal additions
 
-  ansi_c_parser.clear();
-  ansi_c_parser.set_file(ID_built_in);
-  ansi_c_parser.in=&codestr;
-  ansi_c_parser.set_message_handler(get_message_handler());
-  ansi_c_parser.for_has_scope=config.ansi_c.for_has_scope;
-  ansi_c_parser.cpp98=false; // it's not C++
-  ansi_c_parser.cpp11=false; // it's not C++
+    builtin_snapshot=NULL;
 
-  switch(config.ansi_c.mode)
-  {
-  case configt::ansi_ct::flavourt::MODE_CODEWARRIOR_C_CPP:
-    ansi_c_parser.mode=ansi_c_parsert::CW;
-    break;
-   
-  case configt::ansi_ct::flavourt::MODE_VISUAL_STUDIO_C_CPP:
-    ansi_c_parser.mode=ansi_c_parsert::MSC;
-    break;
-    
-  case configt::ansi_ct::flavourt::MODE_ANSI_C_CPP:
-    ansi_c_parser.mode=ansi_c_parsert::ANSI;
-    break;
-    
-  case configt::ansi_ct::flavourt::MODE_GCC_C:
-  case configt::ansi_ct::flavourt::MODE_GCC_CPP:
-    ansi_c_parser.mode=ansi_c_parsert::GCC;
-    break;
-    
-  case configt::ansi_ct::flavourt::MODE_ARM_C_CPP:
-    ansi_c_parser.mode=ansi_c_parsert::ARM;
-    break;
-    
-  default:
-    assert(false);
-  }
+    std::string code;
+    ansi_c_internal_additions(code);
+    std::istringstream codestr(code);
 
-  ansi_c_scanner_init();
+    ansi_c_parser.clear();
+    ansi_c_parser.set_file(ID_built_in);
+    ansi_c_parser.in=&codestr;
+    ansi_c_parser.set_message_handler(get_message_handler());
+    configure_ansi_c_parser();
+    ansi_c_scanner_init();
 
-  bool result=ansi_c_parser.parse();
+    result=ansi_c_parser.parse();
 
-  if(!result)
+    if(!result)
+    {
+      ansi_c_parser.set_line_no(0);
+      ansi_c_parser.set_file(path);
+      ansi_c_parser.in=&i_preprocessed;
+      ansi_c_scanner_init();
+      result=ansi_c_parser.parse();
+    }
+  }
+  else
   {
-    ansi_c_parser.set_line_no(0);
+    // parsing, starting from the state the parser is in
+    // after the internal additions
+
+    if(get_builtin_snapshot(builtin_snapshot, get_message_handler()))
+      return true;
+
+    ansi_c_parser.clear();
+    ansi_c_parser.root_scope()=builtin_snapshot->root_scope;
     ansi_c_parser.set_file(path);
     ansi_c_parser.in=&i_preprocessed;
+    ansi_c_parser.set_message_handler(get_message_handler());
+    configure_ansi_c_parser();
     ansi_c_scanner_init();
+
     result=ansi_c_parser.parse();
   }
 
@@ -198,6 +194,15 @@ bool ansi_c_languaget::typecheck(
 {
   symbol_tablet new_symbol_table;
 
+  // the built-in declarations are typechecked already
+  if(builtin_snapshot!=NULL)
+    forall_symbols(it, builtin_snapshot->symbol_table.symbols)
+    {
+      symbolt symbol=it->second;
+      symbol.module=module;
+      new_symbol_table.add(symbol);
+    }
+
   if(ansi_c_typecheck(parse_tree, new_symbol_table, module, get_message_handler()))
     return true;
 
@@ -40,7 +40,7 @@ public:
   virtual void show_parse(std::ostream &out);
   
   virtual ~ansi_c_languaget();
-  ansi_c_languaget() { }
+  ansi_c_languaget():builtin_snapshot(NULL) { }
   
   virtual bool from_expr(
     const exprt &expr,
@@ -75,6 +75,9 @@ public:
 protected:
   ansi_c_parse_treet parse_tree;
   std::string parse_path;
+
+  // the built-in declarations the parse tree was parsed against
+  const class builtin_snapshott *builtin_snapshot;
 };
  
 languaget *new_ansi_c_language();
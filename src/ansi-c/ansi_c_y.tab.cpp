@@ -0,0 +1,7636 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         yyansi_cparse
+#define yylex           yyansi_clex
+#define yyerror         yyansi_cerror
+#define yydebug         yyansi_cdebug
+#define yynerrs         yyansi_cnerrs
+#define yylval          yyansi_clval
+#define yychar          yyansi_cchar
+
+/* First part of user prologue.  */
+#line 1 "parser.y"
+
+
+/*
+ * This parser is based on:
+ *
+ * c5.y, a ANSI-C grammar written by James A. Roskind.
+ * "Portions Copyright (c) 1989, 1990 James A. Roskind".
+ * (http://www.idiom.com/free-compilers/,
+ * ftp://ftp.infoseek.com/ftp/pub/c++grammar/,
+ * ftp://ftp.sra.co.jp/.a/pub/cmd/c++grammar2.0.tar.gz)
+ */
+
+#define PARSER ansi_c_parser
+
+#include "ansi_c_parser.h"
+
+int yyansi_clex();
+extern char *yyansi_ctext;
+
+#include "parser_static.inc"
+
+#include "ansi_c_y.tab.h"
+
+// statements have right recursion, deep nesting of statements thus
+// requires more stack space
+#define YYMAXDEPTH 25600
+
+/*** token declaration **************************************************/
+#line 234 "parser.y"
+
+/************************************************************************/
+/*** rules **************************************************************/
+/************************************************************************/
+
+#line 113 "ansi_c_y.tab.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "ansi_c_y.tab.hpp"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_TOK_AUTO = 3,                   /* "auto"  */
+  YYSYMBOL_TOK_BOOL = 4,                   /* "bool"  */
+  YYSYMBOL_TOK_COMPLEX = 5,                /* "complex"  */
+  YYSYMBOL_TOK_BREAK = 6,                  /* "break"  */
+  YYSYMBOL_TOK_CASE = 7,                   /* "case"  */
+  YYSYMBOL_TOK_CHAR = 8,                   /* "char"  */
+  YYSYMBOL_TOK_CONST = 9,                  /* "const"  */
+  YYSYMBOL_TOK_CONTINUE = 10,              /* "continue"  */
+  YYSYMBOL_TOK_DEFAULT = 11,               /* "default"  */
+  YYSYMBOL_TOK_DO = 12,                    /* "do"  */
+  YYSYMBOL_TOK_DOUBLE = 13,                /* "double"  */
+  YYSYMBOL_TOK_ELSE = 14,                  /* "else"  */
+  YYSYMBOL_TOK_ENUM = 15,                  /* "enum"  */
+  YYSYMBOL_TOK_EXTERN = 16,                /* "extern"  */
+  YYSYMBOL_TOK_FLOAT = 17,                 /* "float"  */
+  YYSYMBOL_TOK_FOR = 18,                   /* "for"  */
+  YYSYMBOL_TOK_GOTO = 19,                  /* "goto"  */
+  YYSYMBOL_TOK_IF = 20,                    /* "if"  */
+  YYSYMBOL_TOK_INLINE = 21,                /* "inline"  */
+  YYSYMBOL_TOK_INT = 22,                   /* "int"  */
+  YYSYMBOL_TOK_LONG = 23,                  /* "long"  */
+  YYSYMBOL_TOK_REGISTER = 24,              /* "register"  */
+  YYSYMBOL_TOK_RESTRICT = 25,              /* "restrict"  */
+  YYSYMBOL_TOK_RETURN = 26,                /* "return"  */
+  YYSYMBOL_TOK_SHORT = 27,                 /* "short"  */
+  YYSYMBOL_TOK_SIGNED = 28,                /* "signed"  */
+  YYSYMBOL_TOK_SIZEOF = 29,                /* "sizeof"  */
+  YYSYMBOL_TOK_STATIC = 30,                /* "static"  */
+  YYSYMBOL_TOK_STRUCT = 31,                /* "struct"  */
+  YYSYMBOL_TOK_SWITCH = 32,                /* "switch"  */
+  YYSYMBOL_TOK_TYPEDEF = 33,               /* "typedef"  */
+  YYSYMBOL_TOK_UNION = 34,                 /* "union"  */
+  YYSYMBOL_TOK_UNSIGNED = 35,              /* "unsigned"  */
+  YYSYMBOL_TOK_VOID = 36,                  /* "void"  */
+  YYSYMBOL_TOK_VOLATILE = 37,              /* "volatile"  */
+  YYSYMBOL_TOK_WCHAR_T = 38,               /* "wchar_t"  */
+  YYSYMBOL_TOK_WHILE = 39,                 /* "while"  */
+  YYSYMBOL_TOK_ARROW = 40,                 /* "->"  */
+  YYSYMBOL_TOK_INCR = 41,                  /* "++"  */
+  YYSYMBOL_TOK_DECR = 42,                  /* "--"  */
+  YYSYMBOL_TOK_SHIFTLEFT = 43,             /* "<<"  */
+  YYSYMBOL_TOK_SHIFTRIGHT = 44,            /* ">>"  */
+  YYSYMBOL_TOK_LE = 45,                    /* "<="  */
+  YYSYMBOL_TOK_GE = 46,                    /* ">="  */
+  YYSYMBOL_TOK_EQ = 47,                    /* "=="  */
+  YYSYMBOL_TOK_NE = 48,                    /* "!="  */
+  YYSYMBOL_TOK_ANDAND = 49,                /* "&&"  */
+  YYSYMBOL_TOK_OROR = 50,                  /* "||"  */
+  YYSYMBOL_TOK_ELLIPSIS = 51,              /* "..."  */
+  YYSYMBOL_TOK_MULTASSIGN = 52,            /* "*="  */
+  YYSYMBOL_TOK_DIVASSIGN = 53,             /* "/="  */
+  YYSYMBOL_TOK_MODASSIGN = 54,             /* "%="  */
+  YYSYMBOL_TOK_PLUSASSIGN = 55,            /* "+="  */
+  YYSYMBOL_TOK_MINUSASSIGN = 56,           /* "-="  */
+  YYSYMBOL_TOK_SHLASSIGN = 57,             /* "<<="  */
+  YYSYMBOL_TOK_SHRASSIGN = 58,             /* ">>="  */
+  YYSYMBOL_TOK_ANDASSIGN = 59,             /* "&="  */
+  YYSYMBOL_TOK_XORASSIGN = 60,             /* "^="  */
+  YYSYMBOL_TOK_ORASSIGN = 61,              /* "|="  */
+  YYSYMBOL_TOK_IDENTIFIER = 62,            /* TOK_IDENTIFIER  */
+  YYSYMBOL_TOK_TYPEDEFNAME = 63,           /* TOK_TYPEDEFNAME  */
+  YYSYMBOL_TOK_INTEGER = 64,               /* TOK_INTEGER  */
+  YYSYMBOL_TOK_FLOATING = 65,              /* TOK_FLOATING  */
+  YYSYMBOL_TOK_CHARACTER = 66,             /* TOK_CHARACTER  */
+  YYSYMBOL_TOK_STRING = 67,                /* TOK_STRING  */
+  YYSYMBOL_TOK_ASM_STRING = 68,            /* TOK_ASM_STRING  */
+  YYSYMBOL_TOK_INT8 = 69,                  /* "__int8"  */
+  YYSYMBOL_TOK_INT16 = 70,                 /* "__int16"  */
+  YYSYMBOL_TOK_INT32 = 71,                 /* "__int32"  */
+  YYSYMBOL_TOK_INT64 = 72,                 /* "__int64"  */
+  YYSYMBOL_TOK_PTR32 = 73,                 /* "__ptr32"  */
+  YYSYMBOL_TOK_PTR64 = 74,                 /* "__ptr64"  */
+  YYSYMBOL_TOK_TYPEOF = 75,                /* "typeof"  */
+  YYSYMBOL_TOK_GCC_AUTO_TYPE = 76,         /* "__auto_type"  */
+  YYSYMBOL_TOK_GCC_FLOAT80 = 77,           /* "__float80"  */
+  YYSYMBOL_TOK_GCC_FLOAT128 = 78,          /* "__float128"  */
+  YYSYMBOL_TOK_GCC_INT128 = 79,            /* "__int128"  */
+  YYSYMBOL_TOK_GCC_DECIMAL32 = 80,         /* "_Decimal32"  */
+  YYSYMBOL_TOK_GCC_DECIMAL64 = 81,         /* "_Decimal64"  */
+  YYSYMBOL_TOK_GCC_DECIMAL128 = 82,        /* "_Decimal128"  */
+  YYSYMBOL_TOK_GCC_ASM = 83,               /* "__asm__"  */
+  YYSYMBOL_TOK_GCC_ASM_PAREN = 84,         /* "__asm__ (with parentheses)"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE = 85,         /* "__attribute__"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_ALIGNED = 86, /* "aligned"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_TRANSPARENT_UNION = 87, /* "transparent_union"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_PACKED = 88,  /* "packed"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_VECTOR_SIZE = 89, /* "vector_size"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_MODE = 90,    /* "mode"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_GNU_INLINE = 91, /* "__gnu_inline__"  */
+  YYSYMBOL_TOK_GCC_ATTRIBUTE_END = 92,     /* ")"  */
+  YYSYMBOL_TOK_GCC_LABEL = 93,             /* "__label__"  */
+  YYSYMBOL_TOK_MSC_ASM = 94,               /* "__asm"  */
+  YYSYMBOL_TOK_MSC_BASED = 95,             /* "__based"  */
+  YYSYMBOL_TOK_CW_VAR_ARG_TYPEOF = 96,     /* "_var_arg_typeof"  */
+  YYSYMBOL_TOK_BUILTIN_VA_ARG = 97,        /* "__builtin_va_arg"  */
+  YYSYMBOL_TOK_GCC_BUILTIN_TYPES_COMPATIBLE_P = 98, /* "__builtin_types_compatible_p"  */
+  YYSYMBOL_TOK_OFFSETOF = 99,              /* "__offsetof"  */
+  YYSYMBOL_TOK_ALIGNOF = 100,              /* "__alignof__"  */
+  YYSYMBOL_TOK_MSC_TRY = 101,              /* "__try"  */
+  YYSYMBOL_TOK_MSC_FINALLY = 102,          /* "__finally"  */
+  YYSYMBOL_TOK_MSC_EXCEPT = 103,           /* "__except"  */
+  YYSYMBOL_TOK_MSC_LEAVE = 104,            /* "__leave"  */
+  YYSYMBOL_TOK_MSC_DECLSPEC = 105,         /* "__declspec"  */
+  YYSYMBOL_TOK_INTERFACE = 106,            /* "__interface"  */
+  YYSYMBOL_TOK_CDECL = 107,                /* "__cdecl"  */
+  YYSYMBOL_TOK_STDCALL = 108,              /* "__stdcall"  */
+  YYSYMBOL_TOK_FASTCALL = 109,             /* "__fastcall"  */
+  YYSYMBOL_TOK_CLRCALL = 110,              /* "__clrcall"  */
+  YYSYMBOL_TOK_FORALL = 111,               /* "forall"  */
+  YYSYMBOL_TOK_EXISTS = 112,               /* "exists"  */
+  YYSYMBOL_TOK_ACSL_FORALL = 113,          /* "\\forall"  */
+  YYSYMBOL_TOK_ACSL_EXISTS = 114,          /* "\\exists"  */
+  YYSYMBOL_TOK_ARRAY_OF = 115,             /* "array_of"  */
+  YYSYMBOL_TOK_CPROVER_BITVECTOR = 116,    /* "__CPROVER_bitvector"  */
+  YYSYMBOL_TOK_CPROVER_FLOATBV = 117,      /* "__CPROVER_floatbv"  */
+  YYSYMBOL_TOK_CPROVER_FIXEDBV = 118,      /* "__CPROVER_fixedbv"  */
+  YYSYMBOL_TOK_CPROVER_ATOMIC = 119,       /* "__CPROVER_atomic"  */
+  YYSYMBOL_TOK_CPROVER_BOOL = 120,         /* "__CPROVER_bool"  */
+  YYSYMBOL_TOK_CPROVER_THROW = 121,        /* "__CPROVER_throw"  */
+  YYSYMBOL_TOK_CPROVER_CATCH = 122,        /* "__CPROVER_catch"  */
+  YYSYMBOL_TOK_CPROVER_TRY = 123,          /* "__CPROVER_try"  */
+  YYSYMBOL_TOK_CPROVER_FINALLY = 124,      /* "__CPROVER_finally"  */
+  YYSYMBOL_TOK_CPROVER_ID = 125,           /* "__CPROVER_ID"  */
+  YYSYMBOL_TOK_IMPLIES = 126,              /* "==>"  */
+  YYSYMBOL_TOK_EQUIVALENT = 127,           /* "<==>"  */
+  YYSYMBOL_TOK_TRUE = 128,                 /* "TRUE"  */
+  YYSYMBOL_TOK_FALSE = 129,                /* "FALSE"  */
+  YYSYMBOL_TOK_REAL = 130,                 /* "__real__"  */
+  YYSYMBOL_TOK_IMAG = 131,                 /* "__imag__"  */
+  YYSYMBOL_TOK_ALIGNAS = 132,              /* "_Alignas"  */
+  YYSYMBOL_TOK_ATOMIC_TYPE_QUALIFIER = 133, /* "_Atomic"  */
+  YYSYMBOL_TOK_ATOMIC_TYPE_SPECIFIER = 134, /* "_Atomic()"  */
+  YYSYMBOL_TOK_GENERIC = 135,              /* "_Generic"  */
+  YYSYMBOL_TOK_IMAGINARY = 136,            /* "_Imaginary"  */
+  YYSYMBOL_TOK_NORETURN = 137,             /* "_Noreturn"  */
+  YYSYMBOL_TOK_STATIC_ASSERT = 138,        /* "_Static_assert"  */
+  YYSYMBOL_TOK_THREAD_LOCAL = 139,         /* "_Thread_local"  */
+  YYSYMBOL_TOK_NULLPTR = 140,              /* "nullptr"  */
+  YYSYMBOL_TOK_CONSTEXPR = 141,            /* "constexpr"  */
+  YYSYMBOL_TOK_SCANNER_ERROR = 142,        /* TOK_SCANNER_ERROR  */
+  YYSYMBOL_TOK_SCANNER_EOF = 143,          /* TOK_SCANNER_EOF  */
+  YYSYMBOL_TOK_CATCH = 144,                /* "catch"  */
+  YYSYMBOL_TOK_CHAR16_T = 145,             /* "char16_t"  */
+  YYSYMBOL_TOK_CHAR32_T = 146,             /* "char32_t"  */
+  YYSYMBOL_TOK_CLASS = 147,                /* "class"  */
+  YYSYMBOL_TOK_DELETE = 148,               /* "delete"  */
+  YYSYMBOL_TOK_DECLTYPE = 149,             /* "decltype"  */
+  YYSYMBOL_TOK_EXPLICIT = 150,             /* "explicit"  */
+  YYSYMBOL_TOK_FRIEND = 151,               /* "friend"  */
+  YYSYMBOL_TOK_MUTABLE = 152,              /* "mutable"  */
+  YYSYMBOL_TOK_NAMESPACE = 153,            /* "namespace"  */
+  YYSYMBOL_TOK_NEW = 154,                  /* "new"  */
+  YYSYMBOL_TOK_NOEXCEPT = 155,             /* "noexcept"  */
+  YYSYMBOL_TOK_OPERATOR = 156,             /* "operator"  */
+  YYSYMBOL_TOK_PRIVATE = 157,              /* "private"  */
+  YYSYMBOL_TOK_PROTECTED = 158,            /* "protected"  */
+  YYSYMBOL_TOK_PUBLIC = 159,               /* "public"  */
+  YYSYMBOL_TOK_TEMPLATE = 160,             /* "template"  */
+  YYSYMBOL_TOK_THIS = 161,                 /* "this"  */
+  YYSYMBOL_TOK_THROW = 162,                /* "throw"  */
+  YYSYMBOL_TOK_TYPEID = 163,               /* "typeid"  */
+  YYSYMBOL_TOK_TYPENAME = 164,             /* "typename"  */
+  YYSYMBOL_TOK_TRY = 165,                  /* "try"  */
+  YYSYMBOL_TOK_USING = 166,                /* "using"  */
+  YYSYMBOL_TOK_VIRTUAL = 167,              /* "virtual"  */
+  YYSYMBOL_TOK_SCOPE = 168,                /* "::"  */
+  YYSYMBOL_TOK_DOTPM = 169,                /* ".*"  */
+  YYSYMBOL_TOK_ARROWPM = 170,              /* "->*"  */
+  YYSYMBOL_TOK_UNARY_TYPE_PREDICATE = 171, /* TOK_UNARY_TYPE_PREDICATE  */
+  YYSYMBOL_TOK_BINARY_TYPE_PREDICATE = 172, /* TOK_BINARY_TYPE_PREDICATE  */
+  YYSYMBOL_TOK_MSC_UUIDOF = 173,           /* "__uuidof"  */
+  YYSYMBOL_TOK_MSC_IF_EXISTS = 174,        /* "__if_exists"  */
+  YYSYMBOL_TOK_MSC_IF_NOT_EXISTS = 175,    /* "__if_not_exists"  */
+  YYSYMBOL_TOK_UNDERLYING_TYPE = 176,      /* "__underlying_type"  */
+  YYSYMBOL_177_ = 177,                     /* '('  */
+  YYSYMBOL_178_ = 178,                     /* ')'  */
+  YYSYMBOL_179_ = 179,                     /* ','  */
+  YYSYMBOL_180_ = 180,                     /* ':'  */
+  YYSYMBOL_181_ = 181,                     /* '.'  */
+  YYSYMBOL_182_ = 182,                     /* '['  */
+  YYSYMBOL_183_ = 183,                     /* ']'  */
+  YYSYMBOL_184_ = 184,                     /* '{'  */
+  YYSYMBOL_185_ = 185,                     /* '}'  */
+  YYSYMBOL_186_ = 186,                     /* '&'  */
+  YYSYMBOL_187_ = 187,                     /* '*'  */
+  YYSYMBOL_188_ = 188,                     /* '+'  */
+  YYSYMBOL_189_ = 189,                     /* '-'  */
+  YYSYMBOL_190_ = 190,                     /* '~'  */
+  YYSYMBOL_191_ = 191,                     /* '!'  */
+  YYSYMBOL_192_ = 192,                     /* '/'  */
+  YYSYMBOL_193_ = 193,                     /* '%'  */
+  YYSYMBOL_194_ = 194,                     /* '<'  */
+  YYSYMBOL_195_ = 195,                     /* '>'  */
+  YYSYMBOL_196_ = 196,                     /* '^'  */
+  YYSYMBOL_197_ = 197,                     /* '|'  */
+  YYSYMBOL_198_ = 198,                     /* '?'  */
+  YYSYMBOL_199_ = 199,                     /* '='  */
+  YYSYMBOL_200_ = 200,                     /* ';'  */
+  YYSYMBOL_YYACCEPT = 201,                 /* $accept  */
+  YYSYMBOL_grammar = 202,                  /* grammar  */
+  YYSYMBOL_identifier = 203,               /* identifier  */
+  YYSYMBOL_typedef_name = 204,             /* typedef_name  */
+  YYSYMBOL_integer = 205,                  /* integer  */
+  YYSYMBOL_floating = 206,                 /* floating  */
+  YYSYMBOL_character = 207,                /* character  */
+  YYSYMBOL_string = 208,                   /* string  */
+  YYSYMBOL_constant = 209,                 /* constant  */
+  YYSYMBOL_primary_expression = 210,       /* primary_expression  */
+  YYSYMBOL_generic_selection = 211,        /* generic_selection  */
+  YYSYMBOL_generic_assoc_list = 212,       /* generic_assoc_list  */
+  YYSYMBOL_generic_association = 213,      /* generic_association  */
+  YYSYMBOL_gcc_builtin_expressions = 214,  /* gcc_builtin_expressions  */
+  YYSYMBOL_cw_builtin_expressions = 215,   /* cw_builtin_expressions  */
+  YYSYMBOL_offsetof = 216,                 /* offsetof  */
+  YYSYMBOL_offsetof_member_designator = 217, /* offsetof_member_designator  */
+  YYSYMBOL_quantifier_expression = 218,    /* quantifier_expression  */
+  YYSYMBOL_statement_expression = 219,     /* statement_expression  */
+  YYSYMBOL_postfix_expression = 220,       /* postfix_expression  */
+  YYSYMBOL_member_name = 221,              /* member_name  */
+  YYSYMBOL_argument_expression_list = 222, /* argument_expression_list  */
+  YYSYMBOL_unary_expression = 223,         /* unary_expression  */
+  YYSYMBOL_cast_expression = 224,          /* cast_expression  */
+  YYSYMBOL_multiplicative_expression = 225, /* multiplicative_expression  */
+  YYSYMBOL_additive_expression = 226,      /* additive_expression  */
+  YYSYMBOL_shift_expression = 227,         /* shift_expression  */
+  YYSYMBOL_relational_expression = 228,    /* relational_expression  */
+  YYSYMBOL_equality_expression = 229,      /* equality_expression  */
+  YYSYMBOL_and_expression = 230,           /* and_expression  */
+  YYSYMBOL_exclusive_or_expression = 231,  /* exclusive_or_expression  */
+  YYSYMBOL_inclusive_or_expression = 232,  /* inclusive_or_expression  */
+  YYSYMBOL_logical_and_expression = 233,   /* logical_and_expression  */
+  YYSYMBOL_logical_or_expression = 234,    /* logical_or_expression  */
+  YYSYMBOL_logical_implication_expression = 235, /* logical_implication_expression  */
+  YYSYMBOL_logical_equivalence_expression = 236, /* logical_equivalence_expression  */
+  YYSYMBOL_conditional_expression = 237,   /* conditional_expression  */
+  YYSYMBOL_assignment_expression = 238,    /* assignment_expression  */
+  YYSYMBOL_comma_expression = 239,         /* comma_expression  */
+  YYSYMBOL_constant_expression = 240,      /* constant_expression  */
+  YYSYMBOL_comma_expression_opt = 241,     /* comma_expression_opt  */
+  YYSYMBOL_declaration = 242,              /* declaration  */
+  YYSYMBOL_static_assert_declaration = 243, /* static_assert_declaration  */
+  YYSYMBOL_default_declaring_list = 244,   /* default_declaring_list  */
+  YYSYMBOL_245_1 = 245,                    /* @1  */
+  YYSYMBOL_246_2 = 246,                    /* @2  */
+  YYSYMBOL_247_3 = 247,                    /* $@3  */
+  YYSYMBOL_post_declarator_attribute = 248, /* post_declarator_attribute  */
+  YYSYMBOL_post_declarator_attributes = 249, /* post_declarator_attributes  */
+  YYSYMBOL_post_declarator_attributes_opt = 250, /* post_declarator_attributes_opt  */
+  YYSYMBOL_declaring_list = 251,           /* declaring_list  */
+  YYSYMBOL_252_4 = 252,                    /* @4  */
+  YYSYMBOL_253_5 = 253,                    /* @5  */
+  YYSYMBOL_254_6 = 254,                    /* $@6  */
+  YYSYMBOL_declaration_specifier = 255,    /* declaration_specifier  */
+  YYSYMBOL_type_specifier = 256,           /* type_specifier  */
+  YYSYMBOL_declaration_qualifier_list = 257, /* declaration_qualifier_list  */
+  YYSYMBOL_type_qualifier_list = 258,      /* type_qualifier_list  */
+  YYSYMBOL_attribute_type_qualifier_list = 259, /* attribute_type_qualifier_list  */
+  YYSYMBOL_declaration_qualifier = 260,    /* declaration_qualifier  */
+  YYSYMBOL_type_qualifier = 261,           /* type_qualifier  */
+  YYSYMBOL_alignas_specifier = 262,        /* alignas_specifier  */
+  YYSYMBOL_attribute_or_type_qualifier = 263, /* attribute_or_type_qualifier  */
+  YYSYMBOL_attribute_or_type_qualifier_or_storage_class = 264, /* attribute_or_type_qualifier_or_storage_class  */
+  YYSYMBOL_attribute_type_qualifier_storage_class_list = 265, /* attribute_type_qualifier_storage_class_list  */
+  YYSYMBOL_basic_declaration_specifier = 266, /* basic_declaration_specifier  */
+  YYSYMBOL_basic_type_specifier = 267,     /* basic_type_specifier  */
+  YYSYMBOL_sue_declaration_specifier = 268, /* sue_declaration_specifier  */
+  YYSYMBOL_sue_type_specifier = 269,       /* sue_type_specifier  */
+  YYSYMBOL_typedef_declaration_specifier = 270, /* typedef_declaration_specifier  */
+  YYSYMBOL_typeof_declaration_specifier = 271, /* typeof_declaration_specifier  */
+  YYSYMBOL_atomic_declaration_specifier = 272, /* atomic_declaration_specifier  */
+  YYSYMBOL_typedef_type_specifier = 273,   /* typedef_type_specifier  */
+  YYSYMBOL_typeof_specifier = 274,         /* typeof_specifier  */
+  YYSYMBOL_typeof_type_specifier = 275,    /* typeof_type_specifier  */
+  YYSYMBOL_atomic_specifier = 276,         /* atomic_specifier  */
+  YYSYMBOL_atomic_type_specifier = 277,    /* atomic_type_specifier  */
+  YYSYMBOL_msc_decl_identifier = 278,      /* msc_decl_identifier  */
+  YYSYMBOL_msc_decl_modifier = 279,        /* msc_decl_modifier  */
+  YYSYMBOL_msc_declspec_seq = 280,         /* msc_declspec_seq  */
+  YYSYMBOL_msc_declspec = 281,             /* msc_declspec  */
+  YYSYMBOL_msc_declspec_opt = 282,         /* msc_declspec_opt  */
+  YYSYMBOL_storage_class = 283,            /* storage_class  */
+  YYSYMBOL_basic_type_name = 284,          /* basic_type_name  */
+  YYSYMBOL_elaborated_type_name = 285,     /* elaborated_type_name  */
+  YYSYMBOL_array_of_construct = 286,       /* array_of_construct  */
+  YYSYMBOL_pragma_packed = 287,            /* pragma_packed  */
+  YYSYMBOL_aggregate_name = 288,           /* aggregate_name  */
+  YYSYMBOL_289_7 = 289,                    /* $@7  */
+  YYSYMBOL_290_8 = 290,                    /* $@8  */
+  YYSYMBOL_291_9 = 291,                    /* $@9  */
+  YYSYMBOL_aggregate_key = 292,            /* aggregate_key  */
+  YYSYMBOL_gcc_attribute_expression_list = 293, /* gcc_attribute_expression_list  */
+  YYSYMBOL_gcc_attribute_expression_list_opt = 294, /* gcc_attribute_expression_list_opt  */
+  YYSYMBOL_gcc_attribute = 295,            /* gcc_attribute  */
+  YYSYMBOL_gcc_attribute_list = 296,       /* gcc_attribute_list  */
+  YYSYMBOL_gcc_attribute_specifier = 297,  /* gcc_attribute_specifier  */
+  YYSYMBOL_gcc_type_attribute_opt = 298,   /* gcc_type_attribute_opt  */
+  YYSYMBOL_gcc_type_attribute_list = 299,  /* gcc_type_attribute_list  */
+  YYSYMBOL_gcc_type_attribute = 300,       /* gcc_type_attribute  */
+  YYSYMBOL_member_declaration_list_opt = 301, /* member_declaration_list_opt  */
+  YYSYMBOL_member_declaration_list = 302,  /* member_declaration_list  */
+  YYSYMBOL_member_declaration = 303,       /* member_declaration  */
+  YYSYMBOL_member_default_declaring_list = 304, /* member_default_declaring_list  */
+  YYSYMBOL_member_declaring_list = 305,    /* member_declaring_list  */
+  YYSYMBOL_member_declarator = 306,        /* member_declarator  */
+  YYSYMBOL_member_identifier_declarator = 307, /* member_identifier_declarator  */
+  YYSYMBOL_bit_field_size_opt = 308,       /* bit_field_size_opt  */
+  YYSYMBOL_bit_field_size = 309,           /* bit_field_size  */
+  YYSYMBOL_enum_name = 310,                /* enum_name  */
+  YYSYMBOL_311_10 = 311,                   /* $@10  */
+  YYSYMBOL_312_11 = 312,                   /* $@11  */
+  YYSYMBOL_enum_key = 313,                 /* enum_key  */
+  YYSYMBOL_enumerator_list_opt = 314,      /* enumerator_list_opt  */
+  YYSYMBOL_enumerator_list = 315,          /* enumerator_list  */
+  YYSYMBOL_enumerator_declaration = 316,   /* enumerator_declaration  */
+  YYSYMBOL_enumerator_value_opt = 317,     /* enumerator_value_opt  */
+  YYSYMBOL_parameter_type_list = 318,      /* parameter_type_list  */
+  YYSYMBOL_KnR_parameter_list = 319,       /* KnR_parameter_list  */
+  YYSYMBOL_KnR_parameter = 320,            /* KnR_parameter  */
+  YYSYMBOL_parameter_list = 321,           /* parameter_list  */
+  YYSYMBOL_parameter_declaration = 322,    /* parameter_declaration  */
+  YYSYMBOL_identifier_or_typedef_name = 323, /* identifier_or_typedef_name  */
+  YYSYMBOL_type_name = 324,                /* type_name  */
+  YYSYMBOL_initializer_opt = 325,          /* initializer_opt  */
+  YYSYMBOL_initializer = 326,              /* initializer  */
+  YYSYMBOL_initializer_list = 327,         /* initializer_list  */
+  YYSYMBOL_initializer_list_opt = 328,     /* initializer_list_opt  */
+  YYSYMBOL_designated_initializer = 329,   /* designated_initializer  */
+  YYSYMBOL_designator = 330,               /* designator  */
+  YYSYMBOL_statement = 331,                /* statement  */
+  YYSYMBOL_declaration_statement = 332,    /* declaration_statement  */
+  YYSYMBOL_labeled_statement = 333,        /* labeled_statement  */
+  YYSYMBOL_compound_statement = 334,       /* compound_statement  */
+  YYSYMBOL_compound_scope = 335,           /* compound_scope  */
+  YYSYMBOL_statement_list = 336,           /* statement_list  */
+  YYSYMBOL_expression_statement = 337,     /* expression_statement  */
+  YYSYMBOL_selection_statement = 338,      /* selection_statement  */
+  YYSYMBOL_declaration_or_expression_statement = 339, /* declaration_or_expression_statement  */
+  YYSYMBOL_iteration_statement = 340,      /* iteration_statement  */
+  YYSYMBOL_341_12 = 341,                   /* $@12  */
+  YYSYMBOL_jump_statement = 342,           /* jump_statement  */
+  YYSYMBOL_gcc_local_label_statement = 343, /* gcc_local_label_statement  */
+  YYSYMBOL_gcc_local_label_list = 344,     /* gcc_local_label_list  */
+  YYSYMBOL_gcc_local_label = 345,          /* gcc_local_label  */
+  YYSYMBOL_gcc_asm_statement = 346,        /* gcc_asm_statement  */
+  YYSYMBOL_msc_asm_statement = 347,        /* msc_asm_statement  */
+  YYSYMBOL_msc_seh_statement = 348,        /* msc_seh_statement  */
+  YYSYMBOL_cprover_exception_statement = 349, /* cprover_exception_statement  */
+  YYSYMBOL_volatile_or_goto_opt = 350,     /* volatile_or_goto_opt  */
+  YYSYMBOL_gcc_asm_commands = 351,         /* gcc_asm_commands  */
+  YYSYMBOL_gcc_asm_assembler_template = 352, /* gcc_asm_assembler_template  */
+  YYSYMBOL_gcc_asm_outputs = 353,          /* gcc_asm_outputs  */
+  YYSYMBOL_gcc_asm_output = 354,           /* gcc_asm_output  */
+  YYSYMBOL_gcc_asm_output_list = 355,      /* gcc_asm_output_list  */
+  YYSYMBOL_gcc_asm_inputs = 356,           /* gcc_asm_inputs  */
+  YYSYMBOL_gcc_asm_input = 357,            /* gcc_asm_input  */
+  YYSYMBOL_gcc_asm_input_list = 358,       /* gcc_asm_input_list  */
+  YYSYMBOL_gcc_asm_clobbered_registers = 359, /* gcc_asm_clobbered_registers  */
+  YYSYMBOL_gcc_asm_clobbered_register = 360, /* gcc_asm_clobbered_register  */
+  YYSYMBOL_gcc_asm_clobbered_registers_list = 361, /* gcc_asm_clobbered_registers_list  */
+  YYSYMBOL_gcc_asm_labels = 362,           /* gcc_asm_labels  */
+  YYSYMBOL_gcc_asm_labels_list = 363,      /* gcc_asm_labels_list  */
+  YYSYMBOL_gcc_asm_label = 364,            /* gcc_asm_label  */
+  YYSYMBOL_translation_unit = 365,         /* translation_unit  */
+  YYSYMBOL_external_definition_list = 366, /* external_definition_list  */
+  YYSYMBOL_external_definition = 367,      /* external_definition  */
+  YYSYMBOL_asm_definition = 368,           /* asm_definition  */
+  YYSYMBOL_function_definition = 369,      /* function_definition  */
+  YYSYMBOL_function_body = 370,            /* function_body  */
+  YYSYMBOL_KnR_parameter_header_opt = 371, /* KnR_parameter_header_opt  */
+  YYSYMBOL_KnR_parameter_header = 372,     /* KnR_parameter_header  */
+  YYSYMBOL_KnR_parameter_declaration = 373, /* KnR_parameter_declaration  */
+  YYSYMBOL_KnR_declaration_qualifier_list = 374, /* KnR_declaration_qualifier_list  */
+  YYSYMBOL_KnR_basic_declaration_specifier = 375, /* KnR_basic_declaration_specifier  */
+  YYSYMBOL_KnR_typedef_declaration_specifier = 376, /* KnR_typedef_declaration_specifier  */
+  YYSYMBOL_KnR_sue_declaration_specifier = 377, /* KnR_sue_declaration_specifier  */
+  YYSYMBOL_KnR_declaration_specifier = 378, /* KnR_declaration_specifier  */
+  YYSYMBOL_KnR_parameter_declaring_list = 379, /* KnR_parameter_declaring_list  */
+  YYSYMBOL_function_head = 380,            /* function_head  */
+  YYSYMBOL_declarator = 381,               /* declarator  */
+  YYSYMBOL_typedef_declarator = 382,       /* typedef_declarator  */
+  YYSYMBOL_parameter_typedef_declarator = 383, /* parameter_typedef_declarator  */
+  YYSYMBOL_clean_typedef_declarator = 384, /* clean_typedef_declarator  */
+  YYSYMBOL_clean_postfix_typedef_declarator = 385, /* clean_postfix_typedef_declarator  */
+  YYSYMBOL_paren_typedef_declarator = 386, /* paren_typedef_declarator  */
+  YYSYMBOL_paren_postfix_typedef_declarator = 387, /* paren_postfix_typedef_declarator  */
+  YYSYMBOL_simple_paren_typedef_declarator = 388, /* simple_paren_typedef_declarator  */
+  YYSYMBOL_identifier_declarator = 389,    /* identifier_declarator  */
+  YYSYMBOL_unary_identifier_declarator = 390, /* unary_identifier_declarator  */
+  YYSYMBOL_postfix_identifier_declarator = 391, /* postfix_identifier_declarator  */
+  YYSYMBOL_paren_identifier_declarator = 392, /* paren_identifier_declarator  */
+  YYSYMBOL_abstract_declarator = 393,      /* abstract_declarator  */
+  YYSYMBOL_parameter_abstract_declarator = 394, /* parameter_abstract_declarator  */
+  YYSYMBOL_postfixing_abstract_declarator = 395, /* postfixing_abstract_declarator  */
+  YYSYMBOL_396_13 = 396,                   /* $@13  */
+  YYSYMBOL_parameter_postfixing_abstract_declarator = 397, /* parameter_postfixing_abstract_declarator  */
+  YYSYMBOL_398_14 = 398,                   /* $@14  */
+  YYSYMBOL_array_abstract_declarator = 399, /* array_abstract_declarator  */
+  YYSYMBOL_unary_abstract_declarator = 400, /* unary_abstract_declarator  */
+  YYSYMBOL_parameter_unary_abstract_declarator = 401, /* parameter_unary_abstract_declarator  */
+  YYSYMBOL_postfix_abstract_declarator = 402, /* postfix_abstract_declarator  */
+  YYSYMBOL_parameter_postfix_abstract_declarator = 403 /* parameter_postfix_abstract_declarator  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  154
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   6508
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  201
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  203
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  588
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1055
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   431
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   191,     2,     2,     2,   193,   186,     2,
+     177,   178,   187,   188,   179,   189,   181,   192,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   180,   200,
+     194,   199,   195,   198,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   182,     2,   183,   196,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   184,   197,   185,   190,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   242,   242,   248,   249,   261,   265,   269,   273,   277,
+     282,   283,   284,   285,   291,   292,   293,   295,   296,   297,
+     298,   299,   300,   304,   314,   318,   325,   332,   342,   349,
+     363,   372,   382,   390,   397,   407,   415,   425,   433,   445,
+     455,   456,   458,   467,   476,   482,   488,   494,   501,   511,
+     525,   526,   530,   535,   543,   544,   550,   556,   561,   571,
+     576,   581,   586,   591,   596,   601,   606,   612,   621,   622,
+     629,   634,   642,   643,   645,   647,   652,   653,   655,   660,
+     661,   663,   668,   669,   671,   673,   675,   680,   681,   683,
+     688,   689,   694,   695,   700,   701,   706,   707,   712,   713,
+     721,   722,   730,   731,   736,   737,   744,   754,   755,   757,
+     759,   761,   763,   765,   767,   769,   771,   773,   775,   780,
+     781,   786,   791,   792,   798,   804,   810,   811,   812,   816,
+     828,   827,   840,   839,   852,   851,   867,   874,   878,   882,
+     887,   890,   896,   894,   912,   910,   926,   944,   942,   958,
+     959,   960,   961,   962,   966,   967,   968,   969,   970,   974,
+     975,   979,   980,   984,   991,   992,   999,  1006,  1007,  1014,
+    1015,  1019,  1020,  1021,  1022,  1023,  1024,  1025,  1026,  1027,
+    1031,  1036,  1044,  1045,  1049,  1050,  1051,  1055,  1056,  1063,
+    1067,  1071,  1075,  1082,  1086,  1090,  1094,  1102,  1106,  1110,
+    1118,  1119,  1123,  1130,  1134,  1138,  1145,  1149,  1153,  1160,
+    1164,  1168,  1175,  1179,  1183,  1190,  1195,  1203,  1204,  1208,
+    1212,  1219,  1228,  1229,  1233,  1237,  1244,  1248,  1252,  1259,
+    1260,  1264,  1268,  1272,  1276,  1280,  1284,  1291,  1296,  1304,
+    1307,  1311,  1312,  1313,  1314,  1315,  1316,  1317,  1318,  1319,
+    1323,  1324,  1325,  1326,  1327,  1328,  1329,  1330,  1331,  1332,
+    1333,  1334,  1335,  1336,  1337,  1338,  1339,  1340,  1341,  1342,
+    1343,  1344,  1350,  1357,  1364,  1368,  1369,  1370,  1374,  1379,
+    1391,  1388,  1409,  1405,  1429,  1425,  1442,  1444,  1449,  1454,
+    1463,  1466,  1471,  1474,  1480,  1485,  1494,  1495,  1502,  1508,
+    1511,  1515,  1516,  1523,  1525,  1527,  1529,  1531,  1533,  1535,
+    1537,  1539,  1544,  1547,  1551,  1556,  1564,  1565,  1566,  1570,
+    1577,  1588,  1596,  1611,  1619,  1630,  1633,  1644,  1653,  1665,
+    1668,  1672,  1684,  1682,  1696,  1693,  1706,  1717,  1726,  1729,
+    1733,  1738,  1743,  1750,  1761,  1765,  1772,  1773,  1782,  1787,
+    1794,  1803,  1808,  1816,  1824,  1831,  1839,  1848,  1856,  1863,
+    1871,  1879,  1886,  1894,  1902,  1910,  1917,  1928,  1929,  1933,
+    1937,  1942,  1946,  1955,  1959,  1969,  1970,  1976,  1985,  1993,
+    2001,  2003,  2011,  2012,  2020,  2026,  2041,  2048,  2055,  2063,
+    2070,  2078,  2090,  2091,  2092,  2093,  2094,  2095,  2096,  2097,
+    2098,  2099,  2100,  2101,  2105,  2114,  2122,  2129,  2138,  2149,
+    2156,  2164,  2176,  2183,  2188,  2195,  2210,  2219,  2228,  2239,
+    2240,  2244,  2252,  2261,  2260,  2288,  2305,  2312,  2314,  2316,
+    2318,  2323,  2344,  2349,  2356,  2360,  2366,  2377,  2383,  2392,
+    2401,  2409,  2417,  2422,  2430,  2440,  2442,  2443,  2444,  2445,
+    2457,  2463,  2470,  2478,  2487,  2499,  2503,  2507,  2511,  2517,
+    2527,  2532,  2540,  2544,  2548,  2554,  2564,  2569,  2577,  2581,
+    2585,  2593,  2598,  2606,  2610,  2614,  2619,  2627,  2635,  2637,
+    2641,  2642,  2646,  2651,  2655,  2656,  2660,  2667,  2688,  2693,
+    2696,  2700,  2705,  2713,  2718,  2719,  2723,  2730,  2734,  2738,
+    2742,  2750,  2754,  2758,  2766,  2771,  2781,  2782,  2783,  2787,
+    2793,  2799,  2807,  2815,  2822,  2829,  2836,  2846,  2847,  2851,
+    2852,  2856,  2857,  2862,  2866,  2867,  2872,  2880,  2882,  2892,
+    2893,  2898,  2904,  2909,  2917,  2919,  2924,  2934,  2935,  2940,
+    2941,  2945,  2946,  2951,  2958,  2971,  2977,  2979,  2989,  2996,
+    3001,  3002,  3003,  3007,  3008,  3012,  3014,  3025,  3024,  3047,
+    3048,  3056,  3055,  3075,  3082,  3092,  3100,  3107,  3116,  3125,
+    3138,  3144,  3152,  3157,  3167,  3178,  3184,  3192,  3197,  3207,
+    3218,  3220,  3222,  3224,  3230,  3239,  3241,  3243,  3244
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "\"auto\"", "\"bool\"",
+  "\"complex\"", "\"break\"", "\"case\"", "\"char\"", "\"const\"",
+  "\"continue\"", "\"default\"", "\"do\"", "\"double\"", "\"else\"",
+  "\"enum\"", "\"extern\"", "\"float\"", "\"for\"", "\"goto\"", "\"if\"",
+  "\"inline\"", "\"int\"", "\"long\"", "\"register\"", "\"restrict\"",
+  "\"return\"", "\"short\"", "\"signed\"", "\"sizeof\"", "\"static\"",
+  "\"struct\"", "\"switch\"", "\"typedef\"", "\"union\"", "\"unsigned\"",
+  "\"void\"", "\"volatile\"", "\"wchar_t\"", "\"while\"", "\"->\"",
+  "\"++\"", "\"--\"", "\"<<\"", "\">>\"", "\"<=\"", "\">=\"", "\"==\"",
+  "\"!=\"", "\"&&\"", "\"||\"", "\"...\"", "\"*=\"", "\"/=\"", "\"%=\"",
+  "\"+=\"", "\"-=\"", "\"<<=\"", "\">>=\"", "\"&=\"", "\"^=\"", "\"|=\"",
+  "TOK_IDENTIFIER", "TOK_TYPEDEFNAME", "TOK_INTEGER", "TOK_FLOATING",
+  "TOK_CHARACTER", "TOK_STRING", "TOK_ASM_STRING", "\"__int8\"",
+  "\"__int16\"", "\"__int32\"", "\"__int64\"", "\"__ptr32\"",
+  "\"__ptr64\"", "\"typeof\"", "\"__auto_type\"", "\"__float80\"",
+  "\"__float128\"", "\"__int128\"", "\"_Decimal32\"", "\"_Decimal64\"",
+  "\"_Decimal128\"", "\"__asm__\"", "\"__asm__ (with parentheses)\"",
+  "\"__attribute__\"", "\"aligned\"", "\"transparent_union\"",
+  "\"packed\"", "\"vector_size\"", "\"mode\"", "\"__gnu_inline__\"",
+  "\")\"", "\"__label__\"", "\"__asm\"", "\"__based\"",
+  "\"_var_arg_typeof\"", "\"__builtin_va_arg\"",
+  "\"__builtin_types_compatible_p\"", "\"__offsetof\"", "\"__alignof__\"",
+  "\"__try\"", "\"__finally\"", "\"__except\"", "\"__leave\"",
+  "\"__declspec\"", "\"__interface\"", "\"__cdecl\"", "\"__stdcall\"",
+  "\"__fastcall\"", "\"__clrcall\"", "\"forall\"", "\"exists\"",
+  "\"\\\\forall\"", "\"\\\\exists\"", "\"array_of\"",
+  "\"__CPROVER_bitvector\"", "\"__CPROVER_floatbv\"",
+  "\"__CPROVER_fixedbv\"", "\"__CPROVER_atomic\"", "\"__CPROVER_bool\"",
+  "\"__CPROVER_throw\"", "\"__CPROVER_catch\"", "\"__CPROVER_try\"",
+  "\"__CPROVER_finally\"", "\"__CPROVER_ID\"", "\"==>\"", "\"<==>\"",
+  "\"TRUE\"", "\"FALSE\"", "\"__real__\"", "\"__imag__\"", "\"_Alignas\"",
+  "\"_Atomic\"", "\"_Atomic()\"", "\"_Generic\"", "\"_Imaginary\"",
+  "\"_Noreturn\"", "\"_Static_assert\"", "\"_Thread_local\"",
+  "\"nullptr\"", "\"constexpr\"", "TOK_SCANNER_ERROR", "TOK_SCANNER_EOF",
+  "\"catch\"", "\"char16_t\"", "\"char32_t\"", "\"class\"", "\"delete\"",
+  "\"decltype\"", "\"explicit\"", "\"friend\"", "\"mutable\"",
+  "\"namespace\"", "\"new\"", "\"noexcept\"", "\"operator\"",
+  "\"private\"", "\"protected\"", "\"public\"", "\"template\"", "\"this\"",
+  "\"throw\"", "\"typeid\"", "\"typename\"", "\"try\"", "\"using\"",
+  "\"virtual\"", "\"::\"", "\".*\"", "\"->*\"", "TOK_UNARY_TYPE_PREDICATE",
+  "TOK_BINARY_TYPE_PREDICATE", "\"__uuidof\"", "\"__if_exists\"",
+  "\"__if_not_exists\"", "\"__underlying_type\"", "'('", "')'", "','",
+  "':'", "'.'", "'['", "']'", "'{'", "'}'", "'&'", "'*'", "'+'", "'-'",
+  "'~'", "'!'", "'/'", "'%'", "'<'", "'>'", "'^'", "'|'", "'?'", "'='",
+  "';'", "$accept", "grammar", "identifier", "typedef_name", "integer",
+  "floating", "character", "string", "constant", "primary_expression",
+  "generic_selection", "generic_assoc_list", "generic_association",
+  "gcc_builtin_expressions", "cw_builtin_expressions", "offsetof",
+  "offsetof_member_designator", "quantifier_expression",
+  "statement_expression", "postfix_expression", "member_name",
+  "argument_expression_list", "unary_expression", "cast_expression",
+  "multiplicative_expression", "additive_expression", "shift_expression",
+  "relational_expression", "equality_expression", "and_expression",
+  "exclusive_or_expression", "inclusive_or_expression",
+  "logical_and_expression", "logical_or_expression",
+  "logical_implication_expression", "logical_equivalence_expression",
+  "conditional_expression", "assignment_expression", "comma_expression",
+  "constant_expression", "comma_expression_opt", "declaration",
+  "static_assert_declaration", "default_declaring_list", "@1", "@2", "$@3",
+  "post_declarator_attribute", "post_declarator_attributes",
+  "post_declarator_attributes_opt", "declaring_list", "@4", "@5", "$@6",
+  "declaration_specifier", "type_specifier", "declaration_qualifier_list",
+  "type_qualifier_list", "attribute_type_qualifier_list",
+  "declaration_qualifier", "type_qualifier", "alignas_specifier",
+  "attribute_or_type_qualifier",
+  "attribute_or_type_qualifier_or_storage_class",
+  "attribute_type_qualifier_storage_class_list",
+  "basic_declaration_specifier", "basic_type_specifier",
+  "sue_declaration_specifier", "sue_type_specifier",
+  "typedef_declaration_specifier", "typeof_declaration_specifier",
+  "atomic_declaration_specifier", "typedef_type_specifier",
+  "typeof_specifier", "typeof_type_specifier", "atomic_specifier",
+  "atomic_type_specifier", "msc_decl_identifier", "msc_decl_modifier",
+  "msc_declspec_seq", "msc_declspec", "msc_declspec_opt", "storage_class",
+  "basic_type_name", "elaborated_type_name", "array_of_construct",
+  "pragma_packed", "aggregate_name", "$@7", "$@8", "$@9", "aggregate_key",
+  "gcc_attribute_expression_list", "gcc_attribute_expression_list_opt",
+  "gcc_attribute", "gcc_attribute_list", "gcc_attribute_specifier",
+  "gcc_type_attribute_opt", "gcc_type_attribute_list",
+  "gcc_type_attribute", "member_declaration_list_opt",
+  "member_declaration_list", "member_declaration",
+  "member_default_declaring_list", "member_declaring_list",
+  "member_declarator", "member_identifier_declarator",
+  "bit_field_size_opt", "bit_field_size", "enum_name", "$@10", "$@11",
+  "enum_key", "enumerator_list_opt", "enumerator_list",
+  "enumerator_declaration", "enumerator_value_opt", "parameter_type_list",
+  "KnR_parameter_list", "KnR_parameter", "parameter_list",
+  "parameter_declaration", "identifier_or_typedef_name", "type_name",
+  "initializer_opt", "initializer", "initializer_list",
+  "initializer_list_opt", "designated_initializer", "designator",
+  "statement", "declaration_statement", "labeled_statement",
+  "compound_statement", "compound_scope", "statement_list",
+  "expression_statement", "selection_statement",
+  "declaration_or_expression_statement", "iteration_statement", "$@12",
+  "jump_statement", "gcc_local_label_statement", "gcc_local_label_list",
+  "gcc_local_label", "gcc_asm_statement", "msc_asm_statement",
+  "msc_seh_statement", "cprover_exception_statement",
+  "volatile_or_goto_opt", "gcc_asm_commands", "gcc_asm_assembler_template",
+  "gcc_asm_outputs", "gcc_asm_output", "gcc_asm_output_list",
+  "gcc_asm_inputs", "gcc_asm_input", "gcc_asm_input_list",
+  "gcc_asm_clobbered_registers", "gcc_asm_clobbered_register",
+  "gcc_asm_clobbered_registers_list", "gcc_asm_labels",
+  "gcc_asm_labels_list", "gcc_asm_label", "translation_unit",
+  "external_definition_list", "external_definition", "asm_definition",
+  "function_definition", "function_body", "KnR_parameter_header_opt",
+  "KnR_parameter_header", "KnR_parameter_declaration",
+  "KnR_declaration_qualifier_list", "KnR_basic_declaration_specifier",
+  "KnR_typedef_declaration_specifier", "KnR_sue_declaration_specifier",
+  "KnR_declaration_specifier", "KnR_parameter_declaring_list",
+  "function_head", "declarator", "typedef_declarator",
+  "parameter_typedef_declarator", "clean_typedef_declarator",
+  "clean_postfix_typedef_declarator", "paren_typedef_declarator",
+  "paren_postfix_typedef_declarator", "simple_paren_typedef_declarator",
+  "identifier_declarator", "unary_identifier_declarator",
+  "postfix_identifier_declarator", "paren_identifier_declarator",
+  "abstract_declarator", "parameter_abstract_declarator",
+  "postfixing_abstract_declarator", "$@13",
+  "parameter_postfixing_abstract_declarator", "$@14",
+  "array_abstract_declarator", "unary_abstract_declarator",
+  "parameter_unary_abstract_declarator", "postfix_abstract_declarator",
+  "parameter_postfix_abstract_declarator", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-830)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-558)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    1898,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,
+    -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,
+    -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,
+    -830,  -830,  -129,   324,  -830,  -830,  -830,  -830,  -830,  -830,
+    -830,   -67,   -43,   -52,    48,    93,    54,    68,   156,    80,
+      87,    83,   108,   111,   118,  -830,  -830,   293,   167,  -830,
+     193,  -830,   204,  -830,   257,  3548,   257,  -830,   309,  -830,
+    1360,  -830,   189,   -97,   -86,   112,   242,  2174,  2174,  -830,
+    -830,  6005,  6005,  1653,  1653,  1653,  1653,  1653,  1653,  1097,
+     332,  1097,   332,  -830,  -830,  1360,  -830,  -830,  -830,  1360,
+    -830,  -830,  -830,  1360,  -830,  1898,  -830,  -830,  -830,  -830,
+    -830,  -830,  -830,    16,  3945,   823,  1643,    16,  1352,  -830,
+    -830,  -830,  -830,  -830,  -830,  -830,   317,   214,  -830,  5012,
+    -830,  -830,  5012,    12,  -830,  5012,    21,  1360,  5012,  5012,
+    5012,  -830,  3945,  1360,  5012,   218,   125,  3869,   257,   995,
+    -830,  -830,  -830,  -830,  -830,  -830,  1360,  -830,  -830,   257,
+    -830,   324,  -830,  -830,  1344,  -830,  1426,  1360,  -830,  -830,
+    1360,  1360,  -830,  1360,  -830,  -830,   249,  1360,  -830,  1097,
+    1097,  -830,  1360,  -830,  -830,   251,  1360,  1360,  -830,  1360,
+    1360,  -830,  -830,  -830,  1360,  1360,  1360,  1360,  1360,  3869,
+    1360,  3869,  1360,  -830,   306,    59,  -830,  -830,   266,  -830,
+      58,  3278,  -830,  -830,   236,  1289,  5206,  5206,    59,  -830,
+    -830,  -830,  -830,   299,   308,   313,   328,  5212,  -830,  -830,
+    -830,  -830,  5012,  5012,   331,  3838,  5012,  5012,  5012,  5012,
+    5012,  5012,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,
+    -830,  -830,  -830,  -830,  -830,    29,  -830,   169,    66,   -94,
+     279,     9,   310,   340,   322,   333,   488,     6,  -830,   -47,
+    -830,  -830,   269,  6257,   376,   823,  -830,   381,   386,    16,
+     823,   873,  -830,  -830,  -830,   117,  -830,  1352,   369,  -830,
+     403,    38,   277,   288,   412,   295,  -830,  -830,  -830,  -830,
+    -830,   418,  -830,    36,   405,    77,   132,   196,   300,   424,
+     433,   444,    16,  -830,   995,  -830,  1162,  -830,  -830,  -830,
+    1352,  -830,  -830,  -830,  -830,  -830,  -830,   437,  -830,  3869,
+    3869,  -830,   437,  -830,  -830,  -830,  -830,  -830,  -830,  -830,
+    -830,  -830,  -830,  -830,  -830,    59,  -830,  -830,   445,   891,
+    2578,  5752,    12,  5615,  -830,  4333,  -830,   458,  -830,  -830,
+    3409,  -830,  -830,  5109,  3838,  -830,  3838,  -830,  -830,  -830,
+    -830,  1360,  5012,  1360,  1360,  3838,  -830,   464,   473,  5341,
+    5341,  -830,  -830,  5012,   360,   472,   482,  -830,  -830,  -830,
+    -830,  -830,  -830,    59,  -830,  -830,  4430,    59,  5012,  5012,
+    5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,
+    5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,
+    5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,
+    4527,  -830,  5012,   110,  2441,  6375,  1097,  1097,  -830,  -830,
+    -830,   225,    16,    16,   486,   227,   823,  -830,  -830,   630,
+     667,   519,  -830,  4624,   503,  -830,   529,  -830,   367,   620,
+     628,   636,  -830,   508,  -830,  -830,  -830,  -830,   551,   554,
+    -830,  -830,  -830,  5012,  -830,   437,  -830,   437,   437,  4624,
+    -830,  -830,   557,   559,    59,  -830,   571,   565,  5012,   567,
+     601,  2956,  -830,  4721,   596,  3634,   613,   615,   616,   117,
+      59,   -45,  -830,  -830,   600,  -830,  -830,   623,  1076,   627,
+     609,  -830,   112,   242,  2174,  2174,   635,  -830,  -830,  -830,
+    -830,  2767,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,
+    -830,   324,  6126,   332,  6005,  1653,  -830,  5752,  -830,  5884,
+    6005,  1653,  -830,   324,   -73,  -830,   374,  -830,   773,   773,
+    2037,  2037,   640,   642,  -830,  -830,  -830,  -830,   639,  -830,
+    4818,   646,   647,   654,   655,   660,   661,   662,   656,  5341,
+    5341,  1395,  1395,   664,  -830,  4915,  -830,  -830,  -830,  -830,
+    -830,   378,  -830,  -830,   234,  -830,  -830,  -830,  -830,  -830,
+    -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,
+      66,    66,   -94,   -94,   279,   279,   279,   279,     9,     9,
+     310,   340,   322,   333,   488,  -830,  -830,  5012,   383,  -830,
+     682,  3617,  -830,  -830,  -830,  -830,  -830,  -830,  -830,  -830,
+    -830,  -830,  -830,   246,  -830,  -830,   317,  4236,  -830,  -830,
+    -830,  5012,   670,    38,  -830,  -830,  -830,   673,   674,   650,
+    5012,  5012,   675,  -830,   437,  -830,  -830,  -830,  1117,   677,
+    1360,   669,   666,  -830,  1360,    59,  -830,   -24,  -830,  2956,
+     816,   685,   663,   -35,  5012,  -830,   -27,  5012,  5012,  -830,
+      24,   -13,  -830,  -830,   799,   477,  -830,   212,  -830,  1352,
+    1352,  -830,  -830,  2956,  -830,  -830,  -830,  -830,  1360,  1360,
+    -830,  1360,  -830,  1360,    59,    59,  1360,  1360,  1360,  -830,
+     324,  -830,  5752,    12,   775,  1560,   257,  -830,  1360,  -830,
+    -830,  -830,  -830,  -830,  1360,  -830,   848,  3492,  1360,  -830,
+    1360,  -830,  -830,  5478,  -830,  -830,  -830,   684,   684,  -830,
+    1360,  1360,    59,   684,  5012,  5012,  5012,  -830,  -830,   671,
+    4236,  -830,  -830,  5012,  -830,  -830,  5012,   694,   697,   698,
+     110,  -830,  -830,  -830,   699,   700,    59,  5012,   701,   702,
+    -830,   709,   705,  -830,  3731,  -830,   713,   715,  -830,  -830,
+    -830,  -830,    67,   237,   253,  -830,  -830,  -830,   679,  6257,
+     710,  1161,  -830,    34,    40,  1117,  -830,  1360,    59,   695,
+     712,  5012,  2956,  -830,   722,  3145,  -830,  -830,   414,  -830,
+     430,   723,   317,   838,    59,  -830,   727,  -830,   731,  -830,
+    -830,  -830,  -830,  -830,  -830,  -830,  1360,  1360,  -830,  -830,
+    -830,  -830,  -830,  5752,  -830,  -830,   735,   736,   773,  -830,
+    -830,  -830,   515,  -830,  -830,  -830,  -830,   737,   738,   165,
+    -830,    62,   109,   741,   436,  -830,   744,   739,   740,  -830,
+    -830,  -830,    16,    16,  -830,  -830,   -41,   746,  -830,   -15,
+    4624,  4042,  -830,    59,  5012,  4624,  -830,  5012,  -830,   443,
+    -830,  -830,  -830,   407,  2310,  1360,  -830,    55,  -830,   407,
+    -830,   747,  -830,  -830,  5012,  -830,  1360,   749,  -830,  5012,
+    -830,  -830,  5012,  2956,  2956,  2956,   753,   752,  -830,  -830,
+    -830,  5012,  -830,  -830,  -830,  -830,    96,  -830,  -830,  -830,
+    -830,  -830,    59,  5012,  -830,  -830,  5012,  -830,   671,  5012,
+    4139,  -830,  -830,  -830,    59,   767,  -830,   766,    -4,   769,
+    5012,  -830,  -830,  -830,  -830,  -830,    11,  -830,  -830,  -830,
+      67,  5012,  -830,  1360,   776,  -830,  1360,   776,  -830,  -830,
+    -830,  1360,  -830,  -830,  2956,   449,   761,   949,  -830,  -830,
+     768,  -830,   453,   789,  -830,  -830,   262,  -830,  -830,  -830,
+    -830,   787,  5012,   -41,    59,   795,  -830,   811,   317,   794,
+     282,  5012,  -830,   793,  -830,  -830,  1360,  -830,  -830,  1360,
+    -830,  -830,  -830,   797,  5012,  2956,  -830,  -830,  -830,   317,
+     460,  -830,   810,  5012,    -4,  -830,  -830,   815,    59,  -830,
+    -830,   285,    67,  -830,  -830,  -830,  -830,   817,  -830,  -830,
+     822,  -830,   317,   466,  -830,   317,  -830,   824,  -830,  -830,
+     828,  2956,  5012,   825,  -830,  -830,    59,  -830,  -830,   530,
+    5012,  -830,  -830,   593,  -830
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+     478,   244,   269,   270,   255,   172,   265,   337,   242,   258,
+     246,   250,   257,   245,   173,   256,   266,   243,   286,   241,
+     287,   267,   268,   174,     3,     5,   251,   252,   253,   254,
+     176,   177,     0,     0,   259,   260,   261,   262,   263,   264,
+     248,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   175,   274,     0,     0,   171,
+       0,   310,     0,   247,     0,     0,     0,   485,     0,   548,
+     299,   483,     0,     0,     0,     0,     0,     0,     0,   164,
+     179,   149,   154,   150,   155,   151,   152,   153,   156,   217,
+     157,   222,   158,   249,   159,   299,   200,   277,   275,   299,
+     311,   161,   276,   299,     2,   479,   480,   484,   482,   412,
+     512,   539,   541,   540,   299,     0,     0,   521,   140,   518,
+     520,   523,   524,   519,   529,   517,     0,     0,   306,     0,
+     304,   303,     0,     0,   309,     0,     0,   299,     0,     0,
+       0,     4,   299,   299,     0,     0,     0,     0,     0,   164,
+     167,   183,   542,   543,     1,   212,   300,   301,   126,     0,
+     128,     0,   127,   124,   140,   125,   140,   299,   163,   170,
+     299,   299,   169,   299,   197,   162,   130,   299,   165,   218,
+     223,   160,   299,   201,   166,   132,   299,   299,   195,   299,
+     299,   199,   202,   198,   299,   299,   299,   299,   299,   220,
+     299,   225,   299,   193,   239,   332,   481,   488,     0,   487,
+     561,     0,   545,   555,   559,     0,     0,     0,     0,     6,
+       7,     8,     9,     0,     0,     0,     0,     0,   412,   412,
+     412,   412,     0,     0,     0,   299,     0,     0,     0,     0,
+       0,     0,    14,    10,    11,    12,    13,    15,    40,    22,
+      18,    19,    20,    21,    17,    54,    68,    72,    76,    79,
+      82,    87,    90,    92,    94,    96,    98,   100,   102,   104,
+     107,   119,     0,     0,     0,     0,   537,     0,     0,     0,
+       0,     0,   525,   532,   522,   445,   139,   141,     0,   137,
+       0,   292,     0,     0,     0,     0,   228,   226,   227,   238,
+     234,   229,   235,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   546,   549,   165,   168,   166,   544,   302,   134,
+     140,   142,   144,   204,   207,   210,   189,   373,   213,   219,
+     224,   194,   373,   191,   192,   190,   196,   205,   208,   211,
+     214,   203,   206,   209,   240,   280,   367,   368,     0,   299,
+     122,   560,     0,     0,   563,     0,   121,     0,   184,   187,
+       0,   186,   185,     0,   299,    64,   299,    55,    56,   434,
+      58,   299,     0,   299,   299,   299,    66,     0,     0,     0,
+       0,    70,    71,     0,     0,     0,     0,    57,    59,    60,
+      61,    62,    63,     0,    46,    47,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   215,     0,   369,   371,   154,   155,   156,   157,   158,
+     216,     0,   527,   534,     0,     0,     0,   526,   533,   447,
+     446,     0,   138,     0,     0,   293,   294,   296,     0,     0,
+       0,     0,   178,     0,   237,   236,   278,   271,     0,     0,
+     180,   181,   221,     0,   547,   373,   147,   373,   373,     0,
+     131,   133,     0,   284,   338,   336,     0,     0,     0,     0,
+       0,   122,   423,     0,     0,     0,     0,     0,     0,   445,
+       0,     0,   412,   441,     0,   412,   409,    14,   299,   123,
+       0,   404,     0,     0,     0,     0,     0,   413,   394,   392,
+     393,   122,   395,   396,   397,   398,   400,   399,   401,   402,
+     403,     0,     0,   164,   154,   156,   494,   556,   491,     0,
+     506,   507,   508,     0,     0,   350,     0,   348,   353,   360,
+     357,   364,     0,   346,   351,   565,   566,   564,     0,   188,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    16,     0,    39,    50,    51,    45,
+      42,     0,    52,    44,     0,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   108,    73,    74,    75,    72,
+      77,    78,    80,    81,    85,    86,    83,    84,    88,    89,
+      91,    93,    95,    97,    99,   101,   103,     0,     0,   120,
+     561,   570,   574,   370,   552,   550,   551,   372,   538,   528,
+     536,   535,   530,     0,   448,   449,     0,   381,   375,   146,
+     486,   290,     0,   292,   307,   305,   308,     0,     0,     0,
+       0,     0,     0,   135,   373,   143,   145,   374,   299,     0,
+     299,     0,   339,   340,   299,   338,   428,     0,   427,   122,
+       0,     0,     0,     0,     0,   429,     0,     0,   122,   411,
+       0,     0,   432,   438,     0,     0,   442,     0,   415,   140,
+     140,   130,   132,   122,   410,   414,   510,   495,   299,   299,
+     492,   299,   496,   299,     0,     0,   299,   299,   299,   509,
+       0,   493,   489,     0,   561,   575,   579,   356,   299,   354,
+     587,   553,   554,   363,   299,   361,   561,   575,   299,   358,
+     299,   365,   562,     0,   567,   569,   568,    65,     0,    30,
+     299,   299,     0,    67,     0,     0,   412,    36,    38,   299,
+     381,    69,    43,     0,    41,   106,     0,     0,     0,     0,
+     571,   572,   531,   455,     0,   450,     0,     0,    14,     0,
+     382,   380,     0,   378,     0,   288,   291,     0,   298,   297,
+     231,   230,     0,     0,     0,   129,   148,   318,     0,     0,
+       0,   299,   314,     0,     0,   299,   285,   299,   342,   344,
+       0,     0,   122,   408,     0,   122,   426,   425,     0,   430,
+       0,     0,     0,     0,     0,   431,     0,   412,     0,   412,
+     412,   405,   498,   501,   502,   497,   299,   299,   499,   500,
+     503,   511,   558,   490,   349,   560,     0,     0,   576,   577,
+     355,   362,   576,   359,   366,   347,   352,     0,     0,     0,
+      32,     0,     0,     0,     0,    24,     0,   380,     0,    53,
+     105,   582,   580,   581,   573,   136,   457,   451,   386,     0,
+       0,     0,   376,     0,     0,     0,   384,     0,   295,     0,
+     272,   273,   319,   325,     0,   299,   315,     0,   317,   325,
+     316,     0,   333,   341,     0,   343,   299,     0,   406,     0,
+     419,   420,   122,   122,   122,   122,     0,     0,   433,   437,
+     440,     0,   443,   444,   504,   505,   585,   586,   578,    28,
+      29,    31,     0,     0,    35,    37,     0,    23,   299,     0,
+       0,    48,   584,   583,     0,     0,   460,   456,   463,   452,
+       0,   387,   385,   377,   379,   391,     0,   383,   289,   232,
+       0,     0,   322,   299,   329,   320,   299,   329,   279,   321,
+     323,   299,   345,   335,   122,     0,     0,   416,   418,   421,
+       0,   436,     0,   561,   588,    33,     0,    27,    25,    26,
+      49,     0,     0,     0,     0,     0,   466,   462,   469,   453,
+       0,     0,   389,     0,   331,   326,   299,   330,   328,   299,
+     281,   279,   407,     0,   122,   122,   435,   412,    34,     0,
+       0,   461,     0,     0,     0,   470,   471,   468,   474,   454,
+     388,     0,     0,   324,   327,   283,   422,     0,   417,   439,
+       0,   458,     0,     0,   467,     0,   477,   473,   475,   390,
+       0,   122,     0,     0,   464,   472,     0,   233,   424,     0,
+       0,   476,   459,     0,   465
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -830,  -830,     0,   254,  -830,  -830,  -830,   -81,  -830,    14,
+    -830,  -830,    73,  -830,  -830,  -830,  -830,  -830,  -830,  -830,
+    -312,  -830,   122,  1127,   375,   379,   359,   391,   584,   585,
+     588,   589,   587,  -830,   368,  -830,  -611,   920,   545,  -203,
+    -664,    19,  -599,  -830,  -830,  -830,  -830,   734,  -830,  -108,
+    -830,  -830,  -830,  -830,    13,    41,    18,    37,   -85,    26,
+    1067,  -830,   875,   672,  -830,  -830,  -220,  -830,  -216,  -830,
+    -830,  -830,  -213,   -34,  -165,   -28,  -154,  -431,   721,  -830,
+     827,  -830,   184,   -57,   -26,  -830,    32,  -830,  -830,  -830,
+    -830,   495,  -830,  -830,   384,  -830,  -830,   913,  -830,   296,
+     241,  -830,   248,  -830,  -830,   148,   155,    88,  -641,  -830,
+    -830,  -830,   509,   382,  -830,   255,  -830,  -830,  -830,   336,
+    -830,   318,  -202,   -46,  -328,  -444,   304,   305,  -829,  -830,
+    -242,   256,  -830,   -80,   442,  -830,   258,  -830,  -830,  -830,
+    -830,  -830,  -830,  -830,  -217,  -830,  -830,  -830,  -830,   563,
+     259,  -830,  -830,    82,  -830,  -830,    52,  -830,  -830,    35,
+    -830,  -830,  -830,    27,  -830,  -830,   962,  -830,  -830,  -830,
+    -830,   362,  -532,  -830,  -830,  -830,  -830,  -830,  -830,  -830,
+      -3,  -830,  -109,  -113,  -830,  -104,  -830,  -258,   104,   -36,
+    -830,   -25,  -419,  -462,   -79,  -830,   390,  -830,  -830,   452,
+    -535,   456,  -519
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    68,   242,   117,   243,   244,   245,   246,   247,   248,
+     249,   854,   855,   250,   251,   252,   849,   253,   254,   255,
+     769,   581,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   269,   270,   271,   509,   638,
+     510,   511,    72,    73,   327,   332,   475,   286,   287,   321,
+      74,   477,   478,   654,   512,   513,   514,   515,   148,   168,
+      79,    80,   150,   359,   360,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,   301,   302,   303,
+      93,   345,    94,    95,    96,    97,  1000,    98,   482,   659,
+     660,    99,   776,   777,   457,   458,   100,   273,   156,   157,
+     790,   791,   792,   793,   794,   952,   955,   996,   953,   102,
+     348,   486,   103,   661,   662,   663,   895,   552,   546,   547,
+     553,   554,   516,   856,   480,   770,   771,   772,   773,   774,
+     517,   518,   519,   520,   208,   521,   522,   523,   902,   524,
+     671,   525,   526,   681,  1036,   527,   528,   529,   530,   451,
+     764,   765,   867,   936,   937,   939,   986,   987,   989,  1016,
+    1017,  1019,  1037,  1038,   104,   105,   106,   107,   108,   209,
+     832,   537,   538,   539,   540,   541,   542,   543,   544,   109,
+     954,   119,   120,   121,   122,   123,   124,   279,   125,   111,
+     112,   113,   623,   839,   444,   352,   213,   353,   214,   625,
+     721,   626,   722
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      69,   370,   277,   349,   481,   700,   755,   282,   357,   639,
+     288,   278,   283,    75,   811,   627,   369,   441,    77,    71,
+     173,   182,   445,   683,   187,   190,   222,   801,   145,   207,
+     118,   281,   649,    69,   212,   657,   940,    78,   284,   146,
+     128,    76,   944,   170,   179,   290,   296,   455,   114,   171,
+     180,   174,   183,   435,   417,   418,   427,   436,   322,   788,
+     437,   296,   991,   222,    69,    69,    69,   212,   274,   393,
+     394,   395,   164,   166,    24,    69,    69,    69,    69,   145,
+     429,   579,   159,   297,   298,   583,   719,   725,   729,   731,
+     146,   304,   296,   161,   413,   414,   309,   310,   297,   298,
+      24,   944,   147,   160,   110,    69,   710,   186,   438,   191,
+     126,   194,   195,   196,   162,    69,    69,    24,    75,   439,
+    -557,    24,    25,    77,    71,   129,   199,   711,   201,   297,
+     298,   534,   428,   294,   127,   436,   449,    57,   535,   684,
+     130,   934,    78,   483,   432,   860,    76,   653,    69,   655,
+     656,   430,   432,   147,   450,   386,   802,   558,   320,    69,
+     561,    69,   277,    57,   432,   807,   814,   277,   941,   152,
+     153,   278,   447,   809,    24,    25,   278,   448,   984,   836,
+      57,   176,   185,  -557,    57,   131,   438,   815,   633,   385,
+     432,   836,   788,   210,   992,   837,   788,   439,   211,   299,
+     300,   812,   761,   419,   420,   346,   396,   837,   813,   110,
+     397,   398,   476,   887,   464,   300,   329,   330,   346,   889,
+     152,   399,   400,   401,   402,   403,   404,   405,   406,   407,
+     408,   132,    64,   474,   888,   951,   351,    57,   966,   145,
+     890,   432,    65,   956,   145,   133,   956,   924,   134,   670,
+     146,    66,   317,   410,    70,   146,   432,   135,   411,   412,
+     467,   172,   181,   319,   136,   172,   189,   172,   193,   172,
+     172,   172,   198,   973,   200,    69,   202,   137,   211,   695,
+      69,    69,   664,   682,   386,   667,   386,   620,   432,   115,
+     138,   456,   211,   139,   925,   386,   101,   621,   369,   116,
+     140,   700,   210,   313,    24,    25,   622,   211,    66,   154,
+     434,   432,   163,   997,   433,   468,   997,   534,   562,    24,
+     563,   436,   415,   416,   535,   564,   786,   566,   567,   568,
+     876,   167,   177,   277,   819,     1,   820,   365,   367,   368,
+    1027,   864,   278,   921,   142,   346,   922,   923,     8,   376,
+     507,   879,   545,    10,   624,   624,    13,   421,   422,    70,
+     141,   151,    17,   629,   630,    19,   548,    57,   409,   276,
+     143,   550,   438,   175,   184,   432,   918,   182,   190,   469,
+     918,   144,    57,   439,   222,   317,    24,    25,   532,   158,
+     551,   291,   531,   577,   549,   361,   312,   577,   571,   572,
+     179,   101,   210,   628,   210,   632,   180,   211,   183,   211,
+     145,    50,   151,   432,   289,    40,   432,   754,   363,   115,
+     880,   146,   685,   210,   762,   687,   942,   803,   211,   116,
+     850,   947,   432,  -515,    64,  -516,   881,    50,    66,   717,
+     723,   432,   165,   316,    65,  1008,    69,   431,   432,    57,
+     350,   821,   318,    66,   868,   459,   432,   173,   182,   347,
+     289,   432,   289,   664,   432,  1020,   460,   432,  1039,    24,
+      25,    63,   347,   462,   432,   182,   371,   190,   470,   432,
+     170,   179,   703,   707,   346,   372,   171,   180,   174,   183,
+     373,   507,   534,   173,   182,   184,   436,   184,   179,   535,
+     346,   115,   826,   827,   180,   374,   183,   362,   383,   689,
+     690,   116,    69,    69,    69,    69,   170,   179,   424,   993,
+      66,   507,   171,   180,   174,   183,   423,    70,   696,   276,
+     425,    69,    57,   296,   276,   536,   760,   426,   574,   432,
+     709,   757,   624,    69,   361,   642,   643,   438,    69,    69,
+      69,    69,   712,   713,   440,   763,   752,   753,   439,   442,
+     898,   945,   432,   756,   443,   702,   706,   708,   453,   435,
+     297,   298,   647,   436,   532,   648,   437,    24,   531,   817,
+     818,   454,   322,   289,   115,   747,   748,   951,   744,   745,
+     461,  1040,   903,   432,   116,   463,   664,   908,   897,   347,
+     466,   277,   471,    66,   508,    70,   282,    70,   904,   432,
+     975,   472,   369,   534,   927,   928,   289,   436,   691,   692,
+     535,   949,   950,   473,   438,   184,   184,  1003,   432,   484,
+     838,  1007,   432,    70,    70,   439,   479,   768,  1031,   432,
+      57,   556,   842,   456,  1044,   432,   101,   578,   569,   101,
+     575,   578,   718,   724,   728,   730,   362,   570,   147,   272,
+     576,   967,   968,   969,   631,   346,   386,   634,   438,   507,
+     377,   378,   379,   380,   292,   101,   101,   293,   145,   439,
+     295,   624,   853,   305,   306,   307,   635,   308,   177,   146,
+     145,   962,   726,   507,   847,   848,   636,   211,   172,   181,
+     276,   146,   727,   640,   346,   346,   641,   831,  1052,   432,
+      69,   716,   644,   545,    69,    69,    69,   697,   698,   699,
+     645,   536,  1002,   172,   172,   172,    69,    69,   646,   447,
+     184,   763,   981,   650,   172,   181,   651,   910,   347,   912,
+     913,   658,   577,  -282,  -557,   508,   548,   672,   994,   532,
+     768,   550,   147,   531,   347,   665,    42,    43,    44,    45,
+      46,    47,    48,  1028,   147,   666,   577,   668,   167,   177,
+     551,  1054,   432,   674,   549,   508,   604,   605,   606,   607,
+     384,   669,  1012,   932,   933,   935,   177,   101,   600,   601,
+     677,    70,   678,   701,   602,   603,   615,   616,   346,  1048,
+     686,   679,   507,  -367,   167,   177,   432,  -557,    61,   688,
+     175,   184,   608,   609,   346,   693,   369,   101,   732,   152,
+     153,   733,   734,    70,    70,   737,   884,   182,   184,   736,
+     883,   152,   738,   739,   743,    24,    25,    24,    69,   740,
+     741,   742,    69,   749,   369,   798,   175,   184,   778,   782,
+     179,   780,   781,   785,   797,   804,   180,   985,   183,   620,
+     351,   795,   805,   806,   211,   101,   101,   816,   750,   621,
+     532,   768,   861,   577,   531,   862,   863,   865,   622,   882,
+     866,   -50,   870,    69,    69,    24,    25,    69,   871,    69,
+     872,   578,   877,   878,   894,   885,   536,   896,    57,   899,
+      57,   905,   935,   507,   507,   507,   907,  1015,   911,   384,
+      24,   384,   909,   916,   917,   919,   920,   151,   930,   347,
+     384,   926,   577,   508,   929,   931,   938,  1029,  1030,   964,
+     768,   970,   961,   985,   346,    24,    25,   971,   720,   720,
+     720,   720,   317,   584,   982,   983,   317,   508,    57,   988,
+     714,  1043,   714,   835,  1015,   211,   951,   211,   347,   347,
+     715,  1004,   715,  1005,   507,   101,    70,   835,  1006,   716,
+    1009,   716,  1013,    57,  1018,   618,    42,    43,    44,    45,
+      46,    47,    48,   155,   346,   289,   289,    70,   957,   101,
+    1014,   957,  1022,  1032,  1035,  1041,   578,  1026,    57,  1042,
+     275,   978,  1050,  1046,   578,   507,  1047,   610,   203,   611,
+     116,   151,   204,   612,   614,   613,   205,   536,   346,    66,
+     578,   452,   315,   151,   465,   726,   835,   779,    61,   101,
+     211,   344,   559,  1025,   704,   727,   891,   960,   673,   886,
+     676,   507,   959,    70,   716,   999,   346,   800,   705,   834,
+     446,   846,   347,   893,   857,   858,   508,  -182,  -182,    70,
+     116,   900,   680,   901,   311,  1011,  1034,   206,   347,    66,
+    1045,   906,   758,  1051,   833,  -334,   759,     0,     0,     0,
+     323,     0,     0,   324,   325,     0,   326,    70,     0,     0,
+     328,     0,     0,     0,     0,   331,     0,     0,   101,   333,
+     334,   101,   335,   336,   720,   720,     5,   337,   338,   339,
+     340,   341,     0,   342,     0,   343,   720,   720,     0,     0,
+    -182,     0,    14,     0,     0,   578,     0,   578,     0,     0,
+       0,   356,   149,     0,    23,     0,     0,     0,   177,     0,
+       0,     0,     0,     0,   169,   178,     0,     0,   169,   188,
+     169,   192,   169,   169,   169,   197,     0,   508,   508,   508,
+       0,    42,    43,    44,    45,    46,    47,    48,     0,     0,
+      30,    31,  -182,  -182,  -182,  -182,   578,  -182,     0,     0,
+     184,     0,  -182,   149,   578,     0,     0,     0,   347,     0,
+    -182,  -182,    49,     0,     0,   783,   784,     0,     0,   101,
+     101,   101,    42,    43,    44,    45,    46,    47,    48,     0,
+       0,     0,     0,    61,   314,     0,    55,     0,   508,   808,
+       0,     0,   810,     0,  -183,  -183,     0,     0,   720,    58,
+      59,     0,   720,     0,     0,     0,     0,     0,   347,     0,
+       0,     0,     0,     0,     0,     0,    42,    43,    44,    45,
+      46,    47,    48,     0,    61,    62,  -368,     0,     0,   508,
+     101,     0,   485,     0,     0,     0,   178,     0,   178,     0,
+       0,     0,   347,     0,     0,     0,     0,     0,   358,     0,
+     356,     0,     0,   356,     0,     0,     0,  -183,     0,   851,
+     852,   384,   565,     0,     0,   508,     0,     0,    61,    62,
+     347,   101,  -312,   573,     0,     0,   974,     0,     0,     0,
+       0,     0,   869,     0,     0,     0,   582,   787,   215,   585,
+     586,   587,   588,   589,   590,   591,   592,   593,   594,   595,
+     216,   217,     0,     0,     0,     0,     0,   101,   218,  -183,
+    -183,  -183,  -183,     0,  -183,     0,  -313,     0,     0,  -183,
+       0,    24,   619,   219,   220,   221,   222,  -183,  -183,   381,
+     382,   787,     0,   387,   388,   389,   390,   391,   392,     0,
+       0,     0,     0,   356,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   223,   224,   225,   226,   227,
+       0,     0,     0,   652,     0,     0,   178,   178,     0,   356,
+     228,   229,   230,   231,     0,     0,     0,     0,   356,     0,
+       0,     0,     0,     0,    57,     0,     0,     0,   533,   946,
+       0,   155,     0,     0,   234,     0,     0,   358,   285,    42,
+      43,    44,    45,    46,    47,    48,   285,    42,    43,    44,
+      45,    46,    47,    48,   965,    42,    43,    44,    45,    46,
+      47,    48,     0,     0,     0,     0,   972,    24,     0,   219,
+     220,   221,   222,     0,     0,     0,   364,     0,   976,     0,
+       0,     0,     0,     0,     0,   236,   237,   238,   239,   240,
+     241,    61,   388,     0,     0,   990,     0,     0,     0,    61,
+       0,   223,   224,   225,   226,     0,     0,    61,     0,     0,
+       0,   178,   188,   192,   197,     0,   228,   229,   230,   231,
+     285,    42,    43,    44,    45,    46,    47,    48,     0,     0,
+      57,     0,     0,     0,     0,     0,     0,  1010,  -513,     0,
+     234,     0,     0,     0,     0,     0,  1021,   596,   597,   598,
+     599,   599,   599,   599,   599,   599,   599,   599,   599,   599,
+     599,   599,   599,   599,   599,   599,   599,   356,  1033,     0,
+       0,   775,     0,    61,     0,     0,     0,     0,     0,     5,
+       0,   789,   746,   796,     0,     0,     0,   799,     0,     0,
+       0,   169,   178,     0,     0,    14,     0,  1049,     0,     0,
+       0,     0,     0,     0,     0,  1053,     0,    23,     0,   178,
+       0,   188,   197,     0,   533,     0,   169,   169,   169,     0,
+    -514,   822,   823,     0,   824,     0,   825,   169,   178,   828,
+     829,   830,    24,    25,     0,     0,     0,     0,     0,     0,
+       0,   840,     0,    30,    31,     0,     0,   841,     0,     0,
+       0,   843,     0,   844,     0,    42,    43,    44,    45,    46,
+      47,    48,     5,     0,     0,    49,     1,     0,     0,     0,
+       0,     0,     5,     0,     0,     0,     0,     0,    14,     8,
+     356,     0,     0,   859,    10,     0,     0,    13,    14,    55,
+      23,     0,     0,    17,     0,    57,    19,   388,   149,     0,
+      23,     0,    58,    59,   356,     0,     0,    61,     0,     0,
+       0,     0,   751,     0,   789,    24,    25,     0,   789,     0,
+     892,     0,     0,     0,     0,     0,    30,    31,     0,     0,
+       0,   356,     0,     0,     0,     0,    30,    31,    42,    43,
+      44,    45,    46,    47,    48,     0,    40,   714,    49,   914,
+     915,     0,   211,     0,   599,     0,     0,   715,    49,     0,
+       0,     0,     0,     0,     0,     0,   716,     0,    50,     0,
+       0,     0,    55,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    55,     0,     0,    58,    59,     0,     0,   533,
+      61,     0,   149,     0,     0,    58,    59,     0,     0,     0,
+     356,   356,    63,     0,   149,   356,     0,   948,   958,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   963,
+       0,     0,     0,     0,   356,     0,     0,     0,     0,     0,
+     280,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     116,     0,     0,     0,     0,     0,     0,     0,     0,    66,
+       0,     0,     0,     0,     0,     0,   977,     0,     0,   979,
+     356,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   995,     0,     0,   998,
+       0,   356,     0,     0,  1001,     0,     0,     0,     0,     0,
+       0,     0,     0,   599,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     533,     1,     2,     3,     0,     0,     4,     5,     0,  1023,
+       0,     6,  1024,     7,     8,     9,     0,     0,     0,    10,
+      11,    12,    13,    14,     0,    15,    16,     0,    17,    18,
+       0,    19,    20,    21,    22,    23,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   178,     0,     0,     0,     0,     0,     0,     0,     0,
+      24,    25,     0,     0,     0,     0,     0,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+       0,     0,     0,    49,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    50,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    51,    52,    53,    54,    55,    56,     0,
+       0,     0,     0,    57,     0,     0,     0,     0,     0,     0,
+      58,    59,    60,     0,     0,    61,    62,    63,     0,     0,
+       1,     2,     3,     0,     0,     4,     5,     0,     0,     0,
+       6,     0,     7,     8,     9,     0,     0,     0,    10,    11,
+      12,    13,    14,     0,    15,    16,     0,    17,    18,     0,
+      19,    20,    21,    22,    23,    64,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    65,     0,     0,     0,     0,
+       0,     0,     0,     0,    66,     0,     0,     0,    67,    24,
+      25,     0,     0,     0,     0,     0,    26,    27,    28,    29,
+      30,    31,    32,     0,    34,    35,    36,    37,    38,    39,
+      40,     0,    42,    43,    44,    45,    46,    47,    48,     0,
+       0,     0,    49,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    50,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    51,    52,    53,    54,    55,    56,     0,     0,
+       0,     0,    57,     0,     0,     0,     0,     0,     0,    58,
+      59,    60,     0,     0,    61,     0,    63,     1,     2,     3,
+       0,     0,     4,     5,     0,     0,     0,     6,     0,     7,
+       8,     9,     0,     0,     0,    10,    11,    12,    13,    14,
+       0,    15,    16,     0,    17,    18,     0,    19,    20,    21,
+      22,    23,     0,     0,   726,     0,     0,     0,     0,   211,
+       0,     0,     0,     0,   727,     0,     0,     0,     0,     0,
+       0,     0,     0,   716,     0,     0,    24,    25,     0,     0,
+       0,     0,     0,    26,    27,    28,    29,    30,    31,    32,
+       0,    34,    35,    36,    37,    38,    39,    40,     0,    42,
+      43,    44,    45,    46,    47,    48,     0,     0,     0,    49,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    50,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    51,
+      52,    53,    54,    55,    56,     0,     0,     0,     0,    57,
+       0,     0,     0,     0,     0,     0,    58,    59,    60,     0,
+       0,    61,     0,    63,     2,     3,     0,     0,     4,     5,
+       0,     0,     0,     6,     0,     7,     0,     9,     0,     0,
+       0,     0,    11,    12,     0,    14,     0,    15,    16,     0,
+       0,    18,     0,     0,    20,    21,    22,    23,     0,     0,
+       0,    64,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    65,     0,     0,     0,     0,     0,     0,     0,     0,
+      66,     0,    24,    25,     0,     0,     0,     0,     0,    26,
+      27,    28,    29,    30,    31,    32,     0,    34,    35,    36,
+      37,    38,    39,     0,     0,    42,    43,    44,    45,    46,
+      47,    48,     0,     0,     0,    49,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    51,    52,    53,    54,    55,
+      56,     0,     0,     0,     0,    57,     0,     0,     0,     0,
+       0,     0,    58,    59,    60,     2,     3,    61,     0,     4,
+       5,     0,     0,     0,     6,     0,     7,     0,     9,     0,
+       0,     0,     0,    11,    12,     0,    14,     0,    15,    16,
+       0,     0,    18,     0,     0,    20,    21,    22,    23,     0,
+       0,     0,     0,     0,     0,     0,     0,    64,     0,     0,
+     951,     0,     0,     0,     0,     0,     0,    65,     0,     0,
+       0,     0,     0,     0,    25,     0,    66,     0,     0,     0,
+      26,    27,    28,    29,    30,    31,    32,     0,    34,    35,
+      36,    37,    38,    39,     0,     0,    42,    43,    44,    45,
+      46,    47,    48,     0,     0,     0,    49,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    51,    52,    53,    54,
+      55,    56,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    58,    59,    60,     0,     0,    61,     0,
+       0,     1,     2,     3,   487,   488,     4,     5,   489,   490,
+     491,     6,     0,     7,     8,     9,   492,   493,   494,    10,
+      11,    12,    13,    14,   495,    15,    16,   215,    17,    18,
+     496,    19,    20,    21,    22,    23,     0,   497,   620,   216,
+     217,     0,     0,   211,     0,     0,     0,   218,   621,     0,
+       0,     0,     0,     0,     0,     0,     0,   622,     0,     0,
+      24,    25,   219,   220,   221,   222,   498,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,   499,    42,    43,    44,    45,    46,    47,    48,
+       0,   500,   501,    49,   223,   224,   225,   226,   227,   502,
+       0,     0,   503,    50,     0,     0,     0,     0,     0,   228,
+     229,   230,   231,    51,    52,    53,    54,    55,    56,   504,
+       0,   505,     0,    57,     0,     0,     0,     0,   232,   233,
+      58,    59,    60,   234,     0,    61,    62,    63,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   235,     0,     0,     0,     0,
+       0,     0,  -412,   506,   236,   237,   238,   239,   240,   241,
+       1,     2,     3,   487,   488,     4,     5,   489,   490,   491,
+       6,     0,     7,     8,     9,   492,   493,   494,    10,    11,
+      12,    13,    14,   495,    15,    16,   215,    17,    18,   496,
+      19,    20,    21,    22,    23,     0,   497,     0,   216,   217,
+       0,     0,     0,     0,     0,     0,   218,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    24,
+      25,   219,   220,   221,   222,     0,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,   499,    42,    43,    44,    45,    46,    47,    48,     0,
+     500,   501,    49,   223,   224,   225,   226,   227,   502,     0,
+       0,   503,    50,     0,     0,     0,     0,     0,   228,   229,
+     230,   231,    51,    52,    53,    54,    55,    56,   504,     0,
+     505,     0,    57,     0,     0,     0,     0,   232,   233,    58,
+      59,    60,   234,     0,    61,    62,    63,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   235,     0,     0,     0,     0,     0,
+       0,  -412,   694,   236,   237,   238,   239,   240,   241,     1,
+       2,     3,   487,   488,     4,     5,   489,   490,   491,     6,
+       0,     7,     8,     9,   492,   493,   494,    10,    11,    12,
+      13,    14,   495,    15,    16,   215,    17,    18,   496,    19,
+      20,    21,    22,    23,     0,   497,     0,   216,   217,     0,
+       0,     0,     0,     0,     0,   218,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    24,    25,
+     219,   220,   221,   222,     0,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+     499,    42,    43,    44,    45,    46,    47,    48,     0,   500,
+     501,    49,   223,   224,   225,   226,   227,   502,     0,     0,
+     503,    50,     0,     0,     0,     0,     0,   228,   229,   230,
+     231,    51,    52,    53,    54,    55,    56,   504,     0,   505,
+       0,    57,     0,     0,     0,     0,   232,   233,    58,    59,
+      60,   234,     0,    61,    62,    63,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,     0,     0,     0,     0,     0,     0,
+    -412,     0,   236,   237,   238,   239,   240,   241,     1,     2,
+       3,     0,     0,     4,     5,     0,     0,     0,     6,     0,
+       7,     8,     9,     0,     0,     0,    10,    11,    12,    13,
+      14,     0,    15,    16,   215,    17,    18,     0,    19,    20,
+      21,    22,    23,     0,     0,     0,   216,   217,     0,     0,
+       0,     0,     0,     0,   218,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    24,    25,   219,
+     220,   221,   222,     0,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,     0,
+      42,    43,    44,    45,    46,    47,    48,     0,     0,     0,
+      49,   223,   224,   225,   226,   227,     0,     0,     0,     0,
+      50,     0,     0,     0,     0,     0,   228,   229,   230,   231,
+      51,    52,    53,    54,    55,    56,     0,     0,     0,     0,
+      57,     0,     0,     0,     0,   232,   233,    58,    59,    60,
+     234,     1,    61,    62,    63,     0,     0,     5,     0,     0,
+       0,     0,     0,     0,     8,     0,     0,     0,     0,    10,
+       0,     0,    13,    14,     0,     0,     0,   215,    17,     0,
+       0,    19,     0,     0,     0,    23,     0,     0,     0,   216,
+     217,     0,   235,     0,     0,     0,     0,   218,     0,     0,
+       0,   236,   237,   238,   239,   240,   241,     0,     0,     0,
+      24,     0,   219,   220,   221,   222,     0,     0,     0,     0,
+       0,    30,    31,     0,     0,     0,     0,     0,     0,     0,
+       0,    40,     0,    42,    43,    44,    45,    46,    47,    48,
+       0,     0,     0,    49,   223,   224,   225,   226,   227,     0,
+       0,     0,     0,    50,     0,     0,     0,     0,     0,   228,
+     229,   230,   231,     0,     0,     0,     0,    55,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,     0,   232,   233,
+      58,    59,     1,   234,     0,    61,     0,    63,     5,     0,
+       0,     0,     0,     0,     0,     8,     0,     0,     0,     0,
+      10,     0,     0,    13,    14,     0,     0,     0,   215,    17,
+       0,     0,    19,     0,     0,     0,    23,     0,     0,     0,
+     216,   217,     0,     0,     0,   235,     0,     0,   218,     0,
+       0,   354,     0,     0,   236,   355,   238,   239,   240,   241,
+       0,    24,     0,   219,   220,   221,   222,     0,     0,     0,
+       0,     0,    30,    31,     0,     0,     0,     0,     0,     0,
+       0,     0,    40,     0,    42,    43,    44,    45,    46,    47,
+      48,     5,     0,     0,    49,   223,   224,   225,   226,   227,
+       0,     0,     0,     0,    50,     0,     0,    14,     0,     0,
+     228,   229,   230,   231,     0,     0,     0,     0,    55,    23,
+       0,     0,     0,     0,    57,     0,     0,     0,     0,   232,
+     233,    58,    59,     0,   234,     0,    61,     0,    63,     0,
+       0,     0,     0,     0,    24,     0,     0,     5,     0,     0,
+       0,     0,     0,     0,     0,    30,    31,     0,     0,     0,
+       0,     0,     0,    14,     0,     0,     0,    42,    43,    44,
+      45,    46,    47,    48,     0,    23,   235,    49,     0,     0,
+       0,     0,   557,     0,     0,   236,   237,   238,   239,   240,
+     241,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      24,    55,     0,     0,     0,     0,     0,    57,     0,     0,
+       0,    30,    31,     0,    58,    59,     5,     0,     0,    61,
+       0,     0,     0,    42,    43,    44,    45,    46,    47,    48,
+       0,     0,    14,    49,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    23,     0,     0,     0,     0,     0,
+       0,     0,     0,   215,     0,     0,     0,    55,     0,   726,
+       0,     0,     0,    57,   211,   216,   217,     0,     0,   727,
+      58,    59,     0,   218,     0,    61,     0,     0,   716,     0,
+      30,    31,     0,     0,     0,     0,    24,     0,   219,   220,
+     221,   222,    42,    43,    44,    45,    46,    47,    48,     0,
+       0,     0,    49,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    64,     0,     0,     0,     0,
+     223,   224,   225,   226,   227,    65,    55,     0,     0,     0,
+       0,     0,     0,     0,    66,   228,   229,   230,   231,    58,
+      59,     0,     0,     0,    61,     0,     0,     0,     0,    57,
+     215,     0,     0,     0,   232,   233,     0,     0,     0,   234,
+       0,     0,   216,   217,     0,     0,     0,     0,     0,     0,
+     218,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    24,   620,   219,   220,   221,   222,   211,
+       0,     0,     0,     0,   621,     0,     0,     0,     0,     0,
+       0,   235,     0,   622,     0,     0,     0,     0,     0,     0,
+     236,   237,   238,   239,   240,   241,     0,   223,   224,   225,
+     226,   227,     0,     0,   675,     0,     0,     0,     0,     0,
+       0,     0,   228,   229,   230,   231,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+       0,   232,   233,     0,     0,     0,   234,   215,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     5,   216,
+     217,     0,     0,     0,     0,     0,     0,   218,     0,     0,
+       0,     0,     0,     0,    14,     0,     0,     0,     0,     0,
+      24,     0,   219,   220,   221,   222,    23,     0,   235,     0,
+       0,     0,   873,   874,     0,   637,     0,   236,   237,   238,
+     239,   240,   241,    42,    43,    44,    45,    46,    47,    48,
+     875,     0,     0,     0,   223,   224,   225,   226,   227,     0,
+       0,     0,    30,    31,     0,     0,     0,     0,     0,   228,
+     229,   230,   231,     0,    42,    43,    44,    45,    46,    47,
+      48,     0,     0,    57,    49,     0,     0,     0,   232,   233,
+       0,     0,     0,   234,   215,    61,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   216,   217,    55,     0,
+       0,     0,     0,     0,   218,     0,     0,     0,     0,     0,
+       0,    58,    59,     0,     0,     0,    61,    24,     0,   219,
+     220,   221,   222,     0,     0,   235,     0,     0,     0,     0,
+       0,     0,  -412,     0,   236,   237,   238,   239,   240,   241,
+      42,    43,    44,    45,    46,    47,    48,     0,     0,     0,
+       0,   223,   224,   225,   226,   227,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   228,   229,   230,   231,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      57,   215,     0,     0,     0,   232,   233,     0,     0,     0,
+     234,     0,    61,   216,   217,     0,     0,     0,     0,     0,
+       0,   218,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    24,    25,   219,   220,   221,   222,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   235,     0,     0,     0,     0,     0,     0,     0,
+       0,   236,   237,   238,   239,   240,   241,     0,   223,   224,
+     225,   226,   227,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   228,   229,   230,   231,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    57,   215,     0,
+       0,     0,   232,   233,     0,     0,     0,   234,     0,     0,
+     216,   217,     0,     0,     0,     0,     0,     0,   218,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    24,    25,   219,   220,   221,   222,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   235,
+       0,     0,     0,   766,   767,     0,   637,   943,   236,   237,
+     238,   239,   240,   241,     0,   223,   224,   225,   226,   227,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     228,   229,   230,   231,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    57,   215,     0,     0,     0,   232,
+     233,     0,     0,     0,   234,     0,     0,   216,   217,     0,
+       0,     0,     0,     0,     0,   218,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    24,    25,
+     219,   220,   221,   222,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   235,     0,     0,     0,
+     766,   767,     0,   637,   980,   236,   237,   238,   239,   240,
+     241,     0,   223,   224,   225,   226,   227,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   228,   229,   230,
+     231,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    57,   215,     0,     0,     0,   232,   233,     0,     0,
+       0,   234,     0,     0,   216,   217,     0,     0,     0,     0,
+       0,     0,   218,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    24,     0,   219,   220,   221,
+     222,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,     0,     0,     0,   766,   767,     0,
+     637,     0,   236,   237,   238,   239,   240,   241,     0,   223,
+     224,   225,   226,   227,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   228,   229,   230,   231,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    57,   215,
+       0,     0,     0,   232,   233,     0,     0,     0,   234,     0,
+       0,   216,   217,     0,     0,     0,     0,     0,     0,   218,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    24,     0,   219,   220,   221,   222,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     235,     0,     0,     0,     0,     0,   555,     0,     0,   236,
+     237,   238,   239,   240,   241,     0,   223,   224,   225,   226,
+     227,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   228,   229,   230,   231,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    57,   215,     0,     0,     0,
+     232,   233,     0,     0,     0,   234,     0,     0,   216,   217,
+       0,     0,     0,     0,     0,     0,   218,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    24,
+       0,   219,   220,   221,   222,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   235,   580,     0,
+       0,     0,     0,     0,     0,     0,   236,   237,   238,   239,
+     240,   241,     0,   223,   224,   225,   226,   227,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   228,   229,
+     230,   231,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    57,   215,     0,     0,     0,   232,   233,     0,
+       0,     0,   234,     0,     0,   216,   217,     0,     0,     0,
+       0,     0,     0,   218,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    24,     0,   219,   220,
+     221,   222,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   235,     0,     0,   617,     0,     0,
+       0,     0,     0,   236,   237,   238,   239,   240,   241,     0,
+     223,   224,   225,   226,   227,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   228,   229,   230,   231,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    57,
+     215,     0,     0,     0,   232,   233,     0,     0,     0,   234,
+       0,     0,   216,   217,     0,     0,     0,     0,     0,     0,
+     218,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    24,    25,   219,   220,   221,   222,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   235,     0,     0,     0,     0,     0,     0,   637,     0,
+     236,   237,   238,   239,   240,   241,     0,   223,   224,   225,
+     226,   227,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   228,   229,   230,   231,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    57,   215,     0,     0,
+       0,   232,   233,     0,     0,     0,   234,     0,     0,   216,
+     217,     0,     0,     0,     0,     0,     0,   218,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      24,     0,   219,   220,   221,   222,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   235,     0,
+       0,     0,     0,     0,     0,     0,     0,   236,   237,   238,
+     239,   240,   241,     0,   223,   224,   225,   226,   227,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   228,
+     229,   230,   231,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    57,   215,     0,     0,     0,   232,   233,
+       0,     0,     0,   234,     0,     0,   216,   217,     0,     0,
+       0,     0,     0,     0,   218,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    24,     0,   219,
+     220,   221,   222,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   235,     0,     0,     0,     0,
+       0,   735,     0,     0,   236,   237,   238,   239,   240,   241,
+       0,   223,   224,   225,   226,   227,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   228,   229,   230,   231,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      57,   215,     0,     0,     0,   232,   233,     0,     0,     0,
+     234,     0,     0,   216,   217,     0,     0,     0,     0,     0,
+       0,   218,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    24,     0,   219,   220,   221,   222,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   235,     0,     0,     0,     0,     0,     0,   750,
+       0,   236,   237,   238,   239,   240,   241,     0,   223,   224,
+     225,   226,   227,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   228,   229,   230,   231,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    57,   215,     0,
+       0,     0,   232,   233,     0,     0,     0,   234,     0,     0,
+     216,   217,     0,     0,     0,     0,     0,     0,   218,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    24,     0,   219,   220,   221,   222,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   235,
+       0,     0,     0,     0,     0,     0,     0,     0,   236,   237,
+     238,   239,   240,   241,     0,   223,   224,   225,   226,   227,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     228,   229,   230,   231,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    57,   215,     0,     0,     0,   232,
+     233,   215,     0,     0,   234,     0,     0,   216,   217,     0,
+       0,     0,     0,   216,   217,   218,     0,     0,     0,     0,
+       0,   218,     0,     0,     0,     0,     0,     0,    24,     0,
+     219,   220,   221,   222,    24,     0,   219,   220,   221,   222,
+       0,     0,     0,     0,     0,     0,   235,     0,     0,     0,
+       0,     0,     0,     0,     0,   236,   560,   238,   239,   240,
+     241,     0,   223,   224,   225,   226,   227,     0,   223,   224,
+     225,   226,   227,     0,     0,     0,     0,   228,   229,   230,
+     231,     0,     0,   228,   229,   230,   231,     0,     0,     0,
+       0,    57,     0,     0,     0,     0,     0,    57,     0,     0,
+       0,   234,     0,     0,     1,     2,     3,   234,     0,     4,
+       5,     0,     0,     0,     6,     0,     7,     8,     9,     0,
+       0,     0,    10,    11,    12,    13,    14,     0,    15,    16,
+       0,    17,    18,     0,    19,    20,    21,    22,    23,     0,
+       0,     0,     0,   366,     0,     0,     0,     0,     0,   375,
+       0,     0,   236,   237,   238,   239,   240,   241,   236,   237,
+     238,   239,   240,   241,    25,     0,     0,     0,     0,     0,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,     0,    42,    43,    44,    45,
+      46,    47,    48,     0,     0,     0,    49,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    50,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    51,    52,    53,    54,
+      55,    56,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    58,    59,    60,     0,     0,    61,    62,
+      63,     1,     2,     3,     0,     0,     4,     5,     0,     0,
+       0,     6,     0,     7,     8,     9,     0,     0,     0,    10,
+      11,    12,    13,    14,     0,    15,    16,     0,    17,    18,
+       0,    19,    20,    21,    22,    23,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   845,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    25,     0,     0,     0,     0,     0,    26,    27,    28,
+      29,    30,    31,    32,     0,    34,    35,    36,    37,    38,
+      39,    40,     0,    42,    43,    44,    45,    46,    47,    48,
+       0,     0,     0,    49,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    50,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    51,    52,    53,    54,    55,    56,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      58,    59,    60,     0,     0,    61,     0,    63,     1,     2,
+       3,     0,     0,     4,     5,     0,     0,     0,     6,     0,
+       7,     8,     9,     0,     0,     0,    10,    11,    12,    13,
+      14,     0,    15,    16,     0,    17,    18,     0,    19,    20,
+      21,    22,    23,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    25,     0,
+       0,     0,     0,     0,    26,    27,    28,    29,    30,    31,
+      32,     0,    34,    35,    36,    37,    38,    39,    40,     0,
+      42,    43,    44,    45,    46,    47,    48,     0,     0,     0,
+      49,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      50,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      51,    52,    53,    54,    55,    56,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    58,    59,    60,
+       0,     0,    61,     0,    63,     1,     2,     3,     0,     0,
+       4,     5,     0,     0,     0,     6,     0,     7,     8,     9,
+       0,     0,     0,    10,    11,    12,    13,    14,     0,    15,
+      16,     0,    17,    18,     0,    19,    20,    21,    22,    23,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    25,     0,     0,     0,     0,
+       0,    26,    27,    28,    29,    30,    31,    32,     0,    34,
+      35,    36,    37,    38,    39,    40,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    49,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    50,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    51,    52,    53,
+      54,    55,    56,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    58,    59,    60,     1,     2,     3,
+       0,    63,     4,     5,     0,     0,     0,     6,     0,     7,
+       8,     9,     0,     0,     0,    10,    11,    12,    13,    14,
+       0,    15,    16,     0,    17,    18,     0,    19,    20,    21,
+      22,    23,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    25,     0,     0,
+       0,     0,     0,    26,    27,    28,    29,    30,    31,     0,
+       0,    34,    35,    36,    37,    38,    39,    40,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    49,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    50,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      52,    53,    54,    55,    56,     0,     0,     0,     1,     2,
+       3,     0,     0,     4,     5,     0,    58,    59,     6,     0,
+       0,     8,     9,    63,     0,     0,    10,    11,    12,    13,
+      14,     0,    15,    16,     0,    17,     0,     0,    19,     0,
+      21,    22,    23,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    26,    27,    28,    29,    30,    31,
+       0,     0,    34,    35,    36,    37,    38,    39,    40,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      49,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      50,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    52,    53,    54,    55,    56,     0,     0,     0,     0,
+       2,     3,     0,     0,     4,     5,     0,    58,    59,     6,
+       0,     7,     0,     9,    63,     0,     0,     0,    11,    12,
+       0,    14,     0,    15,    16,     0,     0,    18,     0,     0,
+      20,    21,    22,    23,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    25,
+       0,     0,     0,     0,     0,    26,    27,    28,    29,    30,
+      31,    32,     0,    34,    35,    36,    37,    38,    39,     0,
+       0,    42,    43,    44,    45,    46,    47,    48,     0,     0,
+       0,    49,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    51,    52,    53,    54,    55,    56,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    58,    59,
+      60,     2,     3,    61,     0,     4,     5,     0,     0,     0,
+       6,     0,     7,     0,     9,     0,     0,     0,     0,    11,
+      12,     0,    14,     0,    15,    16,     0,     0,    18,     0,
+       0,    20,    21,    22,    23,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      25,     0,     0,     0,     0,     0,    26,    27,    28,    29,
+      30,    31,    32,     0,    34,    35,    36,    37,    38,    39,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    49,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    51,    52,    53,    54,    55,    56,     0,     2,
+       3,     0,     0,     4,     5,     0,     0,     0,     6,    58,
+      59,    60,     9,     0,     0,     0,     0,    11,    12,     0,
+      14,     0,    15,    16,     0,     0,     0,     0,     0,     0,
+      21,    22,    23,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    26,    27,    28,    29,    30,    31,
+       0,     0,    34,    35,    36,    37,    38,    39,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      49,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    52,    53,    54,    55,    56,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    58,    59
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,   218,   115,   205,   332,   537,   617,   116,   211,   453,
+     118,   115,   116,     0,   678,   434,   218,   275,     0,     0,
+      77,    78,   280,    68,    81,    82,    67,    51,    64,   109,
+      33,   116,   463,    33,   113,   479,    51,     0,   117,    64,
+      92,     0,   871,    77,    78,   126,    25,     9,   177,    77,
+      78,    77,    78,   273,    45,    46,    50,   273,   166,   658,
+     273,    25,    51,    67,    64,    65,    66,   146,   114,    40,
+      41,    42,    75,    76,    62,    75,    76,    77,    78,   115,
+     127,   393,   179,    62,    63,   397,   548,   549,   550,   551,
+     115,   137,    25,   179,   188,   189,   142,   143,    62,    63,
+      62,   930,    65,   200,     0,   105,   179,    81,   273,    83,
+     177,    85,    86,    87,   200,   115,   116,    62,   105,   273,
+      62,    62,    63,   105,   105,   177,    89,   200,    91,    62,
+      63,   351,   126,   133,   177,   351,    19,   125,   351,   184,
+      92,   182,   105,   345,   179,   756,   105,   475,   148,   477,
+     478,   198,   179,   116,    37,   235,   180,   360,   161,   159,
+     363,   161,   275,   125,   179,   200,   179,   280,   183,    65,
+      66,   275,   281,   200,    62,    63,   280,   281,   182,   714,
+     125,    77,    78,   125,   125,    92,   351,   200,   446,   235,
+     179,   726,   791,   177,   183,   714,   795,   351,   182,   178,
+     179,   177,   621,   194,   195,   205,   177,   726,   184,   105,
+     181,   182,   320,   179,   178,   179,   179,   180,   218,   179,
+     116,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,   177,   177,   312,   200,   180,   178,   125,   902,   275,
+     200,   179,   187,   884,   280,   177,   887,   185,    92,   491,
+     275,   196,   148,   187,     0,   280,   179,   177,   192,   193,
+     183,    77,    78,   159,   177,    81,    82,    83,    84,    85,
+      86,    87,    88,   177,    90,   275,    92,   194,   182,   521,
+     280,   281,   484,   500,   364,   488,   366,   177,   179,   177,
+     182,   291,   182,   182,   185,   375,     0,   187,   500,   187,
+     182,   833,   177,   178,    62,    63,   196,   182,   196,     0,
+     273,   179,   200,   954,   273,   183,   957,   537,   364,    62,
+     366,   537,    43,    44,   537,   371,   654,   373,   374,   375,
+     774,    77,    78,   446,   122,     3,   124,   215,   216,   217,
+    1004,   760,   446,   178,   177,   345,   181,   182,    16,   227,
+     350,   782,   352,    21,   433,   434,    24,    47,    48,   105,
+      67,    65,    30,   442,   443,    33,   353,   125,   199,   115,
+     177,   353,   537,    77,    78,   179,   838,   434,   435,   183,
+     842,   177,   125,   537,    67,   281,    62,    63,   351,   200,
+     353,   177,   351,   393,   353,   211,   178,   397,   379,   380,
+     434,   105,   177,   178,   177,   178,   434,   182,   434,   182,
+     446,   105,   116,   179,   118,    83,   179,   183,   182,   177,
+     183,   446,   502,   177,   178,   505,   870,   669,   182,   187,
+     742,   875,   179,   184,   177,   184,   183,   105,   196,   548,
+     549,   179,   200,   147,   187,   183,   446,   178,   179,   125,
+     184,   693,   156,   196,   766,   178,   179,   514,   515,   205,
+     164,   179,   166,   665,   179,   183,   178,   179,   183,    62,
+      63,   139,   218,   178,   179,   532,   177,   534,   178,   179,
+     514,   515,   539,   540,   484,   177,   514,   515,   514,   515,
+     177,   491,   712,   550,   551,   199,   712,   201,   532,   712,
+     500,   177,   704,   705,   532,   177,   532,   211,   177,   512,
+     513,   187,   512,   513,   514,   515,   550,   551,   196,   950,
+     196,   521,   550,   551,   550,   551,   186,   273,   531,   275,
+     197,   531,   125,    25,   280,   351,   621,    49,   178,   179,
+     543,   620,   621,   543,   360,   178,   179,   712,   548,   549,
+     550,   551,   178,   179,   178,   636,   178,   179,   712,   178,
+     802,   873,   179,   180,   178,   539,   540,   541,   199,   789,
+      62,    63,    64,   789,   537,    67,   789,    62,   537,   102,
+     103,   178,   690,   287,   177,   571,   572,   180,   569,   570,
+     178,  1022,   178,   179,   187,   177,   798,   814,   801,   345,
+     195,   714,   178,   196,   350,   351,   715,   353,   178,   179,
+     922,   178,   814,   833,   178,   179,   320,   833,   514,   515,
+     833,   178,   179,   179,   789,   329,   330,   178,   179,   184,
+     715,   178,   179,   379,   380,   789,   199,   637,   178,   179,
+     125,   183,   727,   643,   178,   179,   350,   393,   184,   353,
+     178,   397,   548,   549,   550,   551,   360,   184,   621,   114,
+     178,   903,   904,   905,   178,   665,   746,    37,   833,   669,
+     228,   229,   230,   231,   129,   379,   380,   132,   714,   833,
+     135,   760,    11,   138,   139,   140,    19,   142,   434,   714,
+     726,   894,   177,   693,   740,   741,   177,   182,   514,   515,
+     446,   726,   187,   200,   704,   705,   177,   710,   178,   179,
+     710,   196,    92,   713,   714,   715,   716,   533,   534,   535,
+      92,   537,   964,   539,   540,   541,   726,   727,    92,   838,
+     434,   812,   934,   182,   550,   551,   182,   817,   484,   819,
+     820,   184,   742,   184,    62,   491,   733,   493,   951,   712,
+     750,   733,   715,   712,   500,   184,    85,    86,    87,    88,
+      89,    90,    91,  1005,   727,   200,   766,   200,   514,   515,
+     733,   178,   179,   177,   733,   521,   417,   418,   419,   420,
+     235,   180,   984,   862,   863,   866,   532,   491,   413,   414,
+     177,   537,   177,   539,   415,   416,   428,   429,   798,  1041,
+     200,   185,   802,   180,   550,   551,   179,   125,   137,   200,
+     514,   515,   421,   422,   814,   180,  1018,   521,   178,   715,
+     716,   179,   183,   569,   570,   178,   789,   884,   532,   183,
+     789,   727,   178,   178,   178,    62,    63,    62,   838,   179,
+     179,   179,   842,   179,  1046,   179,   550,   551,   178,   199,
+     884,   178,   178,   178,   185,    39,   884,   938,   884,   177,
+     178,   184,   177,   200,   182,   569,   570,    68,   184,   187,
+     833,   871,   178,   873,   833,   178,   178,   178,   196,   200,
+     180,   180,   180,   883,   884,    62,    63,   887,   179,   889,
+     185,   637,   179,   178,   199,   185,   712,   185,   125,   177,
+     125,   178,   983,   903,   904,   905,    68,   988,   177,   364,
+      62,   366,   185,   178,   178,   178,   178,   621,   179,   665,
+     375,   180,   922,   669,   180,   185,   180,  1007,  1009,   180,
+     930,   178,   185,  1014,   934,    62,    63,   185,   548,   549,
+     550,   551,   838,   398,   177,   179,   842,   693,   125,   180,
+     177,  1032,   177,   178,  1035,   182,   180,   182,   704,   705,
+     187,   200,   187,    14,   964,   669,   712,   178,   200,   196,
+     183,   196,   177,   125,   180,   430,    85,    86,    87,    88,
+      89,    90,    91,    70,   984,   689,   690,   733,   884,   693,
+     179,   887,   199,   183,   179,   178,   742,   200,   125,   177,
+     177,   928,   177,   179,   750,  1005,   178,   423,    95,   424,
+     187,   715,    99,   425,   427,   426,   103,   833,  1018,   196,
+     766,   287,   147,   727,   303,   177,   178,   643,   137,   733,
+     182,   204,   360,  1001,   539,   187,   795,   889,   493,   791,
+     495,  1041,   887,   789,   196,   957,  1046,   665,   539,   713,
+     177,   733,   798,   798,   750,   750,   802,    62,    63,   805,
+     187,   805,   499,   805,   144,   983,  1014,   105,   814,   196,
+    1035,   812,   620,  1046,   712,   184,   620,    -1,    -1,    -1,
+     167,    -1,    -1,   170,   171,    -1,   173,   833,    -1,    -1,
+     177,    -1,    -1,    -1,    -1,   182,    -1,    -1,   802,   186,
+     187,   805,   189,   190,   714,   715,     9,   194,   195,   196,
+     197,   198,    -1,   200,    -1,   202,   726,   727,    -1,    -1,
+     125,    -1,    25,    -1,    -1,   871,    -1,   873,    -1,    -1,
+      -1,   211,    65,    -1,    37,    -1,    -1,    -1,   884,    -1,
+      -1,    -1,    -1,    -1,    77,    78,    -1,    -1,    81,    82,
+      83,    84,    85,    86,    87,    88,    -1,   903,   904,   905,
+      -1,    85,    86,    87,    88,    89,    90,    91,    -1,    -1,
+      73,    74,   177,   178,   179,   180,   922,   182,    -1,    -1,
+     884,    -1,   187,   116,   930,    -1,    -1,    -1,   934,    -1,
+     195,   196,    95,    -1,    -1,   650,   651,    -1,    -1,   903,
+     904,   905,    85,    86,    87,    88,    89,    90,    91,    -1,
+      -1,    -1,    -1,   137,   147,    -1,   119,    -1,   964,   674,
+      -1,    -1,   677,    -1,    62,    63,    -1,    -1,   838,   132,
+     133,    -1,   842,    -1,    -1,    -1,    -1,    -1,   984,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    85,    86,    87,    88,
+      89,    90,    91,    -1,   137,   138,   180,    -1,    -1,  1005,
+     964,    -1,   349,    -1,    -1,    -1,   199,    -1,   201,    -1,
+      -1,    -1,  1018,    -1,    -1,    -1,    -1,    -1,   211,    -1,
+     360,    -1,    -1,   363,    -1,    -1,    -1,   125,    -1,   744,
+     745,   746,   372,    -1,    -1,  1041,    -1,    -1,   137,   138,
+    1046,  1005,   185,   383,    -1,    -1,   916,    -1,    -1,    -1,
+      -1,    -1,   767,    -1,    -1,    -1,   396,   200,    29,   399,
+     400,   401,   402,   403,   404,   405,   406,   407,   408,   409,
+      41,    42,    -1,    -1,    -1,    -1,    -1,  1041,    49,   177,
+     178,   179,   180,    -1,   182,    -1,   185,    -1,    -1,   187,
+      -1,    62,   432,    64,    65,    66,    67,   195,   196,   232,
+     233,   200,    -1,   236,   237,   238,   239,   240,   241,    -1,
+      -1,    -1,    -1,   453,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,   473,    -1,    -1,   329,   330,    -1,   479,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,   488,    -1,
+      -1,    -1,    -1,    -1,   125,    -1,    -1,    -1,   351,   874,
+      -1,   508,    -1,    -1,   135,    -1,    -1,   360,    84,    85,
+      86,    87,    88,    89,    90,    91,    84,    85,    86,    87,
+      88,    89,    90,    91,   899,    85,    86,    87,    88,    89,
+      90,    91,    -1,    -1,    -1,    -1,   911,    62,    -1,    64,
+      65,    66,    67,    -1,    -1,    -1,   177,    -1,   923,    -1,
+      -1,    -1,    -1,    -1,    -1,   186,   187,   188,   189,   190,
+     191,   137,   355,    -1,    -1,   940,    -1,    -1,    -1,   137,
+      -1,    96,    97,    98,    99,    -1,    -1,   137,    -1,    -1,
+      -1,   434,   435,   436,   437,    -1,   111,   112,   113,   114,
+      84,    85,    86,    87,    88,    89,    90,    91,    -1,    -1,
+     125,    -1,    -1,    -1,    -1,    -1,    -1,   982,   184,    -1,
+     135,    -1,    -1,    -1,    -1,    -1,   991,   410,   411,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   421,   422,
+     423,   424,   425,   426,   427,   428,   429,   637,  1013,    -1,
+      -1,   641,    -1,   137,    -1,    -1,    -1,    -1,    -1,     9,
+      -1,   658,   177,   660,    -1,    -1,    -1,   664,    -1,    -1,
+      -1,   514,   515,    -1,    -1,    25,    -1,  1042,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,  1050,    -1,    37,    -1,   532,
+      -1,   534,   535,    -1,   537,    -1,   539,   540,   541,    -1,
+     184,   698,   699,    -1,   701,    -1,   703,   550,   551,   706,
+     707,   708,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   718,    -1,    73,    74,    -1,    -1,   724,    -1,    -1,
+      -1,   728,    -1,   730,    -1,    85,    86,    87,    88,    89,
+      90,    91,     9,    -1,    -1,    95,     3,    -1,    -1,    -1,
+      -1,    -1,     9,    -1,    -1,    -1,    -1,    -1,    25,    16,
+     750,    -1,    -1,   753,    21,    -1,    -1,    24,    25,   119,
+      37,    -1,    -1,    30,    -1,   125,    33,   560,   621,    -1,
+      37,    -1,   132,   133,   774,    -1,    -1,   137,    -1,    -1,
+      -1,    -1,   575,    -1,   791,    62,    63,    -1,   795,    -1,
+     797,    -1,    -1,    -1,    -1,    -1,    73,    74,    -1,    -1,
+      -1,   801,    -1,    -1,    -1,    -1,    73,    74,    85,    86,
+      87,    88,    89,    90,    91,    -1,    83,   177,    95,   826,
+     827,    -1,   182,    -1,   617,    -1,    -1,   187,    95,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   196,    -1,   105,    -1,
+      -1,    -1,   119,    -1,    -1,    -1,    -1,    -1,   125,    -1,
+      -1,    -1,   119,    -1,    -1,   132,   133,    -1,    -1,   712,
+     137,    -1,   715,    -1,    -1,   132,   133,    -1,    -1,    -1,
+     870,   871,   139,    -1,   727,   875,    -1,   877,   885,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   896,
+      -1,    -1,    -1,    -1,   894,    -1,    -1,    -1,    -1,    -1,
+     177,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     187,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   196,
+      -1,    -1,    -1,    -1,    -1,    -1,   926,    -1,    -1,   929,
+     930,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   953,    -1,    -1,   956,
+      -1,   951,    -1,    -1,   961,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   756,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     833,     3,     4,     5,    -1,    -1,     8,     9,    -1,   996,
+      -1,    13,   999,    15,    16,    17,    -1,    -1,    -1,    21,
+      22,    23,    24,    25,    -1,    27,    28,    -1,    30,    31,
+      -1,    33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   884,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      62,    63,    -1,    -1,    -1,    -1,    -1,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      -1,    -1,    -1,    95,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   105,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   115,   116,   117,   118,   119,   120,    -1,
+      -1,    -1,    -1,   125,    -1,    -1,    -1,    -1,    -1,    -1,
+     132,   133,   134,    -1,    -1,   137,   138,   139,    -1,    -1,
+       3,     4,     5,    -1,    -1,     8,     9,    -1,    -1,    -1,
+      13,    -1,    15,    16,    17,    -1,    -1,    -1,    21,    22,
+      23,    24,    25,    -1,    27,    28,    -1,    30,    31,    -1,
+      33,    34,    35,    36,    37,   177,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   187,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   196,    -1,    -1,    -1,   200,    62,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    70,    71,    72,
+      73,    74,    75,    -1,    77,    78,    79,    80,    81,    82,
+      83,    -1,    85,    86,    87,    88,    89,    90,    91,    -1,
+      -1,    -1,    95,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   105,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,    -1,    -1,
+      -1,    -1,   125,    -1,    -1,    -1,    -1,    -1,    -1,   132,
+     133,   134,    -1,    -1,   137,    -1,   139,     3,     4,     5,
+      -1,    -1,     8,     9,    -1,    -1,    -1,    13,    -1,    15,
+      16,    17,    -1,    -1,    -1,    21,    22,    23,    24,    25,
+      -1,    27,    28,    -1,    30,    31,    -1,    33,    34,    35,
+      36,    37,    -1,    -1,   177,    -1,    -1,    -1,    -1,   182,
+      -1,    -1,    -1,    -1,   187,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   196,    -1,    -1,    62,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    71,    72,    73,    74,    75,
+      -1,    77,    78,    79,    80,    81,    82,    83,    -1,    85,
+      86,    87,    88,    89,    90,    91,    -1,    -1,    -1,    95,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   115,
+     116,   117,   118,   119,   120,    -1,    -1,    -1,    -1,   125,
+      -1,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,    -1,
+      -1,   137,    -1,   139,     4,     5,    -1,    -1,     8,     9,
+      -1,    -1,    -1,    13,    -1,    15,    -1,    17,    -1,    -1,
+      -1,    -1,    22,    23,    -1,    25,    -1,    27,    28,    -1,
+      -1,    31,    -1,    -1,    34,    35,    36,    37,    -1,    -1,
+      -1,   177,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   187,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     196,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    71,    72,    73,    74,    75,    -1,    77,    78,    79,
+      80,    81,    82,    -1,    -1,    85,    86,    87,    88,    89,
+      90,    91,    -1,    -1,    -1,    95,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   115,   116,   117,   118,   119,
+     120,    -1,    -1,    -1,    -1,   125,    -1,    -1,    -1,    -1,
+      -1,    -1,   132,   133,   134,     4,     5,   137,    -1,     8,
+       9,    -1,    -1,    -1,    13,    -1,    15,    -1,    17,    -1,
+      -1,    -1,    -1,    22,    23,    -1,    25,    -1,    27,    28,
+      -1,    -1,    31,    -1,    -1,    34,    35,    36,    37,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   177,    -1,    -1,
+     180,    -1,    -1,    -1,    -1,    -1,    -1,   187,    -1,    -1,
+      -1,    -1,    -1,    -1,    63,    -1,   196,    -1,    -1,    -1,
+      69,    70,    71,    72,    73,    74,    75,    -1,    77,    78,
+      79,    80,    81,    82,    -1,    -1,    85,    86,    87,    88,
+      89,    90,    91,    -1,    -1,    -1,    95,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   115,   116,   117,   118,
+     119,   120,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   132,   133,   134,    -1,    -1,   137,    -1,
+      -1,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    -1,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    -1,    39,   177,    41,
+      42,    -1,    -1,   182,    -1,    -1,    -1,    49,   187,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   196,    -1,    -1,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      -1,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+      -1,    -1,   104,   105,    -1,    -1,    -1,    -1,    -1,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+      -1,   123,    -1,   125,    -1,    -1,    -1,    -1,   130,   131,
+     132,   133,   134,   135,    -1,   137,   138,   139,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   177,    -1,    -1,    -1,    -1,
+      -1,    -1,   184,   185,   186,   187,   188,   189,   190,   191,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    -1,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    -1,    39,    -1,    41,    42,
+      -1,    -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,
+      63,    64,    65,    66,    67,    -1,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    -1,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,    -1,
+      -1,   104,   105,    -1,    -1,    -1,    -1,    -1,   111,   112,
+     113,   114,   115,   116,   117,   118,   119,   120,   121,    -1,
+     123,    -1,   125,    -1,    -1,    -1,    -1,   130,   131,   132,
+     133,   134,   135,    -1,   137,   138,   139,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   177,    -1,    -1,    -1,    -1,    -1,
+      -1,   184,   185,   186,   187,   188,   189,   190,   191,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      -1,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    -1,    39,    -1,    41,    42,    -1,
+      -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,    63,
+      64,    65,    66,    67,    -1,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    -1,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,    -1,    -1,
+     104,   105,    -1,    -1,    -1,    -1,    -1,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,    -1,   123,
+      -1,   125,    -1,    -1,    -1,    -1,   130,   131,   132,   133,
+     134,   135,    -1,   137,   138,   139,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   177,    -1,    -1,    -1,    -1,    -1,    -1,
+     184,    -1,   186,   187,   188,   189,   190,   191,     3,     4,
+       5,    -1,    -1,     8,     9,    -1,    -1,    -1,    13,    -1,
+      15,    16,    17,    -1,    -1,    -1,    21,    22,    23,    24,
+      25,    -1,    27,    28,    29,    30,    31,    -1,    33,    34,
+      35,    36,    37,    -1,    -1,    -1,    41,    42,    -1,    -1,
+      -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,    63,    64,
+      65,    66,    67,    -1,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    -1,
+      85,    86,    87,    88,    89,    90,    91,    -1,    -1,    -1,
+      95,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+     105,    -1,    -1,    -1,    -1,    -1,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,    -1,    -1,    -1,    -1,
+     125,    -1,    -1,    -1,    -1,   130,   131,   132,   133,   134,
+     135,     3,   137,   138,   139,    -1,    -1,     9,    -1,    -1,
+      -1,    -1,    -1,    -1,    16,    -1,    -1,    -1,    -1,    21,
+      -1,    -1,    24,    25,    -1,    -1,    -1,    29,    30,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    -1,    -1,    -1,    41,
+      42,    -1,   177,    -1,    -1,    -1,    -1,    49,    -1,    -1,
+      -1,   186,   187,   188,   189,   190,   191,    -1,    -1,    -1,
+      62,    -1,    64,    65,    66,    67,    -1,    -1,    -1,    -1,
+      -1,    73,    74,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    83,    -1,    85,    86,    87,    88,    89,    90,    91,
+      -1,    -1,    -1,    95,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    -1,   105,    -1,    -1,    -1,    -1,    -1,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,   119,    -1,    -1,
+      -1,    -1,    -1,   125,    -1,    -1,    -1,    -1,   130,   131,
+     132,   133,     3,   135,    -1,   137,    -1,   139,     9,    -1,
+      -1,    -1,    -1,    -1,    -1,    16,    -1,    -1,    -1,    -1,
+      21,    -1,    -1,    24,    25,    -1,    -1,    -1,    29,    30,
+      -1,    -1,    33,    -1,    -1,    -1,    37,    -1,    -1,    -1,
+      41,    42,    -1,    -1,    -1,   177,    -1,    -1,    49,    -1,
+      -1,   183,    -1,    -1,   186,   187,   188,   189,   190,   191,
+      -1,    62,    -1,    64,    65,    66,    67,    -1,    -1,    -1,
+      -1,    -1,    73,    74,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    83,    -1,    85,    86,    87,    88,    89,    90,
+      91,     9,    -1,    -1,    95,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,   105,    -1,    -1,    25,    -1,    -1,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,   119,    37,
+      -1,    -1,    -1,    -1,   125,    -1,    -1,    -1,    -1,   130,
+     131,   132,   133,    -1,   135,    -1,   137,    -1,   139,    -1,
+      -1,    -1,    -1,    -1,    62,    -1,    -1,     9,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    73,    74,    -1,    -1,    -1,
+      -1,    -1,    -1,    25,    -1,    -1,    -1,    85,    86,    87,
+      88,    89,    90,    91,    -1,    37,   177,    95,    -1,    -1,
+      -1,    -1,   183,    -1,    -1,   186,   187,   188,   189,   190,
+     191,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      62,   119,    -1,    -1,    -1,    -1,    -1,   125,    -1,    -1,
+      -1,    73,    74,    -1,   132,   133,     9,    -1,    -1,   137,
+      -1,    -1,    -1,    85,    86,    87,    88,    89,    90,    91,
+      -1,    -1,    25,    95,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    37,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    -1,    -1,    -1,   119,    -1,   177,
+      -1,    -1,    -1,   125,   182,    41,    42,    -1,    -1,   187,
+     132,   133,    -1,    49,    -1,   137,    -1,    -1,   196,    -1,
+      73,    74,    -1,    -1,    -1,    -1,    62,    -1,    64,    65,
+      66,    67,    85,    86,    87,    88,    89,    90,    91,    -1,
+      -1,    -1,    95,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   177,    -1,    -1,    -1,    -1,
+      96,    97,    98,    99,   100,   187,   119,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   196,   111,   112,   113,   114,   132,
+     133,    -1,    -1,    -1,   137,    -1,    -1,    -1,    -1,   125,
+      29,    -1,    -1,    -1,   130,   131,    -1,    -1,    -1,   135,
+      -1,    -1,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,
+      49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    62,   177,    64,    65,    66,    67,   182,
+      -1,    -1,    -1,    -1,   187,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    -1,   196,    -1,    -1,    -1,    -1,    -1,    -1,
+     186,   187,   188,   189,   190,   191,    -1,    96,    97,    98,
+      99,   100,    -1,    -1,   200,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   111,   112,   113,   114,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   125,    -1,    -1,    -1,
+      -1,   130,   131,    -1,    -1,    -1,   135,    29,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,    41,
+      42,    -1,    -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,
+      -1,    -1,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,
+      62,    -1,    64,    65,    66,    67,    37,    -1,   177,    -1,
+      -1,    -1,   181,   182,    -1,   184,    -1,   186,   187,   188,
+     189,   190,   191,    85,    86,    87,    88,    89,    90,    91,
+     199,    -1,    -1,    -1,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    73,    74,    -1,    -1,    -1,    -1,    -1,   111,
+     112,   113,   114,    -1,    85,    86,    87,    88,    89,    90,
+      91,    -1,    -1,   125,    95,    -1,    -1,    -1,   130,   131,
+      -1,    -1,    -1,   135,    29,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    41,    42,   119,    -1,
+      -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,    -1,    -1,
+      -1,   132,   133,    -1,    -1,    -1,   137,    62,    -1,    64,
+      65,    66,    67,    -1,    -1,   177,    -1,    -1,    -1,    -1,
+      -1,    -1,   184,    -1,   186,   187,   188,   189,   190,   191,
+      85,    86,    87,    88,    89,    90,    91,    -1,    -1,    -1,
+      -1,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   111,   112,   113,   114,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     125,    29,    -1,    -1,    -1,   130,   131,    -1,    -1,    -1,
+     135,    -1,   137,    41,    42,    -1,    -1,    -1,    -1,    -1,
+      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    62,    63,    64,    65,    66,    67,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   177,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   186,   187,   188,   189,   190,   191,    -1,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   111,   112,   113,   114,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   125,    29,    -1,
+      -1,    -1,   130,   131,    -1,    -1,    -1,   135,    -1,    -1,
+      41,    42,    -1,    -1,    -1,    -1,    -1,    -1,    49,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    62,    63,    64,    65,    66,    67,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   177,
+      -1,    -1,    -1,   181,   182,    -1,   184,   185,   186,   187,
+     188,   189,   190,   191,    -1,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   125,    29,    -1,    -1,    -1,   130,
+     131,    -1,    -1,    -1,   135,    -1,    -1,    41,    42,    -1,
+      -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,    63,
+      64,    65,    66,    67,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    -1,    -1,    -1,
+     181,   182,    -1,   184,   185,   186,   187,   188,   189,   190,
+     191,    -1,    96,    97,    98,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   111,   112,   113,
+     114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   125,    29,    -1,    -1,    -1,   130,   131,    -1,    -1,
+      -1,   135,    -1,    -1,    41,    42,    -1,    -1,    -1,    -1,
+      -1,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    62,    -1,    64,    65,    66,
+      67,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   177,    -1,    -1,    -1,   181,   182,    -1,
+     184,    -1,   186,   187,   188,   189,   190,   191,    -1,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   111,   112,   113,   114,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   125,    29,
+      -1,    -1,    -1,   130,   131,    -1,    -1,    -1,   135,    -1,
+      -1,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,    49,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    62,    -1,    64,    65,    66,    67,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     177,    -1,    -1,    -1,    -1,    -1,   183,    -1,    -1,   186,
+     187,   188,   189,   190,   191,    -1,    96,    97,    98,    99,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   125,    29,    -1,    -1,    -1,
+     130,   131,    -1,    -1,    -1,   135,    -1,    -1,    41,    42,
+      -1,    -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,
+      -1,    64,    65,    66,    67,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   177,   178,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   186,   187,   188,   189,
+     190,   191,    -1,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   111,   112,
+     113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   125,    29,    -1,    -1,    -1,   130,   131,    -1,
+      -1,    -1,   135,    -1,    -1,    41,    42,    -1,    -1,    -1,
+      -1,    -1,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,    64,    65,
+      66,    67,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   177,    -1,    -1,   180,    -1,    -1,
+      -1,    -1,    -1,   186,   187,   188,   189,   190,   191,    -1,
+      96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   125,
+      29,    -1,    -1,    -1,   130,   131,    -1,    -1,    -1,   135,
+      -1,    -1,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,
+      49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    62,    63,    64,    65,    66,    67,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,
+     186,   187,   188,   189,   190,   191,    -1,    96,    97,    98,
+      99,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   111,   112,   113,   114,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   125,    29,    -1,    -1,
+      -1,   130,   131,    -1,    -1,    -1,   135,    -1,    -1,    41,
+      42,    -1,    -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      62,    -1,    64,    65,    66,    67,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   177,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   186,   187,   188,
+     189,   190,   191,    -1,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   125,    29,    -1,    -1,    -1,   130,   131,
+      -1,    -1,    -1,   135,    -1,    -1,    41,    42,    -1,    -1,
+      -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,    64,
+      65,    66,    67,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   177,    -1,    -1,    -1,    -1,
+      -1,   183,    -1,    -1,   186,   187,   188,   189,   190,   191,
+      -1,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   111,   112,   113,   114,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     125,    29,    -1,    -1,    -1,   130,   131,    -1,    -1,    -1,
+     135,    -1,    -1,    41,    42,    -1,    -1,    -1,    -1,    -1,
+      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    62,    -1,    64,    65,    66,    67,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   177,    -1,    -1,    -1,    -1,    -1,    -1,   184,
+      -1,   186,   187,   188,   189,   190,   191,    -1,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   111,   112,   113,   114,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   125,    29,    -1,
+      -1,    -1,   130,   131,    -1,    -1,    -1,   135,    -1,    -1,
+      41,    42,    -1,    -1,    -1,    -1,    -1,    -1,    49,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    62,    -1,    64,    65,    66,    67,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   177,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   186,   187,
+     188,   189,   190,   191,    -1,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   125,    29,    -1,    -1,    -1,   130,
+     131,    29,    -1,    -1,   135,    -1,    -1,    41,    42,    -1,
+      -1,    -1,    -1,    41,    42,    49,    -1,    -1,    -1,    -1,
+      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,
+      64,    65,    66,    67,    62,    -1,    64,    65,    66,    67,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   186,   187,   188,   189,   190,
+     191,    -1,    96,    97,    98,    99,   100,    -1,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,   111,   112,   113,
+     114,    -1,    -1,   111,   112,   113,   114,    -1,    -1,    -1,
+      -1,   125,    -1,    -1,    -1,    -1,    -1,   125,    -1,    -1,
+      -1,   135,    -1,    -1,     3,     4,     5,   135,    -1,     8,
+       9,    -1,    -1,    -1,    13,    -1,    15,    16,    17,    -1,
+      -1,    -1,    21,    22,    23,    24,    25,    -1,    27,    28,
+      -1,    30,    31,    -1,    33,    34,    35,    36,    37,    -1,
+      -1,    -1,    -1,   177,    -1,    -1,    -1,    -1,    -1,   177,
+      -1,    -1,   186,   187,   188,   189,   190,   191,   186,   187,
+     188,   189,   190,   191,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    -1,    85,    86,    87,    88,
+      89,    90,    91,    -1,    -1,    -1,    95,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   105,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   115,   116,   117,   118,
+     119,   120,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   132,   133,   134,    -1,    -1,   137,   138,
+     139,     3,     4,     5,    -1,    -1,     8,     9,    -1,    -1,
+      -1,    13,    -1,    15,    16,    17,    -1,    -1,    -1,    21,
+      22,    23,    24,    25,    -1,    27,    28,    -1,    30,    31,
+      -1,    33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    51,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    63,    -1,    -1,    -1,    -1,    -1,    69,    70,    71,
+      72,    73,    74,    75,    -1,    77,    78,    79,    80,    81,
+      82,    83,    -1,    85,    86,    87,    88,    89,    90,    91,
+      -1,    -1,    -1,    95,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   105,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   115,   116,   117,   118,   119,   120,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     132,   133,   134,    -1,    -1,   137,    -1,   139,     3,     4,
+       5,    -1,    -1,     8,     9,    -1,    -1,    -1,    13,    -1,
+      15,    16,    17,    -1,    -1,    -1,    21,    22,    23,    24,
+      25,    -1,    27,    28,    -1,    30,    31,    -1,    33,    34,
+      35,    36,    37,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    71,    72,    73,    74,
+      75,    -1,    77,    78,    79,    80,    81,    82,    83,    -1,
+      85,    86,    87,    88,    89,    90,    91,    -1,    -1,    -1,
+      95,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     105,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     115,   116,   117,   118,   119,   120,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
+      -1,    -1,   137,    -1,   139,     3,     4,     5,    -1,    -1,
+       8,     9,    -1,    -1,    -1,    13,    -1,    15,    16,    17,
+      -1,    -1,    -1,    21,    22,    23,    24,    25,    -1,    27,
+      28,    -1,    30,    31,    -1,    33,    34,    35,    36,    37,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    70,    71,    72,    73,    74,    75,    -1,    77,
+      78,    79,    80,    81,    82,    83,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   132,   133,   134,     3,     4,     5,
+      -1,   139,     8,     9,    -1,    -1,    -1,    13,    -1,    15,
+      16,    17,    -1,    -1,    -1,    21,    22,    23,    24,    25,
+      -1,    27,    28,    -1,    30,    31,    -1,    33,    34,    35,
+      36,    37,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    71,    72,    73,    74,    -1,
+      -1,    77,    78,    79,    80,    81,    82,    83,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     116,   117,   118,   119,   120,    -1,    -1,    -1,     3,     4,
+       5,    -1,    -1,     8,     9,    -1,   132,   133,    13,    -1,
+      -1,    16,    17,   139,    -1,    -1,    21,    22,    23,    24,
+      25,    -1,    27,    28,    -1,    30,    -1,    -1,    33,    -1,
+      35,    36,    37,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    71,    72,    73,    74,
+      -1,    -1,    77,    78,    79,    80,    81,    82,    83,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      95,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     105,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   116,   117,   118,   119,   120,    -1,    -1,    -1,    -1,
+       4,     5,    -1,    -1,     8,     9,    -1,   132,   133,    13,
+      -1,    15,    -1,    17,   139,    -1,    -1,    -1,    22,    23,
+      -1,    25,    -1,    27,    28,    -1,    -1,    31,    -1,    -1,
+      34,    35,    36,    37,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    71,    72,    73,
+      74,    75,    -1,    77,    78,    79,    80,    81,    82,    -1,
+      -1,    85,    86,    87,    88,    89,    90,    91,    -1,    -1,
+      -1,    95,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   115,   116,   117,   118,   119,   120,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   132,   133,
+     134,     4,     5,   137,    -1,     8,     9,    -1,    -1,    -1,
+      13,    -1,    15,    -1,    17,    -1,    -1,    -1,    -1,    22,
+      23,    -1,    25,    -1,    27,    28,    -1,    -1,    31,    -1,
+      -1,    34,    35,    36,    37,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    70,    71,    72,
+      73,    74,    75,    -1,    77,    78,    79,    80,    81,    82,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    95,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,    -1,     4,
+       5,    -1,    -1,     8,     9,    -1,    -1,    -1,    13,   132,
+     133,   134,    17,    -1,    -1,    -1,    -1,    22,    23,    -1,
+      25,    -1,    27,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      35,    36,    37,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    71,    72,    73,    74,
+      -1,    -1,    77,    78,    79,    80,    81,    82,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      95,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   116,   117,   118,   119,   120,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   132,   133
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     3,     4,     5,     8,     9,    13,    15,    16,    17,
+      21,    22,    23,    24,    25,    27,    28,    30,    31,    33,
+      34,    35,    36,    37,    62,    63,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    95,
+     105,   115,   116,   117,   118,   119,   120,   125,   132,   133,
+     134,   137,   138,   139,   177,   187,   196,   200,   202,   203,
+     204,   242,   243,   244,   251,   255,   256,   257,   258,   261,
+     262,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   281,   283,   284,   285,   286,   288,   292,
+     297,   300,   310,   313,   365,   366,   367,   368,   369,   380,
+     389,   390,   391,   392,   177,   177,   187,   204,   381,   382,
+     383,   384,   385,   386,   387,   389,   177,   177,    92,   177,
+      92,    92,   177,   177,    92,   177,   177,   194,   182,   182,
+     182,    67,   177,   177,   177,   390,   392,   258,   259,   261,
+     263,   300,   389,   389,     0,   298,   299,   300,   200,   179,
+     200,   179,   200,   200,   381,   200,   381,   204,   260,   261,
+     274,   276,   283,   284,   285,   300,   389,   204,   261,   274,
+     276,   283,   284,   285,   300,   389,   260,   284,   261,   283,
+     284,   260,   261,   283,   260,   260,   260,   261,   283,   258,
+     283,   258,   283,   298,   298,   298,   367,   334,   335,   370,
+     177,   182,   395,   397,   399,    29,    41,    42,    49,    64,
+      65,    66,    67,    96,    97,    98,    99,   100,   111,   112,
+     113,   114,   130,   131,   135,   177,   186,   187,   188,   189,
+     190,   191,   203,   205,   206,   207,   208,   209,   210,   211,
+     214,   215,   216,   218,   219,   220,   223,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
+     237,   238,   239,   298,   324,   177,   204,   384,   386,   388,
+     177,   259,   383,   386,   395,    84,   248,   249,   250,   300,
+     208,   177,   239,   239,   203,   239,    25,    62,    63,   178,
+     179,   278,   279,   280,   324,   239,   239,   239,   239,   324,
+     324,   238,   178,   178,   261,   263,   300,   389,   300,   389,
+     381,   250,   250,   298,   298,   298,   298,   245,   298,   258,
+     258,   298,   246,   298,   298,   298,   298,   298,   298,   298,
+     298,   298,   298,   298,   281,   282,   203,   204,   311,   323,
+     184,   178,   396,   398,   183,   187,   238,   240,   261,   264,
+     265,   283,   300,   182,   177,   223,   177,   223,   223,   323,
+     345,   177,   177,   177,   177,   177,   223,   335,   335,   335,
+     335,   224,   224,   177,   239,   324,   334,   224,   224,   224,
+     224,   224,   224,    40,    41,    42,   177,   181,   182,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,   199,
+     187,   192,   193,   188,   189,    43,    44,    45,    46,   194,
+     195,    47,    48,   186,   196,   197,    49,    50,   126,   127,
+     198,   178,   179,   256,   258,   267,   269,   273,   275,   277,
+     178,   388,   178,   178,   395,   388,   177,   383,   386,    19,
+      37,   350,   248,   199,   178,     9,   203,   295,   296,   178,
+     178,   178,   178,   177,   178,   279,   195,   183,   183,   183,
+     178,   178,   178,   179,   395,   247,   250,   252,   253,   199,
+     325,   325,   289,   323,   184,   298,   312,     6,     7,    10,
+      11,    12,    18,    19,    20,    26,    32,    39,    68,    84,
+      93,    94,   101,   104,   121,   123,   185,   203,   204,   239,
+     241,   242,   255,   256,   257,   258,   323,   331,   332,   333,
+     334,   336,   337,   338,   340,   342,   343,   346,   347,   348,
+     349,   256,   258,   261,   267,   273,   283,   372,   373,   374,
+     375,   376,   377,   378,   379,   203,   319,   320,   255,   256,
+     257,   258,   318,   321,   322,   183,   183,   183,   240,   264,
+     187,   240,   324,   324,   324,   238,   324,   324,   324,   184,
+     184,   242,   242,   238,   178,   178,   178,   203,   204,   221,
+     178,   222,   238,   221,   239,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   224,   224,   224,   224,
+     225,   225,   226,   226,   227,   227,   227,   227,   228,   228,
+     229,   230,   231,   232,   233,   235,   235,   180,   239,   238,
+     177,   187,   196,   393,   395,   400,   402,   393,   178,   395,
+     395,   178,   178,   388,    37,    19,   177,   184,   240,   326,
+     200,   177,   178,   179,    92,    92,    92,    64,    67,   278,
+     182,   182,   238,   325,   254,   325,   325,   326,   184,   290,
+     291,   314,   315,   316,   323,   184,   200,   240,   200,   180,
+     331,   341,   204,   239,   177,   200,   239,   177,   177,   185,
+     350,   344,   345,    68,   184,   334,   200,   334,   200,   381,
+     381,   389,   389,   180,   185,   331,   381,   283,   283,   283,
+     373,   204,   260,   284,   292,   313,   260,   284,   260,   381,
+     179,   200,   178,   179,   177,   187,   196,   383,   389,   394,
+     397,   401,   403,   383,   389,   394,   177,   187,   389,   394,
+     389,   394,   178,   179,   183,   183,   183,   178,   178,   178,
+     179,   179,   179,   178,   242,   242,   177,   210,   210,   179,
+     184,   224,   178,   179,   183,   237,   180,   395,   400,   402,
+     259,   393,   178,   208,   351,   352,   181,   182,   203,   221,
+     326,   327,   328,   329,   330,   238,   293,   294,   178,   295,
+     178,   178,   199,   239,   239,   178,   325,   200,   243,   298,
+     301,   302,   303,   304,   305,   184,   298,   185,   179,   298,
+     314,    51,   180,   331,    39,   177,   200,   200,   239,   200,
+     239,   241,   177,   184,   179,   200,    68,   102,   103,   122,
+     124,   331,   298,   298,   298,   298,   323,   323,   298,   298,
+     298,   381,   371,   372,   320,   178,   401,   403,   259,   394,
+     298,   298,   259,   298,   298,    51,   322,   324,   324,   217,
+     221,   239,   239,    11,   212,   213,   324,   327,   328,   238,
+     237,   178,   178,   178,   393,   178,   180,   353,   221,   239,
+     180,   179,   185,   181,   182,   199,   326,   179,   178,   278,
+     183,   183,   200,   256,   258,   185,   303,   179,   200,   179,
+     200,   301,   298,   316,   199,   317,   185,   240,   331,   177,
+     332,   337,   339,   178,   178,   178,   351,    68,   345,   185,
+     334,   177,   334,   334,   298,   298,   178,   178,   394,   178,
+     178,   178,   181,   182,   185,   185,   180,   178,   179,   180,
+     179,   185,   395,   395,   182,   208,   354,   355,   180,   356,
+      51,   183,   326,   185,   329,   221,   239,   326,   238,   178,
+     179,   180,   306,   309,   381,   307,   309,   389,   298,   307,
+     306,   185,   240,   298,   180,   239,   241,   331,   331,   331,
+     178,   185,   239,   177,   397,   221,   239,   238,   213,   238,
+     185,   323,   177,   179,   182,   208,   357,   358,   180,   359,
+     239,    51,   183,   278,   240,   298,   308,   309,   298,   308,
+     287,   298,   331,   178,   200,    14,   200,   178,   183,   183,
+     239,   354,   323,   177,   179,   208,   360,   361,   180,   362,
+     183,   239,   199,   298,   298,   287,   200,   241,   331,   334,
+     208,   178,   183,   239,   357,   179,   345,   363,   364,   183,
+     278,   178,   177,   208,   178,   360,   179,   178,   331,   239,
+     177,   364,   178,   239,   178
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   201,   202,   203,   203,   204,   205,   206,   207,   208,
+     209,   209,   209,   209,   210,   210,   210,   210,   210,   210,
+     210,   210,   210,   211,   212,   212,   213,   213,   214,   214,
+     215,   216,   217,   217,   217,   218,   218,   218,   218,   219,
+     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
+     221,   221,   222,   222,   223,   223,   223,   223,   223,   223,
+     223,   223,   223,   223,   223,   223,   223,   223,   224,   224,
+     224,   224,   225,   225,   225,   225,   226,   226,   226,   227,
+     227,   227,   228,   228,   228,   228,   228,   229,   229,   229,
+     230,   230,   231,   231,   232,   232,   233,   233,   234,   234,
+     235,   235,   236,   236,   237,   237,   237,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   239,
+     239,   240,   241,   241,   242,   242,   242,   242,   242,   243,
+     245,   244,   246,   244,   247,   244,   248,   248,   249,   249,
+     250,   250,   252,   251,   253,   251,   251,   254,   251,   255,
+     255,   255,   255,   255,   256,   256,   256,   256,   256,   257,
+     257,   257,   257,   257,   258,   258,   258,   259,   259,   260,
+     260,   261,   261,   261,   261,   261,   261,   261,   261,   261,
+     262,   262,   263,   263,   264,   264,   264,   265,   265,   266,
+     266,   266,   266,   267,   267,   267,   267,   268,   268,   268,
+     269,   269,   269,   270,   270,   270,   271,   271,   271,   272,
+     272,   272,   273,   273,   273,   274,   274,   275,   275,   275,
+     275,   276,   277,   277,   277,   277,   278,   278,   278,   279,
+     279,   279,   279,   279,   279,   280,   280,   281,   281,   282,
+     282,   283,   283,   283,   283,   283,   283,   283,   283,   283,
+     284,   284,   284,   284,   284,   284,   284,   284,   284,   284,
+     284,   284,   284,   284,   284,   284,   284,   284,   284,   284,
+     284,   284,   284,   284,   284,   285,   285,   285,   286,   287,
+     289,   288,   290,   288,   291,   288,   292,   292,   293,   293,
+     294,   294,   295,   295,   295,   295,   296,   296,   297,   298,
+     298,   299,   299,   300,   300,   300,   300,   300,   300,   300,
+     300,   300,   301,   301,   302,   302,   303,   303,   303,   303,
+     304,   304,   305,   305,   306,   306,   306,   307,   307,   308,
+     308,   309,   311,   310,   312,   310,   310,   313,   314,   314,
+     315,   315,   315,   316,   317,   317,   318,   318,   319,   319,
+     320,   321,   321,   322,   322,   322,   322,   322,   322,   322,
+     322,   322,   322,   322,   322,   322,   322,   323,   323,   324,
+     324,   324,   324,   325,   325,   326,   326,   326,   327,   327,
+     328,   328,   329,   329,   329,   329,   330,   330,   330,   330,
+     330,   330,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   332,   333,   333,   333,   333,   334,
+     334,   334,   335,   336,   336,   337,   338,   338,   338,   339,
+     339,   340,   340,   341,   340,   342,   342,   342,   342,   342,
+     342,   343,   344,   344,   345,   346,   346,   347,   347,   348,
+     348,   348,   349,   349,   349,   350,   350,   350,   350,   350,
+     351,   351,   351,   351,   351,   352,   353,   353,   354,   354,
+     355,   355,   356,   356,   357,   357,   358,   358,   359,   359,
+     360,   361,   361,   362,   362,   363,   363,   364,   365,   365,
+     366,   366,   367,   367,   367,   367,   368,   369,   370,   371,
+     371,   372,   372,   373,   374,   374,   374,   375,   375,   375,
+     375,   376,   376,   376,   377,   377,   378,   378,   378,   379,
+     379,   379,   380,   380,   380,   380,   380,   381,   381,   382,
+     382,   383,   383,   383,   384,   384,   384,   385,   385,   386,
+     386,   386,   386,   386,   387,   387,   387,   388,   388,   389,
+     389,   390,   390,   390,   390,   391,   391,   391,   392,   392,
+     393,   393,   393,   394,   394,   395,   395,   396,   395,   397,
+     397,   398,   397,   399,   399,   399,   399,   399,   399,   399,
+     400,   400,   400,   400,   400,   401,   401,   401,   401,   401,
+     402,   402,   402,   402,   402,   403,   403,   403,   403
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     2,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     6,     1,     3,     3,     3,     6,     6,
+       4,     6,     1,     3,     4,     6,     4,     6,     4,     3,
+       1,     4,     3,     4,     3,     3,     2,     2,     6,     7,
+       1,     1,     1,     3,     1,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     4,     2,     4,     1,     4,
+       2,     2,     1,     3,     3,     3,     1,     3,     3,     1,
+       3,     3,     1,     3,     3,     3,     3,     1,     3,     3,
+       1,     3,     1,     3,     1,     3,     1,     3,     1,     3,
+       1,     3,     1,     3,     1,     5,     4,     1,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     1,
+       3,     1,     0,     1,     2,     2,     2,     2,     2,     6,
+       0,     4,     0,     4,     0,     5,     5,     1,     2,     1,
+       0,     1,     0,     5,     0,     5,     5,     0,     6,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     1,     2,     2,     1,     2,     2,     1,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     4,     1,
+       4,     4,     1,     1,     1,     1,     1,     1,     2,     3,
+       3,     3,     3,     2,     3,     2,     3,     2,     2,     2,
+       1,     2,     2,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     2,     3,     3,     4,     4,     1,     2,     3,
+       2,     4,     1,     2,     3,     2,     1,     1,     1,     1,
+       4,     4,     6,    10,     1,     1,     2,     4,     3,     0,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     4,     7,     7,     1,     1,     1,     1,     4,     0,
+       0,     9,     0,    10,     0,     6,     1,     1,     1,     3,
+       0,     1,     0,     1,     1,     4,     1,     3,     6,     0,
+       1,     1,     2,     2,     2,     5,     2,     5,     5,     2,
+       1,     1,     0,     1,     1,     2,     2,     2,     1,     2,
+       3,     3,     3,     3,     3,     0,     2,     3,     2,     0,
+       1,     2,     0,     7,     0,     8,     4,     1,     0,     1,
+       1,     3,     2,     3,     0,     2,     1,     3,     1,     3,
+       1,     1,     3,     1,     2,     3,     2,     1,     2,     3,
+       1,     2,     3,     2,     1,     2,     3,     1,     1,     2,
+       3,     2,     3,     0,     2,     1,     3,     4,     1,     3,
+       1,     0,     1,     3,     2,     3,     2,     3,     5,     4,
+       6,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     4,     6,     3,     3,
+       4,     4,     0,     1,     2,     2,     5,     7,     5,     1,
+       1,     5,     7,     0,     9,     3,     3,     2,     2,     2,
+       3,     3,     1,     3,     1,     6,     5,     4,     2,     7,
+       4,     1,     2,     4,     4,     0,     1,     1,     2,     2,
+       1,     2,     3,     4,     5,     1,     2,     1,     4,     7,
+       1,     3,     2,     1,     4,     7,     1,     3,     2,     1,
+       1,     1,     3,     2,     1,     1,     3,     1,     0,     1,
+       1,     2,     1,     1,     1,     1,     5,     2,     1,     0,
+       1,     1,     2,     2,     1,     2,     2,     3,     3,     3,
+       3,     3,     3,     3,     4,     4,     1,     1,     1,     2,
+       2,     3,     1,     2,     2,     2,     2,     1,     1,     1,
+       1,     1,     2,     1,     1,     2,     3,     3,     4,     1,
+       4,     5,     2,     3,     3,     4,     4,     1,     3,     1,
+       1,     1,     2,     2,     3,     2,     3,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     3,     0,     5,     1,
+       2,     0,     4,     2,     3,     3,     3,     4,     4,     4,
+       1,     2,     2,     3,     1,     1,     2,     2,     3,     1,
+       3,     3,     3,     4,     4,     3,     3,     1,     4
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 4: /* identifier: "__CPROVER_ID" TOK_STRING  */
+#line 250 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack(yyval).id(ID_symbol);
+          irep_idt value=stack(yyvsp[0]).get(ID_value);
+          stack(yyval).set(ID_C_base_name, value);
+          stack(yyval).set(ID_identifier, value);
+          stack(yyval).set(ID_C_id_class, ANSI_C_SYMBOL);
+        }
+#line 3462 "ansi_c_y.tab.cpp"
+    break;
+
+  case 16: /* primary_expression: '(' comma_expression ')'  */
+#line 294 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 3468 "ansi_c_y.tab.cpp"
+    break;
+
+  case 23: /* generic_selection: "_Generic" '(' assignment_expression ',' generic_assoc_list ')'  */
+#line 305 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          set(yyval, ID_generic_selection);
+          mto(yyval, yyvsp[-3]);
+          stack(yyval).add(ID_generic_associations).get_sub().swap((irept::subt&)stack(yyvsp[-1]).operands());
+        }
+#line 3479 "ansi_c_y.tab.cpp"
+    break;
+
+  case 24: /* generic_assoc_list: generic_association  */
+#line 315 "parser.y"
+        {
+          init(yyval); mto(yyval, yyvsp[0]);
+        }
+#line 3487 "ansi_c_y.tab.cpp"
+    break;
+
+  case 25: /* generic_assoc_list: generic_assoc_list ',' generic_association  */
+#line 319 "parser.y"
+        {
+          yyval=yyvsp[-2]; mto(yyval, yyvsp[0]);
+        }
+#line 3495 "ansi_c_y.tab.cpp"
+    break;
+
+  case 26: /* generic_association: type_name ':' assignment_expression  */
+#line 326 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack(yyval).id(ID_generic_association);
+          stack(yyval).set(ID_type_arg, stack(yyvsp[-2]));
+          stack(yyval).set(ID_value, stack(yyvsp[0]));
+        }
+#line 3506 "ansi_c_y.tab.cpp"
+    break;
+
+  case 27: /* generic_association: "default" ':' assignment_expression  */
+#line 333 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack(yyval).id(ID_generic_association);
+          stack(yyval).set(ID_type_arg, irept(ID_default));
+          stack(yyval).set(ID_value, stack(yyvsp[0]));
+        }
+#line 3517 "ansi_c_y.tab.cpp"
+    break;
+
+  case 28: /* gcc_builtin_expressions: "__builtin_va_arg" '(' assignment_expression ',' type_name ')'  */
+#line 343 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          stack(yyval).id(ID_gcc_builtin_va_arg);
+          mto(yyval, yyvsp[-3]);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+        }
+#line 3528 "ansi_c_y.tab.cpp"
+    break;
+
+  case 29: /* gcc_builtin_expressions: "__builtin_types_compatible_p" '(' type_name ',' type_name ')'  */
+#line 351 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          stack(yyval).id(ID_gcc_builtin_types_compatible_p);
+          typet &type_arg=(typet &)(stack(yyval).add(ID_type_arg));
+          typet::subtypest &subtypes=type_arg.subtypes();
+          subtypes.resize(2);
+          subtypes[0].swap(stack(yyvsp[-3]));
+          subtypes[1].swap(stack(yyvsp[-1]));
+        }
+#line 3542 "ansi_c_y.tab.cpp"
+    break;
+
+  case 30: /* cw_builtin_expressions: "_var_arg_typeof" '(' type_name ')'  */
+#line 364 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          stack(yyval).id(ID_cw_va_arg_typeof);
+          stack(yyval).add(ID_type_arg).swap(stack(yyvsp[-1]));
+        }
+#line 3552 "ansi_c_y.tab.cpp"
+    break;
+
+  case 31: /* offsetof: "__offsetof" '(' type_name ',' offsetof_member_designator ')'  */
+#line 373 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          stack(yyval).id(ID_builtin_offsetof);
+          stack(yyval).add(ID_type_arg).swap(stack(yyvsp[-3]));
+          stack(yyval).add(ID_designator).swap(stack(yyvsp[-1]));
+        }
+#line 3563 "ansi_c_y.tab.cpp"
+    break;
+
+  case 32: /* offsetof_member_designator: member_name  */
+#line 383 "parser.y"
+        {
+          init(yyval, ID_designated_initializer);
+          stack(yyval).operands().resize(1);
+          stack(yyval).op0().id(ID_member);
+          stack(yyval).op0().add_source_location()=stack(yyvsp[0]).source_location();
+          stack(yyval).op0().set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+        }
+#line 3575 "ansi_c_y.tab.cpp"
+    break;
+
+  case 33: /* offsetof_member_designator: offsetof_member_designator '.' member_name  */
+#line 391 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          set(yyvsp[-1], ID_member);
+          stack(yyvsp[-1]).set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+          mto(yyval, yyvsp[-1]);
+        }
+#line 3586 "ansi_c_y.tab.cpp"
+    break;
+
+  case 34: /* offsetof_member_designator: offsetof_member_designator '[' comma_expression ']'  */
+#line 398 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          set(yyvsp[-2], ID_index);
+          mto(yyvsp[-2], yyvsp[-1]);
+          mto(yyval, yyvsp[-2]);
+        }
+#line 3597 "ansi_c_y.tab.cpp"
+    break;
+
+  case 35: /* quantifier_expression: "forall" compound_scope '{' declaration comma_expression '}'  */
+#line 408 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          set(yyval, ID_forall);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[-1]);
+          PARSER.pop_scope();
+        }
+#line 3609 "ansi_c_y.tab.cpp"
+    break;
+
+  case 36: /* quantifier_expression: "\\forall" compound_scope declaration primary_expression  */
+#line 416 "parser.y"
+        {
+          // The precedence of this operator is too high; it is meant
+          // to bind only very weakly.
+          yyval=yyvsp[-3];
+          set(yyval, ID_forall);
+          mto(yyval, yyvsp[-1]);
+          mto(yyval, yyvsp[0]);
+          PARSER.pop_scope();
+        }
+#line 3623 "ansi_c_y.tab.cpp"
+    break;
+
+  case 37: /* quantifier_expression: "exists" compound_scope '{' declaration comma_expression '}'  */
+#line 426 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          set(yyval, ID_exists);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[-1]);
+          PARSER.pop_scope();
+        }
+#line 3635 "ansi_c_y.tab.cpp"
+    break;
+
+  case 38: /* quantifier_expression: "\\exists" compound_scope declaration primary_expression  */
+#line 434 "parser.y"
+        {
+          // The precedence of this operator is too high; it is meant
+          // to bind only very weakly.
+          yyval=yyvsp[-3];
+          set(yyval, ID_exists);
+          mto(yyval, yyvsp[-1]);
+          mto(yyval, yyvsp[0]);
+          PARSER.pop_scope();
+        }
+#line 3649 "ansi_c_y.tab.cpp"
+    break;
+
+  case 39: /* statement_expression: '(' compound_statement ')'  */
+#line 446 "parser.y"
+        { 
+          yyval=yyvsp[-2];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_statement_expression);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 3660 "ansi_c_y.tab.cpp"
+    break;
+
+  case 41: /* postfix_expression: postfix_expression '[' comma_expression ']'  */
+#line 457 "parser.y"
+        { binary(yyval, yyvsp[-3], yyvsp[-2], ID_index, yyvsp[-1]); }
+#line 3666 "ansi_c_y.tab.cpp"
+    break;
+
+  case 42: /* postfix_expression: postfix_expression '(' ')'  */
+#line 459 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_function_call);
+          stack(yyval).operands().resize(2);
+          stack(yyval).op0().swap(stack(yyvsp[-2]));
+          stack(yyval).op1().clear();
+          stack(yyval).op1().id(ID_arguments);
+        }
+#line 3679 "ansi_c_y.tab.cpp"
+    break;
+
+  case 43: /* postfix_expression: postfix_expression '(' argument_expression_list ')'  */
+#line 468 "parser.y"
+        { yyval=yyvsp[-2];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_function_call);
+          stack(yyval).operands().resize(2);
+          stack(yyval).op0().swap(stack(yyvsp[-3]));
+          stack(yyval).op1().swap(stack(yyvsp[-1]));
+          stack(yyval).op1().id(ID_arguments);
+        }
+#line 3692 "ansi_c_y.tab.cpp"
+    break;
+
+  case 44: /* postfix_expression: postfix_expression '.' member_name  */
+#line 477 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_member);
+          mto(yyval, yyvsp[-2]);
+          stack(yyval).set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+        }
+#line 3702 "ansi_c_y.tab.cpp"
+    break;
+
+  case 45: /* postfix_expression: postfix_expression "->" member_name  */
+#line 483 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_ptrmember);
+          mto(yyval, yyvsp[-2]);
+          stack(yyval).set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+        }
+#line 3712 "ansi_c_y.tab.cpp"
+    break;
+
+  case 46: /* postfix_expression: postfix_expression "++"  */
+#line 489 "parser.y"
+        { yyval=yyvsp[0];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_postincrement);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 3722 "ansi_c_y.tab.cpp"
+    break;
+
+  case 47: /* postfix_expression: postfix_expression "--"  */
+#line 495 "parser.y"
+        { yyval=yyvsp[0];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_postdecrement);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 3732 "ansi_c_y.tab.cpp"
+    break;
+
+  case 48: /* postfix_expression: '(' type_name ')' '{' initializer_list_opt '}'  */
+#line 502 "parser.y"
+        {
+          exprt tmp(ID_initializer_list);
+          tmp.add_source_location()=stack(yyvsp[-2]).source_location();
+          tmp.operands().swap(stack(yyvsp[-1]).operands());
+          yyval=yyvsp[-5];
+          set(yyval, ID_typecast);
+          stack(yyval).move_to_operands(tmp);
+          stack(yyval).type().swap(stack(yyvsp[-4]));
+        }
+#line 3746 "ansi_c_y.tab.cpp"
+    break;
+
+  case 49: /* postfix_expression: '(' type_name ')' '{' initializer_list ',' '}'  */
+#line 512 "parser.y"
+        {
+          // same as above
+          exprt tmp(ID_initializer_list);
+          tmp.add_source_location()=stack(yyvsp[-3]).source_location();
+          tmp.operands().swap(stack(yyvsp[-2]).operands());
+          yyval=yyvsp[-6];
+          set(yyval, ID_typecast);
+          stack(yyval).move_to_operands(tmp);
+          stack(yyval).type().swap(stack(yyvsp[-5]));
+        }
+#line 3761 "ansi_c_y.tab.cpp"
+    break;
+
+  case 52: /* argument_expression_list: assignment_expression  */
+#line 531 "parser.y"
+        {
+          init(yyval, ID_expression_list);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3770 "ansi_c_y.tab.cpp"
+    break;
+
+  case 53: /* argument_expression_list: argument_expression_list ',' assignment_expression  */
+#line 536 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 3779 "ansi_c_y.tab.cpp"
+    break;
+
+  case 55: /* unary_expression: "++" unary_expression  */
+#line 545 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_preincrement);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3789 "ansi_c_y.tab.cpp"
+    break;
+
+  case 56: /* unary_expression: "--" unary_expression  */
+#line 551 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_side_effect);
+          stack(yyval).set(ID_statement, ID_predecrement);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3799 "ansi_c_y.tab.cpp"
+    break;
+
+  case 57: /* unary_expression: '&' cast_expression  */
+#line 557 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_address_of);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3808 "ansi_c_y.tab.cpp"
+    break;
+
+  case 58: /* unary_expression: "&&" gcc_local_label  */
+#line 562 "parser.y"
+        { // this takes the address of a label (a gcc extension)
+          yyval=yyvsp[-1];
+          irep_idt identifier=PARSER.lookup_label(stack(yyvsp[0]).get(ID_C_base_name));
+          set(yyval, ID_address_of);
+          stack(yyval).operands().resize(1);
+          stack(yyval).op0()=stack(yyvsp[0]);
+          stack(yyval).op0().id(ID_label);
+          stack(yyval).op0().set(ID_identifier, identifier);
+        }
+#line 3822 "ansi_c_y.tab.cpp"
+    break;
+
+  case 59: /* unary_expression: '*' cast_expression  */
+#line 572 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_dereference);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3831 "ansi_c_y.tab.cpp"
+    break;
+
+  case 60: /* unary_expression: '+' cast_expression  */
+#line 577 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_unary_plus);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3840 "ansi_c_y.tab.cpp"
+    break;
+
+  case 61: /* unary_expression: '-' cast_expression  */
+#line 582 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_unary_minus);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3849 "ansi_c_y.tab.cpp"
+    break;
+
+  case 62: /* unary_expression: '~' cast_expression  */
+#line 587 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_bitnot);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3858 "ansi_c_y.tab.cpp"
+    break;
+
+  case 63: /* unary_expression: '!' cast_expression  */
+#line 592 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_not);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3867 "ansi_c_y.tab.cpp"
+    break;
+
+  case 64: /* unary_expression: "sizeof" unary_expression  */
+#line 597 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_sizeof);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3876 "ansi_c_y.tab.cpp"
+    break;
+
+  case 65: /* unary_expression: "sizeof" '(' type_name ')'  */
+#line 602 "parser.y"
+        { yyval=yyvsp[-3];
+          set(yyval, ID_sizeof);
+          stack(yyval).add(ID_type_arg).swap(stack(yyvsp[-1]));
+        }
+#line 3885 "ansi_c_y.tab.cpp"
+    break;
+
+  case 66: /* unary_expression: "__alignof__" unary_expression  */
+#line 607 "parser.y"
+        { // note no parentheses for expressions, just like sizeof
+          yyval=yyvsp[-1];
+          set(yyval, ID_alignof);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3895 "ansi_c_y.tab.cpp"
+    break;
+
+  case 67: /* unary_expression: "__alignof__" '(' type_name ')'  */
+#line 613 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          stack(yyval).id(ID_alignof);
+          stack(yyval).add(ID_type_arg).swap(stack(yyvsp[-1]));
+        }
+#line 3905 "ansi_c_y.tab.cpp"
+    break;
+
+  case 69: /* cast_expression: '(' type_name ')' cast_expression  */
+#line 623 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          set(yyval, ID_typecast);
+          mto(yyval, yyvsp[0]);
+          stack(yyval).type().swap(stack(yyvsp[-2]));
+        }
+#line 3916 "ansi_c_y.tab.cpp"
+    break;
+
+  case 70: /* cast_expression: "__real__" cast_expression  */
+#line 630 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_complex_real);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3925 "ansi_c_y.tab.cpp"
+    break;
+
+  case 71: /* cast_expression: "__imag__" cast_expression  */
+#line 635 "parser.y"
+        { yyval=yyvsp[-1];
+          set(yyval, ID_complex_imag);
+          mto(yyval, yyvsp[0]);
+        }
+#line 3934 "ansi_c_y.tab.cpp"
+    break;
+
+  case 73: /* multiplicative_expression: multiplicative_expression '*' cast_expression  */
+#line 644 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_mult, yyvsp[0]); }
+#line 3940 "ansi_c_y.tab.cpp"
+    break;
+
+  case 74: /* multiplicative_expression: multiplicative_expression '/' cast_expression  */
+#line 646 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_div, yyvsp[0]); }
+#line 3946 "ansi_c_y.tab.cpp"
+    break;
+
+  case 75: /* multiplicative_expression: multiplicative_expression '%' cast_expression  */
+#line 648 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_mod, yyvsp[0]); }
+#line 3952 "ansi_c_y.tab.cpp"
+    break;
+
+  case 77: /* additive_expression: additive_expression '+' multiplicative_expression  */
+#line 654 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_plus, yyvsp[0]); }
+#line 3958 "ansi_c_y.tab.cpp"
+    break;
+
+  case 78: /* additive_expression: additive_expression '-' multiplicative_expression  */
+#line 656 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_minus, yyvsp[0]); }
+#line 3964 "ansi_c_y.tab.cpp"
+    break;
+
+  case 80: /* shift_expression: shift_expression "<<" additive_expression  */
+#line 662 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_shl, yyvsp[0]); }
+#line 3970 "ansi_c_y.tab.cpp"
+    break;
+
+  case 81: /* shift_expression: shift_expression ">>" additive_expression  */
+#line 664 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_shr, yyvsp[0]); }
+#line 3976 "ansi_c_y.tab.cpp"
+    break;
+
+  case 83: /* relational_expression: relational_expression '<' shift_expression  */
+#line 670 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_lt, yyvsp[0]); }
+#line 3982 "ansi_c_y.tab.cpp"
+    break;
+
+  case 84: /* relational_expression: relational_expression '>' shift_expression  */
+#line 672 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_gt, yyvsp[0]); }
+#line 3988 "ansi_c_y.tab.cpp"
+    break;
+
+  case 85: /* relational_expression: relational_expression "<=" shift_expression  */
+#line 674 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_le, yyvsp[0]); }
+#line 3994 "ansi_c_y.tab.cpp"
+    break;
+
+  case 86: /* relational_expression: relational_expression ">=" shift_expression  */
+#line 676 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_ge, yyvsp[0]); }
+#line 4000 "ansi_c_y.tab.cpp"
+    break;
+
+  case 88: /* equality_expression: equality_expression "==" relational_expression  */
+#line 682 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_equal, yyvsp[0]); }
+#line 4006 "ansi_c_y.tab.cpp"
+    break;
+
+  case 89: /* equality_expression: equality_expression "!=" relational_expression  */
+#line 684 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_notequal, yyvsp[0]); }
+#line 4012 "ansi_c_y.tab.cpp"
+    break;
+
+  case 91: /* and_expression: and_expression '&' equality_expression  */
+#line 690 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_bitand, yyvsp[0]); }
+#line 4018 "ansi_c_y.tab.cpp"
+    break;
+
+  case 93: /* exclusive_or_expression: exclusive_or_expression '^' and_expression  */
+#line 696 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_bitxor, yyvsp[0]); }
+#line 4024 "ansi_c_y.tab.cpp"
+    break;
+
+  case 95: /* inclusive_or_expression: inclusive_or_expression '|' exclusive_or_expression  */
+#line 702 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_bitor, yyvsp[0]); }
+#line 4030 "ansi_c_y.tab.cpp"
+    break;
+
+  case 97: /* logical_and_expression: logical_and_expression "&&" inclusive_or_expression  */
+#line 708 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_and, yyvsp[0]); }
+#line 4036 "ansi_c_y.tab.cpp"
+    break;
+
+  case 99: /* logical_or_expression: logical_or_expression "||" logical_and_expression  */
+#line 714 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_or, yyvsp[0]); }
+#line 4042 "ansi_c_y.tab.cpp"
+    break;
+
+  case 101: /* logical_implication_expression: logical_or_expression "==>" logical_implication_expression  */
+#line 723 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_implies, yyvsp[0]); }
+#line 4048 "ansi_c_y.tab.cpp"
+    break;
+
+  case 103: /* logical_equivalence_expression: logical_equivalence_expression "<==>" logical_implication_expression  */
+#line 732 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_equal, yyvsp[0]); }
+#line 4054 "ansi_c_y.tab.cpp"
+    break;
+
+  case 105: /* conditional_expression: logical_equivalence_expression '?' comma_expression ':' conditional_expression  */
+#line 738 "parser.y"
+        { yyval=yyvsp[-3];
+          stack(yyval).id(ID_if);
+          mto(yyval, yyvsp[-4]);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 4065 "ansi_c_y.tab.cpp"
+    break;
+
+  case 106: /* conditional_expression: logical_equivalence_expression '?' ':' conditional_expression  */
+#line 745 "parser.y"
+        { yyval=yyvsp[-2];
+          stack(yyval).id(ID_side_effect);
+          stack(yyval).set(ID_statement, ID_gcc_conditional_expression);
+          mto(yyval, yyvsp[-3]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 4076 "ansi_c_y.tab.cpp"
+    break;
+
+  case 108: /* assignment_expression: cast_expression '=' assignment_expression  */
+#line 756 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign); }
+#line 4082 "ansi_c_y.tab.cpp"
+    break;
+
+  case 109: /* assignment_expression: cast_expression "*=" assignment_expression  */
+#line 758 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_mult); }
+#line 4088 "ansi_c_y.tab.cpp"
+    break;
+
+  case 110: /* assignment_expression: cast_expression "/=" assignment_expression  */
+#line 760 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_div); }
+#line 4094 "ansi_c_y.tab.cpp"
+    break;
+
+  case 111: /* assignment_expression: cast_expression "%=" assignment_expression  */
+#line 762 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_mod); }
+#line 4100 "ansi_c_y.tab.cpp"
+    break;
+
+  case 112: /* assignment_expression: cast_expression "+=" assignment_expression  */
+#line 764 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_plus); }
+#line 4106 "ansi_c_y.tab.cpp"
+    break;
+
+  case 113: /* assignment_expression: cast_expression "-=" assignment_expression  */
+#line 766 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_minus); }
+#line 4112 "ansi_c_y.tab.cpp"
+    break;
+
+  case 114: /* assignment_expression: cast_expression "<<=" assignment_expression  */
+#line 768 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_shl); }
+#line 4118 "ansi_c_y.tab.cpp"
+    break;
+
+  case 115: /* assignment_expression: cast_expression ">>=" assignment_expression  */
+#line 770 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_shr); }
+#line 4124 "ansi_c_y.tab.cpp"
+    break;
+
+  case 116: /* assignment_expression: cast_expression "&=" assignment_expression  */
+#line 772 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_bitand); }
+#line 4130 "ansi_c_y.tab.cpp"
+    break;
+
+  case 117: /* assignment_expression: cast_expression "^=" assignment_expression  */
+#line 774 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_bitxor); }
+#line 4136 "ansi_c_y.tab.cpp"
+    break;
+
+  case 118: /* assignment_expression: cast_expression "|=" assignment_expression  */
+#line 776 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_side_effect, yyvsp[0]); stack(yyval).set(ID_statement, ID_assign_bitor); }
+#line 4142 "ansi_c_y.tab.cpp"
+    break;
+
+  case 120: /* comma_expression: comma_expression ',' assignment_expression  */
+#line 782 "parser.y"
+        { binary(yyval, yyvsp[-2], yyvsp[-1], ID_comma, yyvsp[0]); }
+#line 4148 "ansi_c_y.tab.cpp"
+    break;
+
+  case 122: /* comma_expression_opt: %empty  */
+#line 791 "parser.y"
+        { init(yyval); stack(yyval).make_nil(); }
+#line 4154 "ansi_c_y.tab.cpp"
+    break;
+
+  case 124: /* declaration: declaration_specifier ';'  */
+#line 799 "parser.y"
+        {
+          // type only, no declarator!
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+        }
+#line 4164 "ansi_c_y.tab.cpp"
+    break;
+
+  case 125: /* declaration: type_specifier ';'  */
+#line 805 "parser.y"
+        {
+          // type only, no identifier!
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+        }
+#line 4174 "ansi_c_y.tab.cpp"
+    break;
+
+  case 129: /* static_assert_declaration: "_Static_assert" '(' assignment_expression ',' assignment_expression ')'  */
+#line 817 "parser.y"
+        {
+          yyval=yyvsp[-5];
+          set(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_static_assert(true);
+          mto(yyval, yyvsp[-3]);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 4186 "ansi_c_y.tab.cpp"
+    break;
+
+  case 130: /* @1: %empty  */
+#line 828 "parser.y"
+          {
+            init(yyval, ID_declaration);
+            stack(yyval).type().swap(stack(yyvsp[-1]));
+            PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          }
+#line 4196 "ansi_c_y.tab.cpp"
+    break;
+
+  case 131: /* default_declaring_list: declaration_qualifier_list identifier_declarator @1 initializer_opt  */
+#line 834 "parser.y"
+        {
+          // patch on the initializer
+          yyval=yyvsp[-1];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4206 "ansi_c_y.tab.cpp"
+    break;
+
+  case 132: /* @2: %empty  */
+#line 840 "parser.y"
+          {
+            init(yyval, ID_declaration);
+            stack(yyval).type().swap(stack(yyvsp[-1]));
+            PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          }
+#line 4216 "ansi_c_y.tab.cpp"
+    break;
+
+  case 133: /* default_declaring_list: type_qualifier_list identifier_declarator @2 initializer_opt  */
+#line 846 "parser.y"
+        {
+          // patch on the initializer
+          yyval=yyvsp[-1];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4226 "ansi_c_y.tab.cpp"
+    break;
+
+  case 134: /* $@3: %empty  */
+#line 852 "parser.y"
+          {
+            // just add the declarator
+            PARSER.add_declarator(stack(yyvsp[-2]), stack(yyvsp[0]));
+            // Needs to be done before initializer, as we want to see that identifier
+            // already there!
+          }
+#line 4237 "ansi_c_y.tab.cpp"
+    break;
+
+  case 135: /* default_declaring_list: default_declaring_list ',' identifier_declarator $@3 initializer_opt  */
+#line 859 "parser.y"
+        {
+          // patch on the initializer
+          yyval=yyvsp[-4];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4247 "ansi_c_y.tab.cpp"
+    break;
+
+  case 136: /* post_declarator_attribute: "__asm__ (with parentheses)" volatile_or_goto_opt '(' gcc_asm_commands ')'  */
+#line 868 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          stack(yyval).id(ID_asm);
+          stack(yyval).set(ID_flavor, ID_gcc);
+          stack(yyval).operands().swap(stack(yyvsp[-1]).operands());
+        }
+#line 4258 "ansi_c_y.tab.cpp"
+    break;
+
+  case 138: /* post_declarator_attributes: post_declarator_attributes post_declarator_attribute  */
+#line 879 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4266 "ansi_c_y.tab.cpp"
+    break;
+
+  case 140: /* post_declarator_attributes_opt: %empty  */
+#line 887 "parser.y"
+        {
+          init(yyval);
+        }
+#line 4274 "ansi_c_y.tab.cpp"
+    break;
+
+  case 142: /* @4: %empty  */
+#line 896 "parser.y"
+          {
+            yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]); // type attribute
+            
+            // the symbol has to be visible during initialization
+            init(yyval, ID_declaration);
+            stack(yyval).type().swap(stack(yyvsp[-2]));
+            PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+          }
+#line 4287 "ansi_c_y.tab.cpp"
+    break;
+
+  case 143: /* declaring_list: declaration_specifier declarator post_declarator_attributes_opt @4 initializer_opt  */
+#line 905 "parser.y"
+        {
+          // add the initializer
+          yyval=yyvsp[-1];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4297 "ansi_c_y.tab.cpp"
+    break;
+
+  case 144: /* @5: %empty  */
+#line 912 "parser.y"
+          {
+            yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]);
+            
+            // the symbol has to be visible during initialization
+            init(yyval, ID_declaration);
+            stack(yyval).type().swap(stack(yyvsp[-2]));
+            PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+          }
+#line 4310 "ansi_c_y.tab.cpp"
+    break;
+
+  case 145: /* declaring_list: type_specifier declarator post_declarator_attributes_opt @5 initializer_opt  */
+#line 921 "parser.y"
+        {
+          // add the initializer
+          yyval=yyvsp[-1];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4320 "ansi_c_y.tab.cpp"
+    break;
+
+  case 146: /* declaring_list: "__auto_type" declarator post_declarator_attributes_opt '=' initializer  */
+#line 928 "parser.y"
+        {
+          // handled as typeof(initializer)
+          stack(yyvsp[-4]).id(ID_typeof);
+          stack(yyvsp[-4]).copy_to_operands(stack(yyvsp[0]));
+
+          yyvsp[-3]=merge(yyvsp[-2], yyvsp[-3]);
+
+          // the symbol has to be visible during initialization
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-4]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-3]));
+          // add the initializer
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4339 "ansi_c_y.tab.cpp"
+    break;
+
+  case 147: /* $@6: %empty  */
+#line 944 "parser.y"
+          {
+            // type attribute goes into declarator
+            yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]);
+            PARSER.add_declarator(stack(yyvsp[-3]), stack(yyvsp[-1]));
+          }
+#line 4349 "ansi_c_y.tab.cpp"
+    break;
+
+  case 148: /* declaring_list: declaring_list ',' declarator post_declarator_attributes_opt $@6 initializer_opt  */
+#line 950 "parser.y"
+        {
+          // add in the initializer
+          yyval=yyvsp[-5];
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 4359 "ansi_c_y.tab.cpp"
+    break;
+
+  case 160: /* declaration_qualifier_list: type_qualifier_list storage_class  */
+#line 976 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4367 "ansi_c_y.tab.cpp"
+    break;
+
+  case 162: /* declaration_qualifier_list: declaration_qualifier_list gcc_type_attribute  */
+#line 981 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4375 "ansi_c_y.tab.cpp"
+    break;
+
+  case 163: /* declaration_qualifier_list: declaration_qualifier_list declaration_qualifier  */
+#line 985 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4383 "ansi_c_y.tab.cpp"
+    break;
+
+  case 165: /* type_qualifier_list: type_qualifier_list type_qualifier  */
+#line 993 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4391 "ansi_c_y.tab.cpp"
+    break;
+
+  case 166: /* type_qualifier_list: type_qualifier_list gcc_type_attribute  */
+#line 1000 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4399 "ansi_c_y.tab.cpp"
+    break;
+
+  case 168: /* attribute_type_qualifier_list: type_qualifier_list attribute_or_type_qualifier  */
+#line 1008 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4407 "ansi_c_y.tab.cpp"
+    break;
+
+  case 171: /* type_qualifier: "_Atomic"  */
+#line 1019 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_atomic); }
+#line 4413 "ansi_c_y.tab.cpp"
+    break;
+
+  case 172: /* type_qualifier: "const"  */
+#line 1020 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_const); }
+#line 4419 "ansi_c_y.tab.cpp"
+    break;
+
+  case 173: /* type_qualifier: "restrict"  */
+#line 1021 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_restrict); }
+#line 4425 "ansi_c_y.tab.cpp"
+    break;
+
+  case 174: /* type_qualifier: "volatile"  */
+#line 1022 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_volatile); }
+#line 4431 "ansi_c_y.tab.cpp"
+    break;
+
+  case 175: /* type_qualifier: "__CPROVER_atomic"  */
+#line 1023 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_cprover_atomic); }
+#line 4437 "ansi_c_y.tab.cpp"
+    break;
+
+  case 176: /* type_qualifier: "__ptr32"  */
+#line 1024 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_ptr32); }
+#line 4443 "ansi_c_y.tab.cpp"
+    break;
+
+  case 177: /* type_qualifier: "__ptr64"  */
+#line 1025 "parser.y"
+                                    { yyval=yyvsp[0]; set(yyval, ID_ptr64); }
+#line 4449 "ansi_c_y.tab.cpp"
+    break;
+
+  case 178: /* type_qualifier: "__based" '(' comma_expression ')'  */
+#line 1026 "parser.y"
+                                                 { yyval=yyvsp[-3]; set(yyval, ID_msc_based); mto(yyval, yyvsp[-1]); }
+#line 4455 "ansi_c_y.tab.cpp"
+    break;
+
+  case 180: /* alignas_specifier: "_Alignas" '(' comma_expression ')'  */
+#line 1032 "parser.y"
+        { yyval = yyvsp[-3];
+          stack(yyval).id(ID_aligned);
+          stack(yyval).set(ID_size, stack(yyvsp[-1]));
+        }
+#line 4464 "ansi_c_y.tab.cpp"
+    break;
+
+  case 181: /* alignas_specifier: "_Alignas" '(' type_name ')'  */
+#line 1037 "parser.y"
+        { yyval = yyvsp[-3];
+          stack(yyval).id(ID_aligned);
+          stack(yyvsp[-1]).set(ID_type_arg, stack(yyvsp[-1]));
+        }
+#line 4473 "ansi_c_y.tab.cpp"
+    break;
+
+  case 188: /* attribute_type_qualifier_storage_class_list: attribute_type_qualifier_storage_class_list attribute_or_type_qualifier_or_storage_class  */
+#line 1057 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4481 "ansi_c_y.tab.cpp"
+    break;
+
+  case 189: /* basic_declaration_specifier: declaration_qualifier_list basic_type_name gcc_type_attribute_opt  */
+#line 1064 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4489 "ansi_c_y.tab.cpp"
+    break;
+
+  case 190: /* basic_declaration_specifier: basic_type_specifier storage_class gcc_type_attribute_opt  */
+#line 1068 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4497 "ansi_c_y.tab.cpp"
+    break;
+
+  case 191: /* basic_declaration_specifier: basic_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 1072 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4505 "ansi_c_y.tab.cpp"
+    break;
+
+  case 192: /* basic_declaration_specifier: basic_declaration_specifier basic_type_name gcc_type_attribute_opt  */
+#line 1076 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4513 "ansi_c_y.tab.cpp"
+    break;
+
+  case 193: /* basic_type_specifier: basic_type_name gcc_type_attribute_opt  */
+#line 1083 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]); // type attribute
+        }
+#line 4521 "ansi_c_y.tab.cpp"
+    break;
+
+  case 194: /* basic_type_specifier: type_qualifier_list basic_type_name gcc_type_attribute_opt  */
+#line 1087 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4529 "ansi_c_y.tab.cpp"
+    break;
+
+  case 195: /* basic_type_specifier: basic_type_specifier type_qualifier  */
+#line 1091 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4537 "ansi_c_y.tab.cpp"
+    break;
+
+  case 196: /* basic_type_specifier: basic_type_specifier basic_type_name gcc_type_attribute_opt  */
+#line 1095 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4545 "ansi_c_y.tab.cpp"
+    break;
+
+  case 197: /* sue_declaration_specifier: declaration_qualifier_list elaborated_type_name  */
+#line 1103 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4553 "ansi_c_y.tab.cpp"
+    break;
+
+  case 198: /* sue_declaration_specifier: sue_type_specifier storage_class  */
+#line 1107 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4561 "ansi_c_y.tab.cpp"
+    break;
+
+  case 199: /* sue_declaration_specifier: sue_declaration_specifier declaration_qualifier  */
+#line 1111 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4569 "ansi_c_y.tab.cpp"
+    break;
+
+  case 201: /* sue_type_specifier: type_qualifier_list elaborated_type_name  */
+#line 1120 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4577 "ansi_c_y.tab.cpp"
+    break;
+
+  case 202: /* sue_type_specifier: sue_type_specifier type_qualifier  */
+#line 1124 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4585 "ansi_c_y.tab.cpp"
+    break;
+
+  case 203: /* typedef_declaration_specifier: typedef_type_specifier storage_class gcc_type_attribute_opt  */
+#line 1131 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4593 "ansi_c_y.tab.cpp"
+    break;
+
+  case 204: /* typedef_declaration_specifier: declaration_qualifier_list typedef_name gcc_type_attribute_opt  */
+#line 1135 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4601 "ansi_c_y.tab.cpp"
+    break;
+
+  case 205: /* typedef_declaration_specifier: typedef_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 1139 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4609 "ansi_c_y.tab.cpp"
+    break;
+
+  case 206: /* typeof_declaration_specifier: typeof_type_specifier storage_class gcc_type_attribute_opt  */
+#line 1146 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4617 "ansi_c_y.tab.cpp"
+    break;
+
+  case 207: /* typeof_declaration_specifier: declaration_qualifier_list typeof_specifier gcc_type_attribute_opt  */
+#line 1150 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4625 "ansi_c_y.tab.cpp"
+    break;
+
+  case 208: /* typeof_declaration_specifier: typeof_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 1154 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4633 "ansi_c_y.tab.cpp"
+    break;
+
+  case 209: /* atomic_declaration_specifier: atomic_type_specifier storage_class gcc_type_attribute_opt  */
+#line 1161 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4641 "ansi_c_y.tab.cpp"
+    break;
+
+  case 210: /* atomic_declaration_specifier: declaration_qualifier_list atomic_specifier gcc_type_attribute_opt  */
+#line 1165 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4649 "ansi_c_y.tab.cpp"
+    break;
+
+  case 211: /* atomic_declaration_specifier: atomic_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 1169 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4657 "ansi_c_y.tab.cpp"
+    break;
+
+  case 212: /* typedef_type_specifier: typedef_name gcc_type_attribute_opt  */
+#line 1176 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4665 "ansi_c_y.tab.cpp"
+    break;
+
+  case 213: /* typedef_type_specifier: type_qualifier_list typedef_name gcc_type_attribute_opt  */
+#line 1180 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4673 "ansi_c_y.tab.cpp"
+    break;
+
+  case 214: /* typedef_type_specifier: typedef_type_specifier type_qualifier gcc_type_attribute_opt  */
+#line 1184 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4681 "ansi_c_y.tab.cpp"
+    break;
+
+  case 215: /* typeof_specifier: "typeof" '(' comma_expression ')'  */
+#line 1191 "parser.y"
+        { yyval = yyvsp[-3];
+          stack(yyval).id(ID_typeof);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 4690 "ansi_c_y.tab.cpp"
+    break;
+
+  case 216: /* typeof_specifier: "typeof" '(' type_name ')'  */
+#line 1196 "parser.y"
+        { yyval = yyvsp[-3];
+          stack(yyval).id(ID_typeof);
+          stack(yyval).set(ID_type_arg, stack(yyvsp[-1]));
+        }
+#line 4699 "ansi_c_y.tab.cpp"
+    break;
+
+  case 218: /* typeof_type_specifier: type_qualifier_list typeof_specifier  */
+#line 1205 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4707 "ansi_c_y.tab.cpp"
+    break;
+
+  case 219: /* typeof_type_specifier: type_qualifier_list typeof_specifier type_qualifier_list  */
+#line 1209 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4715 "ansi_c_y.tab.cpp"
+    break;
+
+  case 220: /* typeof_type_specifier: typeof_specifier type_qualifier_list  */
+#line 1213 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4723 "ansi_c_y.tab.cpp"
+    break;
+
+  case 221: /* atomic_specifier: "_Atomic()" '(' type_name ')'  */
+#line 1220 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          stack(yyval).id(ID_atomic_type_specifier);
+          stack_type(yyval).subtype()=stack_type(yyvsp[-1]);
+        }
+#line 4733 "ansi_c_y.tab.cpp"
+    break;
+
+  case 223: /* atomic_type_specifier: type_qualifier_list atomic_specifier  */
+#line 1230 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4741 "ansi_c_y.tab.cpp"
+    break;
+
+  case 224: /* atomic_type_specifier: type_qualifier_list atomic_specifier type_qualifier_list  */
+#line 1234 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 4749 "ansi_c_y.tab.cpp"
+    break;
+
+  case 225: /* atomic_type_specifier: atomic_specifier type_qualifier_list  */
+#line 1238 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 4757 "ansi_c_y.tab.cpp"
+    break;
+
+  case 226: /* msc_decl_identifier: TOK_IDENTIFIER  */
+#line 1245 "parser.y"
+        {
+          stack(yyval).id(stack(yyval).get(ID_identifier));
+        }
+#line 4765 "ansi_c_y.tab.cpp"
+    break;
+
+  case 227: /* msc_decl_identifier: TOK_TYPEDEFNAME  */
+#line 1249 "parser.y"
+        {
+          stack(yyval).id(stack(yyval).get(ID_identifier));
+        }
+#line 4773 "ansi_c_y.tab.cpp"
+    break;
+
+  case 228: /* msc_decl_identifier: "restrict"  */
+#line 1253 "parser.y"
+        {
+          stack(yyval).id(ID_restrict);
+        }
+#line 4781 "ansi_c_y.tab.cpp"
+    break;
+
+  case 230: /* msc_decl_modifier: msc_decl_identifier '(' TOK_STRING ')'  */
+#line 1261 "parser.y"
+        {
+          yyval=yyvsp[-3]; mto(yyval, yyvsp[-1]);
+        }
+#line 4789 "ansi_c_y.tab.cpp"
+    break;
+
+  case 231: /* msc_decl_modifier: msc_decl_identifier '(' TOK_INTEGER ')'  */
+#line 1265 "parser.y"
+        {
+          yyval=yyvsp[-3]; mto(yyval, yyvsp[-1]);
+        }
+#line 4797 "ansi_c_y.tab.cpp"
+    break;
+
+  case 232: /* msc_decl_modifier: msc_decl_identifier '(' msc_decl_identifier '=' msc_decl_identifier ')'  */
+#line 1269 "parser.y"
+        {
+          yyval=yyvsp[-5]; mto(yyval, yyvsp[-3]); mto(yyval, yyvsp[-1]);
+        }
+#line 4805 "ansi_c_y.tab.cpp"
+    break;
+
+  case 233: /* msc_decl_modifier: msc_decl_identifier '(' msc_decl_identifier '=' msc_decl_identifier ',' msc_decl_identifier '=' msc_decl_identifier ')'  */
+#line 1273 "parser.y"
+        {
+          yyval=yyvsp[-9]; mto(yyval, yyvsp[-7]); mto(yyval, yyvsp[-5]); mto(yyval, yyvsp[-3]); mto(yyval, yyvsp[-1]);
+        }
+#line 4813 "ansi_c_y.tab.cpp"
+    break;
+
+  case 234: /* msc_decl_modifier: ','  */
+#line 1276 "parser.y"
+              { init(yyval, ID_nil); }
+#line 4819 "ansi_c_y.tab.cpp"
+    break;
+
+  case 235: /* msc_declspec_seq: msc_decl_modifier  */
+#line 1281 "parser.y"
+        {
+          init(yyval); mto(yyval, yyvsp[0]);
+        }
+#line 4827 "ansi_c_y.tab.cpp"
+    break;
+
+  case 236: /* msc_declspec_seq: msc_declspec_seq msc_decl_modifier  */
+#line 1285 "parser.y"
+        {
+          yyval=yyvsp[-1]; mto(yyval, yyvsp[0]);
+        }
+#line 4835 "ansi_c_y.tab.cpp"
+    break;
+
+  case 237: /* msc_declspec: "__declspec" '(' msc_declspec_seq ')'  */
+#line 1292 "parser.y"
+        {
+          yyval=yyvsp[-3]; set(yyval, ID_msc_declspec);
+          stack(yyval).operands().swap(stack(yyvsp[-1]).operands());
+        }
+#line 4844 "ansi_c_y.tab.cpp"
+    break;
+
+  case 238: /* msc_declspec: "__declspec" '(' ')'  */
+#line 1297 "parser.y"
+        {
+          yyval=yyvsp[-2]; set(yyval, ID_msc_declspec);
+        }
+#line 4852 "ansi_c_y.tab.cpp"
+    break;
+
+  case 239: /* msc_declspec_opt: %empty  */
+#line 1304 "parser.y"
+        {
+          init(yyval, ID_nil);
+        }
+#line 4860 "ansi_c_y.tab.cpp"
+    break;
+
+  case 241: /* storage_class: "typedef"  */
+#line 1311 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_typedef); }
+#line 4866 "ansi_c_y.tab.cpp"
+    break;
+
+  case 242: /* storage_class: "extern"  */
+#line 1312 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_extern); }
+#line 4872 "ansi_c_y.tab.cpp"
+    break;
+
+  case 243: /* storage_class: "static"  */
+#line 1313 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_static); }
+#line 4878 "ansi_c_y.tab.cpp"
+    break;
+
+  case 244: /* storage_class: "auto"  */
+#line 1314 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_auto); }
+#line 4884 "ansi_c_y.tab.cpp"
+    break;
+
+  case 245: /* storage_class: "register"  */
+#line 1315 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_register); }
+#line 4890 "ansi_c_y.tab.cpp"
+    break;
+
+  case 246: /* storage_class: "inline"  */
+#line 1316 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_inline); }
+#line 4896 "ansi_c_y.tab.cpp"
+    break;
+
+  case 247: /* storage_class: "_Thread_local"  */
+#line 1317 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_thread_local); }
+#line 4902 "ansi_c_y.tab.cpp"
+    break;
+
+  case 248: /* storage_class: "__asm__"  */
+#line 1318 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_asm); }
+#line 4908 "ansi_c_y.tab.cpp"
+    break;
+
+  case 249: /* storage_class: msc_declspec  */
+#line 1319 "parser.y"
+                           { yyval=yyvsp[0]; }
+#line 4914 "ansi_c_y.tab.cpp"
+    break;
+
+  case 250: /* basic_type_name: "int"  */
+#line 1323 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_int); }
+#line 4920 "ansi_c_y.tab.cpp"
+    break;
+
+  case 251: /* basic_type_name: "__int8"  */
+#line 1324 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_int8); }
+#line 4926 "ansi_c_y.tab.cpp"
+    break;
+
+  case 252: /* basic_type_name: "__int16"  */
+#line 1325 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_int16); }
+#line 4932 "ansi_c_y.tab.cpp"
+    break;
+
+  case 253: /* basic_type_name: "__int32"  */
+#line 1326 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_int32); }
+#line 4938 "ansi_c_y.tab.cpp"
+    break;
+
+  case 254: /* basic_type_name: "__int64"  */
+#line 1327 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_int64); }
+#line 4944 "ansi_c_y.tab.cpp"
+    break;
+
+  case 255: /* basic_type_name: "char"  */
+#line 1328 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_char); }
+#line 4950 "ansi_c_y.tab.cpp"
+    break;
+
+  case 256: /* basic_type_name: "short"  */
+#line 1329 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_short); }
+#line 4956 "ansi_c_y.tab.cpp"
+    break;
+
+  case 257: /* basic_type_name: "long"  */
+#line 1330 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_long); }
+#line 4962 "ansi_c_y.tab.cpp"
+    break;
+
+  case 258: /* basic_type_name: "float"  */
+#line 1331 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_float); }
+#line 4968 "ansi_c_y.tab.cpp"
+    break;
+
+  case 259: /* basic_type_name: "__float80"  */
+#line 1332 "parser.y"
+                          { yyval=yyvsp[0]; set(yyval, ID_gcc_float80); }
+#line 4974 "ansi_c_y.tab.cpp"
+    break;
+
+  case 260: /* basic_type_name: "__float128"  */
+#line 1333 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_gcc_float128); }
+#line 4980 "ansi_c_y.tab.cpp"
+    break;
+
+  case 261: /* basic_type_name: "__int128"  */
+#line 1334 "parser.y"
+                         { yyval=yyvsp[0]; set(yyval, ID_gcc_int128); }
+#line 4986 "ansi_c_y.tab.cpp"
+    break;
+
+  case 262: /* basic_type_name: "_Decimal32"  */
+#line 1335 "parser.y"
+                            { yyval=yyvsp[0]; set(yyval, ID_gcc_decimal32); }
+#line 4992 "ansi_c_y.tab.cpp"
+    break;
+
+  case 263: /* basic_type_name: "_Decimal64"  */
+#line 1336 "parser.y"
+                            { yyval=yyvsp[0]; set(yyval, ID_gcc_decimal64); }
+#line 4998 "ansi_c_y.tab.cpp"
+    break;
+
+  case 264: /* basic_type_name: "_Decimal128"  */
+#line 1337 "parser.y"
+                             { yyval=yyvsp[0]; set(yyval, ID_gcc_decimal128); }
+#line 5004 "ansi_c_y.tab.cpp"
+    break;
+
+  case 265: /* basic_type_name: "double"  */
+#line 1338 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_double); }
+#line 5010 "ansi_c_y.tab.cpp"
+    break;
+
+  case 266: /* basic_type_name: "signed"  */
+#line 1339 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_signed); }
+#line 5016 "ansi_c_y.tab.cpp"
+    break;
+
+  case 267: /* basic_type_name: "unsigned"  */
+#line 1340 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_unsigned); }
+#line 5022 "ansi_c_y.tab.cpp"
+    break;
+
+  case 268: /* basic_type_name: "void"  */
+#line 1341 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_void); }
+#line 5028 "ansi_c_y.tab.cpp"
+    break;
+
+  case 269: /* basic_type_name: "bool"  */
+#line 1342 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_c_bool); }
+#line 5034 "ansi_c_y.tab.cpp"
+    break;
+
+  case 270: /* basic_type_name: "complex"  */
+#line 1343 "parser.y"
+                       { yyval=yyvsp[0]; set(yyval, ID_complex); }
+#line 5040 "ansi_c_y.tab.cpp"
+    break;
+
+  case 271: /* basic_type_name: "__CPROVER_bitvector" '[' comma_expression ']'  */
+#line 1345 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          set(yyval, ID_custom_bv);
+          stack(yyval).add(ID_size).swap(stack(yyvsp[-1]));
+        }
+#line 5050 "ansi_c_y.tab.cpp"
+    break;
+
+  case 272: /* basic_type_name: "__CPROVER_floatbv" '[' comma_expression ']' '[' comma_expression ']'  */
+#line 1351 "parser.y"
+        {
+          yyval=yyvsp[-6];
+          set(yyval, ID_custom_floatbv);
+          stack(yyval).add(ID_size).swap(stack(yyvsp[-4]));
+          stack(yyval).add(ID_f).swap(stack(yyvsp[-1]));
+        }
+#line 5061 "ansi_c_y.tab.cpp"
+    break;
+
+  case 273: /* basic_type_name: "__CPROVER_fixedbv" '[' comma_expression ']' '[' comma_expression ']'  */
+#line 1358 "parser.y"
+        {
+          yyval=yyvsp[-6];
+          set(yyval, ID_custom_fixedbv);
+          stack(yyval).add(ID_size).swap(stack(yyvsp[-4]));
+          stack(yyval).add(ID_f).swap(stack(yyvsp[-1]));
+        }
+#line 5072 "ansi_c_y.tab.cpp"
+    break;
+
+  case 274: /* basic_type_name: "__CPROVER_bool"  */
+#line 1364 "parser.y"
+                           { yyval=yyvsp[0]; set(yyval, ID_proper_bool); }
+#line 5078 "ansi_c_y.tab.cpp"
+    break;
+
+  case 278: /* array_of_construct: "array_of" '<' type_name '>'  */
+#line 1375 "parser.y"
+        { yyval=yyvsp[-3]; stack_type(yyval).subtype().swap(stack(yyvsp[-2])); }
+#line 5084 "ansi_c_y.tab.cpp"
+    break;
+
+  case 279: /* pragma_packed: %empty  */
+#line 1379 "parser.y"
+        {
+          init(yyval);
+          if(!PARSER.pragma_pack.empty() &&
+             PARSER.pragma_pack.back().is_one())
+            set(yyval, ID_packed);
+        }
+#line 5095 "ansi_c_y.tab.cpp"
+    break;
+
+  case 280: /* $@7: %empty  */
+#line 1391 "parser.y"
+          {
+            // an anon struct/union with body
+          }
+#line 5103 "ansi_c_y.tab.cpp"
+    break;
+
+  case 281: /* aggregate_name: aggregate_key gcc_type_attribute_opt msc_declspec_opt $@7 '{' member_declaration_list_opt '}' gcc_type_attribute_opt pragma_packed  */
+#line 1397 "parser.y"
+        {
+          // save the members
+          stack(yyvsp[-8]).add(ID_components).get_sub().swap(
+            (irept::subt &)stack(yyvsp[-3]).operands());
+
+          // throw in the gcc attributes
+          yyval=merge(yyvsp[-8], merge(yyvsp[-7], merge(yyvsp[-1], yyvsp[0])));
+        }
+#line 5116 "ansi_c_y.tab.cpp"
+    break;
+
+  case 282: /* $@8: %empty  */
+#line 1409 "parser.y"
+          {
+            // A struct/union with tag and body.
+            PARSER.add_tag_with_body(stack(yyvsp[0]));
+            stack(yyvsp[-3]).set(ID_tag, stack(yyvsp[0]));
+          }
+#line 5126 "ansi_c_y.tab.cpp"
+    break;
+
+  case 283: /* aggregate_name: aggregate_key gcc_type_attribute_opt msc_declspec_opt identifier_or_typedef_name $@8 '{' member_declaration_list_opt '}' gcc_type_attribute_opt pragma_packed  */
+#line 1417 "parser.y"
+        {
+          // save the members
+          stack(yyvsp[-9]).add(ID_components).get_sub().swap(
+            (irept::subt &)stack(yyvsp[-3]).operands());
+
+          // throw in the gcc attributes
+          yyval=merge(yyvsp[-9], merge(yyvsp[-8], merge(yyvsp[-1], yyvsp[0])));
+        }
+#line 5139 "ansi_c_y.tab.cpp"
+    break;
+
+  case 284: /* $@9: %empty  */
+#line 1429 "parser.y"
+          {
+            // a struct/union with tag but without body
+            stack(yyvsp[-3]).set(ID_tag, stack(yyvsp[0]));
+          }
+#line 5148 "ansi_c_y.tab.cpp"
+    break;
+
+  case 285: /* aggregate_name: aggregate_key gcc_type_attribute_opt msc_declspec_opt identifier_or_typedef_name $@9 gcc_type_attribute_opt  */
+#line 1434 "parser.y"
+        {
+          stack(yyvsp[-5]).set(ID_components, ID_nil);
+          // type attributes
+          yyval=merge(yyvsp[-5], merge(yyvsp[-4], yyvsp[0]));
+        }
+#line 5158 "ansi_c_y.tab.cpp"
+    break;
+
+  case 286: /* aggregate_key: "struct"  */
+#line 1443 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_struct); }
+#line 5164 "ansi_c_y.tab.cpp"
+    break;
+
+  case 287: /* aggregate_key: "union"  */
+#line 1445 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_union); }
+#line 5170 "ansi_c_y.tab.cpp"
+    break;
+
+  case 288: /* gcc_attribute_expression_list: assignment_expression  */
+#line 1450 "parser.y"
+        {
+          init(yyval, ID_expression_list);
+          mto(yyval, yyvsp[0]);
+        }
+#line 5179 "ansi_c_y.tab.cpp"
+    break;
+
+  case 289: /* gcc_attribute_expression_list: gcc_attribute_expression_list ',' assignment_expression  */
+#line 1455 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 5188 "ansi_c_y.tab.cpp"
+    break;
+
+  case 290: /* gcc_attribute_expression_list_opt: %empty  */
+#line 1463 "parser.y"
+        {
+          init(yyval, ID_expression_list);
+        }
+#line 5196 "ansi_c_y.tab.cpp"
+    break;
+
+  case 292: /* gcc_attribute: %empty  */
+#line 1471 "parser.y"
+        {
+          init(yyval);
+        }
+#line 5204 "ansi_c_y.tab.cpp"
+    break;
+
+  case 293: /* gcc_attribute: "const"  */
+#line 1475 "parser.y"
+        {
+          yyval=yyvsp[0];
+          stack(yyval).id(ID_gcc_attribute);
+          stack(yyval).set(ID_identifier, ID_const);
+        }
+#line 5214 "ansi_c_y.tab.cpp"
+    break;
+
+  case 294: /* gcc_attribute: identifier  */
+#line 1481 "parser.y"
+        {
+          yyval=yyvsp[0];
+          stack(yyval).id(ID_gcc_attribute);
+        }
+#line 5223 "ansi_c_y.tab.cpp"
+    break;
+
+  case 295: /* gcc_attribute: identifier '(' gcc_attribute_expression_list_opt ')'  */
+#line 1486 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          stack(yyval).id(ID_gcc_attribute);
+          stack(yyval).operands().swap(stack(yyvsp[-1]).operands());
+        }
+#line 5233 "ansi_c_y.tab.cpp"
+    break;
+
+  case 297: /* gcc_attribute_list: gcc_attribute_list ',' gcc_attribute  */
+#line 1496 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], yyvsp[-1]);
+        }
+#line 5241 "ansi_c_y.tab.cpp"
+    break;
+
+  case 298: /* gcc_attribute_specifier: "__attribute__" '(' '(' gcc_attribute_list ')' ')'  */
+#line 1503 "parser.y"
+        { yyval=yyvsp[-2]; }
+#line 5247 "ansi_c_y.tab.cpp"
+    break;
+
+  case 299: /* gcc_type_attribute_opt: %empty  */
+#line 1508 "parser.y"
+        {
+          init(yyval);
+        }
+#line 5255 "ansi_c_y.tab.cpp"
+    break;
+
+  case 302: /* gcc_type_attribute_list: gcc_type_attribute_list gcc_type_attribute  */
+#line 1517 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+        }
+#line 5263 "ansi_c_y.tab.cpp"
+    break;
+
+  case 303: /* gcc_type_attribute: "packed" ")"  */
+#line 1524 "parser.y"
+        { yyval=yyvsp[-1]; set(yyval, ID_packed); }
+#line 5269 "ansi_c_y.tab.cpp"
+    break;
+
+  case 304: /* gcc_type_attribute: "transparent_union" ")"  */
+#line 1526 "parser.y"
+        { yyval=yyvsp[-1]; set(yyval, ID_transparent_union); }
+#line 5275 "ansi_c_y.tab.cpp"
+    break;
+
+  case 305: /* gcc_type_attribute: "vector_size" '(' comma_expression ')' ")"  */
+#line 1528 "parser.y"
+        { yyval=yyvsp[-4]; set(yyval, ID_vector); stack(yyval).add(ID_size)=stack(yyvsp[-2]); }
+#line 5281 "ansi_c_y.tab.cpp"
+    break;
+
+  case 306: /* gcc_type_attribute: "aligned" ")"  */
+#line 1530 "parser.y"
+        { yyval=yyvsp[-1]; set(yyval, ID_aligned); }
+#line 5287 "ansi_c_y.tab.cpp"
+    break;
+
+  case 307: /* gcc_type_attribute: "aligned" '(' comma_expression ')' ")"  */
+#line 1532 "parser.y"
+        { yyval=yyvsp[-4]; set(yyval, ID_aligned); stack(yyval).set(ID_size, stack(yyvsp[-2])); }
+#line 5293 "ansi_c_y.tab.cpp"
+    break;
+
+  case 308: /* gcc_type_attribute: "mode" '(' identifier ')' ")"  */
+#line 1534 "parser.y"
+        { yyval=yyvsp[-4]; set(yyval, ID_gcc_attribute_mode); stack(yyval).set(ID_size, stack(yyvsp[-2]).get(ID_identifier)); }
+#line 5299 "ansi_c_y.tab.cpp"
+    break;
+
+  case 309: /* gcc_type_attribute: "__gnu_inline__" ")"  */
+#line 1536 "parser.y"
+        { yyval=yyvsp[-1]; set(yyval, ID_static); }
+#line 5305 "ansi_c_y.tab.cpp"
+    break;
+
+  case 310: /* gcc_type_attribute: "_Noreturn"  */
+#line 1538 "parser.y"
+        { yyval=yyvsp[0]; set(yyval, ID_noreturn); }
+#line 5311 "ansi_c_y.tab.cpp"
+    break;
+
+  case 312: /* member_declaration_list_opt: %empty  */
+#line 1544 "parser.y"
+        {
+          init(yyval, ID_declaration_list);
+        }
+#line 5319 "ansi_c_y.tab.cpp"
+    break;
+
+  case 314: /* member_declaration_list: member_declaration  */
+#line 1552 "parser.y"
+        {
+          init(yyval, ID_declaration_list);
+          mto(yyval, yyvsp[0]);
+        }
+#line 5328 "ansi_c_y.tab.cpp"
+    break;
+
+  case 315: /* member_declaration_list: member_declaration_list member_declaration  */
+#line 1557 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          mto(yyval, yyvsp[0]);
+        }
+#line 5337 "ansi_c_y.tab.cpp"
+    break;
+
+  case 318: /* member_declaration: ';'  */
+#line 1567 "parser.y"
+        {
+          init(yyval, ID_declaration);
+        }
+#line 5345 "ansi_c_y.tab.cpp"
+    break;
+
+  case 320: /* member_default_declaring_list: gcc_type_attribute_opt type_qualifier_list member_identifier_declarator  */
+#line 1580 "parser.y"
+        {
+          yyvsp[-1]=merge(yyvsp[-1], yyvsp[-2]);
+
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_member(true);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5358 "ansi_c_y.tab.cpp"
+    break;
+
+  case 321: /* member_default_declaring_list: member_default_declaring_list ',' member_identifier_declarator  */
+#line 1589 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5367 "ansi_c_y.tab.cpp"
+    break;
+
+  case 322: /* member_declaring_list: gcc_type_attribute_opt type_specifier member_declarator  */
+#line 1599 "parser.y"
+        {
+          if(!PARSER.pragma_pack.empty() &&
+             !PARSER.pragma_pack.back().is_zero())
+            stack(yyvsp[-1]).set(ID_C_alignment, PARSER.pragma_pack.back());
+
+          yyvsp[-1]=merge(yyvsp[-1], yyvsp[-2]);
+
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_member(true);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5384 "ansi_c_y.tab.cpp"
+    break;
+
+  case 323: /* member_declaring_list: member_declaring_list ',' member_declarator  */
+#line 1612 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5393 "ansi_c_y.tab.cpp"
+    break;
+
+  case 324: /* member_declarator: declarator bit_field_size_opt gcc_type_attribute_opt  */
+#line 1620 "parser.y"
+        {
+          yyval=yyvsp[-2];
+
+          if(stack(yyvsp[-1]).is_not_nil())
+            make_subtype(yyval, yyvsp[-1]);
+
+          if(stack(yyvsp[0]).is_not_nil()) // type attribute
+            yyval=merge(yyvsp[0], yyval);
+        }
+#line 5407 "ansi_c_y.tab.cpp"
+    break;
+
+  case 325: /* member_declarator: %empty  */
+#line 1630 "parser.y"
+        {
+          init(yyval, ID_abstract);
+        }
+#line 5415 "ansi_c_y.tab.cpp"
+    break;
+
+  case 326: /* member_declarator: bit_field_size gcc_type_attribute_opt  */
+#line 1634 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack_type(yyval).subtype()=typet(ID_abstract);
+
+          if(stack(yyvsp[0]).is_not_nil()) // type attribute
+            yyval=merge(yyvsp[0], yyval);
+        }
+#line 5427 "ansi_c_y.tab.cpp"
+    break;
+
+  case 327: /* member_identifier_declarator: identifier_declarator bit_field_size_opt gcc_type_attribute_opt  */
+#line 1645 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          if(stack(yyvsp[-1]).is_not_nil())
+            make_subtype(yyval, yyvsp[-1]);
+          
+          if(stack(yyvsp[0]).is_not_nil()) // type attribute
+            yyval=merge(yyvsp[0], yyval);
+        }
+#line 5440 "ansi_c_y.tab.cpp"
+    break;
+
+  case 328: /* member_identifier_declarator: bit_field_size gcc_type_attribute_opt  */
+#line 1654 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack_type(yyval).subtype()=typet(ID_abstract);
+
+          if(stack(yyvsp[0]).is_not_nil()) // type attribute
+            yyval=merge(yyvsp[0], yyval);
+        }
+#line 5452 "ansi_c_y.tab.cpp"
+    break;
+
+  case 329: /* bit_field_size_opt: %empty  */
+#line 1665 "parser.y"
+        {
+          init(yyval, ID_nil);
+        }
+#line 5460 "ansi_c_y.tab.cpp"
+    break;
+
+  case 331: /* bit_field_size: ':' constant_expression  */
+#line 1673 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          set(yyval, ID_c_bit_field);
+          stack_type(yyval).set(ID_size, stack(yyvsp[0]));
+          stack_type(yyval).subtype().id(ID_abstract);
+        }
+#line 5471 "ansi_c_y.tab.cpp"
+    break;
+
+  case 332: /* $@10: %empty  */
+#line 1684 "parser.y"
+          {
+            // an anon enum
+          }
+#line 5479 "ansi_c_y.tab.cpp"
+    break;
+
+  case 333: /* enum_name: enum_key gcc_type_attribute_opt $@10 '{' enumerator_list_opt '}' gcc_type_attribute_opt  */
+#line 1689 "parser.y"
+        {
+          stack(yyvsp[-6]).operands().swap(stack(yyvsp[-2]).operands());
+          yyval=merge(yyvsp[-6], merge(yyvsp[-5], yyvsp[0])); // throw in the gcc attributes
+        }
+#line 5488 "ansi_c_y.tab.cpp"
+    break;
+
+  case 334: /* $@11: %empty  */
+#line 1696 "parser.y"
+          {
+            // an enum with tag
+            stack(yyvsp[-2]).set(ID_tag, stack(yyvsp[0]));
+          }
+#line 5497 "ansi_c_y.tab.cpp"
+    break;
+
+  case 335: /* enum_name: enum_key gcc_type_attribute_opt identifier_or_typedef_name $@11 '{' enumerator_list_opt '}' gcc_type_attribute_opt  */
+#line 1702 "parser.y"
+        {
+          stack(yyvsp[-7]).operands().swap(stack(yyvsp[-2]).operands());
+          yyval=merge(yyvsp[-7], merge(yyvsp[-6], yyvsp[0])); // throw in the gcc attributes
+        }
+#line 5506 "ansi_c_y.tab.cpp"
+    break;
+
+  case 336: /* enum_name: enum_key gcc_type_attribute_opt identifier_or_typedef_name gcc_type_attribute_opt  */
+#line 1710 "parser.y"
+        {
+          stack(yyvsp[-3]).id(ID_c_enum_tag); // tag only
+          stack(yyvsp[-3]).set(ID_tag, stack(yyvsp[-1]));
+          yyval=merge(yyvsp[-3], merge(yyvsp[-2], yyvsp[0])); // throw in the gcc attributes
+        }
+#line 5516 "ansi_c_y.tab.cpp"
+    break;
+
+  case 337: /* enum_key: "enum"  */
+#line 1718 "parser.y"
+        {
+          yyval=yyvsp[0];
+          set(yyval, ID_c_enum);
+        }
+#line 5525 "ansi_c_y.tab.cpp"
+    break;
+
+  case 338: /* enumerator_list_opt: %empty  */
+#line 1726 "parser.y"
+        {
+          init(yyval, ID_declaration_list);
+        }
+#line 5533 "ansi_c_y.tab.cpp"
+    break;
+
+  case 340: /* enumerator_list: enumerator_declaration  */
+#line 1734 "parser.y"
+        {
+          init(yyval, ID_declaration_list);
+          mto(yyval, yyvsp[0]);
+        }
+#line 5542 "ansi_c_y.tab.cpp"
+    break;
+
+  case 341: /* enumerator_list: enumerator_list ',' enumerator_declaration  */
+#line 1739 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 5551 "ansi_c_y.tab.cpp"
+    break;
+
+  case 342: /* enumerator_list: enumerator_list ','  */
+#line 1744 "parser.y"
+        {
+          yyval=yyvsp[-1];
+        }
+#line 5559 "ansi_c_y.tab.cpp"
+    break;
+
+  case 343: /* enumerator_declaration: identifier_or_typedef_name gcc_type_attribute_opt enumerator_value_opt  */
+#line 1751 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_enum_constant(true);
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-2]));
+          to_ansi_c_declaration(stack(yyval)).add_initializer(stack(yyvsp[0]));
+        }
+#line 5570 "ansi_c_y.tab.cpp"
+    break;
+
+  case 344: /* enumerator_value_opt: %empty  */
+#line 1761 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).make_nil();
+        }
+#line 5579 "ansi_c_y.tab.cpp"
+    break;
+
+  case 345: /* enumerator_value_opt: '=' constant_expression  */
+#line 1766 "parser.y"
+        {
+          yyval=yyvsp[0];
+        }
+#line 5587 "ansi_c_y.tab.cpp"
+    break;
+
+  case 347: /* parameter_type_list: parameter_list ',' "..."  */
+#line 1774 "parser.y"
+        {
+          typet tmp(ID_ellipsis);
+          yyval=yyvsp[-2];
+          stack_type(yyval).move_to_subtypes(tmp);
+        }
+#line 5597 "ansi_c_y.tab.cpp"
+    break;
+
+  case 348: /* KnR_parameter_list: KnR_parameter  */
+#line 1783 "parser.y"
+        {
+          init(yyval, ID_parameters);
+          mts(yyval, yyvsp[0]);
+        }
+#line 5606 "ansi_c_y.tab.cpp"
+    break;
+
+  case 349: /* KnR_parameter_list: KnR_parameter_list ',' KnR_parameter  */
+#line 1788 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mts(yyval, yyvsp[0]);
+        }
+#line 5615 "ansi_c_y.tab.cpp"
+    break;
+
+  case 350: /* KnR_parameter: identifier  */
+#line 1795 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type()=typet(ID_KnR);
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5625 "ansi_c_y.tab.cpp"
+    break;
+
+  case 351: /* parameter_list: parameter_declaration  */
+#line 1804 "parser.y"
+        {
+          init(yyval, ID_parameters);
+          mts(yyval, yyvsp[0]);
+        }
+#line 5634 "ansi_c_y.tab.cpp"
+    break;
+
+  case 352: /* parameter_list: parameter_list ',' parameter_declaration  */
+#line 1809 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mts(yyval, yyvsp[0]);
+        }
+#line 5643 "ansi_c_y.tab.cpp"
+    break;
+
+  case 353: /* parameter_declaration: declaration_specifier  */
+#line 1817 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[0]));
+          exprt declarator=exprt(ID_abstract);
+          PARSER.add_declarator(stack(yyval), declarator);
+        }
+#line 5655 "ansi_c_y.tab.cpp"
+    break;
+
+  case 354: /* parameter_declaration: declaration_specifier parameter_abstract_declarator  */
+#line 1825 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5666 "ansi_c_y.tab.cpp"
+    break;
+
+  case 355: /* parameter_declaration: declaration_specifier identifier_declarator gcc_type_attribute_opt  */
+#line 1832 "parser.y"
+        {
+          yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]); // type attribute to go into declarator
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-2]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+        }
+#line 5678 "ansi_c_y.tab.cpp"
+    break;
+
+  case 356: /* parameter_declaration: declaration_specifier parameter_typedef_declarator  */
+#line 1840 "parser.y"
+        {
+          // the second tree is really the declarator -- not part
+          // of the type!
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5691 "ansi_c_y.tab.cpp"
+    break;
+
+  case 357: /* parameter_declaration: declaration_qualifier_list  */
+#line 1849 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[0]));
+          exprt declarator=exprt(ID_abstract);
+          PARSER.add_declarator(stack(yyval), declarator);
+        }
+#line 5703 "ansi_c_y.tab.cpp"
+    break;
+
+  case 358: /* parameter_declaration: declaration_qualifier_list parameter_abstract_declarator  */
+#line 1857 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5714 "ansi_c_y.tab.cpp"
+    break;
+
+  case 359: /* parameter_declaration: declaration_qualifier_list identifier_declarator gcc_type_attribute_opt  */
+#line 1864 "parser.y"
+        {
+          yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]); // type attribute to go into declarator
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-2]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+        }
+#line 5726 "ansi_c_y.tab.cpp"
+    break;
+
+  case 360: /* parameter_declaration: type_specifier  */
+#line 1872 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[0]));
+          exprt declarator=exprt(ID_abstract);
+          PARSER.add_declarator(stack(yyval), declarator);
+        }
+#line 5738 "ansi_c_y.tab.cpp"
+    break;
+
+  case 361: /* parameter_declaration: type_specifier parameter_abstract_declarator  */
+#line 1880 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5749 "ansi_c_y.tab.cpp"
+    break;
+
+  case 362: /* parameter_declaration: type_specifier identifier_declarator gcc_type_attribute_opt  */
+#line 1887 "parser.y"
+        {
+          yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]); // type attribute to go into declarator
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-2]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+        }
+#line 5761 "ansi_c_y.tab.cpp"
+    break;
+
+  case 363: /* parameter_declaration: type_specifier parameter_typedef_declarator  */
+#line 1895 "parser.y"
+        {
+          // the second tree is really the declarator -- not part of the type!
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5773 "ansi_c_y.tab.cpp"
+    break;
+
+  case 364: /* parameter_declaration: type_qualifier_list  */
+#line 1903 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[0]));
+          exprt declarator=exprt(ID_abstract);
+          PARSER.add_declarator(stack(yyval), declarator);
+        }
+#line 5785 "ansi_c_y.tab.cpp"
+    break;
+
+  case 365: /* parameter_declaration: type_qualifier_list parameter_abstract_declarator  */
+#line 1911 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 5796 "ansi_c_y.tab.cpp"
+    break;
+
+  case 366: /* parameter_declaration: type_qualifier_list identifier_declarator gcc_type_attribute_opt  */
+#line 1918 "parser.y"
+        {
+          yyvsp[-1]=merge(yyvsp[0], yyvsp[-1]); // type attribute to go into declarator
+          init(yyval, ID_declaration);
+          to_ansi_c_declaration(stack(yyval)).set_is_parameter(true);
+          to_ansi_c_declaration(stack(yyval)).type().swap(stack(yyvsp[-2]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[-1]));
+        }
+#line 5808 "ansi_c_y.tab.cpp"
+    break;
+
+  case 369: /* type_name: gcc_type_attribute_opt type_specifier  */
+#line 1934 "parser.y"
+        {
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 5816 "ansi_c_y.tab.cpp"
+    break;
+
+  case 370: /* type_name: gcc_type_attribute_opt type_specifier abstract_declarator  */
+#line 1938 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[-2]);
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 5825 "ansi_c_y.tab.cpp"
+    break;
+
+  case 371: /* type_name: gcc_type_attribute_opt type_qualifier_list  */
+#line 1943 "parser.y"
+        {
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 5833 "ansi_c_y.tab.cpp"
+    break;
+
+  case 372: /* type_name: gcc_type_attribute_opt type_qualifier_list abstract_declarator  */
+#line 1947 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[-2]);
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 5842 "ansi_c_y.tab.cpp"
+    break;
+
+  case 373: /* initializer_opt: %empty  */
+#line 1955 "parser.y"
+        {
+          newstack(yyval);
+          stack(yyval).make_nil();
+        }
+#line 5851 "ansi_c_y.tab.cpp"
+    break;
+
+  case 374: /* initializer_opt: '=' initializer  */
+#line 1960 "parser.y"
+        { yyval = yyvsp[0]; }
+#line 5857 "ansi_c_y.tab.cpp"
+    break;
+
+  case 376: /* initializer: '{' initializer_list_opt '}'  */
+#line 1971 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          set(yyval, ID_initializer_list);
+          stack(yyval).operands().swap(stack(yyvsp[-1]).operands());
+        }
+#line 5867 "ansi_c_y.tab.cpp"
+    break;
+
+  case 377: /* initializer: '{' initializer_list ',' '}'  */
+#line 1977 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          set(yyval, ID_initializer_list);
+          stack(yyval).operands().swap(stack(yyvsp[-2]).operands());
+        }
+#line 5877 "ansi_c_y.tab.cpp"
+    break;
+
+  case 378: /* initializer_list: designated_initializer  */
+#line 1986 "parser.y"
+        {
+          yyval=yyvsp[0];
+          exprt tmp;
+          tmp.swap(stack(yyval));
+          stack(yyval).clear();
+          stack(yyval).move_to_operands(tmp);
+        }
+#line 5889 "ansi_c_y.tab.cpp"
+    break;
+
+  case 379: /* initializer_list: initializer_list ',' designated_initializer  */
+#line 1994 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 5898 "ansi_c_y.tab.cpp"
+    break;
+
+  case 381: /* initializer_list_opt: %empty  */
+#line 2003 "parser.y"
+        {
+          init(yyval);
+          set(yyval, ID_initializer_list);
+          stack(yyval).operands().clear();
+        }
+#line 5908 "ansi_c_y.tab.cpp"
+    break;
+
+  case 383: /* designated_initializer: designator '=' initializer  */
+#line 2013 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          stack(yyval).id(ID_designated_initializer);
+          stack(yyval).add(ID_designator).swap(stack(yyvsp[-2]));
+          mto(yyval, yyvsp[0]);
+        }
+#line 5919 "ansi_c_y.tab.cpp"
+    break;
+
+  case 384: /* designated_initializer: designator initializer  */
+#line 2021 "parser.y"
+        {
+          init(yyval, ID_designated_initializer);
+          stack(yyval).add(ID_designator).swap(stack(yyvsp[-1]));
+          mto(yyval, yyvsp[0]);
+        }
+#line 5929 "ansi_c_y.tab.cpp"
+    break;
+
+  case 385: /* designated_initializer: member_name ':' initializer  */
+#line 2027 "parser.y"
+        {
+          // yet another GCC speciality
+          yyval=yyvsp[-1];
+          stack(yyval).id(ID_designated_initializer);
+          exprt designator;
+          exprt member(ID_member);
+          member.set(ID_component_name, stack(yyvsp[-2]).get(ID_C_base_name));
+          designator.move_to_operands(member);
+          stack(yyval).add(ID_designator).swap(designator);
+          mto(yyval, yyvsp[0]);
+        }
+#line 5945 "ansi_c_y.tab.cpp"
+    break;
+
+  case 386: /* designator: '.' member_name  */
+#line 2042 "parser.y"
+        {
+          init(yyval);
+          stack(yyvsp[-1]).id(ID_member);
+          stack(yyvsp[-1]).set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+          mto(yyval, yyvsp[-1]);
+        }
+#line 5956 "ansi_c_y.tab.cpp"
+    break;
+
+  case 387: /* designator: '[' comma_expression ']'  */
+#line 2049 "parser.y"
+        {
+          init(yyval);
+          stack(yyvsp[-2]).id(ID_index);
+          mto(yyvsp[-2], yyvsp[-1]);
+          mto(yyval, yyvsp[-2]);
+        }
+#line 5967 "ansi_c_y.tab.cpp"
+    break;
+
+  case 388: /* designator: '[' comma_expression "..." comma_expression ']'  */
+#line 2056 "parser.y"
+        {
+          // TODO
+          init(yyval);
+          stack(yyvsp[-4]).id(ID_index);
+          mto(yyvsp[-4], yyvsp[-3]);
+          mto(yyval, yyvsp[-4]);
+        }
+#line 5979 "ansi_c_y.tab.cpp"
+    break;
+
+  case 389: /* designator: designator '[' comma_expression ']'  */
+#line 2064 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          stack(yyvsp[-2]).id(ID_index);
+          mto(yyvsp[-2], yyvsp[-1]);
+          mto(yyval, yyvsp[-2]);
+        }
+#line 5990 "ansi_c_y.tab.cpp"
+    break;
+
+  case 390: /* designator: designator '[' comma_expression "..." comma_expression ']'  */
+#line 2071 "parser.y"
+        {
+          // TODO
+          yyval=yyvsp[-5];
+          stack(yyvsp[-4]).id(ID_index);
+          mto(yyvsp[-4], yyvsp[-3]);
+          mto(yyval, yyvsp[-4]);
+        }
+#line 6002 "ansi_c_y.tab.cpp"
+    break;
+
+  case 391: /* designator: designator '.' member_name  */
+#line 2079 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          stack(yyvsp[-1]).id(ID_member);
+          stack(yyvsp[-1]).set(ID_component_name, stack(yyvsp[0]).get(ID_C_base_name));
+          mto(yyval, yyvsp[-1]);
+        }
+#line 6013 "ansi_c_y.tab.cpp"
+    break;
+
+  case 404: /* declaration_statement: declaration  */
+#line 2106 "parser.y"
+        {
+          init(yyval);
+          statement(yyval, ID_decl);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6023 "ansi_c_y.tab.cpp"
+    break;
+
+  case 405: /* labeled_statement: identifier_or_typedef_name ':' statement  */
+#line 2115 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          statement(yyval, ID_label);
+          irep_idt identifier=PARSER.lookup_label(stack(yyvsp[-2]).get(ID_C_base_name));
+          stack(yyval).set(ID_label, identifier);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6035 "ansi_c_y.tab.cpp"
+    break;
+
+  case 406: /* labeled_statement: "case" constant_expression ':' statement  */
+#line 2123 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          statement(yyval, ID_switch_case);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6046 "ansi_c_y.tab.cpp"
+    break;
+
+  case 407: /* labeled_statement: "case" constant_expression "..." constant_expression ':' statement  */
+#line 2130 "parser.y"
+        {
+          // this is a GCC extension
+          yyval=yyvsp[-5];
+          statement(yyval, ID_gcc_switch_case_range);
+          mto(yyval, yyvsp[-4]);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6059 "ansi_c_y.tab.cpp"
+    break;
+
+  case 408: /* labeled_statement: "default" ':' statement  */
+#line 2139 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          statement(yyval, ID_switch_case);
+          stack(yyval).operands().push_back(nil_exprt());
+          mto(yyval, yyvsp[0]);
+          stack(yyval).set(ID_default, true);
+        }
+#line 6071 "ansi_c_y.tab.cpp"
+    break;
+
+  case 409: /* compound_statement: compound_scope '{' '}'  */
+#line 2150 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          statement(yyval, ID_block);
+          stack(yyval).set(ID_C_end_location, stack(yyvsp[0]).source_location());
+          PARSER.pop_scope();
+        }
+#line 6082 "ansi_c_y.tab.cpp"
+    break;
+
+  case 410: /* compound_statement: compound_scope '{' statement_list '}'  */
+#line 2157 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          statement(yyval, ID_block);
+          stack(yyval).set(ID_C_end_location, stack(yyvsp[0]).source_location());
+          stack(yyval).operands().swap(stack(yyvsp[-1]).operands());
+          PARSER.pop_scope();
+        }
+#line 6094 "ansi_c_y.tab.cpp"
+    break;
+
+  case 411: /* compound_statement: compound_scope '{' TOK_ASM_STRING '}'  */
+#line 2165 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          statement(yyval, ID_asm);
+          stack(yyval).set(ID_C_end_location, stack(yyvsp[0]).source_location());
+          mto(yyval, yyvsp[-1]);
+          PARSER.pop_scope();
+        }
+#line 6106 "ansi_c_y.tab.cpp"
+    break;
+
+  case 412: /* compound_scope: %empty  */
+#line 2176 "parser.y"
+        {
+          unsigned prefix=++PARSER.current_scope().compound_counter;
+          PARSER.new_scope(i2string(prefix)+"::");
+        }
+#line 6115 "ansi_c_y.tab.cpp"
+    break;
+
+  case 413: /* statement_list: statement  */
+#line 2184 "parser.y"
+        {
+          init(yyval);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6124 "ansi_c_y.tab.cpp"
+    break;
+
+  case 414: /* statement_list: statement_list statement  */
+#line 2189 "parser.y"
+        {
+          mto(yyval, yyvsp[0]);
+        }
+#line 6132 "ansi_c_y.tab.cpp"
+    break;
+
+  case 415: /* expression_statement: comma_expression_opt ';'  */
+#line 2196 "parser.y"
+        {
+          yyval=yyvsp[0];
+
+          if(stack(yyvsp[-1]).is_nil())
+            statement(yyval, ID_skip);
+          else
+          {
+            statement(yyval, ID_expression);
+            mto(yyval, yyvsp[-1]);
+          }
+        }
+#line 6148 "ansi_c_y.tab.cpp"
+    break;
+
+  case 416: /* selection_statement: "if" '(' comma_expression ')' statement  */
+#line 2211 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          statement(yyval, ID_ifthenelse);
+          stack(yyval).operands().reserve(3);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+          stack(yyval).copy_to_operands(nil_exprt());
+        }
+#line 6161 "ansi_c_y.tab.cpp"
+    break;
+
+  case 417: /* selection_statement: "if" '(' comma_expression ')' statement "else" statement  */
+#line 2220 "parser.y"
+        {
+          yyval=yyvsp[-6];
+          statement(yyval, ID_ifthenelse);
+          stack(yyval).operands().reserve(3);
+          mto(yyval, yyvsp[-4]);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6174 "ansi_c_y.tab.cpp"
+    break;
+
+  case 418: /* selection_statement: "switch" '(' comma_expression ')' statement  */
+#line 2229 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          statement(yyval, ID_switch);
+          stack(yyval).operands().reserve(2);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6186 "ansi_c_y.tab.cpp"
+    break;
+
+  case 421: /* iteration_statement: "while" '(' comma_expression_opt ')' statement  */
+#line 2245 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          statement(yyval, ID_while);
+          stack(yyval).operands().reserve(2);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6198 "ansi_c_y.tab.cpp"
+    break;
+
+  case 422: /* iteration_statement: "do" statement "while" '(' comma_expression ')' ';'  */
+#line 2253 "parser.y"
+        {
+          yyval=yyvsp[-6];
+          statement(yyval, ID_dowhile);
+          stack(yyval).operands().reserve(2);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[-5]);
+        }
+#line 6210 "ansi_c_y.tab.cpp"
+    break;
+
+  case 423: /* $@12: %empty  */
+#line 2261 "parser.y"
+          {
+            // In C99 and upwards, for(;;) has a scope
+            if(PARSER.for_has_scope)
+            {
+              unsigned prefix=++PARSER.current_scope().compound_counter;
+              PARSER.new_scope(i2string(prefix)+"::");
+            }
+          }
+#line 6223 "ansi_c_y.tab.cpp"
+    break;
+
+  case 424: /* iteration_statement: "for" $@12 '(' declaration_or_expression_statement comma_expression_opt ';' comma_expression_opt ')' statement  */
+#line 2273 "parser.y"
+        {
+          yyval=yyvsp[-8];
+          statement(yyval, ID_for);
+          stack(yyval).operands().reserve(4);
+          mto(yyval, yyvsp[-5]);
+          mto(yyval, yyvsp[-4]);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+
+          if(PARSER.for_has_scope)
+            PARSER.pop_scope(); // remove the C99 for-scope
+        }
+#line 6240 "ansi_c_y.tab.cpp"
+    break;
+
+  case 425: /* jump_statement: "goto" comma_expression ';'  */
+#line 2289 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          if(stack(yyvsp[-1]).id()==ID_symbol)
+          {
+            statement(yyval, ID_goto);
+            irep_idt identifier=PARSER.lookup_label(stack(yyvsp[-1]).get(ID_C_base_name));
+            stack(yyval).set(ID_destination, identifier);
+          }
+          else
+          {
+            // this is a gcc extension.
+            // the original grammar uses identifier_or_typedef_name
+            statement(yyval, ID_gcc_computed_goto);
+            mto(yyval, yyvsp[-1]);
+          }
+        }
+#line 6261 "ansi_c_y.tab.cpp"
+    break;
+
+  case 426: /* jump_statement: "goto" typedef_name ';'  */
+#line 2306 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          statement(yyval, ID_goto);
+          irep_idt identifier=PARSER.lookup_label(stack(yyvsp[-1]).get(ID_C_base_name));
+          stack(yyval).set(ID_destination, identifier);
+        }
+#line 6272 "ansi_c_y.tab.cpp"
+    break;
+
+  case 427: /* jump_statement: "continue" ';'  */
+#line 2313 "parser.y"
+        { yyval=yyvsp[-1]; statement(yyval, ID_continue); }
+#line 6278 "ansi_c_y.tab.cpp"
+    break;
+
+  case 428: /* jump_statement: "break" ';'  */
+#line 2315 "parser.y"
+        { yyval=yyvsp[-1]; statement(yyval, ID_break); }
+#line 6284 "ansi_c_y.tab.cpp"
+    break;
+
+  case 429: /* jump_statement: "return" ';'  */
+#line 2317 "parser.y"
+        { yyval=yyvsp[-1]; statement(yyval, ID_return); }
+#line 6290 "ansi_c_y.tab.cpp"
+    break;
+
+  case 430: /* jump_statement: "return" comma_expression ';'  */
+#line 2319 "parser.y"
+        { yyval=yyvsp[-2]; statement(yyval, ID_return); mto(yyval, yyvsp[-1]); }
+#line 6296 "ansi_c_y.tab.cpp"
+    break;
+
+  case 431: /* gcc_local_label_statement: "__label__" gcc_local_label_list ';'  */
+#line 2324 "parser.y"
+        { 
+          yyval=yyvsp[-2];
+          statement(yyval, ID_gcc_local_label);
+          
+          // put these into the scope
+          forall_operands(it, stack(yyvsp[-1]))
+          {
+            // labels have a separate name space
+            irep_idt base_name=it->get(ID_identifier);
+            irep_idt id="label-"+id2string(base_name);
+            ansi_c_parsert::identifiert &i=PARSER.current_scope().name_map[id];
+            i.id_class=ANSI_C_LOCAL_LABEL;
+            i.base_name=base_name;
+          }
+
+          stack(yyval).add(ID_label).get_sub().swap((irept::subt&)stack(yyvsp[-1]).operands());
+        }
+#line 6318 "ansi_c_y.tab.cpp"
+    break;
+
+  case 432: /* gcc_local_label_list: gcc_local_label  */
+#line 2345 "parser.y"
+        {
+          init(yyval);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6327 "ansi_c_y.tab.cpp"
+    break;
+
+  case 433: /* gcc_local_label_list: gcc_local_label_list ',' gcc_local_label  */
+#line 2350 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6336 "ansi_c_y.tab.cpp"
+    break;
+
+  case 435: /* gcc_asm_statement: "__asm__ (with parentheses)" volatile_or_goto_opt '(' gcc_asm_commands ')' ';'  */
+#line 2361 "parser.y"
+        { yyval=yyvsp[-5];
+          statement(yyval, ID_asm);
+          stack(yyval).set(ID_flavor, ID_gcc);
+          stack(yyval).operands().swap(stack(yyvsp[-2]).operands());
+        }
+#line 6346 "ansi_c_y.tab.cpp"
+    break;
+
+  case 436: /* gcc_asm_statement: "__asm__ (with parentheses)" volatile_or_goto_opt '{' TOK_ASM_STRING '}'  */
+#line 2367 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          statement(yyval, ID_asm);
+          stack(yyval).set(ID_flavor, ID_gcc);
+          stack(yyval).operands().resize(5);
+          stack(yyval).op0()=stack(yyvsp[-1]);
+        }
+#line 6358 "ansi_c_y.tab.cpp"
+    break;
+
+  case 437: /* msc_asm_statement: "__asm" '{' TOK_ASM_STRING '}'  */
+#line 2378 "parser.y"
+        { yyval=yyvsp[-3];
+          statement(yyval, ID_asm);
+          stack(yyval).set(ID_flavor, ID_msc);
+          mto(yyval, yyvsp[-1]);
+        }
+#line 6368 "ansi_c_y.tab.cpp"
+    break;
+
+  case 438: /* msc_asm_statement: "__asm" TOK_ASM_STRING  */
+#line 2384 "parser.y"
+        { yyval=yyvsp[-1];
+          statement(yyval, ID_asm);
+          stack(yyval).set(ID_flavor, ID_msc);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6378 "ansi_c_y.tab.cpp"
+    break;
+
+  case 439: /* msc_seh_statement: "__try" compound_statement "__except" '(' comma_expression ')' compound_statement  */
+#line 2394 "parser.y"
+        {
+          yyval=yyvsp[-6];
+          statement(yyval, ID_msc_try_except);
+          mto(yyval, yyvsp[-5]);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6390 "ansi_c_y.tab.cpp"
+    break;
+
+  case 440: /* msc_seh_statement: "__try" compound_statement "__finally" compound_statement  */
+#line 2403 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          statement(yyval, ID_msc_try_finally);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6401 "ansi_c_y.tab.cpp"
+    break;
+
+  case 441: /* msc_seh_statement: "__leave"  */
+#line 2410 "parser.y"
+        {
+          yyval=yyvsp[0];
+          statement(yyval, ID_msc_leave);
+        }
+#line 6410 "ansi_c_y.tab.cpp"
+    break;
+
+  case 442: /* cprover_exception_statement: "__CPROVER_throw" ';'  */
+#line 2418 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          statement(yyval, ID_CPROVER_throw);
+        }
+#line 6419 "ansi_c_y.tab.cpp"
+    break;
+
+  case 443: /* cprover_exception_statement: "__CPROVER_try" compound_statement "__CPROVER_catch" compound_statement  */
+#line 2424 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          statement(yyval, ID_CPROVER_try_catch);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6430 "ansi_c_y.tab.cpp"
+    break;
+
+  case 444: /* cprover_exception_statement: "__CPROVER_try" compound_statement "__CPROVER_finally" compound_statement  */
+#line 2432 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          statement(yyval, ID_CPROVER_try_finally);
+          mto(yyval, yyvsp[-2]);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6441 "ansi_c_y.tab.cpp"
+    break;
+
+  case 450: /* gcc_asm_commands: gcc_asm_assembler_template  */
+#line 2458 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).operands().resize(5);
+          stack(yyval).operands()[0]=stack(yyvsp[0]);
+        }
+#line 6451 "ansi_c_y.tab.cpp"
+    break;
+
+  case 451: /* gcc_asm_commands: gcc_asm_assembler_template gcc_asm_outputs  */
+#line 2464 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).operands().resize(5);
+          stack(yyval).operands()[0]=stack(yyvsp[-1]);
+          stack(yyval).operands()[1]=stack(yyvsp[0]);
+        }
+#line 6462 "ansi_c_y.tab.cpp"
+    break;
+
+  case 452: /* gcc_asm_commands: gcc_asm_assembler_template gcc_asm_outputs gcc_asm_inputs  */
+#line 2471 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).operands().resize(5);
+          stack(yyval).operands()[0]=stack(yyvsp[-2]);
+          stack(yyval).operands()[1]=stack(yyvsp[-1]);
+          stack(yyval).operands()[2]=stack(yyvsp[0]);
+        }
+#line 6474 "ansi_c_y.tab.cpp"
+    break;
+
+  case 453: /* gcc_asm_commands: gcc_asm_assembler_template gcc_asm_outputs gcc_asm_inputs gcc_asm_clobbered_registers  */
+#line 2479 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).operands().resize(5);
+          stack(yyval).operands()[0]=stack(yyvsp[-3]);
+          stack(yyval).operands()[1]=stack(yyvsp[-2]);
+          stack(yyval).operands()[2]=stack(yyvsp[-1]);
+          stack(yyval).operands()[3]=stack(yyvsp[0]);
+        }
+#line 6487 "ansi_c_y.tab.cpp"
+    break;
+
+  case 454: /* gcc_asm_commands: gcc_asm_assembler_template gcc_asm_outputs gcc_asm_inputs gcc_asm_clobbered_registers gcc_asm_labels  */
+#line 2488 "parser.y"
+        {
+          init(yyval);
+          stack(yyval).operands().resize(5);
+          stack(yyval).operands()[0]=stack(yyvsp[-4]);
+          stack(yyval).operands()[1]=stack(yyvsp[-3]);
+          stack(yyval).operands()[2]=stack(yyvsp[-2]);
+          stack(yyval).operands()[3]=stack(yyvsp[-1]);
+          stack(yyval).operands()[4]=stack(yyvsp[0]);
+        }
+#line 6501 "ansi_c_y.tab.cpp"
+    break;
+
+  case 456: /* gcc_asm_outputs: ':' gcc_asm_output_list  */
+#line 2504 "parser.y"
+        {
+          yyval=yyvsp[0];
+        }
+#line 6509 "ansi_c_y.tab.cpp"
+    break;
+
+  case 458: /* gcc_asm_output: string '(' comma_expression ')'  */
+#line 2512 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          stack(yyval).id(ID_gcc_asm_output);
+          stack(yyval).move_to_operands(stack(yyvsp[-3]), stack(yyvsp[-1])); 
+        }
+#line 6519 "ansi_c_y.tab.cpp"
+    break;
+
+  case 459: /* gcc_asm_output: '[' identifier_or_typedef_name ']' string '(' comma_expression ')'  */
+#line 2519 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          stack(yyval).id(ID_gcc_asm_output);
+          stack(yyval).move_to_operands(stack(yyvsp[-3]), stack(yyvsp[-1])); 
+        }
+#line 6529 "ansi_c_y.tab.cpp"
+    break;
+
+  case 460: /* gcc_asm_output_list: gcc_asm_output  */
+#line 2528 "parser.y"
+        {
+          init(yyval, irep_idt());
+          mto(yyval, yyvsp[0]);
+        }
+#line 6538 "ansi_c_y.tab.cpp"
+    break;
+
+  case 461: /* gcc_asm_output_list: gcc_asm_output_list ',' gcc_asm_output  */
+#line 2533 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6547 "ansi_c_y.tab.cpp"
+    break;
+
+  case 462: /* gcc_asm_inputs: ':' gcc_asm_input_list  */
+#line 2541 "parser.y"
+        {
+          yyval=yyvsp[0];
+        }
+#line 6555 "ansi_c_y.tab.cpp"
+    break;
+
+  case 464: /* gcc_asm_input: string '(' comma_expression ')'  */
+#line 2549 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          stack(yyval).id(ID_gcc_asm_input);
+          stack(yyval).move_to_operands(stack(yyvsp[-3]), stack(yyvsp[-1])); 
+        }
+#line 6565 "ansi_c_y.tab.cpp"
+    break;
+
+  case 465: /* gcc_asm_input: '[' identifier_or_typedef_name ']' string '(' comma_expression ')'  */
+#line 2556 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          stack(yyval).id(ID_gcc_asm_input);
+          stack(yyval).move_to_operands(stack(yyvsp[-3]), stack(yyvsp[-1])); 
+        }
+#line 6575 "ansi_c_y.tab.cpp"
+    break;
+
+  case 466: /* gcc_asm_input_list: gcc_asm_input  */
+#line 2565 "parser.y"
+        {
+          init(yyval, irep_idt());
+          mto(yyval, yyvsp[0]);
+        }
+#line 6584 "ansi_c_y.tab.cpp"
+    break;
+
+  case 467: /* gcc_asm_input_list: gcc_asm_input_list ',' gcc_asm_input  */
+#line 2570 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6593 "ansi_c_y.tab.cpp"
+    break;
+
+  case 468: /* gcc_asm_clobbered_registers: ':' gcc_asm_clobbered_registers_list  */
+#line 2578 "parser.y"
+        {
+          yyval=yyvsp[0];
+        }
+#line 6601 "ansi_c_y.tab.cpp"
+    break;
+
+  case 470: /* gcc_asm_clobbered_register: string  */
+#line 2586 "parser.y"
+        {
+          init(yyval, ID_gcc_asm_clobbered_register);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6610 "ansi_c_y.tab.cpp"
+    break;
+
+  case 471: /* gcc_asm_clobbered_registers_list: gcc_asm_clobbered_register  */
+#line 2594 "parser.y"
+        {
+          init(yyval, irep_idt());
+          mto(yyval, yyvsp[0]);
+        }
+#line 6619 "ansi_c_y.tab.cpp"
+    break;
+
+  case 472: /* gcc_asm_clobbered_registers_list: gcc_asm_clobbered_registers_list ',' gcc_asm_clobbered_register  */
+#line 2599 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6628 "ansi_c_y.tab.cpp"
+    break;
+
+  case 473: /* gcc_asm_labels: ':' gcc_asm_labels_list  */
+#line 2607 "parser.y"
+        {
+          yyval=yyvsp[0];
+        }
+#line 6636 "ansi_c_y.tab.cpp"
+    break;
+
+  case 475: /* gcc_asm_labels_list: gcc_asm_label  */
+#line 2615 "parser.y"
+        {
+          init(yyval);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6645 "ansi_c_y.tab.cpp"
+    break;
+
+  case 476: /* gcc_asm_labels_list: gcc_asm_labels_list ',' gcc_asm_label  */
+#line 2620 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6654 "ansi_c_y.tab.cpp"
+    break;
+
+  case 477: /* gcc_asm_label: gcc_local_label  */
+#line 2628 "parser.y"
+        {
+          yyval=yyvsp[0];
+          irep_idt identifier=PARSER.lookup_label(stack(yyval).get(ID_C_base_name));
+          stack(yyval).id(ID_label);
+          stack(yyval).set(ID_identifier, identifier);
+        }
+#line 6665 "ansi_c_y.tab.cpp"
+    break;
+
+  case 482: /* external_definition: function_definition  */
+#line 2647 "parser.y"
+        {
+          // put into global list of items
+          PARSER.copy_item(to_ansi_c_declaration(stack(yyvsp[0])));
+        }
+#line 6674 "ansi_c_y.tab.cpp"
+    break;
+
+  case 483: /* external_definition: declaration  */
+#line 2652 "parser.y"
+        {
+          PARSER.copy_item(to_ansi_c_declaration(stack(yyvsp[0])));
+        }
+#line 6682 "ansi_c_y.tab.cpp"
+    break;
+
+  case 486: /* asm_definition: "__asm__ (with parentheses)" '(' string ')' ';'  */
+#line 2661 "parser.y"
+        {
+          // Not obvious what to do with this.
+        }
+#line 6690 "ansi_c_y.tab.cpp"
+    break;
+
+  case 487: /* function_definition: function_head function_body  */
+#line 2669 "parser.y"
+        {
+          // The head is a declaration with one declarator,
+          // and the body becomes the 'value'.
+          yyval=yyvsp[-1];
+          ansi_c_declarationt &ansi_c_declaration=
+            to_ansi_c_declaration(stack(yyval));
+            
+          assert(ansi_c_declaration.declarators().size()==1);
+          ansi_c_declaration.add_initializer(stack(yyvsp[0]));
+          
+          // Kill the scope that 'function_head' creates.
+          PARSER.pop_scope();
+          
+          // We are no longer in any function.
+          PARSER.set_function(irep_idt());
+        }
+#line 6711 "ansi_c_y.tab.cpp"
+    break;
+
+  case 489: /* KnR_parameter_header_opt: %empty  */
+#line 2693 "parser.y"
+        {
+          init(yyval);
+        }
+#line 6719 "ansi_c_y.tab.cpp"
+    break;
+
+  case 491: /* KnR_parameter_header: KnR_parameter_declaration  */
+#line 2701 "parser.y"
+        {
+          init(yyval, ID_decl_block);
+          mto(yyval, yyvsp[0]);
+        }
+#line 6728 "ansi_c_y.tab.cpp"
+    break;
+
+  case 492: /* KnR_parameter_header: KnR_parameter_header KnR_parameter_declaration  */
+#line 2706 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          mto(yyval, yyvsp[0]);
+        }
+#line 6737 "ansi_c_y.tab.cpp"
+    break;
+
+  case 495: /* KnR_declaration_qualifier_list: type_qualifier storage_class  */
+#line 2720 "parser.y"
+        {
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 6745 "ansi_c_y.tab.cpp"
+    break;
+
+  case 496: /* KnR_declaration_qualifier_list: KnR_declaration_qualifier_list declaration_qualifier  */
+#line 2724 "parser.y"
+        {
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 6753 "ansi_c_y.tab.cpp"
+    break;
+
+  case 497: /* KnR_basic_declaration_specifier: KnR_declaration_qualifier_list basic_type_name gcc_type_attribute_opt  */
+#line 2731 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6761 "ansi_c_y.tab.cpp"
+    break;
+
+  case 498: /* KnR_basic_declaration_specifier: basic_type_specifier storage_class gcc_type_attribute_opt  */
+#line 2735 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6769 "ansi_c_y.tab.cpp"
+    break;
+
+  case 499: /* KnR_basic_declaration_specifier: KnR_basic_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 2739 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6777 "ansi_c_y.tab.cpp"
+    break;
+
+  case 500: /* KnR_basic_declaration_specifier: KnR_basic_declaration_specifier basic_type_name gcc_type_attribute_opt  */
+#line 2743 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6785 "ansi_c_y.tab.cpp"
+    break;
+
+  case 501: /* KnR_typedef_declaration_specifier: typedef_type_specifier storage_class gcc_type_attribute_opt  */
+#line 2751 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6793 "ansi_c_y.tab.cpp"
+    break;
+
+  case 502: /* KnR_typedef_declaration_specifier: KnR_declaration_qualifier_list typedef_name gcc_type_attribute_opt  */
+#line 2755 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6801 "ansi_c_y.tab.cpp"
+    break;
+
+  case 503: /* KnR_typedef_declaration_specifier: KnR_typedef_declaration_specifier declaration_qualifier gcc_type_attribute_opt  */
+#line 2759 "parser.y"
+        {
+          yyval=merge(yyvsp[-2], merge(yyvsp[-1], yyvsp[0]));
+        }
+#line 6809 "ansi_c_y.tab.cpp"
+    break;
+
+  case 504: /* KnR_sue_declaration_specifier: KnR_declaration_qualifier_list aggregate_key identifier_or_typedef_name gcc_type_attribute_opt  */
+#line 2767 "parser.y"
+        {
+          stack(yyvsp[-2]).set(ID_tag, stack(yyvsp[-1]));
+          yyval=merge(yyvsp[-3], merge(yyvsp[-2], yyvsp[0]));
+        }
+#line 6818 "ansi_c_y.tab.cpp"
+    break;
+
+  case 505: /* KnR_sue_declaration_specifier: KnR_declaration_qualifier_list enum_key identifier_or_typedef_name gcc_type_attribute_opt  */
+#line 2772 "parser.y"
+        {
+          stack(yyvsp[-2]).id(ID_c_enum_tag);
+          stack(yyvsp[-2]).set(ID_tag, stack(yyvsp[-1]));
+          yyval=merge(yyvsp[-3], merge(yyvsp[-2], yyvsp[0]));
+        }
+#line 6828 "ansi_c_y.tab.cpp"
+    break;
+
+  case 509: /* KnR_parameter_declaring_list: KnR_declaration_specifier declarator  */
+#line 2788 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 6838 "ansi_c_y.tab.cpp"
+    break;
+
+  case 510: /* KnR_parameter_declaring_list: type_specifier declarator  */
+#line 2794 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 6848 "ansi_c_y.tab.cpp"
+    break;
+
+  case 511: /* KnR_parameter_declaring_list: KnR_parameter_declaring_list ',' declarator  */
+#line 2800 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+        }
+#line 6857 "ansi_c_y.tab.cpp"
+    break;
+
+  case 512: /* function_head: identifier_declarator  */
+#line 2808 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          irept return_type(ID_int);
+          stack(yyval).type().swap(return_type);
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          create_function_scope(yyval);
+        }
+#line 6869 "ansi_c_y.tab.cpp"
+    break;
+
+  case 513: /* function_head: declaration_specifier declarator  */
+#line 2816 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          create_function_scope(yyval);
+        }
+#line 6880 "ansi_c_y.tab.cpp"
+    break;
+
+  case 514: /* function_head: type_specifier declarator  */
+#line 2823 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          create_function_scope(yyval);
+        }
+#line 6891 "ansi_c_y.tab.cpp"
+    break;
+
+  case 515: /* function_head: declaration_qualifier_list identifier_declarator  */
+#line 2830 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          create_function_scope(yyval);
+        }
+#line 6902 "ansi_c_y.tab.cpp"
+    break;
+
+  case 516: /* function_head: type_qualifier_list identifier_declarator  */
+#line 2837 "parser.y"
+        {
+          init(yyval, ID_declaration);
+          stack(yyval).type().swap(stack(yyvsp[-1]));
+          PARSER.add_declarator(stack(yyval), stack(yyvsp[0]));
+          create_function_scope(yyval);
+        }
+#line 6913 "ansi_c_y.tab.cpp"
+    break;
+
+  case 522: /* parameter_typedef_declarator: typedef_name postfixing_abstract_declarator  */
+#line 2858 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 6922 "ansi_c_y.tab.cpp"
+    break;
+
+  case 525: /* clean_typedef_declarator: '*' parameter_typedef_declarator  */
+#line 2868 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 6931 "ansi_c_y.tab.cpp"
+    break;
+
+  case 526: /* clean_typedef_declarator: '*' attribute_type_qualifier_list parameter_typedef_declarator  */
+#line 2873 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+          do_pointer(yyvsp[-2], yyvsp[-1]);
+        }
+#line 6940 "ansi_c_y.tab.cpp"
+    break;
+
+  case 527: /* clean_postfix_typedef_declarator: '(' clean_typedef_declarator ')'  */
+#line 2881 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 6946 "ansi_c_y.tab.cpp"
+    break;
+
+  case 528: /* clean_postfix_typedef_declarator: '(' clean_typedef_declarator ')' postfixing_abstract_declarator  */
+#line 2883 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function ($4) */
+          /* or an array ($4)! */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 6957 "ansi_c_y.tab.cpp"
+    break;
+
+  case 530: /* paren_typedef_declarator: '*' '(' simple_paren_typedef_declarator ')'  */
+#line 2894 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          do_pointer(yyvsp[-3], yyvsp[-1]);
+        }
+#line 6966 "ansi_c_y.tab.cpp"
+    break;
+
+  case 531: /* paren_typedef_declarator: '*' attribute_type_qualifier_list '(' simple_paren_typedef_declarator ')'  */
+#line 2899 "parser.y"
+        {
+          // not sure where the type qualifiers belong
+          yyval=merge(yyvsp[-3], yyvsp[-1]);
+          do_pointer(yyvsp[-4], yyvsp[-3]);
+        }
+#line 6976 "ansi_c_y.tab.cpp"
+    break;
+
+  case 532: /* paren_typedef_declarator: '*' paren_typedef_declarator  */
+#line 2905 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 6985 "ansi_c_y.tab.cpp"
+    break;
+
+  case 533: /* paren_typedef_declarator: '*' attribute_type_qualifier_list paren_typedef_declarator  */
+#line 2910 "parser.y"
+        {
+          yyval=merge(yyvsp[-1], yyvsp[0]);
+          do_pointer(yyvsp[-2], yyvsp[-1]);
+        }
+#line 6994 "ansi_c_y.tab.cpp"
+    break;
+
+  case 534: /* paren_postfix_typedef_declarator: '(' paren_typedef_declarator ')'  */
+#line 2918 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7000 "ansi_c_y.tab.cpp"
+    break;
+
+  case 535: /* paren_postfix_typedef_declarator: '(' simple_paren_typedef_declarator postfixing_abstract_declarator ')'  */
+#line 2920 "parser.y"
+        {        /* note: this is a function ($3) with a typedef name ($2) */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[-1]);
+        }
+#line 7009 "ansi_c_y.tab.cpp"
+    break;
+
+  case 536: /* paren_postfix_typedef_declarator: '(' paren_typedef_declarator ')' postfixing_abstract_declarator  */
+#line 2925 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function ($4) */
+          /* or an array ($4)! */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7020 "ansi_c_y.tab.cpp"
+    break;
+
+  case 538: /* simple_paren_typedef_declarator: '(' simple_paren_typedef_declarator ')'  */
+#line 2936 "parser.y"
+        { yyval=yyvsp[-1]; }
+#line 7026 "ansi_c_y.tab.cpp"
+    break;
+
+  case 542: /* unary_identifier_declarator: '*' identifier_declarator  */
+#line 2947 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 7035 "ansi_c_y.tab.cpp"
+    break;
+
+  case 543: /* unary_identifier_declarator: '^' identifier_declarator  */
+#line 2952 "parser.y"
+        {
+          // This is an Apple extension to C/C++/Objective C.
+          // http://en.wikipedia.org/wiki/Blocks_(C_language_extension)
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 7046 "ansi_c_y.tab.cpp"
+    break;
+
+  case 544: /* unary_identifier_declarator: '*' attribute_type_qualifier_list identifier_declarator  */
+#line 2959 "parser.y"
+        {
+          // the type_qualifier_list is for the pointer,
+          // and not the identifier_declarator
+          stack_type(yyvsp[-2]).id(ID_pointer);
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          yyvsp[-1]=merge(yyvsp[-1], yyvsp[-2]); // dest=$2
+          make_subtype(yyvsp[0], yyvsp[-1]); // dest=$3
+          yyval=yyvsp[0];
+        }
+#line 7060 "ansi_c_y.tab.cpp"
+    break;
+
+  case 545: /* postfix_identifier_declarator: paren_identifier_declarator postfixing_abstract_declarator  */
+#line 2972 "parser.y"
+        {
+          /* note: this is a function or array ($2) with name ($1) */
+          yyval=yyvsp[-1];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7070 "ansi_c_y.tab.cpp"
+    break;
+
+  case 546: /* postfix_identifier_declarator: '(' unary_identifier_declarator ')'  */
+#line 2978 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7076 "ansi_c_y.tab.cpp"
+    break;
+
+  case 547: /* postfix_identifier_declarator: '(' unary_identifier_declarator ')' postfixing_abstract_declarator  */
+#line 2980 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function ($4) */
+          /* or an array ($4)! */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7087 "ansi_c_y.tab.cpp"
+    break;
+
+  case 548: /* paren_identifier_declarator: identifier  */
+#line 2990 "parser.y"
+        {
+          // We remember the last declarator for the benefit
+          // of function argument scoping.
+          PARSER.current_scope().last_declarator=
+            stack(yyvsp[0]).get(ID_identifier);
+        }
+#line 7098 "ansi_c_y.tab.cpp"
+    break;
+
+  case 549: /* paren_identifier_declarator: '(' paren_identifier_declarator ')'  */
+#line 2997 "parser.y"
+        { yyval=yyvsp[-1]; }
+#line 7104 "ansi_c_y.tab.cpp"
+    break;
+
+  case 556: /* postfixing_abstract_declarator: '(' ')' KnR_parameter_header  */
+#line 3017 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          set(yyval, ID_code);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+          stack_type(yyval).add(ID_parameters);
+          stack_type(yyval).set(ID_C_KnR, true);
+        }
+#line 7116 "ansi_c_y.tab.cpp"
+    break;
+
+  case 557: /* $@13: %empty  */
+#line 3025 "parser.y"
+          {
+            // Use last declarator (i.e., function name) to name
+            // the scope.
+            PARSER.new_scope(
+              id2string(PARSER.current_scope().last_declarator)+"::");
+          }
+#line 7127 "ansi_c_y.tab.cpp"
+    break;
+
+  case 558: /* postfixing_abstract_declarator: '(' $@13 KnR_parameter_list ')' KnR_parameter_header_opt  */
+#line 3034 "parser.y"
+        {
+          yyval=yyvsp[-4];
+          set(yyval, ID_code);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+          stack_type(yyval).add(ID_parameters).get_sub().
+            swap((irept::subt &)(stack_type(yyvsp[-2]).subtypes()));
+          PARSER.pop_scope();
+          adjust_KnR_parameters(stack(yyval).add(ID_parameters), stack(yyvsp[0]));
+          stack(yyval).set(ID_C_KnR, true);
+        }
+#line 7142 "ansi_c_y.tab.cpp"
+    break;
+
+  case 560: /* parameter_postfixing_abstract_declarator: '(' ')'  */
+#line 3049 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          set(yyval, ID_code);
+          stack_type(yyval).add(ID_parameters);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7153 "ansi_c_y.tab.cpp"
+    break;
+
+  case 561: /* $@14: %empty  */
+#line 3056 "parser.y"
+          {
+            // Use last declarator (i.e., function name) to name
+            // the scope.
+            PARSER.new_scope(
+              id2string(PARSER.current_scope().last_declarator)+"::");
+          }
+#line 7164 "ansi_c_y.tab.cpp"
+    break;
+
+  case 562: /* parameter_postfixing_abstract_declarator: '(' $@14 parameter_type_list ')'  */
+#line 3064 "parser.y"
+        {
+          yyval=yyvsp[-3];
+          set(yyval, ID_code);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+          stack_type(yyval).add(ID_parameters).get_sub().
+            swap((irept::subt &)(stack_type(yyvsp[-1]).subtypes()));
+          PARSER.pop_scope();
+        }
+#line 7177 "ansi_c_y.tab.cpp"
+    break;
+
+  case 563: /* array_abstract_declarator: '[' ']'  */
+#line 3076 "parser.y"
+        {
+          yyval=yyvsp[-1];
+          set(yyval, ID_array);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+          stack_type(yyval).add(ID_size).make_nil();
+        }
+#line 7188 "ansi_c_y.tab.cpp"
+    break;
+
+  case 564: /* array_abstract_declarator: '[' attribute_type_qualifier_storage_class_list ']'  */
+#line 3083 "parser.y"
+        {
+          // this is C99: e.g., restrict, const, etc
+          // The type qualifier belongs to the array, not the
+          // contents of the array, nor the size.
+          set(yyvsp[-2], ID_array);
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          stack_type(yyvsp[-2]).add(ID_size).make_nil();
+          yyval=merge(yyvsp[-1], yyvsp[-2]);
+        }
+#line 7202 "ansi_c_y.tab.cpp"
+    break;
+
+  case 565: /* array_abstract_declarator: '[' '*' ']'  */
+#line 3093 "parser.y"
+        {
+          // these should be allowed in prototypes only
+          yyval=yyvsp[-2];
+          set(yyval, ID_array);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+          stack_type(yyval).add(ID_size).make_nil();
+        }
+#line 7214 "ansi_c_y.tab.cpp"
+    break;
+
+  case 566: /* array_abstract_declarator: '[' constant_expression ']'  */
+#line 3101 "parser.y"
+        {
+          yyval=yyvsp[-2];
+          set(yyval, ID_array);
+          stack_type(yyval).add(ID_size).swap(stack(yyvsp[-1]));
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7225 "ansi_c_y.tab.cpp"
+    break;
+
+  case 567: /* array_abstract_declarator: '[' attribute_type_qualifier_storage_class_list constant_expression ']'  */
+#line 3108 "parser.y"
+        {
+          // The type qualifier belongs to the array, not the
+          // contents of the array, nor the size.
+          set(yyvsp[-3], ID_array);
+          stack_type(yyvsp[-3]).add(ID_size).swap(stack(yyvsp[-1]));
+          stack_type(yyvsp[-3]).subtype()=typet(ID_abstract);
+          yyval=merge(yyvsp[-2], yyvsp[-3]); // dest=$2
+        }
+#line 7238 "ansi_c_y.tab.cpp"
+    break;
+
+  case 568: /* array_abstract_declarator: array_abstract_declarator '[' constant_expression ']'  */
+#line 3117 "parser.y"
+        {
+          // we need to push this down
+          yyval=yyvsp[-3];
+          set(yyvsp[-2], ID_array);
+          stack_type(yyvsp[-2]).add(ID_size).swap(stack(yyvsp[-1]));
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          make_subtype(yyvsp[-3], yyvsp[-2]);
+        }
+#line 7251 "ansi_c_y.tab.cpp"
+    break;
+
+  case 569: /* array_abstract_declarator: array_abstract_declarator '[' '*' ']'  */
+#line 3126 "parser.y"
+        {
+          // these should be allowed in prototypes only
+          // we need to push this down
+          yyval=yyvsp[-3];
+          set(yyvsp[-2], ID_array);
+          stack_type(yyvsp[-2]).add(ID_size).make_nil();
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          make_subtype(yyvsp[-3], yyvsp[-2]);
+        }
+#line 7265 "ansi_c_y.tab.cpp"
+    break;
+
+  case 570: /* unary_abstract_declarator: '*'  */
+#line 3139 "parser.y"
+        {
+          yyval=yyvsp[0];
+          set(yyval, ID_pointer);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7275 "ansi_c_y.tab.cpp"
+    break;
+
+  case 571: /* unary_abstract_declarator: '*' attribute_type_qualifier_list  */
+#line 3145 "parser.y"
+        {
+          // The type_qualifier_list belongs to the pointer,
+          // not to the (missing) abstract declarator.
+          set(yyvsp[-1], ID_pointer);
+          stack_type(yyvsp[-1]).subtype()=typet(ID_abstract);
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 7287 "ansi_c_y.tab.cpp"
+    break;
+
+  case 572: /* unary_abstract_declarator: '*' abstract_declarator  */
+#line 3153 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 7296 "ansi_c_y.tab.cpp"
+    break;
+
+  case 573: /* unary_abstract_declarator: '*' attribute_type_qualifier_list abstract_declarator  */
+#line 3158 "parser.y"
+        {
+          // The type_qualifier_list belongs to the pointer,
+          // not to the abstract declarator.
+          stack_type(yyvsp[-2]).id(ID_pointer);
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          yyvsp[-1]=merge(yyvsp[-1], yyvsp[-2]); // dest=$2
+          make_subtype(yyvsp[0], yyvsp[-1]); // dest=$3
+          yyval=yyvsp[0];
+        }
+#line 7310 "ansi_c_y.tab.cpp"
+    break;
+
+  case 574: /* unary_abstract_declarator: '^'  */
+#line 3168 "parser.y"
+        {
+          // This is an Apple extension to C/C++/Objective C.
+          // http://en.wikipedia.org/wiki/Blocks_(C_language_extension)
+          yyval=yyvsp[0];
+          set(yyval, ID_block_pointer);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7322 "ansi_c_y.tab.cpp"
+    break;
+
+  case 575: /* parameter_unary_abstract_declarator: '*'  */
+#line 3179 "parser.y"
+        {
+          yyval=yyvsp[0];
+          set(yyval, ID_pointer);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7332 "ansi_c_y.tab.cpp"
+    break;
+
+  case 576: /* parameter_unary_abstract_declarator: '*' attribute_type_qualifier_list  */
+#line 3185 "parser.y"
+        {
+          // The type_qualifier_list belongs to the pointer,
+          // not to the (missing) abstract declarator.
+          set(yyvsp[-1], ID_pointer);
+          stack_type(yyvsp[-1]).subtype()=typet(ID_abstract);
+          yyval=merge(yyvsp[0], yyvsp[-1]);
+        }
+#line 7344 "ansi_c_y.tab.cpp"
+    break;
+
+  case 577: /* parameter_unary_abstract_declarator: '*' parameter_abstract_declarator  */
+#line 3193 "parser.y"
+        {
+          yyval=yyvsp[0];
+          do_pointer(yyvsp[-1], yyvsp[0]);
+        }
+#line 7353 "ansi_c_y.tab.cpp"
+    break;
+
+  case 578: /* parameter_unary_abstract_declarator: '*' attribute_type_qualifier_list parameter_abstract_declarator  */
+#line 3198 "parser.y"
+        {
+          // The type_qualifier_list belongs to the pointer,
+          // not to the (missing) abstract declarator.
+          stack(yyvsp[-2]).id(ID_pointer);
+          stack_type(yyvsp[-2]).subtype()=typet(ID_abstract);
+          yyvsp[-1]=merge(yyvsp[-1], yyvsp[-2]); // dest=$2
+          make_subtype(yyvsp[0], yyvsp[-1]); // dest=$3
+          yyval=yyvsp[0];
+        }
+#line 7367 "ansi_c_y.tab.cpp"
+    break;
+
+  case 579: /* parameter_unary_abstract_declarator: '^'  */
+#line 3208 "parser.y"
+        {
+          // This is an Apple extension to C/C++/Objective C.
+          // http://en.wikipedia.org/wiki/Blocks_(C_language_extension)
+          yyval=yyvsp[0];
+          set(yyval, ID_block_pointer);
+          stack_type(yyval).subtype()=typet(ID_abstract);
+        }
+#line 7379 "ansi_c_y.tab.cpp"
+    break;
+
+  case 580: /* postfix_abstract_declarator: '(' unary_abstract_declarator ')'  */
+#line 3219 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7385 "ansi_c_y.tab.cpp"
+    break;
+
+  case 581: /* postfix_abstract_declarator: '(' postfix_abstract_declarator ')'  */
+#line 3221 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7391 "ansi_c_y.tab.cpp"
+    break;
+
+  case 582: /* postfix_abstract_declarator: '(' postfixing_abstract_declarator ')'  */
+#line 3223 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7397 "ansi_c_y.tab.cpp"
+    break;
+
+  case 583: /* postfix_abstract_declarator: '(' postfix_abstract_declarator ')' postfixing_abstract_declarator  */
+#line 3225 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function or array ($4) */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7407 "ansi_c_y.tab.cpp"
+    break;
+
+  case 584: /* postfix_abstract_declarator: '(' unary_abstract_declarator ')' postfixing_abstract_declarator  */
+#line 3231 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function or array ($4) */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7417 "ansi_c_y.tab.cpp"
+    break;
+
+  case 585: /* parameter_postfix_abstract_declarator: '(' parameter_unary_abstract_declarator ')'  */
+#line 3240 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7423 "ansi_c_y.tab.cpp"
+    break;
+
+  case 586: /* parameter_postfix_abstract_declarator: '(' parameter_postfix_abstract_declarator ')'  */
+#line 3242 "parser.y"
+        { yyval = yyvsp[-1]; }
+#line 7429 "ansi_c_y.tab.cpp"
+    break;
+
+  case 588: /* parameter_postfix_abstract_declarator: '(' parameter_unary_abstract_declarator ')' parameter_postfixing_abstract_declarator  */
+#line 3245 "parser.y"
+        {
+          /* note: this is a pointer ($2) to a function ($4) */
+          yyval=yyvsp[-2];
+          make_subtype(yyval, yyvsp[0]);
+        }
+#line 7439 "ansi_c_y.tab.cpp"
+    break;
+
+
+#line 7443 "ansi_c_y.tab.cpp"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 3252 "parser.y"
+
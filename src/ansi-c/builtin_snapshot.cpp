@@ -0,0 +1,393 @@
+/*******************************************************************\
+
+Module: Snapshot of the Built-in Declarations
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include <util/config.h>
+#include <util/i2string.h>
+#include <util/irep_serialization.h>
+#include <util/string_hash.h>
+
+#include "ansi_c_internal_additions.h"
+#include "ansi_c_parser.h"
+#include "ansi_c_typecheck.h"
+#include "builtin_snapshot.h"
+
+#define BUILTIN_SNAPSHOT_VERSION 1
+
+std::string builtin_snapshot_directory;
+
+/*******************************************************************\
+
+Function: ansi_c_configuration_key
+
+  Inputs:
+
+ Outputs: a string that is the same for two runs iff the
+          configuration is the same as far as the C front-end
+          is concerned
+
+ Purpose: for caching the results of the front-end
+
+\*******************************************************************/
+
+std::string ansi_c_configuration_key()
+{
+  const configt::ansi_ct &c=config.ansi_c;
+  std::ostringstream key;
+
+  key << c.int_width << ' ' << c.long_int_width << ' '
+      << c.bool_width << ' ' << c.char_width << ' '
+      << c.short_int_width << ' ' << c.long_long_int_width << ' '
+      << c.pointer_width << ' ' << c.single_width << ' '
+      << c.double_width << ' ' << c.long_double_width << ' '
+      << c.wchar_t_width << ' '
+      << c.char_is_unsigned << c.wchar_t_is_unsigned
+      << c.use_fixed_for_float << c.for_has_scope
+      << c.single_precision_constant << ' '
+      << int(c.c_standard) << ' ' << int(c.rounding_mode) << ' '
+      << c.alignment << ' ' << c.memory_operand_size << ' '
+      << int(c.endianness) << ' ' << int(c.os) << ' '
+      << c.arch << ' ' << c.NULL_is_zero << ' '
+      << int(c.mode) << ' ' << int(c.preprocessor) << ' '
+      << c.string_abstraction;
+
+  // these change what the system headers give us
+  const std::list<std::string> *lists[]=
+    { &c.defines, &c.undefines, &c.preprocessor_options,
+      &c.include_paths, &c.include_files };
+
+  for(std::size_t i=0; i<sizeof(lists)/sizeof(*lists); i++)
+  {
+    key << '\0';
+    for(std::list<std::string>::const_iterator
+        it=lists[i]->begin();
+        it!=lists[i]->end();
+        it++)
+      key << *it << '\n';
+  }
+
+  return key.str();
+}
+
+/*******************************************************************\
+
+Function: configure_ansi_c_parser
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: set the dialect of the parser from the configuration
+
+\*******************************************************************/
+
+void configure_ansi_c_parser()
+{
+  ansi_c_parser.for_has_scope=config.ansi_c.for_has_scope;
+  ansi_c_parser.cpp98=false; // it's not C++
+  ansi_c_parser.cpp11=false; // it's not C++
+
+  switch(config.ansi_c.mode)
+  {
+  case configt::ansi_ct::flavourt::MODE_CODEWARRIOR_C_CPP:
+    ansi_c_parser.mode=ansi_c_parsert::CW;
+    break;
+   
+  case configt::ansi_ct::flavourt::MODE_VISUAL_STUDIO_C_CPP:
+    ansi_c_parser.mode=ansi_c_parsert::MSC;
+    break;
+    
+  case configt::ansi_ct::flavourt::MODE_ANSI_C_CPP:
+    ansi_c_parser.mode=ansi_c_parsert::ANSI;
+    break;
+    
+  case configt::ansi_ct::flavourt::MODE_GCC_C:
+  case configt::ansi_ct::flavourt::MODE_GCC_CPP:
+    ansi_c_parser.mode=ansi_c_parsert::GCC;
+    break;
+    
+  case configt::ansi_ct::flavourt::MODE_ARM_C_CPP:
+    ansi_c_parser.mode=ansi_c_parsert::ARM;
+    break;
+    
+  default:
+    assert(false);
+  }
+}
+
+/*******************************************************************\
+
+Function: builtin_snapshott::write
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void builtin_snapshott::write(std::ostream &out) const
+{
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt irepconverter(ireps_container);
+
+  write_gb_word(out, BUILTIN_SNAPSHOT_VERSION);
+  write_gb_string(out, key);
+
+  // the global scope of the parser
+  write_gb_word(out, root_scope.compound_counter);
+  write_gb_word(out, root_scope.anon_counter);
+  irepconverter.write_string_ref(out, root_scope.last_declarator);
+  write_gb_word(out, root_scope.name_map.size());
+
+  for(ansi_c_scopet::name_mapt::const_iterator
+      it=root_scope.name_map.begin();
+      it!=root_scope.name_map.end();
+      it++)
+  {
+    irepconverter.write_string_ref(out, it->first);
+    write_gb_word(out, it->second.id_class);
+    irepconverter.write_string_ref(out, it->second.base_name);
+  }
+
+  // the typechecked declarations
+  write_gb_word(out, symbol_table.symbols.size());
+
+  forall_symbols(it, symbol_table.symbols)
+  {
+    irept irep;
+    it->second.to_irep(irep);
+    irepconverter.reference_convert(irep, out);
+  }
+}
+
+/*******************************************************************\
+
+Function: builtin_snapshott::read
+
+  Inputs:
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
+bool builtin_snapshott::read(std::istream &in)
+{
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt irepconverter(ireps_container);
+
+  if(irep_serializationt::read_gb_word(in)!=BUILTIN_SNAPSHOT_VERSION)
+    return true;
+
+  key=id2string(irepconverter.read_gb_string(in));
+
+  root_scope=ansi_c_scopet();
+  root_scope.compound_counter=irep_serializationt::read_gb_word(in);
+  root_scope.anon_counter=irep_serializationt::read_gb_word(in);
+  root_scope.last_declarator=irepconverter.read_string_ref(in);
+
+  std::size_t count=irep_serializationt::read_gb_word(in);
+
+  for(std::size_t i=0; i<count && in; i++)
+  {
+    irep_idt name=irepconverter.read_string_ref(in);
+    ansi_c_identifiert &identifier=root_scope.name_map[name];
+    identifier.id_class=
+      (ansi_c_id_classt)irep_serializationt::read_gb_word(in);
+    identifier.base_name=irepconverter.read_string_ref(in);
+  }
+
+  symbol_table.clear();
+  count=irep_serializationt::read_gb_word(in);
+
+  for(std::size_t i=0; i<count && in; i++)
+  {
+    irept irep;
+    irepconverter.reference_convert(in, irep);
+
+    symbolt symbol;
+    symbol.from_irep(irep);
+    symbol_table.add(symbol);
+  }
+
+  return !in;
+}
+
+/*******************************************************************\
+
+Function: builtin_snapshot_file_name
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static std::string builtin_snapshot_file_name(const std::string &key)
+{
+  // the version is checked when reading
+  std::size_t h=hash_string(key);
+
+  std::ostringstream result;
+  result << builtin_snapshot_directory
+         << "/builtin-" << std::hex << h << ".gb";
+  return result.str();
+}
+
+/*******************************************************************\
+
+Function: take_builtin_snapshot
+
+  Inputs:
+
+ Outputs: true on error
+
+ Purpose: run the parser and the typechecker on the internal
+          additions alone
+
+\*******************************************************************/
+
+static bool take_builtin_snapshot(
+  const std::string &code,
+  builtin_snapshott &snapshot,
+  message_handlert &message_handler)
+{
+  std::istringstream codestr(code);
+
+  ansi_c_parser.clear();
+  ansi_c_parser.set_file(ID_built_in);
+  ansi_c_parser.in=&codestr;
+  ansi_c_parser.set_message_handler(message_handler);
+  configure_ansi_c_parser();
+
+  ansi_c_scanner_init();
+
+  if(ansi_c_parser.parse())
+    return true;
+
+  snapshot.root_scope=ansi_c_parser.root_scope();
+
+  ansi_c_parse_treet parse_tree;
+  parse_tree.swap(ansi_c_parser.parse_tree);
+  ansi_c_parser.clear();
+
+  // the module is filled in by the user of the snapshot
+  return ansi_c_typecheck(
+    parse_tree, snapshot.symbol_table, "", message_handler);
+}
+
+/*******************************************************************\
+
+Function: get_builtin_snapshot
+
+  Inputs:
+
+ Outputs: true on error
+
+ Purpose: returns the snapshot for the current configuration,
+          taking it only if neither this process nor the snapshot
+          directory has one
+
+\*******************************************************************/
+
+bool get_builtin_snapshot(
+  const builtin_snapshott *&snapshot,
+  message_handlert &message_handler)
+{
+  std::string code;
+  ansi_c_internal_additions(code);
+
+  const std::string key=code+'\0'+ansi_c_configuration_key();
+
+  typedef std::map<std::string, builtin_snapshott> snapshotst;
+  static snapshotst snapshots;
+
+  snapshotst::iterator s_it=snapshots.find(key);
+
+  if(s_it!=snapshots.end())
+  {
+    snapshot=&s_it->second;
+    return false;
+  }
+
+  builtin_snapshott new_snapshot;
+  std::string file_name;
+
+  if(!builtin_snapshot_directory.empty())
+  {
+    file_name=builtin_snapshot_file_name(key);
+    std::ifstream in(file_name.c_str(), std::ios::binary);
+
+    // on a hash collision, the key differs
+    if(in &&
+       !new_snapshot.read(in) &&
+       new_snapshot.key==key)
+    {
+      messaget message(message_handler);
+      message.statistics() << "Built-in snapshot read from cache"
+                           << messaget::eom;
+
+      snapshot=&snapshots[key];
+      snapshots[key].swap(new_snapshot);
+      return false;
+    }
+
+    new_snapshot.root_scope=ansi_c_scopet();
+    new_snapshot.symbol_table.clear();
+  }
+
+  new_snapshot.key=key;
+
+  if(take_builtin_snapshot(code, new_snapshot, message_handler))
+    return true;
+
+  messaget message(message_handler);
+  message.statistics() << "Built-in snapshot taken" << messaget::eom;
+
+  if(!file_name.empty())
+  {
+    // write to a temporary file first, as other processes
+    // may use the same directory concurrently
+    const std::string tmp_name=file_name+"."+i2string(getpid());
+    bool error;
+
+    {
+      std::ofstream out(tmp_name.c_str(), std::ios::binary);
+      error=!out;
+      if(!error)
+      {
+        new_snapshot.write(out);
+        error=!out;
+      }
+    }
+
+    if(error || std::rename(tmp_name.c_str(), file_name.c_str())!=0)
+      std::remove(tmp_name.c_str());
+  }
+
+  snapshot=&snapshots[key];
+  snapshots[key].swap(new_snapshot);
+
+  return false;
+}
@@ -0,0 +1,70 @@
+/*******************************************************************\
+
+Module: Snapshot of the Built-in Declarations
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_ANSI_C_BUILTIN_SNAPSHOT_H
+#define CPROVER_ANSI_C_BUILTIN_SNAPSHOT_H
+
+#include <iosfwd>
+#include <string>
+
+#include <util/symbol_table.h>
+#include <util/message.h>
+
+#include "ansi_c_scope.h"
+
+/*******************************************************************\
+
+   Class: builtin_snapshott
+
+ Purpose: The state of the front-end after the internal additions
+          and the built-in headers: the global scope of the parser
+          and the typechecked declarations. Taken once per
+          configuration, and optionally kept in a directory
+          between runs.
+
+\*******************************************************************/
+
+class builtin_snapshott
+{
+public:
+  // identifies the configuration the snapshot was taken for
+  std::string key;
+
+  ansi_c_scopet root_scope;
+  symbol_tablet symbol_table;
+
+  void write(std::ostream &) const;
+
+  // returns true on error
+  bool read(std::istream &);
+
+  void swap(builtin_snapshott &other)
+  {
+    key.swap(other.key);
+    root_scope.swap(other.root_scope);
+    std::swap(root_scope.anon_counter, other.root_scope.anon_counter);
+    symbol_table.swap(other.symbol_table);
+  }
+};
+
+// returns true on error
+bool get_builtin_snapshot(
+  const builtin_snapshott *&snapshot,
+  message_handlert &message_handler);
+
+// where to keep snapshots between runs; if empty, the
+// front-end does not use snapshots
+extern std::string builtin_snapshot_directory;
+
+// sets the dialect of ansi_c_parser from the configuration
+void configure_ansi_c_parser();
+
+// everything in the configuration that affects the front-end
+std::string ansi_c_configuration_key();
+
+#endif
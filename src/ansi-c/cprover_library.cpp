@@ -13,6 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "cprover_library.h"
 #include "ansi_c_language.h"
+#include "builtin_snapshot.h"
 
 struct cprover_library_entryt
 {
@@ -104,6 +105,41 @@ void add_cprover_library(
 
 /*******************************************************************\
 
+Function: cprover_library_key
+
+  Inputs: name of a function
+
+ Outputs: a string that is the same for two runs iff the model of
+          the function is translated the same way, or an empty
+          string if there is no model
+
+ Purpose: for caching translated library models
+
+\*******************************************************************/
+
+std::string cprover_library_key(const irep_idt &function)
+{
+  if(config.ansi_c.lib==configt::ansi_ct::libt::LIB_NONE)
+    return std::string();
+
+  const cprover_library_entryt *e=cprover_library;
+
+  while(e->function!=NULL && function!=e->function)
+    e++;
+
+  if(e->function==NULL)
+    return std::string();
+
+  std::ostringstream key;
+
+  key << e->model << '\0'
+      << ansi_c_configuration_key();
+
+  return key.str();
+}
+
+/*******************************************************************\
+
 Function: add_library
 
   Inputs:
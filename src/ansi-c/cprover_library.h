@@ -28,4 +28,8 @@ void add_cprover_library(
   symbol_tablet &,
   message_handlert &);
 
+// identifies the model of the given function and everything in the
+// configuration that affects its translation; empty if there is none
+std::string cprover_library_key(const irep_idt &function);
+
 #endif
@@ -196,7 +196,14 @@ safety_checkert::resultt bmc_all_propertiest::operator()()
   
   cover_goalst cover_goals(solver);
   
+  cover_goals.set_message_handler(get_message_handler());
   cover_goals.register_observer(*this);
+
+  // Properties are checked in groups of this size; an UNSAT
+  // group may prove further properties via failed assumptions.
+  if(bmc.options.get_option("property-batch")!="")
+    cover_goals.batch_size=
+      bmc.options.get_unsigned_int_option("property-batch");
   
   for(goal_mapt::const_iterator
       it=goal_map.begin();
@@ -213,6 +220,11 @@ safety_checkert::resultt bmc_all_propertiest::operator()()
 
   cover_goals();  
 
+  statistics() << cover_goals.number_infeasible()
+               << " properties proved in "
+               << cover_goals.iterations() << " iteration"
+               << (cover_goals.iterations()==1?"":"s") << eom;
+
   // output runtime
 
   {
@@ -252,6 +264,23 @@ safety_checkert::resultt bmc_all_propertiest::operator()()
     }
   }
 
+  if(bmc.options.get_bool_option("validate-trace"))
+  {
+    named_goto_tracest goto_traces;
+
+    for(goal_mapt::const_iterator
+        it=goal_map.begin();
+        it!=goal_map.end();
+        it++)
+      if(it->second.failed)
+        goto_traces.push_back(std::make_pair(
+          "["+id2string(it->first)+"]", &it->second.goto_trace));
+
+    validate_goto_traces(
+      bmc.ns.get_symbol_table(), goto_functions, goto_traces,
+      "counterexamples", get_message_handler());
+  }
+
   status() << eom;
   
   status() << "** " << cover_goals.number_covered()
@@ -142,6 +142,29 @@ void bmct::do_conversion()
   
   status() << "converting SSA" << eom;
 
+  // size the pointer encoding by the number of objects
+  bv_pointerst *bv_pointers=dynamic_cast<bv_pointerst *>(&prop_conv);
+
+  if(bv_pointers!=NULL)
+  {
+    for(symex_target_equationt::SSA_stepst::const_iterator
+        it=equation.SSA_steps.begin();
+        it!=equation.SSA_steps.end();
+        it++)
+    {
+      bv_pointers->add_objects(it->guard);
+      bv_pointers->add_objects(it->cond_expr);
+
+      forall_expr_list(a_it, it->io_args)
+        bv_pointers->add_objects(*a_it);
+    }
+
+    forall_expr_list(it, bmc_constraints)
+      bv_pointers->add_objects(*it);
+
+    bv_pointers->fit_object_bits();
+  }
+
   // convert SSA
   equation.convert(prop_conv);
 
@@ -568,10 +591,28 @@ safety_checkert::resultt bmct::decide(
 
   case decision_proceduret::D_SATISFIABLE:
     if(options.get_bool_option("beautify"))
-      counterexample_beautificationt()(
+    {
+      counterexample_beautificationt counterexample_beautification;
+
+      if(options.get_option("beautify-time-limit")!="")
+        counterexample_beautification.time_limit=
+          options.get_unsigned_int_option("beautify-time-limit");
+
+      counterexample_beautification(
         dynamic_cast<bv_cbmct &>(prop_conv), equation, ns);
+    }
   
     error_trace();
+
+    if(options.get_bool_option("validate-trace"))
+    {
+      status() << "Validating counterexample by concrete execution" << eom;
+      validate_goto_tracet validate_goto_trace(
+        ns.get_symbol_table(), goto_functions);
+      validate_goto_trace.set_message_handler(get_message_handler());
+      validate_goto_trace("Counterexample", safety_checkert::error_trace);
+    }
+
     report_failure();
     return UNSAFE;
 
@@ -24,6 +24,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <langapi/language_ui.h>
 #include <goto-symex/symex_target_equation.h>
 #include <goto-programs/safety_checker.h>
+#include <goto-programs/validate_goto_trace.h>
 
 #include "symex_bmc.h"
 
@@ -101,7 +102,7 @@ protected:
   
   bool cover(
     const goto_functionst &goto_functions,
-    const std::string &criterion);
+    const std::string &criteria);
 
   friend class bmc_all_propertiest;
   friend class bmc_covert;
@@ -27,6 +27,12 @@ Function: cbmc_dimacst::write_dimacs
 
 bool cbmc_dimacst::write_dimacs(const std::string &filename)
 { 
+  // the clauses have been streamed to the file already
+  dimacs_cnf_dumpt *dump=dynamic_cast<dimacs_cnf_dumpt *>(&prop);
+
+  if(dump!=NULL)
+    return write_dimacs(dump->get_out());
+
   if(filename.empty() || filename=="-")
     return write_dimacs(std::cout);
 
@@ -55,7 +61,12 @@ Function: cbmc_dimacst::write_dimacs
 
 bool cbmc_dimacst::write_dimacs(std::ostream &out)
 {
-  dynamic_cast<dimacs_cnft&>(prop).write_dimacs_cnf(out);
+  dimacs_cnf_dumpt *dump=dynamic_cast<dimacs_cnf_dumpt *>(&prop);
+
+  if(dump!=NULL)
+    dump->finish();
+  else
+    dynamic_cast<dimacs_cnft&>(prop).write_dimacs_cnf(out);
 
   // we dump the mapping variable<->literals
   for(bv_cbmct::symbolst::const_iterator
@@ -18,10 +18,13 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/unicode.h>
 #include <util/memory_info.h>
 #include <util/i2string.h>
+#include <util/tempfile.h>
 
 #include <ansi-c/c_preprocess.h>
+#include <ansi-c/builtin_snapshot.h>
 
 #include <goto-programs/goto_convert_functions.h>
+#include <goto-programs/goto_convert_cache.h>
 #include <goto-programs/remove_function_pointers.h>
 #include <goto-programs/remove_returns.h>
 #include <goto-programs/remove_vector.h>
@@ -41,10 +44,13 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <cegis/safety/facade/safety_runner.h>
 
 #include <goto-instrument/full_slicer.h>
+#include <goto-instrument/horn_encoding.h>
 
 #include <linking/entry_point.h>
 
 #include <pointer-analysis/add_failed_symbols.h>
+#include <pointer-analysis/value_set_analysis_fi.h>
+#include <pointer-analysis/goto_program_dereference.h>
 
 #include <analyses/goto_check.h>
 
@@ -53,6 +59,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "cbmc_solvers.h"
 #include "cbmc_parse_options.h"
 #include "bmc.h"
+#include "cover.h"
 #include "version.h"
 #include "xml_interface.h"
 
@@ -184,6 +191,9 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   else
     options.set_option("all-properties", false);
 
+  if(cmdline.isset("property-batch"))
+    options.set_option("property-batch", cmdline.get_value("property-batch"));
+
   if(cmdline.isset("unwind"))
     options.set_option("unwind", cmdline.get_value("unwind"));
 
@@ -326,6 +336,13 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     options.set_option("refine-arithmetic", true);
   }
 
+  if(cmdline.isset("refine-floats"))
+  {
+    options.set_option("refine", true);
+    options.set_option("refine-arithmetic", true);
+    options.set_option("refine-floats", true);
+  }
+
   if(cmdline.isset("max-node-refinement"))
     options.set_option("max-node-refinement", cmdline.get_value("max-node-refinement"));
 
@@ -430,11 +447,21 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("beautify"))
     options.set_option("beautify", true);
 
+  if(cmdline.isset("beautify-time-limit"))
+    options.set_option("beautify-time-limit",
+                       cmdline.get_value("beautify-time-limit"));
+
+  if(cmdline.isset("validate-trace"))
+    options.set_option("validate-trace", true);
+
   if(cmdline.isset("no-sat-preprocessor"))
     options.set_option("sat-preprocessor", false);
   else
     options.set_option("sat-preprocessor", true);
 
+  if(cmdline.isset("cadical"))
+    options.set_option("cadical", true);
+
   options.set_option("pretty-names", 
                      !cmdline.isset("no-pretty-names"));
 
@@ -604,6 +631,9 @@ int cbmc_parse_optionst::doit()
   if(cmdline.isset("safety"))
     return run_safety(options, result(), symbol_table, goto_functions);
 
+  if(cmdline.isset("horn"))
+    return do_horn(goto_functions);
+
   // do actual BMC
   return do_bmc(bmc, goto_functions);
 }
@@ -741,6 +771,9 @@ int cbmc_parse_optionst::get_goto_program(
 
     if(!cmdline.args.empty())
     {
+      if(cmdline.isset("goto-cache"))
+        builtin_snapshot_directory=cmdline.get_value("goto-cache");
+
       if(parse()) return 6;
       if(typecheck()) return 6;
       int get_modules_ret=get_modules(bmc);
@@ -776,7 +809,16 @@ int cbmc_parse_optionst::get_goto_program(
 
     status() << "Generating GOTO Program" << eom;
 
-    goto_convert(symbol_table, goto_functions, ui_message_handler);
+    if(cmdline.isset("goto-cache"))
+    {
+      goto_convert_cachet cache(
+        cmdline.get_value("goto-cache"), ansi_c_configuration_key());
+      goto_convert(symbol_table, goto_functions, cache, ui_message_handler);
+      statistics() << "GOTO conversion cache: " << cache.hits
+                   << " hit(s), " << cache.misses << " miss(es)" << eom;
+    }
+    else
+      goto_convert(symbol_table, goto_functions, ui_message_handler);
 
     if(process_goto_program(options, goto_functions))
       return 6;
@@ -903,7 +945,17 @@ bool cbmc_parse_optionst::process_goto_program(
     // add the library
     status() << "Adding CPROVER library (" 
              << config.ansi_c.arch << ")" << eom;
-    link_to_library(symbol_table, goto_functions, ui_message_handler);
+    if(cmdline.isset("goto-cache"))
+    {
+      goto_convert_cachet cache(
+        cmdline.get_value("goto-cache"), ansi_c_configuration_key());
+      link_to_library(
+        symbol_table, goto_functions, cache, ui_message_handler);
+      statistics() << "Library cache: " << cache.hits
+                   << " hit(s), " << cache.misses << " miss(es)" << eom;
+    }
+    else
+      link_to_library(symbol_table, goto_functions, ui_message_handler);
 
     if(cmdline.isset("string-abstraction"))
       string_instrumentation(
@@ -955,9 +1007,14 @@ bool cbmc_parse_optionst::process_goto_program(
     // all assertions by false to prevent simplification
     
     if(cmdline.isset("cover") &&
-       cmdline.get_value("cover")=="assertions")
+       (","+cmdline.get_value("cover")+",").find(",assertions,")!=
+         std::string::npos)
       make_assertions_false(goto_functions);
 
+    // the goals of the criteria about conditions
+    if(cmdline.isset("cover"))
+      instrument_cover_goals(ns, goto_functions, cmdline.get_value("cover"));
+
     // show it?
     if(cmdline.isset("show-loops"))
     {
@@ -1032,6 +1089,146 @@ int cbmc_parse_optionst::do_bmc(
 
 /*******************************************************************\
 
+Function: shell_quote
+
+  Inputs: a file name
+
+ Outputs: the file name, quoted for use in a shell command
+
+ Purpose:
+
+\*******************************************************************/
+
+static std::string shell_quote(const std::string &src)
+{
+  #ifdef _WIN32
+  return "\""+src+"\"";
+  #else
+  std::string result="'";
+
+  for(std::string::const_iterator it=src.begin(); it!=src.end(); it++)
+    if(*it=='\'')
+      result+="'\\''";
+    else
+      result+=*it;
+
+  return result+"'";
+  #endif
+}
+
+/*******************************************************************\
+
+Function: cbmc_parse_optionst::do_horn
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: encode the program as constrained Horn clauses and
+          hand them to Z3; the clauses are satisfiable iff all
+          properties hold
+
+\*******************************************************************/
+
+int cbmc_parse_optionst::do_horn(goto_functionst &goto_functions)
+{
+  const namespacet ns(symbol_table);
+
+  try
+  {
+    status() << "Performing full inlining" << eom;
+    goto_inline(goto_functions, ns, ui_message_handler);
+
+    status() << "Pointer Analysis" << eom;
+    value_set_analysis_fit value_set_analysis(ns);
+    value_set_analysis(goto_functions);
+
+    status() << "Removing Pointers" << eom;
+    remove_pointers(goto_functions, symbol_table, value_set_analysis);
+    goto_functions.update();
+
+    if(cmdline.isset("outfile"))
+    {
+      std::string filename=cmdline.get_value("outfile");
+
+      if(filename=="-")
+      {
+        horn_encoding(goto_functions, ns, std::cout);
+        return 0;
+      }
+
+      #ifdef _MSC_VER
+      std::ofstream out(widen(filename).c_str());
+      #else
+      std::ofstream out(filename.c_str());
+      #endif
+
+      if(!out)
+      {
+        error() << "failed to open " << filename << eom;
+        return 6;
+      }
+
+      horn_encoding(goto_functions, ns, out);
+      return 0;
+    }
+
+    temporary_filet horn_file("cbmc_horn_", ".smt2");
+    temporary_filet result_file("cbmc_horn_result_", "");
+
+    {
+      std::ofstream out(horn_file().c_str());
+      horn_encoding(goto_functions, ns, out);
+    }
+
+    status() << "Running Horn-clause solver Z3" << eom;
+
+    std::string command=
+      "z3 -smt2 "+shell_quote(horn_file())+
+      " > "+shell_quote(result_file());
+
+    int res=system(command.c_str());
+
+    std::ifstream in(result_file().c_str());
+    std::string line;
+    std::getline(in, line);
+
+    if(line=="sat")
+    {
+      result() << "VERIFICATION SUCCESSFUL" << eom;
+      return 0;
+    }
+    else if(line=="unsat")
+    {
+      result() << "VERIFICATION FAILED" << eom;
+      return 10;
+    }
+
+    error() << "Horn-clause solver returned `" << line
+            << "' (exit code " << res << ")" << eom;
+    return 6;
+  }
+
+  catch(const char *e)
+  {
+    error() << e << eom;
+    return 6;
+  }
+
+  catch(const std::string e)
+  {
+    error() << e << eom;
+    return 6;
+  }
+
+  catch(int)
+  {
+    return 6;
+  }
+}
+
+/*******************************************************************\
+
 Function: cbmc_parse_optionst::help
 
   Inputs:
@@ -1065,6 +1262,7 @@ void cbmc_parse_optionst::help()
     "\n"
     "Analysis options:\n"
     " --all-properties             check and report status of all properties\n"
+    " --property-batch n           with --all-properties, check n properties at a time\n"
     " --show-properties            show the properties, but don't run analysis\n"
     "\n"
     "Frontend options:\n"
@@ -1105,11 +1303,15 @@ void cbmc_parse_optionst::help()
     " --round-to-plus-inf          rounding towards plus infinity\n"
     " --round-to-minus-inf         rounding towards minus infinity\n"
     " --round-to-zero              rounding towards zero\n"
+    " --lazy-methods               only load the Java classes and methods\n"
+    "                              reachable from the entry point\n"
     "\n"
     "Program representations:\n"
     " --show-parse-tree            show parse tree\n"
     " --show-symbol-table          show symbol table\n"
     " --show-goto-functions        show goto program\n"
+    " --goto-cache dir             re-use goto programs of unchanged functions\n"
+    "                              and of library models and built-ins\n"
     "\n"
     "Program instrumentation options:\n"
     " --bounds-check               enable array bounds checks\n"
@@ -1124,6 +1326,7 @@ void cbmc_parse_optionst::help()
     " --no-assumptions             ignore user assumptions\n"
     " --error-label label          check that label is unreachable\n"
     " --cover CC                   create test-suite with coverage criterion CC\n"
+    "                              (comma-separated list for several criteria)\n"
     " --mm MM                      memory consistency model for concurrent programs\n"
     "\n"
     "BMC options:\n"
@@ -1141,10 +1344,16 @@ void cbmc_parse_optionst::help()
     " --partial-loops              permit paths with partial loops\n"
     " --no-pretty-names            do not simplify identifiers\n"
     " --graphml-cex filename       write the counterexample in GraphML format to filename\n"
+    " --validate-trace             replay counterexamples by concrete execution\n"
     "\n"
     "Backend options:\n"
     " --dimacs                     generate CNF in DIMACS format\n"
     " --beautify                   beautify the counterexample (greedy heuristic)\n"
+    " --beautify-time-limit s      spend at most s seconds beautifying\n"
+    #ifdef HAVE_CADICAL
+    " --cadical                    use CaDiCaL as SAT solver\n"
+    #endif
+    " --aig                        simplify the formula as and-inverter graph\n"
     " --smt1                       output subgoals in SMT1 syntax (obsolete)\n"
     " --smt2                       output subgoals in SMT2 syntax\n"
     " --boolector                  use Boolector\n"
@@ -1153,6 +1362,9 @@ void cbmc_parse_optionst::help()
     " --yices                      use Yices\n"
     " --z3                         use Z3\n"
     " --refine                     use refinement procedure (experimental)\n"
+    " --refine-floats              refine the precision of floating-point\n"
+    "                              arithmetic, starting low (experimental)\n"
+    " --horn                       prove properties with a Horn-clause solver\n"
     " --outfile filename           output formula to given file\n"
     " --arrays-uf-never            never turn arrays into uninterpreted functions\n"
     " --arrays-uf-always           always turn arrays into uninterpreted functions\n"
@@ -26,27 +26,28 @@ class optionst;
   "(debug-level):(no-propagation)(no-simplify-if)" \
   "(document-subgoals)(outfile):(test-preprocessor)" \
   "D:I:(std89)(std99)(std11)" \
-  "(classpath):" \
+  "(classpath):(lazy-methods)" \
   "(depth):(partial-loops)(no-unwinding-assertions)(unwinding-assertions)" \
   "(bounds-check)(pointer-check)(div-by-zero-check)(memory-leak-check)" \
   "(signed-overflow-check)(unsigned-overflow-check)(float-overflow-check)(nan-check)" \
   "(no-assertions)(no-assumptions)" \
   "(xml-ui)(xml-interface)(vcd):" \
   "(smt1)(smt2)(fpa)(cvc3)(cvc4)(boolector)(yices)(z3)(opensmt)(mathsat)" \
+  "(horn)" \
   "(cegis)(cegis-seed):(cegis-root):(cegis-targets):(cegis-min-prog-size):(cegis-max-prog-size):(cegis-skolem):(cegis-ranking):" \
   "(cegis-max-size):(cegis-statistics)(cegis-genetic)(cegis-genetic-rounds):(cegis-genetic-popsize):(cegis-tournament-select)" \
   "(cegis-genetic-mutation-rate):(cegis-genetic-replace-rate):(cegis-limit-wordsize)(cegis-parallel-verify)(danger)" \
   "(safety)(danger)(danger-max-size):" \
-  "(no-sat-preprocessor)" \
-  "(no-pretty-names)(beautify)" \
+  "(no-sat-preprocessor)(cadical)" \
+  "(no-pretty-names)(beautify)(beautify-time-limit):(validate-trace)" \
   "(floatbv)(fixedbv)" \
-  "(dimacs)(refine)(max-node-refinement):(refine-arrays)(refine-arithmetic)(aig)" \
+  "(dimacs)(refine)(max-node-refinement):(refine-arrays)(refine-arithmetic)(refine-floats)(aig)" \
   "(16)(32)(64)(LP64)(ILP64)(LLP64)(ILP32)(LP32)" \
   "(little-endian)(big-endian)" \
-  "(show-goto-functions)(show-loops)" \
+  "(show-goto-functions)(show-loops)(goto-cache):" \
   "(show-symbol-table)(show-parse-tree)(show-vcc)" \
   "(show-claims)(claim):(show-properties)(show-reachable-properties)(property):" \
-  "(all-claims)(all-properties)" \
+  "(all-claims)(all-properties)(property-batch):" \
   "(error-label):(verbosity):(no-library)" \
   "(version)" \
   "(cover):" \
@@ -79,6 +80,7 @@ protected:
 
   virtual void get_command_line_options(optionst &options);
   virtual int do_bmc(bmct &bmc, const goto_functionst &goto_functions);
+  int do_horn(goto_functionst &goto_functions);
 
   virtual int get_goto_program(
     const optionst &options,
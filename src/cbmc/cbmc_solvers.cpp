@@ -20,6 +20,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <solvers/prop/aig_prop.h>
 #include <solvers/sat/dimacs_cnf.h>
 
+#ifdef HAVE_CADICAL
+#include <solvers/sat/satcheck_cadical.h>
+#endif
+
 #include "cbmc_solvers.h"
 #include "bv_cbmc.h"
 #include "cbmc_dimacs.h"
@@ -125,6 +129,9 @@ public:
   
   ~cbmc_solver_with_propt()
   {
+    // delete the prop_conv before the prop it uses
+    delete prop_conv_ptr;
+    prop_conv_ptr=NULL;
     delete prop;
   }
 
@@ -146,24 +153,26 @@ public:
 
   cbmc_solver_with_aigpropt(
     prop_convt *_prop_conv,
-    propt *_prop,
-    aigt *_aig):
-    cbmc_solver_with_propt(_prop_conv, _prop),
-    aig(_aig)
+    aig_prop_solvert *_aig_prop,
+    propt *_sat):
+    cbmc_solver_with_propt(_prop_conv, _aig_prop),
+    sat(_sat)
   {
-    assert(_aig!=NULL);
+    assert(_sat!=NULL);
   }
 
   ~cbmc_solver_with_aigpropt()
   {
-    // delete prop before the AIG
+    // delete the AIG before the solver it feeds
+    delete prop_conv_ptr;
+    prop_conv_ptr=NULL;
     delete prop;
     prop=NULL;
-    delete aig;
+    delete sat;
   }
 
 protected:
-  aigt *aig;
+  propt *sat;
 };
 
 /*******************************************************************\
@@ -179,9 +188,11 @@ class cbmc_solver_with_filet:public cbmc_solverst::solvert
 public:
   cbmc_solver_with_filet(
     prop_convt *_prop_conv,
-    std::ofstream *_out):
+    std::ofstream *_out,
+    propt *_prop=NULL):
     cbmc_solverst::solvert(_prop_conv),
-    out(_out)
+    out(_out),
+    prop(_prop)
   {
     assert(_out!=NULL);
   }
@@ -191,11 +202,13 @@ public:
     // delete the prop before the file
     delete prop_conv_ptr;
     prop_conv_ptr=NULL;
+    delete prop;
     delete out;
   }
 
 protected:
   std::ofstream *out;
+  propt *prop;
 };
 
 /*******************************************************************\
@@ -214,6 +227,47 @@ cbmc_solverst::solvert* cbmc_solverst::get_default()
 {
   solvert *solver;
   
+  if(options.get_bool_option("cadical"))
+  {
+    #ifdef HAVE_CADICAL
+    // CaDiCaL's inprocessing respects frozen variables,
+    // and thus is fine with beautification
+    propt* prop = new satcheck_cadicalt();
+    prop->set_message_handler(get_message_handler());
+    
+    bv_cbmct* bv_cbmc = new bv_cbmct(ns, *prop);
+    
+    if(options.get_option("arrays-uf")=="never")
+      bv_cbmc->unbounded_array=bv_cbmct::U_NONE;
+    else if(options.get_option("arrays-uf")=="always")
+      bv_cbmc->unbounded_array=bv_cbmct::U_ALL;
+   
+    return new cbmc_solver_with_propt(bv_cbmc, prop);
+    #else
+    throw "CaDiCaL support is not compiled in";
+    #endif
+  }
+
+  if(options.get_bool_option("aig"))
+  {
+    // The AIG layer does the simplification; it adds clauses
+    // between calls, which the SAT simplifier can't deal with.
+    propt* sat = new satcheck_no_simplifiert();
+    sat->set_message_handler(get_message_handler());
+    
+    aig_prop_solvert* prop = new aig_prop_solvert(*sat);
+    prop->set_message_handler(get_message_handler());
+
+    bv_cbmct* bv_cbmc = new bv_cbmct(ns, *prop);
+    
+    if(options.get_option("arrays-uf")=="never")
+      bv_cbmc->unbounded_array=bv_cbmct::U_NONE;
+    else if(options.get_option("arrays-uf")=="always")
+      bv_cbmc->unbounded_array=bv_cbmct::U_ALL;
+
+    return new cbmc_solver_with_aigpropt(bv_cbmc, prop, sat);
+  }
+
   if(options.get_bool_option("beautify") || 
      !options.get_bool_option("sat-preprocessor")) // no simplifier
   {
@@ -232,18 +286,10 @@ cbmc_solverst::solvert* cbmc_solverst::get_default()
   }
   else // with simplifier
   {
-  #if 1
     propt* prop = new satcheckt();
     prop->set_message_handler(get_message_handler());
     bv_cbmct* bv_cbmc = new bv_cbmct(ns, *prop);
     solver = new cbmc_solver_with_propt(bv_cbmc, prop);
-  #else
-    aigt* aig = new aigt();
-    propt* prop = new aig_propt(*aig);
-    prop->set_message_handler(get_message_handler());
-    bv_cbmct* bv_cbmc = new bv_cbmct(ns, *prop);
-    solver = new cbmc_solver_with_aigpropt(bv_cbmc, prop, aig);
-  #endif
 
     if(options.get_option("arrays-uf")=="never")
       bv_cbmc->unbounded_array=bv_cbmct::U_NONE;
@@ -271,12 +317,33 @@ cbmc_solverst::solvert* cbmc_solverst::get_dimacs()
   no_beautification();
   no_incremental_check();
 
-  dimacs_cnft *prop=new dimacs_cnft();
-  prop->set_message_handler(get_message_handler());
-  
   std::string filename=options.get_option("outfile");
+
+  if(filename=="" || filename=="-")
+  {
+    dimacs_cnft *prop=new dimacs_cnft();
+    prop->set_message_handler(get_message_handler());
   
-  return new cbmc_solver_with_propt(new cbmc_dimacst(ns, *prop, filename), prop);
+    return new cbmc_solver_with_propt(
+      new cbmc_dimacst(ns, *prop, filename), prop);
+  }
+
+  // write the clauses as they are generated, rather
+  // than keeping the formula in memory
+  #ifdef _MSC_VER
+  std::ofstream *out=new std::ofstream(widen(filename).c_str());
+  #else
+  std::ofstream *out=new std::ofstream(filename.c_str());
+  #endif
+
+  if(!*out)
+    throw "failed to open "+filename;
+
+  dimacs_cnf_dumpt *prop=new dimacs_cnf_dumpt(*out, true);
+  prop->set_message_handler(get_message_handler());
+
+  return new cbmc_solver_with_filet(
+    new cbmc_dimacst(ns, *prop, filename), out, prop);
 }
 
 /*******************************************************************\
@@ -318,6 +385,8 @@ cbmc_solverst::solvert* cbmc_solverst::get_bv_refinement()
     options.get_bool_option("refine-arrays");
   bv_refinement->do_arithmetic_refinement = 
     options.get_bool_option("refine-arithmetic");
+  bv_refinement->do_float_approximation = 
+    options.get_bool_option("refine-floats");
 
   return new cbmc_solver_with_propt(bv_refinement, prop);
 }
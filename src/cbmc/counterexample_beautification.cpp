@@ -11,6 +11,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/arith_tools.h>
 #include <util/symbol.h>
 #include <util/std_expr.h>
+#include <util/time_stopping.h>
 
 #include <solvers/prop/minimize.h>
 #include <solvers/prop/literal_expr.h>
@@ -117,6 +118,8 @@ void counterexample_beautificationt::operator()(
   const symex_target_equationt &equation,
   const namespacet &ns)
 {
+  absolute_timet start_time=current_time();
+
   // find failed property
 
   failed=get_failed_property(bv_cbmc, equation);
@@ -151,6 +154,7 @@ void counterexample_beautificationt::operator()(
     // give to propositional minimizer
     prop_minimizet prop_minimize(bv_cbmc);
     prop_minimize.set_message_handler(bv_cbmc.get_message_handler());
+    prop_minimize.time_limit=time_limit*1000;
     
     for(guard_countt::const_iterator
         it=guard_count.begin();
@@ -160,6 +164,9 @@ void counterexample_beautificationt::operator()(
 
     // minimize
     prop_minimize();
+
+    if(prop_minimize.timed_out())
+      return;
   }
 
   {
@@ -174,6 +181,15 @@ void counterexample_beautificationt::operator()(
     // minimize
     bv_minimizet bv_minimize(bv_cbmc);
     bv_minimize.set_message_handler(bv_cbmc.get_message_handler());
+
+    // what is left of the budget
+    if(time_limit!=0)
+    {
+      unsigned long long spent=(current_time()-start_time).get_t();
+      if(spent>=time_limit*1000ull) return;
+      bv_minimize.time_limit=time_limit*1000ull-spent;
+    }
+
     bv_minimize(minimization_list);
   }
 }
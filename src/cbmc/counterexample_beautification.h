@@ -20,10 +20,17 @@ Author: Daniel Kroening, kroening@kroening.com
 class counterexample_beautificationt
 {
 public:
+  counterexample_beautificationt():time_limit(0)
+  {
+  }
+
   virtual ~counterexample_beautificationt()
   {
   }
 
+  // in seconds, for both phases together; zero for no limit
+  unsigned time_limit;
+
   void operator()(
     bv_cbmct &bv_cbmc,
     const symex_target_equationt &equation,
@@ -8,10 +8,15 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <iostream>
 
+#include <util/i2string.h>
+#include <util/replace_expr.h>
+#include <util/std_expr.h>
 #include <util/time_stopping.h>
 #include <util/xml.h>
 #include <util/xml_expr.h>
 
+#include <langapi/language_util.h>
+
 #include <solvers/prop/cover_goals.h>
 #include <solvers/prop/literal_expr.h>
 
@@ -20,6 +25,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "bmc.h"
 #include "bv_cbmc.h"
+#include "cover.h"
 
 /*******************************************************************\
 
@@ -104,7 +110,16 @@ public:
     }
   }
 
-  bool operator()(const criteriont criterion);
+  typedef std::set<criteriont> criteriast;
+
+  bool operator()(const criteriast &criteria);
+
+  inline bool operator()(const criteriont criterion)
+  {
+    criteriast criteria;
+    criteria.insert(criterion);
+    return (*this)(criteria);
+  }
 
   virtual void goal_covered(const cover_goalst::goalt &);
 
@@ -132,20 +147,30 @@ public:
     std::string description;
     source_locationt source_location;
     
+    criteriont criterion;
+    
+    // covered for free if a goal that implies it is covered
+    bool dominated;
+    
     // if satisified, we compute a goto_trace
     bool satisfied;
     goto_tracet goto_trace;
     
     goalt(
       const std::string &_description,
-      const source_locationt &_source_location):
+      const source_locationt &_source_location,
+      criteriont _criterion):
       description(_description),
       source_location(_source_location),
+      criterion(_criterion),
+      dominated(false),
       satisfied(false)
     {
     }
     
     goalt():source_location(source_locationt::nil()),
+            criterion(C_LOCATION),
+            dominated(false),
             satisfied(false)
     {
     }
@@ -160,7 +185,7 @@ public:
           it++)
         tmp.push_back(literal_exprt(it->condition));
 
-      return conjunction(tmp);
+      return disjunction(tmp);
     }
   };
   
@@ -173,15 +198,31 @@ public:
            suffix;
   }
 
+  // with several criteria, the IDs are qualified by the criterion
+  inline irep_idt goal_id(criteriont c, const irep_idt &id)
+  {
+    if(criteria.size()<=1) return id;
+    return std::string(as_string(c))+":"+id2string(id);
+  }
+
   typedef std::map<irep_idt, goalt> goal_mapt;
   goal_mapt goal_map;
 
 protected:
+  criteriast criteria;
+
   const goto_functionst &goto_functions;
   prop_convt &solver;
   bmct &bmc;
 
-  void collect_conditions(const exprt &src, std::set<exprt> &dest);
+public:
+  static void collect_conditions(const exprt &src, std::set<exprt> &dest);
+
+  // the name of a criterion on the command line
+  static bool parse_criterion(const std::string &, criteriont &);
+
+  // the goals that instrument_cover_goals adds to the program
+  static bool is_cover_goal(const goto_programt::instructiont &);
 };
 
 /*******************************************************************\
@@ -260,6 +301,58 @@ void bmc_covert::collect_conditions(const exprt &src, std::set<exprt> &dest)
 
 /*******************************************************************\
 
+Function: bmc_covert::parse_criterion
+
+  Inputs: the name of a criterion
+
+ Outputs: true if the name is unknown
+
+ Purpose:
+
+\*******************************************************************/
+
+bool bmc_covert::parse_criterion(const std::string &name, criteriont &c)
+{
+  if(name=="assertion" || name=="assertions")
+    c=C_ASSERTION;
+  else if(name=="path" || name=="paths")
+    c=C_PATH;
+  else if(name=="branch" || name=="branches")
+    c=C_BRANCH;
+  else if(name=="location" || name=="locations")
+    c=C_LOCATION;
+  else if(name=="decision" || name=="decisions")
+    c=C_DECISION;
+  else if(name=="condition" || name=="conditions")
+    c=C_CONDITION;
+  else if(name=="mcdc")
+    c=C_MCDC;
+  else
+    return true;
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: bmc_covert::is_cover_goal
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool bmc_covert::is_cover_goal(const goto_programt::instructiont &instruction)
+{
+  return instruction.is_assert() &&
+         instruction.source_location.get_property_class()=="coverage";
+}
+
+/*******************************************************************\
+
 Function: bmc_covert::operator()
 
   Inputs:
@@ -270,8 +363,10 @@ Function: bmc_covert::operator()
 
 \*******************************************************************/
 
-bool bmc_covert::operator()(const criteriont criterion)
+bool bmc_covert::operator()(const criteriast &_criteria)
 {
+  criteria=_criteria;
+
   status() << "Passing problem to " << solver.decision_procedure_text() << eom;
 
   solver.set_message_handler(get_message_handler());
@@ -292,6 +387,7 @@ bool bmc_covert::operator()(const criteriont criterion)
   //bmc.equation.output(std::cout);
   
   std::map<goto_programt::const_targett, irep_idt> location_map;
+  std::map<goto_programt::const_targett, irep_idt> cover_goal_map;
   
   // Collect _all_ goals in `goal_map'.
   // This maps property IDs to 'goalt'
@@ -304,28 +400,60 @@ bool bmc_covert::operator()(const criteriont criterion)
       if(i_it->function==ID__start ||
          i_it->function=="__CPROVER_initialize")
         continue;
+
+      // the goals about the conditions of the branch that follows
+      if(is_cover_goal(*i_it))
+      {
+        criteriont c;
+        const source_locationt &l=i_it->source_location;
+        if(parse_criterion(l.get_string("coverage_criterion"), c))
+          assert(false);
+
+        goto_programt::const_targett branch=i_it;
+        while(is_cover_goal(*branch)) branch++;
+
+        irep_idt goal=goal_id(c, id(branch, l.get_string("coverage_goal")));
+        goal_map[goal]=goalt(id2string(l.get_comment()), l, c);
+        cover_goal_map[i_it]=goal;
+      }
         
-      switch(criterion)
+      // A block is executed whenever a branch or an assertion
+      // in it is, hence its location goal is dominated by these.
+      // C_LOCATION comes first in the set, so location_map is
+      // filled in by the time the other criteria look at it.
+      for(criteriast::const_iterator
+          c_it=criteria.begin();
+          c_it!=criteria.end();
+          c_it++)
+      switch(*c_it)
       {
       case C_ASSERTION:
-        if(i_it->is_assert())
-          goal_map[id(i_it)]=
+        if(i_it->is_assert() && !is_cover_goal(*i_it))
+        {
+          goal_map[goal_id(C_ASSERTION, id(i_it))]=
             goalt(
               id2string(i_it->source_location.get_comment()),
-              i_it->source_location);
+              i_it->source_location,
+              C_ASSERTION);
+
+          if(location_map.find(i_it)!=location_map.end())
+            goal_map[location_map[i_it]].dominated=true;
+        }
         break;
         
       case C_LOCATION:
         {
           std::string b=i2string(basic_blocks[i_it]);
-          std::string id=id2string(f_it->first)+"#"+b;
+          irep_idt id=
+            goal_id(C_LOCATION, id2string(f_it->first)+"#"+b);
           location_map[i_it]=id;
           if(goal_map[id].description=="" &&
              i_it->source_location.get_file()!="")
           {
             goal_map[id]=goalt(
               "block "+i_it->source_location.as_string(),
-              i_it->source_location);
+              i_it->source_location,
+              C_LOCATION);
           }
         }
         break;
@@ -334,35 +462,26 @@ bool bmc_covert::operator()(const criteriont criterion)
         if(i_it->is_goto() && !i_it->guard.is_true())
         {
           std::string b=i2string(basic_blocks[i_it]);
-          goal_map[id(i_it, "TRUE")]=
+          goal_map[goal_id(C_BRANCH, id(i_it, "TRUE"))]=
             goalt("function "+id2string(f_it->first)+" block "+b+" branch true",
-                  i_it->source_location);
-          goal_map[id(i_it, "FALSE")]=
+                  i_it->source_location, C_BRANCH);
+          goal_map[goal_id(C_BRANCH, id(i_it, "FALSE"))]=
             goalt("function "+id2string(f_it->first)+" block "+b+" branch false",
-                  i_it->source_location);
+                  i_it->source_location, C_BRANCH);
+
+          if(location_map.find(i_it)!=location_map.end())
+            goal_map[location_map[i_it]].dominated=true;
         }
         break;
         
+      case C_DECISION:
       case C_CONDITION:
-        if(i_it->is_goto())
-        {
-          std::set<exprt> conditions;
-
-          collect_conditions(i_it->guard, conditions);
-          unsigned i=0;
-
-          for(std::set<exprt>::const_iterator it=conditions.begin();
-              it!=conditions.end();
-              it++, i++)
-          {
-            goal_map[id(i_it, "C"+i2string(i))]=
-              goalt("condition "+from_expr(bmc.ns, "", *it),
-                    i_it->source_location);
-          }
-        }
+      case C_MCDC:
+        // instrumented, see above
         break;
       
-      default:;
+      case C_PATH:
+        assert(false);
       }
     }
   }
@@ -383,15 +502,28 @@ bool bmc_covert::operator()(const criteriont criterion)
     if(it->source.pc->function==ID__start ||
        it->source.pc->function=="__CPROVER_initialize")
       continue;
+
+    // covered when the assertion fails; its condition
+    // implies the goal from the guard already
+    if(is_cover_goal(*it->source.pc))
+    {
+      and_exprt c_expr(conjunction(assumptions), not_exprt(it->cond_expr));
+      literalt c=solver.convert(c_expr);
+      goal_map[cover_goal_map[it->source.pc]].add_instance(it, c);
+    }
       
-    switch(criterion)
+    for(criteriast::const_iterator
+        c_it=criteria.begin();
+        c_it!=criteria.end();
+        c_it++)
+    switch(*c_it)
     {
     case C_ASSERTION:
-      if(it->source.pc->is_assert())
+      if(it->source.pc->is_assert() && !is_cover_goal(*it->source.pc))
       {
         and_exprt c_expr(conjunction(assumptions), literal_exprt(it->guard_literal));
         literalt c=solver.convert(c_expr);
-        goal_map[id(it->source.pc)].add_instance(it, c);
+        goal_map[goal_id(C_ASSERTION, id(it->source.pc))].add_instance(it, c);
       }
       break;
       
@@ -419,12 +551,19 @@ bool bmc_covert::operator()(const criteriont criterion)
         // a branch can have three states:
         // 1) taken 2) not taken 3) not executed!
 
-        goal_map[id(it->source.pc, "TRUE")].add_instance(it, c_true);
-        goal_map[id(it->source.pc, "FALSE")].add_instance(it, c_false);
+        goal_map[goal_id(C_BRANCH, id(it->source.pc, "TRUE"))].add_instance(it, c_true);
+        goal_map[goal_id(C_BRANCH, id(it->source.pc, "FALSE"))].add_instance(it, c_false);
       }
       break;
       
-    default:;
+    case C_DECISION:
+    case C_CONDITION:
+    case C_MCDC:
+      // see above
+      break;
+
+    case C_PATH:
+      assert(false);
     }
   }
   
@@ -432,6 +571,7 @@ bool bmc_covert::operator()(const criteriont criterion)
   
   cover_goalst cover_goals(solver);
   
+  cover_goals.set_message_handler(get_message_handler());
   cover_goals.register_observer(*this);
   
   for(goal_mapt::const_iterator
@@ -440,7 +580,7 @@ bool bmc_covert::operator()(const criteriont criterion)
       it++)
   {
     literalt l=solver.convert(it->second.as_expr());
-    cover_goals.add(l);
+    cover_goals.add(l, it->second.dominated);
   }
   
   assert(cover_goals.size()==goal_map.size());
@@ -461,10 +601,20 @@ bool bmc_covert::operator()(const criteriont criterion)
   if(bmc.ui!=ui_message_handlert::XML_UI)
   {
     status() << eom;
-    status() << "** " << as_string(criterion) << " coverage results:" << eom;
+    status() << "** ";
+    for(criteriast::const_iterator
+        c_it=criteria.begin();
+        c_it!=criteria.end();
+        c_it++)
+    {
+      if(c_it!=criteria.begin()) status() << ", ";
+      status() << as_string(*c_it);
+    }
+    status() << " coverage results:" << eom;
   }
   
   unsigned goals_covered=0;
+  std::map<criteriont, std::pair<unsigned, unsigned> > per_criterion;
   
   for(goal_mapt::const_iterator
       it=goal_map.begin();
@@ -473,7 +623,13 @@ bool bmc_covert::operator()(const criteriont criterion)
   {
     const goalt &goal=it->second;
     
-    if(goal.satisfied) goals_covered++;
+    per_criterion[goal.criterion].second++;
+
+    if(goal.satisfied)
+    {
+      goals_covered++;
+      per_criterion[goal.criterion].first++;
+    }
   
     if(bmc.ui==ui_message_handlert::XML_UI)
     {
@@ -499,8 +655,36 @@ bool bmc_covert::operator()(const criteriont criterion)
     }
   }
 
+  if(bmc.options.get_bool_option("validate-trace"))
+  {
+    named_goto_tracest goto_traces;
+
+    for(goal_mapt::const_iterator
+        it=goal_map.begin();
+        it!=goal_map.end();
+        it++)
+      if(it->second.satisfied)
+        goto_traces.push_back(std::make_pair(
+          "["+id2string(it->first)+"]", &it->second.goto_trace));
+
+    validate_goto_traces(
+      bmc.ns.get_symbol_table(), goto_functions, goto_traces,
+      "tests", get_message_handler());
+  }
+
   status() << eom;
   
+  if(criteria.size()>1)
+  {
+    for(std::map<criteriont, std::pair<unsigned, unsigned> >::const_iterator
+        it=per_criterion.begin();
+        it!=per_criterion.end();
+        it++)
+      status() << "** " << as_string(it->first) << ": "
+               << it->second.first << " of " << it->second.second
+               << " covered" << eom;
+  }
+
   status() << "** " << goals_covered
            << " of " << goal_map.size() << " covered ("
            << cover_goals.iterations() << " iteration"
@@ -514,7 +698,7 @@ bool bmc_covert::operator()(const criteriont criterion)
 
 Function: bmct::cover
 
-  Inputs:
+  Inputs: a comma-separated list of coverage criteria
 
  Outputs:
 
@@ -524,32 +708,193 @@ Function: bmct::cover
 
 bool bmct::cover(
   const goto_functionst &goto_functions,
-  const std::string &criterion)
+  const std::string &criteria)
 {
-  bmc_covert::criteriont c;
-  
-  if(criterion=="assertion" || criterion=="assertions")
-    c=bmc_covert::C_ASSERTION;
-  else if(criterion=="path" || criterion=="paths")
-    c=bmc_covert::C_PATH;
-  else if(criterion=="branch" || criterion=="branches")
-    c=bmc_covert::C_BRANCH;
-  else if(criterion=="location" || criterion=="locations")
-    c=bmc_covert::C_LOCATION;
-  else if(criterion=="decision" || criterion=="decisions")
-    c=bmc_covert::C_DECISION;
-  else if(criterion=="condition" || criterion=="conditions")
-    c=bmc_covert::C_CONDITION;
-  else if(criterion=="mcdc")
-    c=bmc_covert::C_MCDC;
-  else
+  bmc_covert::criteriast c_set;
+
+  std::string::size_type start=0;
+
+  while(start<=criteria.size())
   {
-    error() << "coverage criterion `" << criterion << "' is unknown"
-            << eom;
-    return true;
+    std::string::size_type end=criteria.find(',', start);
+    if(end==std::string::npos) end=criteria.size();
+
+    const std::string criterion=criteria.substr(start, end-start);
+    start=end+1;
+
+    bmc_covert::criteriont c;
+  
+    if(bmc_covert::parse_criterion(criterion, c))
+    {
+      error() << "coverage criterion `" << criterion << "' is unknown"
+              << eom;
+      return true;
+    }
+
+    if(c==bmc_covert::C_PATH)
+    {
+      error() << "coverage criterion `" << criterion
+              << "' is not supported" << eom;
+      return true;
+    }
+
+    c_set.insert(c);
   }
 
   bmc_covert bmc_cover(goto_functions, *this);
   bmc_cover.set_message_handler(get_message_handler());
-  return bmc_cover(c);
+  return bmc_cover(c_set);
+}
+
+/*******************************************************************\
+
+Function: add_cover_goal
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: a goal is an assertion that fails when it is covered
+
+\*******************************************************************/
+
+static void add_cover_goal(
+  const exprt &goal,
+  const std::string &criterion,
+  const std::string &suffix,
+  const std::string &description,
+  const source_locationt &source_location,
+  goto_programt &dest)
+{
+  goto_programt::targett t=dest.add_instruction(ASSERT);
+  t->guard=not_exprt(goal);
+  t->source_location=source_location;
+  t->source_location.set_property_class("coverage");
+  t->source_location.set_comment(description);
+  t->source_location.set("coverage_criterion", criterion);
+  t->source_location.set("coverage_goal", suffix);
+}
+
+/*******************************************************************\
+
+Function: instrument_cover_goals
+
+  Inputs: the program, and the coverage criteria
+
+ Outputs:
+
+ Purpose: The goals of decision, condition and MC/DC coverage are
+          about the values of the conditions of a branch, which the
+          formula does not have. They are added in front of the
+          branch, as assertions over these conditions.
+
+          A condition is an atom of the decision. The MC/DC goals
+          of a condition are that it is true, and false, while it
+          determines the outcome of the decision; the two tests
+          that cover them show its independent effect.
+
+\*******************************************************************/
+
+void instrument_cover_goals(
+  const namespacet &ns,
+  goto_functionst &goto_functions,
+  const std::string &criteria)
+{
+  bool decision=false, condition=false, mcdc=false;
+
+  std::string::size_type start=0;
+
+  while(start<=criteria.size())
+  {
+    std::string::size_type end=criteria.find(',', start);
+    if(end==std::string::npos) end=criteria.size();
+
+    // unknown criteria are reported by bmct::cover
+    bmc_covert::criteriont c;
+    if(!bmc_covert::parse_criterion(criteria.substr(start, end-start), c))
+    {
+      decision|=c==bmc_covert::C_DECISION;
+      condition|=c==bmc_covert::C_CONDITION;
+      mcdc|=c==bmc_covert::C_MCDC;
+    }
+
+    start=end+1;
+  }
+
+  if(!decision && !condition && !mcdc)
+    return;
+
+  Forall_goto_functions(f_it, goto_functions)
+  {
+    if(f_it->first==ID__start ||
+       f_it->first=="__CPROVER_initialize")
+      continue;
+
+    goto_programt &body=f_it->second.body;
+
+    Forall_goto_program_instructions(i_it, body)
+    {
+      if(!i_it->is_goto() || i_it->guard.is_true())
+        continue;
+
+      const exprt decision_expr=i_it->guard;
+      const source_locationt source_location=i_it->source_location;
+      const std::string d=from_expr(ns, "", decision_expr);
+
+      goto_programt goals;
+
+      if(decision)
+      {
+        add_cover_goal(decision_expr, "decision", "DT",
+                       "decision "+d+" true", source_location, goals);
+        add_cover_goal(not_exprt(decision_expr), "decision", "DF",
+                       "decision "+d+" false", source_location, goals);
+      }
+
+      std::set<exprt> conditions;
+      bmc_covert::collect_conditions(decision_expr, conditions);
+      unsigned i=0;
+
+      for(std::set<exprt>::const_iterator
+          c_it=conditions.begin();
+          c_it!=conditions.end();
+          c_it++, i++)
+      {
+        const std::string c=from_expr(ns, "", *c_it);
+        const std::string n=i2string(i);
+
+        if(condition)
+        {
+          add_cover_goal(*c_it, "condition", "C"+n+"T",
+                         "condition "+c+" true", source_location, goals);
+          add_cover_goal(not_exprt(*c_it), "condition", "C"+n+"F",
+                         "condition "+c+" false", source_location, goals);
+        }
+
+        if(mcdc)
+        {
+          // the outcome differs with the value of the condition
+          exprt if_true=decision_expr, if_false=decision_expr;
+          replace_expr(*c_it, true_exprt(), if_true);
+          replace_expr(*c_it, false_exprt(), if_false);
+          const notequal_exprt determines(if_true, if_false);
+
+          add_cover_goal(and_exprt(*c_it, determines), "mcdc", "M"+n+"T",
+                         "condition "+c+" true, determining "+d,
+                         source_location, goals);
+          add_cover_goal(and_exprt(not_exprt(*c_it), determines),
+                         "mcdc", "M"+n+"F",
+                         "condition "+c+" false, determining "+d,
+                         source_location, goals);
+        }
+      }
+
+      // the goals take over the jumps to the branch
+      std::size_t count=goals.instructions.size();
+      body.insert_before_swap(i_it, goals);
+      for(; count!=0; count--) i_it++;
+    }
+  }
+
+  goto_functions.update();
 }
@@ -0,0 +1,21 @@
+/*******************************************************************\
+
+Module: Test-Suite Generation
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_CBMC_COVER_H
+#define CPROVER_CBMC_COVER_H
+
+#include <goto-programs/goto_functions.h>
+
+// adds the goals of decision, condition and MC/DC coverage
+// in the comma-separated list of criteria to the program
+void instrument_cover_goals(
+  const namespacet &ns,
+  goto_functionst &goto_functions,
+  const std::string &criteria);
+
+#endif
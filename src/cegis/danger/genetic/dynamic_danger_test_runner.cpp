@@ -18,11 +18,16 @@ dynamic_danger_test_runnert::~dynamic_danger_test_runnert()
   close_fitness_tester_library(handle, fitness_tester);
 }
 
-void dynamic_danger_test_runnert::run_test(individualt &ind,
-    const counterexamplet &ce, const std::function<void(bool)> on_complete)
+void dynamic_danger_test_runnert::prepare_library()
 {
   prepare_fitness_tester_library(handle, fitness_tester, source_code_provider,
       shared_library());
+}
+
+void dynamic_danger_test_runnert::run_test(individualt &ind,
+    const counterexamplet &ce, const std::function<void(bool)> on_complete)
+{
+  prepare_library();
   std::deque<unsigned int> args;
   serialise(args, ce);
   serialise(args, ind, max_prog_sz);
@@ -36,6 +41,23 @@ void dynamic_danger_test_runnert::run_test(individualt &ind,
   on_complete(EXIT_SUCCESS == fitness_tester(argv.data()));
 }
 
+void dynamic_danger_test_runnert::run_tests(individualt &ind,
+    const std::deque<counterexamplet> &ces, const size_t first,
+    const std::function<void(size_t, bool)> &on_complete,
+    const size_t max_failures)
+{
+  prepare_library();
+  ce_table.update(ces,
+      [](std::deque<unsigned int> &row, const counterexamplet &ce)
+      { serialise(row, ce);});
+  // Counterexample slots first, then the candidate.
+  std::deque<unsigned int> args(ce_table.get_width(), 0u);
+  serialise(args, ind, max_prog_sz);
+  std::vector<unsigned int> argv(args.begin(), args.end());
+  run_fitness_tests(fitness_tester, argv, 0u, ce_table, first, on_complete,
+      max_failures);
+}
+
 void dynamic_danger_test_runnert::join()
 {
 }
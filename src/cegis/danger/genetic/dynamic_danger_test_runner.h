@@ -10,12 +10,14 @@
 #ifndef CEGIS_GENETIC_DYNAMIC_DANGER_TEST_RUNNER_H_
 #define CEGIS_GENETIC_DYNAMIC_DANGER_TEST_RUNNER_H_
 
+#include <deque>
 #include <functional>
 
 #include <util/expr.h>
 #include <util/tempfile.h>
 
 #include <cegis/value/program_individual.h>
+#include <cegis/genetic/counterexample_table.h>
 
 /**
  * @brief
@@ -33,6 +35,9 @@ private:
   const temporary_filet shared_library;
   lib_handlet handle;
   fitness_testert fitness_tester;
+  counterexample_tablet ce_table;
+
+  void prepare_library();
 public:
   typedef std::map<const irep_idt, exprt> counterexamplet;
   typedef program_individualt individualt;
@@ -68,6 +73,22 @@ public:
   void run_test(individualt &ind, const counterexamplet &ce,
       std::function<void(bool)> on_complete);
 
+  /**
+   * @brief
+   *
+   * @details Runs the tests of the counterexamples from <code>first</code>
+   * on. Stops once more than <code>max_failures</code> tests failed.
+   *
+   * @param ind
+   * @param ces
+   * @param first
+   * @param on_complete
+   * @param max_failures
+   */
+  void run_tests(individualt &ind, const std::deque<counterexamplet> &ces,
+      size_t first, const std::function<void(size_t, bool)> &on_complete,
+      size_t max_failures);
+
   /**
    * @brief
    *
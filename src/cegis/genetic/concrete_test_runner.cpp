@@ -1,15 +1,20 @@
 #include <cstdlib>
+#include <cassert>
 #include <fstream>
 #include <stdexcept>
 
 #ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
 #include <sys/wait.h>
 #endif
 
 #include <util/bv_arithmetic.h>
 #include <util/mp_arith.h>
 
-#include <cegis/invariant/meta/literals.h>
 #include <cegis/genetic/concrete_test_runner.h>
 
 #define EXECUTABLE_PREFIX "test_runner"
@@ -26,6 +31,7 @@ concrete_test_runnert::concrete_test_runnert(
 
 concrete_test_runnert::~concrete_test_runnert()
 {
+  stop_evaluators();
 }
 
 namespace
@@ -33,6 +39,7 @@ namespace
 void implement_deserialise(std::string &source)
 {
   source+=
+      "#define _POSIX_C_SOURCE 200809L\n"
       "#include <stdlib.h>\n\n"
           "#define " CEGIS_PREFIX "next_arg() atol(argv[__CPROVER_cegis_deserialise_index++])\n"
           "#define " CEGIS_PREFIX "deserialise_init() unsigned int __CPROVER_cegis_deserialise_index=1u+__CPROVER_cegis_first_prog_offset\n"
@@ -51,6 +58,67 @@ void implement_deserialise(std::string &source)
 
 }
 
+/*
+ * The evaluator reads batches of the form "<count>" followed by
+ * <count> tests "<argc> <arg> ...", and answers with one character
+ * per test ('1' for success) and a newline. Every test runs in a
+ * fork of the evaluator, with its output discarded.
+ */
+void implement_evaluator(std::string &source)
+{
+  source+=
+      "\n#include <stdio.h>\n"
+      "#include <fcntl.h>\n"
+      "#include <unistd.h>\n"
+      "#include <sys/types.h>\n"
+      "#include <sys/wait.h>\n\n"
+      "#define " CEGIS_PREFIX "MAX_ARG_LEN 32\n\n"
+      "int " CONCRETE_TEST_FUNC "(const int argc, const char * const argv[]);\n\n"
+      "int main(void)\n"
+      "{\n"
+      "  const int null_fd=open(\"/dev/null\", O_WRONLY);\n"
+      "  size_t batch, argc, capacity=0u, i, j;\n"
+      "  char (*buffers)[" CEGIS_PREFIX "MAX_ARG_LEN]=0;\n"
+      "  const char **argv=0;\n"
+      "  char *results=0;\n"
+      "  while (1 == scanf(\"%zu\", &batch))\n"
+      "  {\n"
+      "    results=realloc(results, batch + 1u);\n"
+      "    for (i=0; i < batch; ++i)\n"
+      "    {\n"
+      "      if (1 != scanf(\"%zu\", &argc)) return EXIT_FAILURE;\n"
+      "      if (argc + 2u > capacity)\n"
+      "      {\n"
+      "        capacity=argc + 2u;\n"
+      "        buffers=realloc(buffers, capacity * sizeof(*buffers));\n"
+      "        argv=realloc(argv, capacity * sizeof(*argv));\n"
+      "      }\n"
+      "      argv[0]=\"" EXECUTABLE_PREFIX "\";\n"
+      "      for (j=1u; j <= argc; ++j)\n"
+      "      {\n"
+      "        if (1 != scanf(\"%31s\", buffers[j])) return EXIT_FAILURE;\n"
+      "        argv[j]=buffers[j];\n"
+      "      }\n"
+      "      argv[argc + 1u]=0;\n"
+      "      const pid_t pid=fork();\n"
+      "      if (0 == pid)\n"
+      "      {\n"
+      "        if (null_fd >= 0) dup2(null_fd, STDOUT_FILENO);\n"
+      "        _exit(" CONCRETE_TEST_FUNC "(argc + 1u, argv));\n"
+      "      }\n"
+      "      int status=0;\n"
+      "      results[i]=pid > 0 && pid == waitpid(pid, &status, 0)\n"
+      "          && WIFEXITED(status) && EXIT_SUCCESS == WEXITSTATUS(status) ?\n"
+      "          '1' : '0';\n"
+      "    }\n"
+      "    results[batch]='\\n';\n"
+      "    fwrite(results, 1u, batch + 1u, stdout);\n"
+      "    fflush(stdout);\n"
+      "  }\n"
+      "  return EXIT_SUCCESS;\n"
+      "}\n";
+}
+
 void write_file(const char * const path, const std::string &content)
 {
   std::ofstream ofs(path);
@@ -60,6 +128,8 @@ void write_file(const char * const path, const std::string &content)
 #define COMPILE_COMMAND "gcc -std=c99 -g0 -O2 "
 #define ARTIFACT_SEPARATOR " -o "
 #define COMPLING_FAILED "Compiling test runner failed."
+#define STARTING_FAILED "Starting test evaluator failed."
+#define EVALUATION_FAILED "Test evaluator failed."
 
 void prepare_executable(bool &executable_compiled,
     const std::function<std::string(void)> &source_code_provider,
@@ -71,6 +141,7 @@ void prepare_executable(bool &executable_compiled,
   std::string source;
   implement_deserialise(source);
   source+=source_code_provider();
+  implement_evaluator(source);
   write_file(source_file_name.c_str(), source);
   std::string compile_command(COMPILE_COMMAND);
   compile_command+=source_file_name;
@@ -82,89 +153,276 @@ void prepare_executable(bool &executable_compiled,
 }
 
 #ifdef _WIN32
-#define NOT_SUPPORTED() assert(!"task_poolt not supported on Windows.")
+#define NOT_SUPPORTED() assert(!"concrete_test_runnert not supported on Windows.")
 #endif
 
-class conrete_test_runner_taskt
+void append_arg(std::string &args, size_t &argc, const unsigned int value)
 {
-  concrete_test_runnert::individualt &ind;
-  const std::string command;
-public:
-  conrete_test_runner_taskt(concrete_test_runnert::individualt &ind,
-      const std::string &command) :
-      ind(ind), command(command)
+  args+=' ';
+  args+=integer2string(value);
+  ++argc;
+}
+
+#ifndef _WIN32
+/*
+ * The batch for one evaluator, and what we got back so far.
+ */
+struct transfert
+{
+  int to_fd;
+  int from_fd;
+  std::string input;
+  size_t written;
+  size_t count;
+  std::string results;
+};
+
+bool wants_input(const transfert &transfer)
+{
+  return transfer.written < transfer.input.size();
+}
+
+bool has_output(const transfert &transfer)
+{
+  return transfer.count && transfer.results.size() <= transfer.count;
+}
+
+void add_poll_fd(std::vector<pollfd> &fds, std::vector<size_t> &owners,
+    const int fd, const short events, const size_t owner)
+{
+  const pollfd entry={ fd, events, 0 };
+  fds.push_back(entry);
+  owners.push_back(owner);
+}
+
+/*
+ * Sends all batches and collects all results. Writing a whole batch
+ * before reading anything could block us on a full pipe while the
+ * evaluator is blocked on its own output, so we wait for whichever
+ * pipe is ready.
+ */
+void exchange(std::vector<transfert> &transfers)
+{
+  std::vector<pollfd> fds;
+  std::vector<size_t> owners;
+  char buffer[4096];
+  while (true)
   {
+    fds.clear();
+    owners.clear();
+    for (size_t i=0; i < transfers.size(); ++i)
+    {
+      if (wants_input(transfers[i]))
+        add_poll_fd(fds, owners, transfers[i].to_fd, POLLOUT, i);
+      if (has_output(transfers[i]))
+        add_poll_fd(fds, owners, transfers[i].from_fd, POLLIN, i);
+    }
+    if (fds.empty()) return;
+    if (poll(&fds.front(), fds.size(), -1) < 0)
+    {
+      if (EINTR == errno) continue;
+      throw std::runtime_error(EVALUATION_FAILED);
+    }
+    for (size_t i=0; i < fds.size(); ++i)
+    {
+      if (!fds[i].revents) continue;
+      transfert &transfer=transfers[owners[i]];
+      if (POLLOUT == fds[i].events)
+      {
+        const ssize_t written=write(transfer.to_fd,
+            transfer.input.data() + transfer.written,
+            transfer.input.size() - transfer.written);
+        if (written < 0 && (EAGAIN == errno || EINTR == errno)) continue;
+        if (written <= 0) throw std::runtime_error(EVALUATION_FAILED);
+        transfer.written+=written;
+      } else
+      {
+        const ssize_t bytes_read=read(transfer.from_fd, buffer,
+            sizeof(buffer));
+        if (bytes_read < 0 && (EAGAIN == errno || EINTR == errno)) continue;
+        if (bytes_read <= 0) throw std::runtime_error(EVALUATION_FAILED);
+        transfer.results.append(buffer, bytes_read);
+      }
+    }
   }
+}
+#endif
+}
 
-  int operator()() const
-  {
+void concrete_test_runnert::start_evaluators()
+{
 #ifndef _WIN32
-    const int result=system(command.c_str());
-    if (!WIFEXITED(result)) return EXIT_FAILURE;
-    return WEXITSTATUS(result);
+  if (!evaluators.empty()) return;
+  const std::string exe(executable());
+  prepare_executable(executable_compiled, source_code_provider, exe);
+  // A write to a crashed evaluator must not take us down.
+  signal(SIGPIPE, SIG_IGN);
+  const long num_cpus=sysconf(_SC_NPROCESSORS_ONLN);
+  const size_t num_evaluators=num_cpus > 0 ? num_cpus : 1u;
+  for (size_t i=0; i < num_evaluators; ++i)
+  {
+    int to_evaluator[2], from_evaluator[2];
+    if (pipe(to_evaluator)) throw std::runtime_error(STARTING_FAILED);
+    if (pipe(from_evaluator))
+    {
+      close(to_evaluator[0]);
+      close(to_evaluator[1]);
+      throw std::runtime_error(STARTING_FAILED);
+    }
+    const pid_t pid=fork();
+    if (0 == pid)
+    {
+      dup2(to_evaluator[0], STDIN_FILENO);
+      dup2(from_evaluator[1], STDOUT_FILENO);
+      close(to_evaluator[0]);
+      close(to_evaluator[1]);
+      close(from_evaluator[0]);
+      close(from_evaluator[1]);
+      for (const evaluatort &other : evaluators)
+      {
+        close(other.to_fd);
+        close(other.from_fd);
+      }
+      execl(exe.c_str(), exe.c_str(), static_cast<char *>(0));
+      _exit(EXIT_FAILURE);
+    }
+    close(to_evaluator[0]);
+    close(from_evaluator[1]);
+    if (pid < 0)
+    {
+      close(to_evaluator[1]);
+      close(from_evaluator[0]);
+      throw std::runtime_error(STARTING_FAILED);
+    }
+    // Partial writes let us serve the other evaluators meanwhile.
+    fcntl(to_evaluator[1], F_SETFL,
+        fcntl(to_evaluator[1], F_GETFL) | O_NONBLOCK);
+    const evaluatort evaluator={ pid, to_evaluator[1], from_evaluator[0] };
+    evaluators.push_back(evaluator);
+  }
 #else
-    NOT_SUPPORTED();
-    return 0;
+  NOT_SUPPORTED();
 #endif
-  }
+}
 
-  void operator()(const int status) const
-  {
+void concrete_test_runnert::stop_evaluators()
+{
 #ifndef _WIN32
-    if (!WIFEXITED(status)) return;
-    if (EXIT_SUCCESS == WEXITSTATUS(status)) ++ind.fitness;
-#else
-    NOT_SUPPORTED();
+  for (const evaluatort &evaluator : evaluators)
+  {
+    // Closing the input ends the evaluator's loop.
+    close(evaluator.to_fd);
+    close(evaluator.from_fd);
+    int status;
+    waitpid(evaluator.pid, &status, 0);
+  }
+  evaluators.clear();
 #endif
+}
+
+namespace
+{
+class fitness_callbackt
+{
+  concrete_test_runnert::individualt &ind;
+public:
+  fitness_callbackt(concrete_test_runnert::individualt &ind) :
+      ind(ind)
+  {
   }
-};
 
-#define NUM_RUNNER_OPS 3u
+  void operator()(const bool success) const
+  {
+    if (success) ++ind.fitness;
+  }
+};
 }
 
 void concrete_test_runnert::run_test(individualt &ind,
     const counterexamplet &ce)
 {
-  const std::string exe(executable());
-  prepare_executable(executable_compiled, source_code_provider, exe);
-  std::string command(exe);
+  run_test(ind, ce, fitness_callbackt(ind));
+}
+
+void concrete_test_runnert::run_test(individualt &ind,
+    const counterexamplet &ce, const on_completet &on_complete)
+{
+  std::string args;
+  size_t argc=0;
   for (const std::pair<const irep_idt, exprt> &assignment : ce)
   {
-    command+=" ";
     const bv_arithmetict arith(assignment.second);
     const mp_integer::llong_t v=arith.to_integer().to_long();
-    command+=integer2string(static_cast<unsigned int>(v));
+    append_arg(args, argc, static_cast<unsigned int>(v));
   }
   for (const individualt::programt &prog : ind.programs)
   {
     if (prog.empty()) continue;
-    command+=" ";
-    command+=integer2string(prog.size());
+    append_arg(args, argc, prog.size());
     for (const individualt::instructiont &instr : prog)
     {
-      command+=" ";
-      command+=integer2string(static_cast<unsigned int>(instr.opcode));
+      append_arg(args, argc, static_cast<unsigned int>(instr.opcode));
       size_t op_count=0;
       for (const individualt::instructiont::opt &op : instr.ops)
       {
-        command+=" ";
-        command+=integer2string(static_cast<unsigned int>(op));
+        append_arg(args, argc, static_cast<unsigned int>(op));
         ++op_count;
       }
       for (; op_count < 3u; ++op_count)
-        command+=" 0";
+        append_arg(args, argc, 0u);
     }
   }
   for (const individualt::x0t::value_type &x0 : ind.x0)
-  {
-    command+=" ";
-    command+=integer2string(static_cast<unsigned int>(x0));
-  }
-  const conrete_test_runner_taskt task(ind, command);
-  task_pool.schedule(task, task);
+    append_arg(args, argc, static_cast<unsigned int>(x0));
+  const testt test={ integer2string(argc) + args + '\n', on_complete };
+  tests.push_back(test);
+}
+
+void concrete_test_runnert::run_tests(individualt &ind,
+    const std::deque<counterexamplet> &ces, const size_t first,
+    const std::function<void(size_t, bool)> &on_complete, size_t)
+{
+  for (size_t i=first; i < ces.size(); ++i)
+    run_test(ind, ces[i], [on_complete, i](const bool success)
+    { on_complete(i, success);});
 }
 
 void concrete_test_runnert::join()
 {
-  task_pool.join_all();
+  if (tests.empty()) return;
+#ifndef _WIN32
+  start_evaluators();
+  const size_t num_evaluators=evaluators.size();
+  const size_t num_tests=tests.size();
+  // Evaluator i gets tests i, i+n, i+2n, ...
+  std::vector<transfert> transfers(num_evaluators);
+  for (size_t i=0; i < num_evaluators; ++i)
+  {
+    transfert &transfer=transfers[i];
+    transfer.to_fd=evaluators[i].to_fd;
+    transfer.from_fd=evaluators[i].from_fd;
+    transfer.written=0;
+    transfer.count=0;
+    std::string batch;
+    for (size_t t=i; t < num_tests; t+=num_evaluators)
+    {
+      batch+=tests[t].args;
+      ++transfer.count;
+    }
+    if (transfer.count)
+      transfer.input=integer2string(transfer.count) + '\n' + batch;
+  }
+  testst done;
+  done.swap(tests);
+  exchange(transfers);
+  for (size_t i=0; i < num_evaluators; ++i)
+  {
+    const std::string &results=transfers[i].results;
+    size_t index=0;
+    for (size_t t=i; t < num_tests; t+=num_evaluators)
+      done[t].on_complete('1' == results[index++]);
+  }
+#else
+  NOT_SUPPORTED();
+#endif
 }
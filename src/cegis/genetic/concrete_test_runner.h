@@ -10,36 +10,72 @@
 #ifndef CEGIS_GENETIC_CONCRETE_TEST_RUNNER_H_
 #define CEGIS_GENETIC_CONCRETE_TEST_RUNNER_H_
 
+#include <deque>
 #include <functional>
+#include <string>
+#include <vector>
 
 #include <util/expr.h>
 #include <util/tempfile.h>
 
-#include <cegis/cegis-util/task_pool.h>
-
+#include <cegis/invariant/meta/literals.h>
 #include <cegis/value/program_individual.h>
 
+/**
+ * @brief The test function the source code has to provide:
+ * int CONCRETE_TEST_FUNC(const int argc, const char * const argv[]),
+ * returning zero iff the test passes.
+ */
+#define CONCRETE_TEST_FUNC CEGIS_PREFIX "test_main"
+
 /**
  * @brief
  *
- * @details
+ * @details Runs fitness tests in long-lived evaluator processes, one per
+ * processor. Tests are queued by run_test and sent to the evaluators in
+ * batches by join. Each evaluator forks once per test, so that a crashing
+ * candidate program does not take it down, but does neither start a shell
+ * nor load the executable again. The evaluators call CONCRETE_TEST_FUNC
+ * of the provided source code.
  */
 class concrete_test_runnert
 {
-  const std::function<std::string(void)> source_code_provider;
-  const temporary_filet executable;
-  bool executable_compiled;
-  task_poolt task_pool;
 public:
   typedef std::map<const irep_idt, exprt> counterexamplet;
   typedef program_individualt individualt;
+  typedef std::function<void(bool)> on_completet;
+private:
+  const std::function<std::string(void)> source_code_provider;
+  const temporary_filet executable;
+  bool executable_compiled;
+
+  struct evaluatort
+  {
+    int pid;
+    int to_fd;
+    int from_fd;
+  };
+  typedef std::vector<evaluatort> evaluatorst;
+  evaluatorst evaluators;
+
+  struct testt
+  {
+    std::string args;
+    on_completet on_complete;
+  };
+  typedef std::vector<testt> testst;
+  testst tests;
 
+  void start_evaluators();
+  void stop_evaluators();
+public:
   /**
    * @brief
    *
    * @details
    *
-   * @param source_code_provider
+   * @param source_code_provider Provides the definition of
+   * CONCRETE_TEST_FUNC.
    */
   concrete_test_runnert(std::function<std::string(void)> source_code_provider);
 
@@ -53,7 +89,7 @@ public:
   /**
    * @brief
    *
-   * @details
+   * @details Increments the fitness of the individual if the test passes.
    *
    * @param ind
    * @param ce
@@ -64,6 +100,36 @@ public:
    * @brief
    *
    * @details
+   *
+   * @param ind
+   * @param ce
+   * @param on_complete
+   */
+  void run_test(individualt &ind, const counterexamplet &ce,
+      const on_completet &on_complete);
+
+  /**
+   * @brief
+   *
+   * @details Queues the tests of the counterexamples from
+   * <code>first</code> on. All of them are evaluated by join, regardless
+   * of <code>max_failures</code>.
+   *
+   * @param ind
+   * @param ces
+   * @param first
+   * @param on_complete Called with the index of the counterexample.
+   * @param max_failures
+   */
+  void run_tests(individualt &ind, const std::deque<counterexamplet> &ces,
+      size_t first, const std::function<void(size_t, bool)> &on_complete,
+      size_t max_failures);
+
+  /**
+   * @brief
+   *
+   * @details Evaluates all queued tests and calls their completion
+   * handlers.
    */
   void join();
 };
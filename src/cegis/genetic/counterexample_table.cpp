@@ -0,0 +1,32 @@
+/*******************************************************************
+
+ Module: Counterexample-Guided Inductive Synthesis
+
+ Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+
+#include <cegis/genetic/counterexample_table.h>
+
+counterexample_tablet::counterexample_tablet() :
+    width(0u), rows(0u)
+{
+}
+
+size_t counterexample_tablet::size() const
+{
+  return rows;
+}
+
+size_t counterexample_tablet::get_width() const
+{
+  return width;
+}
+
+const unsigned int *counterexample_tablet::row(const size_t index) const
+{
+  assert(index < rows);
+  return values.data() + index * width;
+}
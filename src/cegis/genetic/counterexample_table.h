@@ -0,0 +1,53 @@
+/*******************************************************************
+
+ Module: Counterexample-Guided Inductive Synthesis
+
+ Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CEGIS_GENETIC_COUNTEREXAMPLE_TABLE_H_
+#define CEGIS_GENETIC_COUNTEREXAMPLE_TABLE_H_
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief
+ *
+ * @details Counterexamples in serialised form, one row of equal width per
+ * counterexample. Rows are only appended, since counterexample sets only
+ * grow, so every counterexample is serialised once.
+ */
+class counterexample_tablet
+{
+  std::vector<unsigned int> values;
+  size_t width;
+  size_t rows;
+public:
+  counterexample_tablet();
+
+  /**
+   * @brief
+   *
+   * @details Serialises the counterexamples not in the table yet.
+   *
+   * @param ces
+   * @param serialise
+   * @tparam cest
+   */
+  template<class cest>
+  void update(const cest &ces,
+      const std::function<void(std::deque<unsigned int> &,
+          const typename cest::value_type &)> &serialise);
+
+  size_t size() const;
+  size_t get_width() const;
+  const unsigned int *row(size_t index) const;
+};
+
+#include "counterexample_table.inc"
+
+#endif /* CEGIS_GENETIC_COUNTEREXAMPLE_TABLE_H_ */
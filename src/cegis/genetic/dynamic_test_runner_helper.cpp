@@ -2,6 +2,7 @@
 #include <dlfcn.h> // TODO: Windows MinGW/VS equivalent?
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <fstream>
@@ -165,3 +166,21 @@ void serialise(std::deque<unsigned int> &stream,
     stream.push_back(static_cast<unsigned int>(v));
   }
 }
+
+void run_fitness_tests(fitness_testert fitness_tester,
+    std::vector<unsigned int> &argv, const size_t offset,
+    const counterexample_tablet &table, const size_t first,
+    const fitness_resultt &on_complete, const size_t max_failures)
+{
+  const size_t width=table.get_width();
+  assert(offset + width <= argv.size());
+  unsigned int * const slots=argv.data() + offset;
+  size_t failures=0u;
+  for (size_t i=first; i < table.size(); ++i)
+  {
+    std::copy(table.row(i), table.row(i) + width, slots);
+    const bool success=EXIT_SUCCESS == fitness_tester(argv.data());
+    on_complete(i, success);
+    if (!success && ++failures > max_failures) return;
+  }
+}
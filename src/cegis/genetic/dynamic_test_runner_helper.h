@@ -3,8 +3,11 @@
 
 #include <deque>
 #include <functional>
+#include <vector>
 #include <util/expr.h>
 
+#include <cegis/genetic/counterexample_table.h>
+
 typedef int (*fitness_testert)(const unsigned int[]);
 typedef void *fitness_lib_handlet;
 
@@ -66,4 +69,28 @@ void serialise(std::deque<unsigned int> &stream,
 void serialise(std::deque<unsigned int> &stream,
     const std::map<const irep_idt, exprt> assignments);
 
+typedef std::function<void(size_t, bool)> fitness_resultt;
+
+/**
+ * @brief
+ *
+ * @details Runs the fitness tester on the counterexamples from
+ * <code>first</code> on. The argument vector holds the candidate and
+ * <code>table.get_width()</code> slots at <code>offset</code>, which are
+ * overwritten with one counterexample after the other. Stops once more
+ * than <code>max_failures</code> tests failed.
+ *
+ * @param fitness_tester
+ * @param argv
+ * @param offset
+ * @param table
+ * @param first
+ * @param on_complete
+ * @param max_failures
+ */
+void run_fitness_tests(fitness_testert fitness_tester,
+    std::vector<unsigned int> &argv, size_t offset,
+    const counterexample_tablet &table, size_t first,
+    const fitness_resultt &on_complete, size_t max_failures);
+
 #endif /* CEGIS_DYNAMIC_TEST_RUNNER_HELPER_H_ */
@@ -39,7 +39,8 @@ private:
   bool is_population_initialised;
   std::function<bool(void)> is_evolving;
 
-  bool set_fitness(typename selectt::individualt &ind);
+  bool set_fitness(typename selectt::individualt &ind,
+      typename selectt::individualt::fitnesst min_fitness=0u);
 public:
   /**
    * @brief
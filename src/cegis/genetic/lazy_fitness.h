@@ -86,8 +86,12 @@ public:
    * @details
    *
    * @param individual
+   * @param min_fitness Evaluation stops as soon as the individual can no
+   * longer reach this fitness. Skipped tests count as failures. Zero
+   * evaluates all tests.
    */
-  void set_fitness(individualt &individual);
+  void set_fitness(individualt &individual,
+      typename individualt::fitnesst min_fitness=0u);
 
   /**
    * @brief
@@ -58,10 +58,23 @@ bool contains(const std::string &haystack, const std::string &needle)
   return std::string::npos != haystack.find(needle);
 }
 
-bool handle_start(std::string &source, const std::string &line)
+bool handle_start(std::string &source, bool &in_start,
+    const std::string &entry_func_name, const std::string &line)
 {
   if ("void _start(void)" != line) return false;
-  source+="int main(const int argc, const char * const argv[])\n";
+  source+="int ";
+  source+=entry_func_name;
+  source+="(const int argc, const char * const argv[])\n";
+  in_start=true;
+  return true;
+}
+
+bool handle_start_end(std::string &source, bool &in_start,
+    const std::string &line)
+{
+  if (!in_start || "}" != line) return false;
+  source+="  return 0;\n}\n";
+  in_start=false;
   return true;
 }
 
@@ -199,13 +212,17 @@ bool handle_internals(const std::string &line)
       || "static signed int assert#return_value;" == line;
 }
 
-std::string &post_process(std::string &source, std::stringstream &ss)
+std::string &post_process(std::string &source, std::stringstream &ss,
+    const std::string &entry_func_name)
 {
   bool deserialise_initialised=false;
   bool ce_initialised=false;
+  bool in_start=false;
   for (std::string line; std::getline(ss, line);)
   {
-    if (handle_start(source, line) || handle_return_value(line)
+    if (handle_start(source, in_start, entry_func_name, line)
+        || handle_start_end(source, in_start, line)
+        || handle_return_value(line)
         || handle_ce_loop(line, ss) || handle_internals(line)
         || handle_programs(source, deserialise_initialised, line)
         || handle_x0(source, line) || handle_ce(source, ce_initialised, line)
@@ -232,7 +249,8 @@ void add_first_prog_offset(std::string &source, const size_t num_ce_vars)
 std::string &post_process_fitness_source(std::string &result,
     const symbol_tablet &st, const goto_functionst &gf,
     const size_t num_ce_vars, const size_t num_vars, const size_t num_consts,
-    const size_t max_prog_size, const std::string &exec)
+    const size_t max_prog_size, const std::string &exec,
+    const std::string &entry_func_name)
 {
   const namespacet ns(st);
   std::stringstream ss;
@@ -240,5 +258,5 @@ std::string &post_process_fitness_source(std::string &result,
   add_first_prog_offset(result, num_ce_vars);
   add_assume_implementation(result);
   add_danger_execute(result, num_vars, num_consts, max_prog_size, exec);
-  return post_process(result, ss);
+  return post_process(result, ss, entry_func_name);
 }
@@ -26,6 +26,7 @@ class concrete_fitness_source_providert
   configt learn_config;
   const std::function<size_t(void)> max_size;
   const std::string execute_func_name;
+  const std::string entry_func_name;
   std::string source;
 public:
   /**
@@ -36,10 +37,13 @@ public:
    * @param prog
    * @param max_size
    * @param execute_func_name
+   * @param entry_func_name The name of the generated test function, which
+   * takes argc and argv and returns zero iff the test passes.
    */
   concrete_fitness_source_providert(const progt &prog,
       std::function<size_t(void)> max_size,
-      const std::string &execute_func_name);
+      const std::string &execute_func_name,
+      const std::string &entry_func_name="main");
 
   /**
    * @brief
@@ -75,7 +79,7 @@ public:
 std::string &post_process_fitness_source(std::string &result,
     const symbol_tablet &st, const goto_functionst &gf, size_t num_ce_vars,
     size_t num_vars, size_t num_consts, size_t max_prog_size,
-    const std::string &exec_func_name);
+    const std::string &exec_func_name, const std::string &entry_func_name);
 
 #include "concrete_fitness_source_provider.inc"
 
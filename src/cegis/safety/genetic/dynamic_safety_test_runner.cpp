@@ -20,8 +20,7 @@ dynamic_safety_test_runnert::~dynamic_safety_test_runnert()
   close_fitness_tester_library(handle, fitness_tester);
 }
 
-void dynamic_safety_test_runnert::run_test(individualt &ind,
-    const counterexamplet &ce, const std::function<void(bool)> on_complete)
+void dynamic_safety_test_runnert::prepare_library()
 {
   const auto source_code_provider=
       [this]()
@@ -33,15 +32,29 @@ void dynamic_safety_test_runnert::run_test(individualt &ind,
       };
   prepare_fitness_tester_library(handle, fitness_tester, source_code_provider,
       shared_library(), false);
+}
+
+namespace
+{
+void serialise_ce(std::deque<unsigned int> &args, const safety_goto_cet &ce)
+{
+  serialise(args, ce.x0);
+  // TODO: Implement for multiple loops (change constraint, instrumentation)
+  assert(ce.x.size() == 1u);
+  serialise(args, ce.x.front());
+}
+}
+
+void dynamic_safety_test_runnert::run_test(individualt &ind,
+    const counterexamplet &ce, const std::function<void(bool)> on_complete)
+{
+  prepare_library();
   assert(ind.x0.empty());
   std::deque<unsigned int> args;
   // TODO: Implement for multiple loops (change constraint, instrumentation)
   assert(ind.programs.size() == 1u);
   serialise(args, ind, max_prog_sz);
-  serialise(args, ce.x0);
-  // TODO: Implement for multiple loops (change constraint, instrumentation)
-  assert(ce.x.size() == 1u);
-  serialise(args, ce.x.front());
+  serialise_ce(args, ce);
 
   const int argc=args.size();
   std::vector<unsigned int> argv;
@@ -52,6 +65,26 @@ void dynamic_safety_test_runnert::run_test(individualt &ind,
   on_complete(EXIT_SUCCESS == fitness_tester(argv.data()));
 }
 
+void dynamic_safety_test_runnert::run_tests(individualt &ind,
+    const std::deque<counterexamplet> &ces, const size_t first,
+    const std::function<void(size_t, bool)> &on_complete,
+    const size_t max_failures)
+{
+  prepare_library();
+  assert(ind.x0.empty());
+  ce_table.update(ces, &serialise_ce);
+  // The candidate first, then the counterexample slots.
+  std::deque<unsigned int> args;
+  // TODO: Implement for multiple loops (change constraint, instrumentation)
+  assert(ind.programs.size() == 1u);
+  serialise(args, ind, max_prog_sz);
+  const size_t offset=args.size();
+  args.resize(offset + ce_table.get_width(), 0u);
+  std::vector<unsigned int> argv(args.begin(), args.end());
+  run_fitness_tests(fitness_tester, argv, offset, ce_table, first,
+      on_complete, max_failures);
+}
+
 void dynamic_safety_test_runnert::join()
 {
 }
@@ -297,44 +297,52 @@ bool disjunctive_polynomial_accelerationt::accelerate(
 }
 
 bool disjunctive_polynomial_accelerationt::find_path(patht &path) {
-  scratch_programt program(symbol_table);
+  try {
+    if (!path_program) {
+      // The two copies of the loop body are encoded once.  Each query
+      // only adds the constraints excluding the paths found since.
+      std::unique_ptr<scratch_programt> program(
+        new scratch_programt(symbol_table));
+
+      program->append(fixed);
+      program->append(fixed);
+      program->add_instruction(ASSERT)->guard = false_exprt();
+      program->encode();
+
+      path_program.swap(program);
+    }
 
-  program.append(fixed);
-  program.append(fixed);
+    // Let's make sure that we get a path we have not seen before.
+    list<distinguish_valuest>::iterator it = accelerated_paths.begin();
+    advance(it, blocked_paths);
 
-  // Let's make sure that we get a path we have not seen before.
-  for (list<distinguish_valuest>::iterator it = accelerated_paths.begin();
-       it != accelerated_paths.end();
-       ++it) {
-    exprt new_path = false_exprt();
+    for ( ; it != accelerated_paths.end(); ++it, ++blocked_paths) {
+      exprt new_path = false_exprt();
 
-    for (distinguish_valuest::iterator jt = it->begin();
-         jt != it->end();
-         ++jt) {
-      exprt distinguisher = jt->first;
-      bool taken = jt->second;
+      for (distinguish_valuest::iterator jt = it->begin();
+           jt != it->end();
+           ++jt) {
+        exprt distinguisher = jt->first;
+        bool taken = jt->second;
 
-      if (taken) {
-        not_exprt negated(distinguisher);
-        distinguisher.swap(negated);
+        if (taken) {
+          not_exprt negated(distinguisher);
+          distinguisher.swap(negated);
+        }
+
+        or_exprt disjunct(new_path, distinguisher);
+        new_path.swap(disjunct);
       }
 
-      or_exprt disjunct(new_path, distinguisher);
-      new_path.swap(disjunct);
+      path_program->add_constraint(new_path);
     }
 
-    program.assume(new_path);
-  }
-
-  program.add_instruction(ASSERT)->guard = false_exprt();
-
-  try {
-    if (program.check_sat()) {
+    if (path_program->check_sat_assuming(true_exprt())) {
 #ifdef DEBUG
       std::cout << "Found a path" << std::endl;
 #endif
-      build_path(program, path);
-      record_path(program);
+      build_path(*path_program, path);
+      record_path(*path_program);
 
       return true;
     }
@@ -2,6 +2,7 @@
 #define DISJUNCTIVE_POLYNOMIAL_ACCELERATION_H
 
 #include <map>
+#include <memory>
 #include <set>
 
 #include <util/symbol_table.h>
@@ -34,7 +35,8 @@ class disjunctive_polynomial_accelerationt : public loop_accelerationt {
       goto_program(_goto_program),
       loop(_loop),
       loop_header(_loop_header),
-      utils(symbol_table, goto_functions, loop_counter)
+      utils(symbol_table, goto_functions, loop_counter),
+      blocked_paths(0)
   {
     loop_counter = nil_exprt();
     find_distinguishing_points();
@@ -85,6 +87,10 @@ class disjunctive_polynomial_accelerationt : public loop_accelerationt {
   expr_sett modified;
   goto_programt fixed;
   list<distinguish_valuest> accelerated_paths;
+
+  // Path enumeration query, kept across calls to reuse its encoding.
+  std::unique_ptr<scratch_programt> path_program;
+  std::size_t blocked_paths;
 };
 
 #endif // DISJUNCTIVE_POLYNOMIAL_ACCELERATION_H
@@ -2,6 +2,7 @@
 #define DISJUNCTIVE_POLYNOMIAL_ACCELERATION_H
 
 #include <map>
+#include <memory>
 #include <set>
 
 #include <util/symbol_table.h>
@@ -35,7 +36,8 @@ class sat_path_enumeratort : public path_enumeratort {
       goto_program(_goto_program),
       loop(_loop),
       loop_header(_loop_header),
-      utils(symbol_table, goto_functions, loop_counter)
+      utils(symbol_table, goto_functions, loop_counter),
+      blocked_paths(0)
   {
     find_distinguishing_points();
     build_fixed();
@@ -68,6 +70,10 @@ class sat_path_enumeratort : public path_enumeratort {
   expr_sett modified;
   goto_programt fixed;
   list<distinguish_valuest> accelerated_paths;
+
+  // Path enumeration query, kept across calls to reuse its encoding.
+  std::unique_ptr<scratch_programt> path_program;
+  std::size_t blocked_paths;
 };
 
 #endif // DISJUNCTIVE_POLYNOMIAL_ACCELERATION_H
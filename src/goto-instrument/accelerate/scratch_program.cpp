@@ -1,3 +1,5 @@
+#include <cassert>
+
 #include <util/i2string.h>
 #include <util/fixedbv.h>
 #include <util/decision_procedure.h>
@@ -14,7 +16,7 @@
 #include <iostream>
 #endif
 
-bool scratch_programt::check_sat(bool do_slice)
+void scratch_programt::run_symex(bool do_slice)
 {
   fix_types();
 
@@ -36,6 +38,11 @@ bool scratch_programt::check_sat(bool do_slice)
   if (do_slice) {
     slice(equation);
   }
+}
+
+bool scratch_programt::check_sat(bool do_slice)
+{
+  run_symex(do_slice);
 
   if (equation.count_assertions() == 0) {
     // Symex sliced away all our assertions.
@@ -54,6 +61,46 @@ bool scratch_programt::check_sat(bool do_slice)
   return (checker->dec_solve() == decision_proceduret::D_SATISFIABLE);
 }
 
+void scratch_programt::encode() {
+  assert(!encoded);
+
+  // Later constraints may mention any variable of the program, so we
+  // can't slice.  The external SMT solver isn't incremental, so we use
+  // the SAT back end and keep all of its variables alive.
+  run_symex(false);
+
+  checker = &satchecker;
+  satchecker.set_all_frozen();
+  equation.convert(*checker);
+  encoded = true;
+}
+
+void scratch_programt::add_constraint(const exprt &e) {
+  assert(encoded);
+
+  exprt ssa = e;
+  symex_state.rename(ssa, ns);
+  checker->set_to_true(ssa);
+}
+
+bool scratch_programt::check_sat_assuming(const exprt &assumption) {
+  assert(encoded);
+
+  exprt ssa = assumption;
+  symex_state.rename(ssa, ns);
+
+  bvt assumptions;
+  assumptions.push_back(checker->convert(ssa));
+  checker->set_assumptions(assumptions);
+
+  bool result =
+    (checker->dec_solve() == decision_proceduret::D_SATISFIABLE);
+
+  checker->set_assumptions(bvt());
+
+  return result;
+}
+
 exprt scratch_programt::eval(const exprt &e) {
   exprt ssa = e;
 
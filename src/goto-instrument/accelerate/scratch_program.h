@@ -32,7 +32,8 @@ class scratch_programt : public goto_programt {
       satchecker(ns, *satcheck),
       z3(ns, "accelerate", "", "", smt2_dect::Z3),
 
-      checker(&z3)
+      checker(&z3),
+      encoded(false)
       //checker(&satchecker)
   {
   }
@@ -57,6 +58,17 @@ class scratch_programt : public goto_programt {
 
   exprt eval(const exprt &e);
 
+  // Incremental use: encode() converts the program once into a SAT
+  // instance that is kept alive.  Constraints and assumptions added
+  // afterwards refer to the values at the end of the program.
+  void encode();
+  void add_constraint(const exprt &e);
+  bool check_sat_assuming(const exprt &assumption);
+
+  bool is_encoded() const {
+    return encoded;
+  }
+
   void fix_types();
 
   bool constant_propagation;
@@ -74,6 +86,9 @@ class scratch_programt : public goto_programt {
   bv_pointerst satchecker;
   smt2_dect z3;
   prop_convt *checker;
+  bool encoded;
+
+  void run_symex(bool do_slice);
 };
 
 #endif // SCRATCH_PROGRAM_H
@@ -596,10 +596,24 @@ int goto_instrument_parse_optionst::doit()
       goto_functions.update();
     }
     
-    if(cmdline.isset("horn-encoding"))
+    if(cmdline.isset("horn"))
     {
-      status() << "Horn-clause encoding" << eom;
+      do_function_pointer_removal();
+
       namespacet ns(symbol_table);
+
+      status() << "Performing full inlining" << eom;
+      goto_inline(goto_functions, ns, ui_message_handler);
+
+      status() << "Pointer Analysis" << eom;
+      value_set_analysist value_set_analysis(ns);
+      value_set_analysis(goto_functions);
+
+      status() << "Removing Pointers" << eom;
+      remove_pointers(goto_functions, symbol_table, value_set_analysis);
+      goto_functions.update();
+
+      status() << "Horn-clause encoding" << eom;
       
       if(cmdline.args.size()==2)
       {
@@ -1322,6 +1336,7 @@ void goto_instrument_parse_optionst::help()
     " --base-case                  k-induction: do base-case\n"
     " --havoc-loops                over-approximate all loops\n"
     " --accelerate                 add loop accelerators\n"
+    " --horn                       encode program as constrained Horn clauses\n"
     " --skip-loops <loop-ids>      add gotos to skip selected loops during execution\n"
     "\n"
     "Memory model instrumentations:\n"
@@ -10,11 +10,596 @@ Date: June 2015
 
 #include <ostream>
 
+#include <util/i2string.h>
+#include <util/std_expr.h>
+#include <util/std_code.h>
+#include <util/replace_symbol.h>
+
+#include <solvers/smt2/smt2_conv.h>
+
 #include "horn_encoding.h"
 
 /*******************************************************************\
 
-Function: horn_encoding
+   Class: horn_smt2_convt
+
+ Purpose: gives access to the term printer of the SMT2 back-end;
+          variables bound by a quantifier must not be declared
+
+\*******************************************************************/
+
+class horn_smt2_convt:public smt2_convt
+{
+public:
+  horn_smt2_convt(const namespacet &_ns, std::ostream &_out):
+    smt2_convt(_ns, "", "Horn-clause encoding", "HORN", GENERIC, _out)
+  {
+  }
+
+  void bind(const symbol_exprt &expr)
+  {
+    identifier_map[expr.get_identifier()].type=expr.type();
+  }
+
+  void prepare(const exprt &expr)
+  {
+    find_symbols(expr);
+  }
+
+  void convert_variable(const symbol_exprt &expr)
+  {
+    out << "(|" << convert_identifier(expr.get_identifier()) << "| ";
+    convert_type(expr.type());
+    out << ")";
+  }
+};
+
+/*******************************************************************\
+
+   Class: horn_encodingt
+
+ Purpose: large-block encoding of the entry function; there is one
+          predicate for the entry location and for every location
+          that has more than one predecessor, which includes all
+          loop heads
+
+\*******************************************************************/
+
+class horn_encodingt
+{
+public:
+  horn_encodingt(
+    const goto_functionst &_goto_functions,
+    const namespacet &_ns,
+    std::ostream &_out):
+    goto_functions(_goto_functions),
+    ns(_ns),
+    out(_out),
+    smt2(_ns, _out),
+    nondet_count(0)
+  {
+  }
+
+  void operator()();
+
+protected:
+  const goto_functionst &goto_functions;
+  const namespacet &ns;
+  std::ostream &out;
+  horn_smt2_convt smt2;
+  unsigned nondet_count;
+
+  typedef goto_programt::const_targett locationt;
+  typedef std::map<locationt, std::string> predicatest;
+  predicatest predicates;
+
+  typedef std::map<irep_idt, symbol_exprt> variablest;
+  variablest variables;
+
+  // the values of the variables in terms of those at the cut-point
+  struct statet
+  {
+    replace_symbolt values;
+    exprt::operandst guard;
+    std::vector<symbol_exprt> nondets;
+  };
+
+  void collect_variables(const exprt &expr);
+  void find_cut_points(const goto_programt &goto_program);
+
+  symbol_exprt nondet(const typet &type, statet &state);
+  exprt rename(const exprt &expr, statet &state);
+  void assign(const exprt &lhs, const exprt &rhs, statet &state);
+  void havoc_globals(statet &state);
+
+  void encode(locationt cut_point);
+  void encode_rec(
+    locationt cut_point,
+    locationt l,
+    statet &state,
+    bool first);
+
+  void predicate(const std::string &name, const exprt::operandst &args);
+  void rule(
+    locationt cut_point,
+    const statet &state,
+    const exprt &condition,
+    const predicatest::const_iterator target);
+};
+
+/*******************************************************************\
+
+Function: horn_encodingt::collect_variables
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void horn_encodingt::collect_variables(const exprt &expr)
+{
+  if(expr.id()==ID_symbol)
+  {
+    if(expr.type().id()!=ID_code)
+      variables.insert(std::make_pair(
+        to_symbol_expr(expr).get_identifier(), to_symbol_expr(expr)));
+  }
+  else
+    forall_operands(it, expr)
+      collect_variables(*it);
+}
+
+/*******************************************************************\
+
+Function: horn_encodingt::find_cut_points
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void horn_encodingt::find_cut_points(const goto_programt &goto_program)
+{
+  std::map<locationt, unsigned> predecessors;
+
+  forall_goto_program_instructions(it, goto_program)
+  {
+    goto_programt::const_targetst successors;
+    goto_program.get_successors(it, successors);
+
+    for(goto_programt::const_targetst::const_iterator
+        s_it=successors.begin();
+        s_it!=successors.end();
+        s_it++)
+      predecessors[*s_it]++;
+
+    collect_variables(it->code);
+    collect_variables(it->guard);
+  }
+
+  locationt entry=goto_program.instructions.begin();
+  predicates[entry]="";
+
+  forall_goto_program_instructions(it, goto_program)
+    if(predecessors[it]>1)
+      predicates[it]="";
+
+  unsigned count=0;
+
+  for(predicatest::iterator
+      p_it=predicates.begin();
+      p_it!=predicates.end();
+      p_it++)
+    p_it->second="|inv"+i2string(count++)+"|";
+}
+
+/*******************************************************************\
+
+Function: horn_encodingt::nondet
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+symbol_exprt horn_encodingt::nondet(const typet &type, statet &state)
+{
+  symbol_exprt result("horn::nondet"+i2string(nondet_count++), type);
+  state.nondets.push_back(result);
+  smt2.bind(result);
+  return result;
+}
+
+/*******************************************************************\
+
+Function: horn_encodingt::rename
+
+  Inputs:
+
+ Outputs: the expression in terms of the variables at the cut-point
+
+ Purpose:
+
+\*******************************************************************/
+
+exprt horn_encodingt::rename(const exprt &expr, statet &state)
+{
+  if(expr.id()==ID_side_effect &&
+     to_side_effect_expr(expr).get_statement()==ID_nondet)
+    return nondet(expr.type(), state);
+  else if(expr.id()==ID_nondet_symbol)
+    return nondet(expr.type(), state);
+  else if(expr.id()==ID_address_of)
+    return expr;
+  else if(expr.id()==ID_dereference)
+    throw "Horn encoding does not support pointer dereferencing, "
+          "remove pointers first";
+  else if(expr.id()==ID_symbol)
+  {
+    exprt tmp=expr;
+    state.values.replace(tmp);
+    return tmp;
+  }
+
+  exprt tmp=expr;
+
+  Forall_operands(it, tmp)
+    *it=rename(*it, state);
+
+  return tmp;
+}
+
+/*******************************************************************\
+
+Function: horn_encodingt::assign
+
+  Inputs: lhs and the renamed value
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void horn_encodingt::assign(
+  const exprt &lhs,
+  const exprt &rhs,
+  statet &state)
+{
+  if(lhs.id()==ID_symbol)
+  {
+    const irep_idt &identifier=to_symbol_expr(lhs).get_identifier();
+    state.values.expr_map[identifier]=rhs;
+  }
+  else if(lhs.id()==ID_index)
+  {
+    const index_exprt &index_expr=to_index_expr(lhs);
+    with_exprt new_value(
+      rename(index_expr.array(), state),
+      rename(index_expr.index(), state),
+      rhs);
+    assign(index_expr.array(), new_value, state);
+  }
+  else if(lhs.id()==ID_member)
+  {
+    const member_exprt &member_expr=to_member_expr(lhs);
+    exprt where(ID_member_name);
+    where.set(ID_component_name, member_expr.get_component_name());
+    with_exprt new_value(
+      rename(member_expr.struct_op(), state),
+      where,
+      rhs);
+    assign(member_expr.struct_op(), new_value, state);
+  }
+  else if(lhs.id()==ID_typecast)
+  {
+    const exprt &op=to_typecast_expr(lhs).op();
+    assign(op, typecast_exprt(rhs, op.type()), state);
+  }
+  else
+    throw "Horn encoding does not support assignments to "+
+          lhs.id_string();
+}
+
+/*******************************************************************\
+
+Function: horn_encodingt::havoc_globals
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void horn_encodingt::havoc_globals(statet &state)
+{
+  for(variablest::const_iterator
+      v_it=variables.begin();
+      v_it!=variables.end();
+      v_it++)
+  {
+    const symbolt *symbol;
+    if(!ns.lookup(v_it->first, symbol) && symbol->is_static_lifetime)
+      assign(v_it->second, nondet(v_it->second.type(), state), state);
+  }
+}
+
+/*******************************************************************\
+
+Function: horn_encodingt::predicate
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void horn_encodingt::predicate(
+  const std::string &name,
+  const exprt::operandst &args)
+{
+  if(args.empty())
+  {
+    out << name;
+    return;
+  }
+
+  out << "(" << name;
+
+  for(exprt::operandst::const_iterator
+      it=args.begin();
+      it!=args.end();
+      it++)
+  {
+    out << " ";
+    smt2.convert_expr(*it);
+  }
+
+  out << ")";
+}
+
+/*******************************************************************\
+
+Function: horn_encodingt::rule
+
+  Inputs: the target predicate, or predicates.end() for a query
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void horn_encodingt::rule(
+  locationt cut_point,
+  const statet &state,
+  const exprt &condition,
+  const predicatest::const_iterator target)
+{
+  exprt::operandst guard=state.guard;
+  if(condition.is_not_nil())
+    guard.push_back(condition);
+
+  exprt::operandst args;
+
+  for(variablest::const_iterator
+      v_it=variables.begin();
+      v_it!=variables.end();
+      v_it++)
+  {
+    exprt tmp=v_it->second;
+    state.values.replace(tmp);
+    args.push_back(tmp);
+  }
+
+  // auxiliary definitions have to go before the rule
+  for(exprt::operandst::const_iterator
+      it=guard.begin();
+      it!=guard.end();
+      it++)
+    smt2.prepare(*it);
+
+  if(target!=predicates.end())
+    for(exprt::operandst::const_iterator
+        it=args.begin();
+        it!=args.end();
+        it++)
+      smt2.prepare(*it);
+
+  out << "(assert ";
+
+  bool quantified=!variables.empty() || !state.nondets.empty();
+
+  if(quantified)
+  {
+    out << "(forall (";
+
+    for(variablest::const_iterator
+        v_it=variables.begin();
+        v_it!=variables.end();
+        v_it++)
+      smt2.convert_variable(v_it->second);
+
+    for(std::vector<symbol_exprt>::const_iterator
+        it=state.nondets.begin();
+        it!=state.nondets.end();
+        it++)
+      smt2.convert_variable(*it);
+
+    out << ") ";
+  }
+
+  exprt::operandst current;
+
+  for(variablest::const_iterator
+      v_it=variables.begin();
+      v_it!=variables.end();
+      v_it++)
+    current.push_back(v_it->second);
+
+  out << "(=> (and ";
+  predicate(predicates.find(cut_point)->second, current);
+
+  for(exprt::operandst::const_iterator
+      it=guard.begin();
+      it!=guard.end();
+      it++)
+  {
+    out << " ";
+    smt2.convert_expr(*it);
+  }
+
+  out << ") ";
+
+  if(target==predicates.end())
+    out << "false";
+  else
+    predicate(target->second, args);
+
+  out << ")";
+
+  if(quantified)
+    out << ")";
+
+  out << ")\n";
+}
+
+/*******************************************************************\
+
+Function: horn_encodingt::encode_rec
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: follows all paths from the cut-point up to the next
+          cut-points; these form a tree, so the number of rules is
+          linear in the size of the program
+
+\*******************************************************************/
+
+void horn_encodingt::encode_rec(
+  locationt cut_point,
+  locationt l,
+  statet &state,
+  bool first)
+{
+  while(true)
+  {
+    if(!first)
+    {
+      predicatest::const_iterator p_it=predicates.find(l);
+
+      if(p_it!=predicates.end())
+      {
+        rule(cut_point, state, nil_exprt(), p_it);
+        return;
+      }
+    }
+
+    first=false;
+
+    switch(l->type)
+    {
+    case GOTO:
+      {
+        assert(l->targets.size()==1);
+        exprt guard=rename(l->guard, state);
+
+        if(guard.is_true())
+        {
+          l=l->targets.front();
+          continue;
+        }
+
+        statet taken=state;
+        taken.guard.push_back(guard);
+        encode_rec(cut_point, l->targets.front(), taken, false);
+
+        state.guard.push_back(not_exprt(guard));
+      }
+      break;
+
+    case ASSUME:
+      state.guard.push_back(rename(l->guard, state));
+      break;
+
+    case ASSERT:
+      rule(
+        cut_point,
+        state,
+        not_exprt(rename(l->guard, state)),
+        predicates.end());
+      break;
+
+    case ASSIGN:
+      {
+        const code_assignt &code=to_code_assign(l->code);
+        assign(code.lhs(), rename(code.rhs(), state), state);
+      }
+      break;
+
+    case DECL:
+      {
+        const exprt &symbol=to_code_decl(l->code).symbol();
+        assign(symbol, nondet(symbol.type(), state), state);
+      }
+      break;
+
+    case FUNCTION_CALL:
+      {
+        // functions are inlined before, what remains has no body
+        // or is recursive
+        const code_function_callt &code=to_code_function_call(l->code);
+
+        havoc_globals(state);
+
+        if(code.lhs().is_not_nil())
+          assign(code.lhs(), nondet(code.lhs().type(), state), state);
+      }
+      break;
+
+    case END_FUNCTION:
+      return;
+
+    case START_THREAD:
+    case END_THREAD:
+    case THROW:
+    case CATCH:
+      throw "Horn encoding does not support "+
+            id2string(l->code.get_statement());
+
+    case RETURN:
+    case DEAD:
+    case SKIP:
+    case LOCATION:
+    case OTHER:
+    case ATOMIC_BEGIN:
+    case ATOMIC_END:
+    case NO_INSTRUCTION_TYPE:
+      break;
+    }
+
+    l++;
+  }
+}
+
+/*******************************************************************\
+
+Function: horn_encodingt::encode
 
   Inputs:
 
@@ -24,9 +609,134 @@ Function: horn_encoding
 
 \*******************************************************************/
 
+void horn_encodingt::encode(locationt cut_point)
+{
+  out << "\n";
+
+  const std::string location=cut_point->source_location.as_string();
+  if(!location.empty())
+    out << "; " << location << "\n";
+
+  statet state;
+  encode_rec(cut_point, cut_point, state, true);
+}
+
+/*******************************************************************\
+
+Function: horn_encodingt::operator()
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void horn_encodingt::operator()()
+{
+  goto_functionst::function_mapt::const_iterator f_it=
+    goto_functions.function_map.find(goto_functionst::entry_point());
+
+  if(f_it==goto_functions.function_map.end() ||
+     !f_it->second.body_available())
+    throw "Horn encoding needs an entry point";
+
+  const goto_programt &goto_program=f_it->second.body;
+
+  find_cut_points(goto_program);
+
+  for(variablest::const_iterator
+      v_it=variables.begin();
+      v_it!=variables.end();
+      v_it++)
+    smt2.bind(v_it->second);
+
+  out << "\n";
+
+  for(predicatest::const_iterator
+      p_it=predicates.begin();
+      p_it!=predicates.end();
+      p_it++)
+  {
+    for(variablest::const_iterator
+        v_it=variables.begin();
+        v_it!=variables.end();
+        v_it++)
+      smt2.prepare(v_it->second);
+
+    out << "(declare-fun " << p_it->second << " (";
+
+    for(variablest::const_iterator
+        v_it=variables.begin();
+        v_it!=variables.end();
+        v_it++)
+    {
+      if(v_it!=variables.begin())
+        out << " ";
+      smt2.convert_type(v_it->second.type());
+    }
+
+    out << ") Bool)\n";
+  }
+
+  // the entry location is reachable with any values
+  locationt entry=goto_program.instructions.begin();
+  exprt::operandst current;
+
+  for(variablest::const_iterator
+      v_it=variables.begin();
+      v_it!=variables.end();
+      v_it++)
+    current.push_back(v_it->second);
+
+  out << "\n(assert ";
+
+  if(!variables.empty())
+  {
+    out << "(forall (";
+    for(variablest::const_iterator
+        v_it=variables.begin();
+        v_it!=variables.end();
+        v_it++)
+      smt2.convert_variable(v_it->second);
+    out << ") ";
+  }
+
+  predicate(predicates[entry], current);
+
+  if(!variables.empty())
+    out << ")";
+
+  out << ")\n";
+
+  for(predicatest::const_iterator
+      p_it=predicates.begin();
+      p_it!=predicates.end();
+      p_it++)
+    encode(p_it->first);
+
+  out << "\n(check-sat)\n";
+}
+
+/*******************************************************************\
+
+Function: horn_encoding
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: writes constrained Horn clauses in SMT-LIB2 format; the
+          clauses are satisfiable iff no assertion can be violated
+
+\*******************************************************************/
+
 void horn_encoding(
-  const goto_functionst &,
-  const namespacet &,
+  const goto_functionst &goto_functions,
+  const namespacet &ns,
   std::ostream &out)
 {
+  horn_encodingt horn_encoding(goto_functions, ns, out);
+  horn_encoding();
 }
@@ -48,9 +48,9 @@ void event_grapht::graph_explorert::filter_thin_air(
   for(std::set<unsigned>::const_iterator it=thin_air_events.begin();
     it!=thin_air_events.end();
     ++it)
-    egraph.message.debug()<<egraph[*it]<<";";
+    message.debug()<<egraph[*it]<<";";
 
-  egraph.message.debug() << messaget::eom;
+  message.debug() << messaget::eom;
 #endif
 }
 
@@ -71,8 +71,7 @@ void event_grapht::graph_explorert::collect_cycles(
   memory_modelt model)
 {
   /* all the events initially unmarked */
-  for(unsigned i = 0; i<egraph.size(); i++)
-    mark[i] = false;
+  mark.assign(egraph.size(), false);
 
   std::list<unsigned>* order=0;
   /* on Power, rfe pairs are also potentially unsafe */
@@ -100,11 +99,20 @@ void event_grapht::graph_explorert::collect_cycles(
   if(order->empty())
     return;
 
+  const unsigned total=order->size();
+  unsigned explored=0;
+
   for(std::list<unsigned>::const_iterator st_it=order->begin(); 
     st_it!=order->end(); ++st_it)
   {
     unsigned source=*st_it;
-    egraph.message.debug() << "explore " << egraph[source].id << messaget::eom;
+
+    if(++explored%1000==0)
+      message.statistics() << "explored " << explored << " of " << total
+        << " events, " << set_of_cycles.size() << " cycles" 
+        << messaget::eom;
+
+    message.debug() << "explore " << egraph[source].id << messaget::eom;
     backtrack(set_of_cycles, source, source, 
       false, max_po_trans, false, false, false, "", model);
 
@@ -149,7 +157,7 @@ event_grapht::critical_cyclet event_grapht::graph_explorert::extract_cycle(
     unsigned current_vertex=stack.top();
     stack.pop();
 
-    egraph.message.debug() << "extract: " << egraph[current_vertex].get_operation() 
+    message.debug() << "extract: " << egraph[current_vertex].get_operation() 
       << egraph[current_vertex].variable << "@" 
       << egraph[current_vertex].thread << "~" << egraph[current_vertex].local
       << messaget::eom;
@@ -197,18 +205,18 @@ bool event_grapht::graph_explorert::backtrack(
   memory_modelt model)
 {
 #ifdef DEBUG
-  for(unsigned i=0; i<80; egraph.message.debug() << "-", ++i);
-  egraph.message.debug() << messaget::eom;
-  egraph.message.debug() << "marked size:" << marked_stack.size() 
+  for(unsigned i=0; i<80; message.debug() << "-", ++i);
+  message.debug() << messaget::eom;
+  message.debug() << "marked size:" << marked_stack.size() 
     << messaget::eom;
   std::stack<unsigned> tmp;
   while(!point_stack.empty())
   {
-    egraph.message.debug() << point_stack.top() << " | ";
+    message.debug() << point_stack.top() << " | ";
     tmp.push(point_stack.top());
     point_stack.pop();
   }
-  egraph.message.debug() << messaget::eom;
+  message.debug() << messaget::eom;
   while(!tmp.empty())
   { 
     point_stack.push(tmp.top());
@@ -216,11 +224,11 @@ bool event_grapht::graph_explorert::backtrack(
   }
   while(!marked_stack.empty())
   {
-    egraph.message.debug() << marked_stack.top() << " | ";
+    message.debug() << marked_stack.top() << " | ";
     tmp.push(marked_stack.top());
     marked_stack.pop();
   }
-  egraph.message.debug() << messaget::eom;
+  message.debug() << messaget::eom;
   while(!tmp.empty())
   {
     marked_stack.push(tmp.top());
@@ -232,7 +240,7 @@ bool event_grapht::graph_explorert::backtrack(
   if(filtering(vertex))
     return false;
 
-  egraph.message.debug() << "bcktck "<<egraph[vertex].id<<"#"<<vertex<<", "
+  message.debug() << "bcktck "<<egraph[vertex].id<<"#"<<vertex<<", "
     <<egraph[source].id<<"#"<<source<<" lw:"<<lwfence_met<<" unsafe:"
     <<unsafe_met << messaget::eom;
   bool f=false;
@@ -393,11 +401,11 @@ bool event_grapht::graph_explorert::backtrack(
     if(!get_com_only)
     {
       /* we first visit via po transition, if existing */
-      for(graph<abstract_eventt>::edgest::const_iterator 
-        w_it=egraph.po_out(vertex).begin(); 
-        w_it!=egraph.po_out(vertex).end(); w_it++)
+      for(successorst::const_iterator 
+        w_it=egraph.po_successors.begin(vertex); 
+        w_it!=egraph.po_successors.end(vertex); w_it++)
       {
-        const unsigned w = w_it->first;
+        const unsigned w = *w_it;
         if(w == source && point_stack.size()>=4
           && (unsafe_met_updated
             || this_vertex.unsafe_pair(egraph[source],model)) )
@@ -416,7 +424,7 @@ bool event_grapht::graph_explorert::backtrack(
             new_cycle.is_unsafe(model) /*&&
             new_cycle.is_unsafe_asm(model)*/)
           {
-            egraph.message.debug() << new_cycle.print_name(model,false) 
+            message.debug() << new_cycle.print_name(model,false) 
               << messaget::eom;
             set_of_cycles.insert(new_cycle);
 #if 0
@@ -436,13 +444,15 @@ bool event_grapht::graph_explorert::backtrack(
 
     if(!no_comm)
     /* we then visit via com transitions, if existing */
-    for(graph<abstract_eventt>::edgest::const_iterator 
-      w_it=egraph.com_out(vertex).begin();
-      w_it!=egraph.com_out(vertex).end(); w_it++)
+    for(successorst::const_iterator 
+      w_it=egraph.com_successors.begin(vertex);
+      w_it!=egraph.com_successors.end(vertex); w_it++)
     {
-      const unsigned w = w_it->first;
+      const unsigned w = *w_it;
+      /* com edges towards smaller events are ignored; they are not
+         removed, as the graph is shared by the explorers */
       if(w < source)
-        egraph.remove_com_edge(vertex,w);
+        continue;
       else if(w == source && point_stack.size()>=4
         && (unsafe_met_updated 
           || this_vertex.unsafe_pair(egraph[source],model)) )
@@ -461,7 +471,7 @@ bool event_grapht::graph_explorert::backtrack(
           new_cycle.is_unsafe(model) /*&&
           new_cycle.is_unsafe_asm(model)*/)
         {
-          egraph.message.debug() << new_cycle.print_name(model,false) 
+          message.debug() << new_cycle.print_name(model,false) 
             << messaget::eom;
           set_of_cycles.insert(new_cycle);
 #if 0
@@ -568,11 +578,11 @@ bool event_grapht::graph_explorert::backtrack(
          (!this_vertex.WRfence 
            && egraph[point_stack.top()].operation==abstract_eventt::Write));
 
-    for(graph<abstract_eventt>::edgest::const_iterator w_it=
-      egraph.po_out(vertex).begin();
-      w_it!=egraph.po_out(vertex).end(); w_it++)
+    for(successorst::const_iterator w_it=
+      egraph.po_successors.begin(vertex);
+      w_it!=egraph.po_successors.end(vertex); w_it++)
     {
-      const unsigned w = w_it->first;
+      const unsigned w = *w_it;
       f |= backtrack(set_of_cycles, source, w,
         unsafe_met/*_updated*/, (po_trans==0?0:po_trans-1), 
         same_var_pair/*_updated*/, is_lwfence, has_to_be_unsafe, avoid_at_the_end,
@@ -341,7 +341,9 @@ Function: event_grapht::critical_cyclet::is_unsafe
 
 bool event_grapht::critical_cyclet::is_unsafe(memory_modelt model, bool fast)
 {
+#ifdef DEBUG
   egraph.message.debug() << "cycle is safe?" << messaget::eom;
+#endif
   bool unsafe_met=false;
 
   /* critical cycles contain at least 4 events */
@@ -628,7 +630,9 @@ Function: event_grapht::critical_cyclet::is_unsafe_asm
 bool event_grapht::critical_cyclet::is_unsafe_asm(memory_modelt model, 
   bool fast)
 {
+#ifdef DEBUG
   egraph.message.debug() << "cycle is safe?" << messaget::eom;
+#endif
   bool unsafe_met = false;
   unsigned char fences_met = 0;
 
@@ -14,15 +14,16 @@ Date: 2012
 #include <list>
 #include <set>
 #include <map>
+#include <vector>
 #include <iosfwd>
 
 #include <util/graph.h>
+#include <util/message.h>
 
 #include "abstract_event.h"
 #include "data_dp.h"
 #include "wmm.h"
 
-class messaget;
 class namespacet;
 
 /*******************************************************************\
@@ -203,6 +204,47 @@ protected:
   graph<abstract_eventt> po_graph;
   graph<abstract_eventt> com_graph;
 
+  /* successors in compressed form, read by the explorers */
+  class successorst
+  {
+  public:
+    typedef std::vector<unsigned>::const_iterator const_iterator;
+
+    void build(const graph<abstract_eventt>& g)
+    {
+      offsets.clear();
+      targets.clear();
+      offsets.reserve(g.size()+1);
+
+      for(unsigned n=0; n<g.size(); n++)
+      {
+        offsets.push_back(targets.size());
+        for(graph<abstract_eventt>::edgest::const_iterator
+          it=g.out(n).begin(); it!=g.out(n).end(); ++it)
+          targets.push_back(it->first);
+      }
+
+      offsets.push_back(targets.size());
+    }
+
+    inline const_iterator begin(unsigned n) const
+    {
+      return targets.begin()+offsets[n];
+    }
+
+    inline const_iterator end(unsigned n) const
+    {
+      return targets.begin()+offsets[n+1];
+    }
+
+  protected:
+    std::vector<unsigned> offsets;
+    std::vector<unsigned> targets;
+  };
+
+  successorst po_successors;
+  successorst com_successors;
+
   /* parameters limiting the exploration */
   unsigned max_var;
   unsigned max_po_trans;
@@ -219,6 +261,9 @@ protected:
   protected:
     event_grapht& egraph;
 
+    /* explorers may run in threads of their own */
+    messaget message;
+
     /* parameters limiting the exploration */
     unsigned max_var;
     unsigned max_po_trans;
@@ -254,13 +299,14 @@ protected:
 
   public:
     graph_explorert(event_grapht& _egraph, unsigned _max_var, 
-      unsigned _max_po_trans)
-      :egraph(_egraph), max_var(_max_var), max_po_trans(_max_po_trans), cycle_nb(0)
+      unsigned _max_po_trans, message_handlert& _message_handler)
+      :egraph(_egraph), message(_message_handler), max_var(_max_var),
+      max_po_trans(_max_po_trans), cycle_nb(0)
     {
     }
 
     /* structures for graph exploration */
-    std::map<unsigned,bool> mark;
+    std::vector<bool> mark;
     std::stack<unsigned> marked_stack;
     std::stack<unsigned> point_stack;
 
@@ -291,11 +337,14 @@ protected:
   {
   protected:
     const std::set<unsigned>& filter;
+    std::list<unsigned> filtered_order;
 
   public:
     graph_conc_explorert(event_grapht& _egraph, unsigned _max_var,
-      unsigned _max_po_trans, const std::set<unsigned>& _filter)
-      :graph_explorert(_egraph,_max_var,_max_po_trans),filter(_filter)
+      unsigned _max_po_trans, const std::set<unsigned>& _filter,
+      message_handlert& _message_handler)
+      :graph_explorert(_egraph,_max_var,_max_po_trans,_message_handler),
+      filter(_filter)
     {
     }
 
@@ -304,16 +353,16 @@ protected:
       return filter.find(u)==filter.end();
     }
 
-    inline std::list<unsigned>* initial_filtering(std::list<unsigned>* order)
+    inline std::list<unsigned>* order_filtering(std::list<unsigned>* order)
     {
-      static std::list<unsigned> new_order;
+      filtered_order.clear();
 
       /* intersection */
       for(std::list<unsigned>::iterator it=order->begin();it!=order->end();it++)
         if(filter.find(*it)!=filter.end())
-          new_order.push_back(*it);
+          filtered_order.push_back(*it);
 
-      return &new_order;
+      return &filtered_order;
     }
   };
 
@@ -329,7 +378,8 @@ protected:
   public:
     graph_pensieve_explorert(event_grapht& _egraph, unsigned _max_var,
       unsigned _max_po_trans)
-      :graph_explorert(_egraph,_max_var,_max_po_trans), naive(false) 
+      :graph_explorert(_egraph,_max_var,_max_po_trans,
+        _egraph.message.get_message_handler()), naive(false) 
     {}
 
     void set_naive() {naive=true;}
@@ -502,19 +552,44 @@ public:
   void print_rec_graph(std::ofstream& file, unsigned node_id,
     std::set<unsigned>& visited);
 
+  /* to be called once the graph is complete; afterwards, the
+     explorers only read the graph and can run in parallel */
+  void prepare_exploration()
+  {
+    po_successors.build(po_graph);
+    com_successors.build(com_graph);
+
+    for(unsigned n=0; n<po_graph.size(); n++)
+      map_data_dp[po_graph[n].thread];
+  }
+
   /* Tarjan 1972 adapted and modified for events + po-transitivity */
   void collect_cycles(std::set<critical_cyclet>& set_of_cycles, 
     memory_modelt model,
     const std::set<unsigned>& filter)
   {
-    graph_conc_explorert exploration(*this, max_var, max_po_trans,filter);
+    prepare_exploration();
+    collect_cycles(set_of_cycles, model, filter,
+      message.get_message_handler());
+  }
+
+  /* requires prepare_exploration() */
+  void collect_cycles(std::set<critical_cyclet>& set_of_cycles, 
+    memory_modelt model,
+    const std::set<unsigned>& filter,
+    message_handlert& message_handler)
+  {
+    graph_conc_explorert exploration(*this, max_var, max_po_trans, filter,
+      message_handler);
     exploration.collect_cycles(set_of_cycles,model);
   }
 
   void collect_cycles(std::set<critical_cyclet>& set_of_cycles,
     memory_modelt model)
   {
-    graph_explorert exploration(*this, max_var, max_po_trans);
+    prepare_exploration();
+    graph_explorert exploration(*this, max_var, max_po_trans,
+      message.get_message_handler());
     exploration.collect_cycles(set_of_cycles,model);
   }
 
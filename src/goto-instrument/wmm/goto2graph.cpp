@@ -11,6 +11,14 @@ Date: 2012
 #include <vector>
 #include <string>
 #include <fstream>
+#include <algorithm>
+
+#ifdef CPROVER_THREAD_SAFE
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 
 #ifndef _WIN32
 #include <cstdlib>
@@ -1804,86 +1812,99 @@ Function: instrumentert::collect_cycles_by_SCCs
   
  Outputs:
   
- Purpose: Note: can be distributed (#define DISTRIBUTED)
+ Purpose: the SCCs are explored independently; with CPROVER_THREAD_SAFE,
+          by a pool of threads, largest SCCs first
   
 \*******************************************************************/
 
-#if 1
-//#ifdef _WIN32
 void instrumentert::collect_cycles_by_SCCs(memory_modelt model)
 {
-  unsigned scc = 0;
+  set_of_cycles_per_SCC.clear();
+
+  /* SCCs which could host critical cycles */
+  std::vector<unsigned> interesting_SCCs;
+  for(unsigned i=0; i<egraph_SCCs.size(); i++)
+    if(egraph_SCCs[i].size()>=4)
+      interesting_SCCs.push_back(i);
+
+  /* the cycles of the interesting SCCs come first */
   set_of_cycles_per_SCC.resize(num_sccs,
     std::set<event_grapht::critical_cyclet>());
-  for(std::vector<std::set<unsigned> >::const_iterator it=egraph_SCCs.begin();
-    it!=egraph_SCCs.end(); it++)
-    if(it->size()>=4)
-      egraph.collect_cycles(set_of_cycles_per_SCC[scc++],model,*it);
-}
-#else
-class pthread_argumentt
-{
-public:
-  instrumentert& instr;
-  memory_modelt mem;
-  const std::set<unsigned>& filter;
-  std::set<event_grapht::critical_cyclet>& cycles;
-
-  pthread_argumentt(instrumentert& _instr,
-    memory_modelt _mem, 
-    const std::set<unsigned>& _filter,
-    std::set<event_grapht::critical_cyclet>& _cycles)
-    :instr(_instr),mem(_mem),filter(_filter),cycles(_cycles)
-  {
-  }
-};
 
-/* wraper */
-void* collect_cycles_in_thread(void* arg)
-{
-  /* arguments */
-  instrumentert& this_instrumenter = ((pthread_argumentt*) arg)->instr;
-  memory_modelt model = ((pthread_argumentt*) arg)->mem;
-  const std::set<unsigned>& filter = ((pthread_argumentt*) arg)->filter;
-  std::set<event_grapht::critical_cyclet>& cycles = 
-    ((pthread_argumentt*) arg)->cycles;
+  if(interesting_SCCs.empty())
+    return;
 
-  this_instrumenter.egraph.collect_cycles(cycles, model, filter);
+  egraph.prepare_exploration();
 
-  return NULL;
-}
+#ifdef CPROVER_THREAD_SAFE
+  /* the order in which the SCCs are handed out */
+  std::vector<unsigned> schedule(interesting_SCCs.size());
+  for(unsigned i=0; i<schedule.size(); i++)
+    schedule[i]=i;
 
-void instrumentert::collect_cycles_by_SCCs(memory_modelt model)
-{
-  const unsigned number_of_sccs = num_sccs;
-  std::set<unsigned> interesting_SCCs;
+  std::sort(schedule.begin(), schedule.end(),
+    [&](unsigned a, unsigned b)
+    {
+      return egraph_SCCs[interesting_SCCs[a]].size()>
+        egraph_SCCs[interesting_SCCs[b]].size();
+    });
+
+  std::vector<buffered_message_handlert> messages(schedule.size());
+  std::atomic<unsigned> next(0);
+  std::mutex finished_mutex;
+  std::condition_variable finished_cond;
+  std::vector<unsigned> finished;
+
+  unsigned number_of_threads=std::thread::hardware_concurrency();
+  if(number_of_threads==0)
+    number_of_threads=1;
+  if(number_of_threads>schedule.size())
+    number_of_threads=schedule.size();
+
+  std::vector<std::thread> threads;
+  for(unsigned t=0; t<number_of_threads; t++)
+    threads.push_back(std::thread([&]()
+    {
+      for(unsigned n=next++; n<schedule.size(); n=next++)
+      {
+        const unsigned i=schedule[n];
+        egraph.collect_cycles(set_of_cycles_per_SCC[i], model,
+          egraph_SCCs[interesting_SCCs[i]], messages[i]);
 
-  unsigned scc = 0;
-  pthread_t* threads = (pthread_t*)malloc((num_sccs+1)*sizeof(pthread_t));
+        std::lock_guard<std::mutex> lock(finished_mutex);
+        finished.push_back(i);
+        finished_cond.notify_one();
+      }
+    }));
 
-  set_of_cycles_per_SCC.resize(num_sccs,
-    std::set<event_grapht::critical_cyclet>());
+  /* progress is reported by this thread only */
+  for(unsigned reported=0; reported<schedule.size(); reported++)
+  {
+    unsigned i;
 
-  for(std::vector<std::set<unsigned> >::const_iterator it=egraph_SCCs.begin();
-    it!=egraph_SCCs.end(); it++)
-    if(it->size()>=4)
     {
-      interesting_SCCs.insert(scc);
-      pthread_argumentt arg(*this,model,*it,set_of_cycles_per_SCC[scc]);
+      std::unique_lock<std::mutex> lock(finished_mutex);
+      finished_cond.wait(lock, [&]() { return reported<finished.size(); });
+      i=finished[reported];
+    }
 
-      unsigned rc = pthread_create(&threads[scc++], NULL,
-        collect_cycles_in_thread, (void*) &arg);
+    messages[i].flush(message.get_message_handler());
+    message.statistics() << "SCC #" << interesting_SCCs[i] << " done ("
+      << reported+1 << " of " << schedule.size() << "): "
+      << set_of_cycles_per_SCC[i].size() << " cycles" << messaget::eom;
+  }
 
-      message.status()<<(rc!=0?"Failure ":"Success ")
-        <<"in creating thread for SCC #"<<scc-1<<messaget::eom;
-    }
+  for(unsigned t=0; t<threads.size(); t++)
+    threads[t].join();
+#else
+  for(unsigned i=0; i<interesting_SCCs.size(); i++)
+  {
+    egraph.collect_cycles(set_of_cycles_per_SCC[i], model,
+      egraph_SCCs[interesting_SCCs[i]], message.get_message_handler());
 
-  for(unsigned i=0; i<number_of_sccs; i++)
-    if(interesting_SCCs.find(i)!=interesting_SCCs.end())
-    {
-      unsigned rc = pthread_join(threads[i],NULL);
-      message.status()<<(rc!=0?"Failure ":"Success ")
-        <<"in joining thread for SCC #"<<i<<messaget::eom;
-    }
-}
+    message.statistics() << "SCC #" << interesting_SCCs[i] << " done ("
+      << i+1 << " of " << interesting_SCCs.size() << "): "
+      << set_of_cycles_per_SCC[i].size() << " cycles" << messaget::eom;
+  }
 #endif
+}
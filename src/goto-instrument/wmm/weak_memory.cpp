@@ -187,11 +187,11 @@ void weak_memory(
     for(unsigned i=0; i<instrumenter.num_sccs; i++)
       if(instrumenter.egraph_SCCs[i].size()>=4)
       {
-        message.status()<<"SCC #"<<i<<": "
-          <<instrumenter.set_of_cycles_per_SCC[interesting_scc++].size()
+        const unsigned cycles=
+          instrumenter.set_of_cycles_per_SCC[interesting_scc++].size();
+        message.status()<<"SCC #"<<i<<": "<<cycles
           <<" cycles found"<<messaget::eom;
-        total_cycles += instrumenter
-          .set_of_cycles_per_SCC[interesting_scc++].size();
+        total_cycles += cycles;
       }
 
     /* if no cycle, no need to instrument */
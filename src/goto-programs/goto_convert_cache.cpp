@@ -0,0 +1,500 @@
+/*******************************************************************\
+
+Module: Persistent Cache for Goto Conversion
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <util/find_symbols.h>
+#include <util/i2string.h>
+#include <util/irep_hash.h>
+#include <util/message.h>
+#include <util/prefix.h>
+#include <util/string_hash.h>
+#include <util/symbol_table.h>
+
+#include "read_bin_goto_object.h"
+#include "write_goto_binary.h"
+#include "goto_convert_cache.h"
+
+// bump this whenever goto_convert changes its output
+#define GOTO_CONVERT_CACHE_VERSION 2
+
+// bump this whenever the C front-end changes its output
+#define LIBRARY_CACHE_VERSION 1
+
+/*******************************************************************\
+
+Function: stable_hash
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: a hash of an irep, including comments, that only depends
+          on the strings, and not on the numbering of the strings
+          in this process
+
+\*******************************************************************/
+
+static std::size_t stable_hash(const irept &irep)
+{
+  std::size_t result=hash_string(id2string(irep.id()));
+
+  forall_irep(it, irep.get_sub())
+    result=hash_combine(result, stable_hash(*it));
+
+  // the order of named_sub depends on the string numbering
+  std::size_t named=0;
+
+  forall_named_irep(it, irep.get_named_sub())
+    named+=hash_combine(hash_string(id2string(it->first)),
+                        stable_hash(it->second));
+
+  forall_named_irep(it, irep.get_comments())
+    named+=hash_combine(hash_string(id2string(it->first)),
+                        stable_hash(it->second));
+
+  return hash_combine(result, named);
+}
+
+/*******************************************************************\
+
+Function: goto_convert_cachet::file_name
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::string goto_convert_cachet::file_name(const symbolt &symbol) const
+{
+  std::size_t h=GOTO_CONVERT_CACHE_VERSION;
+  h=hash_combine(h, hash_string(configuration));
+  h=hash_combine(h, hash_string(id2string(symbol.name)));
+  h=hash_combine(h, stable_hash(symbol.type));
+  h=hash_combine(h, stable_hash(symbol.value));
+
+  std::ostringstream result;
+  result << directory << '/' << std::hex << h << ".gb";
+  return result.str();
+}
+
+/*******************************************************************\
+
+Function: goto_convert_cachet::file_name
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::string goto_convert_cachet::file_name(
+  const irep_idt &function,
+  const std::string &key) const
+{
+  std::size_t h=hash_combine(GOTO_CONVERT_CACHE_VERSION,
+                             LIBRARY_CACHE_VERSION);
+  h=hash_combine(h, hash_string(configuration));
+  h=hash_combine(h, hash_string(id2string(function)));
+  h=hash_combine(h, hash_string(key));
+
+  std::ostringstream result;
+  result << directory << "/lib-" << std::hex << h << ".gb";
+  return result.str();
+}
+
+/*******************************************************************\
+
+Function: goto_convert_cachet::is_auxiliary
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the temporaries introduced by goto_convert carry the
+          name of the function as prefix
+
+\*******************************************************************/
+
+bool goto_convert_cachet::is_auxiliary(
+  const symbolt &function,
+  const irep_idt &identifier)
+{
+  return has_prefix(
+    id2string(identifier), id2string(function.name)+"::$tmp::");
+}
+
+/*******************************************************************\
+
+Function: goto_convert_cachet::read
+
+  Inputs:
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
+bool goto_convert_cachet::read(
+  const std::string &name,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions)
+{
+  std::ifstream in(name.c_str(), std::ios::binary);
+  
+  if(!in)
+    return true;
+  
+  null_message_handlert null_message_handler;
+  
+  return read_bin_goto_object(
+    in, "", symbol_table, functions, null_message_handler);
+}
+
+/*******************************************************************\
+
+Function: goto_convert_cachet::write
+
+  Inputs:
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
+bool goto_convert_cachet::write(
+  const std::string &name,
+  const symbol_tablet &symbol_table,
+  const goto_functionst &functions)
+{
+  // write to a temporary file first, as other processes
+  // may use the same directory concurrently
+  const std::string tmp_name=name+"."+i2string(getpid());
+  
+  {
+    std::ofstream out(tmp_name.c_str(), std::ios::binary);
+    
+    if(!out ||
+       write_goto_binary(out, symbol_table, functions))
+      return true;
+  }
+
+  if(std::rename(tmp_name.c_str(), name.c_str())!=0)
+  {
+    std::remove(tmp_name.c_str());
+    return true;
+  }
+  
+  return false;
+}
+
+/*******************************************************************\
+
+Function: goto_convert_cachet::collect_symbols
+
+  Inputs:
+
+ Outputs: true on error
+
+ Purpose: collect the symbols the converted function refers to,
+          and, transitively, the symbols used in their types;
+          values are kept for the function's own symbols, and,
+          if requested, for those of other symbols but functions
+
+\*******************************************************************/
+
+bool goto_convert_cachet::collect_symbols(
+  const symbolt &symbol,
+  const symbol_tablet &symbol_table,
+  const goto_functionst::goto_functiont &src,
+  bool keep_values,
+  symbol_tablet &dest)
+{
+  dest.add(symbol);
+
+  find_symbols_sett symbols;
+  
+  forall_goto_program_instructions(i_it, src.body)
+  {
+    find_type_and_expr_symbols(i_it->code, symbols);
+    find_type_and_expr_symbols(i_it->guard, symbols);
+  }
+  
+  find_type_symbols(symbol.type, symbols);
+
+  std::list<irep_idt> queue(symbols.begin(), symbols.end());
+  
+  while(!queue.empty())
+  {
+    irep_idt identifier=queue.front();
+    queue.pop_front();
+    
+    if(dest.has_symbol(identifier))
+      continue;
+
+    symbol_tablet::symbolst::const_iterator s_it=
+      symbol_table.symbols.find(identifier);
+    
+    if(s_it==symbol_table.symbols.end())
+      return true;
+
+    symbolt s=s_it->second;
+    
+    find_symbols_sett more_symbols;
+    find_type_symbols(s.type, more_symbols);
+
+    // only the type matters, unless it is ours
+    if(is_auxiliary(symbol, identifier))
+    {
+    }
+    else if(keep_values && s.type.id()!=ID_code)
+      find_type_and_expr_symbols(s.value, more_symbols);
+    else
+      s.value.make_nil();
+      
+    queue.insert(queue.end(), more_symbols.begin(), more_symbols.end());
+
+    dest.add(s);
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: goto_convert_cachet::lookup
+
+  Inputs:
+
+ Outputs: false on a cache hit
+
+ Purpose:
+
+\*******************************************************************/
+
+bool goto_convert_cachet::lookup(
+  const symbolt &symbol,
+  symbol_tablet &symbol_table,
+  goto_functionst::goto_functiont &dest)
+{
+  symbol_tablet cached_symbol_table;
+  goto_functionst cached_functions;
+  
+  if(read(file_name(symbol), cached_symbol_table, cached_functions))
+  {
+    misses++;
+    return true;
+  }
+
+  goto_functionst::function_mapt::iterator f_it=
+    cached_functions.function_map.find(symbol.name);
+
+  if(f_it==cached_functions.function_map.end() ||
+     !f_it->second.body_available())
+  {
+    misses++;
+    return true;
+  }
+  
+  // The entry may be for a different function with the same hash,
+  // or the types used by the function may have changed.
+  forall_symbols(it, cached_symbol_table.symbols)
+  {
+    if(is_auxiliary(symbol, it->first))
+      continue;
+
+    symbol_tablet::symbolst::const_iterator s_it=
+      symbol_table.symbols.find(it->first);
+
+    if(s_it==symbol_table.symbols.end() ||
+       !full_eq(s_it->second.type, it->second.type) ||
+       (it->first==symbol.name &&
+        !full_eq(s_it->second.value, it->second.value)))
+    {
+      misses++;
+      return true;
+    }
+  }
+  
+  forall_symbols(it, cached_symbol_table.symbols)
+    if(is_auxiliary(symbol, it->first))
+      symbol_table.add(it->second);
+  
+  dest.body.swap(f_it->second.body);
+
+  if(f_it->second.is_hidden())
+    dest.make_hidden();
+
+  hits++;
+  return false;
+}
+
+/*******************************************************************\
+
+Function: goto_convert_cachet::store
+
+  Inputs:
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
+bool goto_convert_cachet::store(
+  const symbolt &symbol,
+  const symbol_tablet &symbol_table,
+  const goto_functionst::goto_functiont &src)
+{
+  symbol_tablet entry_symbol_table;
+
+  if(collect_symbols(symbol, symbol_table, src, false, entry_symbol_table))
+    return true;
+  
+  goto_functionst entry_functions;
+  goto_functionst::goto_functiont &f=
+    entry_functions.function_map[symbol.name];
+  f.type=src.type;
+  f.body.copy_from(src.body);
+  f.body.update();
+
+  return write(file_name(symbol), entry_symbol_table, entry_functions);
+}
+
+/*******************************************************************\
+
+Function: goto_convert_cachet::lookup_library
+
+  Inputs: the function and its key, see cprover_library_key
+
+ Outputs: false on a cache hit
+
+ Purpose:
+
+\*******************************************************************/
+
+bool goto_convert_cachet::lookup_library(
+  const irep_idt &function,
+  const std::string &key,
+  symbol_tablet &symbol_table,
+  goto_functionst::goto_functiont &dest)
+{
+  symbol_tablet cached_symbol_table;
+  goto_functionst cached_functions;
+  
+  if(read(file_name(function, key), cached_symbol_table, cached_functions))
+  {
+    misses++;
+    return true;
+  }
+
+  goto_functionst::function_mapt::iterator f_it=
+    cached_functions.function_map.find(function);
+
+  symbol_tablet::symbolst::const_iterator cached_symbol=
+    cached_symbol_table.symbols.find(function);
+
+  if(f_it==cached_functions.function_map.end() ||
+     !f_it->second.body_available() ||
+     cached_symbol==cached_symbol_table.symbols.end())
+  {
+    misses++;
+    return true;
+  }
+
+  // Whatever the program has already must agree with what the
+  // model was translated with; otherwise the front-end has to
+  // reconcile the two.
+  forall_symbols(it, cached_symbol_table.symbols)
+  {
+    symbol_tablet::symbolst::const_iterator s_it=
+      symbol_table.symbols.find(it->first);
+
+    if(s_it!=symbol_table.symbols.end() &&
+       s_it->second.type!=it->second.type)
+    {
+      misses++;
+      return true;
+    }
+  }
+  
+  dest.type=to_code_type(cached_symbol->second.type);
+  dest.body.swap(f_it->second.body);
+
+  Forall_symbols(it, cached_symbol_table.symbols)
+  {
+    symbolt *new_symbol;
+
+    // the model replaces the declaration of the function
+    if(symbol_table.move(it->second, new_symbol) &&
+       it->first==function)
+      new_symbol->swap(it->second);
+  }
+
+  if(f_it->second.is_hidden())
+    dest.make_hidden();
+
+  hits++;
+  return false;
+}
+
+/*******************************************************************\
+
+Function: goto_convert_cachet::store_library
+
+  Inputs:
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
+bool goto_convert_cachet::store_library(
+  const irep_idt &function,
+  const std::string &key,
+  const symbol_tablet &symbol_table,
+  const goto_functionst::goto_functiont &src)
+{
+  symbol_tablet::symbolst::const_iterator s_it=
+    symbol_table.symbols.find(function);
+
+  if(s_it==symbol_table.symbols.end())
+    return true;
+
+  symbol_tablet entry_symbol_table;
+
+  if(collect_symbols(
+       s_it->second, symbol_table, src, true, entry_symbol_table))
+    return true;
+  
+  goto_functionst entry_functions;
+  goto_functionst::goto_functiont &f=
+    entry_functions.function_map[function];
+  f.type=src.type;
+  f.body.copy_from(src.body);
+  f.body.update();
+
+  return write(file_name(function, key), entry_symbol_table, entry_functions);
+}
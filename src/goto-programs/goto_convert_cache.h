@@ -0,0 +1,108 @@
+/*******************************************************************\
+
+Module: Persistent Cache for Goto Conversion
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_PROGRAMS_GOTO_CONVERT_CACHE_H
+#define CPROVER_GOTO_PROGRAMS_GOTO_CONVERT_CACHE_H
+
+#include <string>
+
+#include "goto_functions.h"
+
+/*******************************************************************\
+
+   Class: goto_convert_cachet
+
+ Purpose: stores the goto program of each function in a directory,
+          as a goto binary named by a hash of the function symbol;
+          an entry also records the types of all symbols the
+          conversion depended on and is only used if they match
+
+          The configuration string must capture everything else
+          that the output of the conversion depends on, such as
+          the widths of the types introduced by goto_convert
+
+          Library models are stored with all the symbols they
+          need, keyed by the model text and the configuration,
+          so that they can be added without the C front-end
+
+\*******************************************************************/
+
+class goto_convert_cachet
+{
+public:
+  goto_convert_cachet(
+    const std::string &_directory,
+    const std::string &_configuration):
+    hits(0), misses(0),
+    directory(_directory),
+    configuration(_configuration)
+  {
+  }
+
+  // returns false and fills in 'dest' on a hit; the auxiliary
+  // symbols of the function are added to the symbol table
+  bool lookup(
+    const symbolt &symbol,
+    symbol_tablet &symbol_table,
+    goto_functionst::goto_functiont &dest);
+
+  // returns true on error
+  bool store(
+    const symbolt &symbol,
+    const symbol_tablet &symbol_table,
+    const goto_functionst::goto_functiont &src);
+  
+  // returns false on a hit, in which case the function and the
+  // symbols it needs are added to the symbol table
+  bool lookup_library(
+    const irep_idt &function,
+    const std::string &key,
+    symbol_tablet &symbol_table,
+    goto_functionst::goto_functiont &dest);
+
+  // returns true on error
+  bool store_library(
+    const irep_idt &function,
+    const std::string &key,
+    const symbol_tablet &symbol_table,
+    const goto_functionst::goto_functiont &src);
+  
+  unsigned hits, misses;
+
+protected:
+  std::string directory;
+  std::string configuration;
+
+  std::string file_name(const symbolt &symbol) const;
+  std::string file_name(
+    const irep_idt &function,
+    const std::string &key) const;
+
+  bool read(
+    const std::string &name,
+    symbol_tablet &symbol_table,
+    goto_functionst &functions);
+
+  bool write(
+    const std::string &name,
+    const symbol_tablet &symbol_table,
+    const goto_functionst &functions);
+
+  static bool collect_symbols(
+    const symbolt &symbol,
+    const symbol_tablet &symbol_table,
+    const goto_functionst::goto_functiont &src,
+    bool keep_values,
+    symbol_tablet &dest);
+  
+  static bool is_auxiliary(
+    const symbolt &function,
+    const irep_idt &identifier);
+};
+
+#endif
@@ -16,6 +16,7 @@ Date: June 2003
 #include <util/prefix.h>
 
 #include "goto_convert_functions.h"
+#include "goto_convert_cache.h"
 #include "goto_inline.h"
 #include "remove_skip.h"
 
@@ -36,6 +37,7 @@ goto_convert_functionst::goto_convert_functionst(
   goto_functionst &_functions,
   message_handlert &_message_handler):
   goto_convertt(_symbol_table, _message_handler),
+  cache(NULL),
   functions(_functions)
 {
 }
@@ -237,6 +239,10 @@ void goto_convert_functionst::convert_function(const irep_idt &identifier)
     throw "got invalid code for function `"+id2string(identifier)+"'";
   }
   
+  if(cache!=NULL &&
+     !cache->lookup(symbol, symbol_table, f))
+    return;
+  
   const codet &code=to_code(symbol.value);
   
   source_locationt end_location;
@@ -301,6 +307,11 @@ void goto_convert_functionst::convert_function(const irep_idt &identifier)
 
   if(hide(f.body))
     f.make_hidden();
+    
+  if(cache!=NULL &&
+     cache->store(symbol, symbol_table, f))
+    warning_msg("failed to store `"+id2string(identifier)+
+                "' in goto conversion cache");
 }
 
 /*******************************************************************\
@@ -382,6 +393,55 @@ Function: goto_convert
 
 \*******************************************************************/
 
+void goto_convert(
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  goto_convert_cachet &cache,
+  message_handlert &message_handler)
+{
+  goto_convert_functionst goto_convert_functions(
+    symbol_table, functions, message_handler);
+  
+  goto_convert_functions.cache=&cache;
+  
+  try
+  {  
+    goto_convert_functions.goto_convert();
+  }
+
+  catch(int)
+  {
+    goto_convert_functions.error_msg();
+  }
+
+  catch(const char *e)
+  {
+    goto_convert_functions.str << e;
+    goto_convert_functions.error_msg();
+  }
+
+  catch(const std::string &e)
+  {
+    goto_convert_functions.str << e;
+    goto_convert_functions.error_msg();
+  }
+
+  if(goto_convert_functions.get_error_found())
+    throw 0;
+}
+
+/*******************************************************************\
+
+Function: goto_convert
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
 void goto_convert(
   const irep_idt &identifier,
   symbol_tablet &symbol_table,
@@ -26,6 +26,14 @@ void goto_convert(
   goto_modelt &dest,
   message_handlert &message_handler);
   
+// convert it all, re-using and updating the conversions
+// stored in the given cache
+void goto_convert(
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  class goto_convert_cachet &cache,
+  message_handlert &message_handler);
+  
 // just convert a specific function
 void goto_convert(
   const irep_idt &identifier,
@@ -46,6 +54,9 @@ public:
   
   virtual ~goto_convert_functionst();
 
+  // optional, persistent
+  class goto_convert_cachet *cache;
+
 protected:
   goto_functionst &functions;
   
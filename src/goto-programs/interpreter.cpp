@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <algorithm>
 
 #include <util/std_types.h>
+#include <util/std_code.h>
 #include <util/symbol_table.h>
 
 #include "interpreter.h"
@@ -31,6 +32,7 @@ Function: interpretert::operator()
 
 void interpretert::operator()()
 {
+  interactive=true;
   build_memory_map();
   
   const goto_functionst::function_mapt::const_iterator
@@ -59,6 +61,138 @@ void interpretert::operator()()
 
 /*******************************************************************\
 
+Function: interpretert::run
+
+  Inputs: the instruction to stop at, whether to stop only once
+          the assertion at 'stop' is violated, and a bound on the
+          number of instructions to execute
+
+ Outputs: the reason for stopping
+
+ Purpose: non-interactive execution, with non-deterministic
+          choices taken from 'inputs'
+
+\*******************************************************************/
+
+interpretert::run_resultt interpretert::run(
+  goto_programt::const_targett stop,
+  bool stop_on_violation,
+  unsigned max_steps)
+{
+  interactive=false;
+  reset();
+
+  const goto_functionst::function_mapt::const_iterator
+    main_it=goto_functions.function_map.find(goto_functionst::entry_point());
+
+  if(main_it==goto_functions.function_map.end())
+    throw "main not found";
+  
+  const goto_functionst::goto_functiont &goto_function=main_it->second;
+  
+  if(!goto_function.body_available())
+    throw "main has no body";
+
+  PC=goto_function.body.instructions.begin();
+  function=main_it;
+    
+  done=false;
+  
+  for(unsigned steps=0; !done; steps++)
+  {
+    if(PC==stop)
+    {
+      if(!stop_on_violation)
+        return STOP_REACHED;
+
+      if(PC->is_assert() && !evaluate_boolean(PC->guard))
+        return STOP_REACHED;
+    }
+
+    if(steps>=max_steps)
+      return STEP_LIMIT;
+
+    if(PC!=function->second.body.instructions.end() &&
+       PC->is_assume() &&
+       !evaluate_boolean(PC->guard))
+      return ASSUMPTION_VIOLATED;
+
+    step();
+  }
+  
+  return END_OF_PROGRAM;
+}
+
+/*******************************************************************\
+
+Function: interpretert::reset
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: set up the memory for a fresh run, reusing the
+          memory map of the static objects if already built
+
+\*******************************************************************/
+
+void interpretert::reset()
+{
+  missing_inputs=0;
+
+  while(!call_stack.empty())
+    call_stack.pop();
+
+  if(memory.empty())
+  {
+    build_memory_map();
+    return;
+  }
+  
+  memory.resize(stack_base);
+  
+  for(memoryt::iterator it=memory.begin(); it!=memory.end(); it++)
+    it->value=0;
+
+  stack_pointer=stack_base;
+}
+
+/*******************************************************************\
+
+Function: interpretert::read_input
+
+  Inputs: the type of the object to be assigned
+
+ Outputs: the next value recorded for the current instruction
+
+ Purpose: resolve a non-deterministic choice
+
+\*******************************************************************/
+
+void interpretert::read_input(
+  const typet &type,
+  std::vector<mp_integer> &dest)
+{
+  unsigned size=get_size(type);
+  input_mapt::iterator i_it=inputs.find(PC);
+
+  if(i_it==inputs.end() || i_it->second.empty())
+  {
+    // not in the trace, e.g., sliced away
+    missing_inputs++;
+    dest.assign(size, 0);
+    return;
+  }
+
+  evaluate(i_it->second.front(), dest);
+  i_it->second.pop_front();
+
+  if(dest.size()!=size)
+    throw "input value of unexpected size";
+}
+
+/*******************************************************************\
+
 Function: interpretert::show_state
 
   Inputs:
@@ -171,6 +305,7 @@ void interpretert::step()
   case SKIP:
   case LOCATION:
   case END_FUNCTION:
+  case DEAD:
     break;
   
   case RETURN:
@@ -209,9 +344,6 @@ void interpretert::step()
   case ATOMIC_END:
     throw "ATOMIC_END not yet implemented";
     
-  case DEAD:
-    throw "DEAD not yet implemented";
-  
   default:
     throw "encountered instruction with undefined instruction type";
   }
@@ -286,6 +418,15 @@ Function: interpretert::execute_decl
 void interpretert::execute_decl()
 {
   assert(PC->code.get_statement()==ID_decl);
+  
+  if(!interactive)
+  {
+    // the initial value is non-deterministic
+    const exprt &symbol_expr=to_code_decl(PC->code).symbol();
+    std::vector<mp_integer> rhs;
+    read_input(symbol_expr.type(), rhs);
+    assign(evaluate_address(symbol_expr), rhs);
+  }
 }
 
 /*******************************************************************\
@@ -306,7 +447,13 @@ void interpretert::execute_assign()
     to_code_assign(PC->code);
 
   std::vector<mp_integer> rhs;
-  evaluate(code_assign.rhs(), rhs);
+
+  if(!interactive &&
+     code_assign.rhs().id()==ID_side_effect &&
+     to_side_effect_expr(code_assign.rhs()).get_statement()==ID_nondet)
+    read_input(code_assign.lhs().type(), rhs);
+  else
+    evaluate(code_assign.rhs(), rhs);
   
   if(!rhs.empty())
   {
@@ -314,9 +461,14 @@ void interpretert::execute_assign()
     unsigned size=get_size(code_assign.lhs().type());
 
     if(size!=rhs.size())
+    {
+      if(!interactive)
+        throw "failed to obtain rhs";
+
       std::cout << "!! failed to obtain rhs ("
                 << rhs.size() << " vs. "
                 << size << ")" << std::endl;
+    }
     else
       assign(address, rhs);
   }
@@ -343,8 +495,9 @@ void interpretert::assign(
     if(address<memory.size())
     {
       memory_cellt &cell=memory[integer2unsigned(address)];
-      std::cout << "** assigning " << cell.identifier
-                << "[" << cell.offset << "]:=" << rhs[i] << std::endl;
+      if(interactive)
+        std::cout << "** assigning " << cell.identifier
+                  << "[" << cell.offset << "]:=" << rhs[i] << std::endl;
       cell.value=rhs[i];
     }
   }
@@ -382,7 +535,8 @@ Function: interpretert::execute_assert
 
 void interpretert::execute_assert()
 {
-  if(!evaluate_boolean(PC->guard))
+  // like symbolic execution, we carry on in non-interactive mode
+  if(!evaluate_boolean(PC->guard) && interactive)
     throw "assertion failed";
 }
 
@@ -466,7 +620,7 @@ void interpretert::execute_function_call()
       {
         frame.local_map[id]=stack_pointer;
 
-        for(unsigned i=0; i<stack_pointer; i++)
+        for(unsigned i=0; i<size; i++)
         {
           unsigned address=stack_pointer+i;
           if(address>=memory.size()) memory.resize(address+1);
@@ -499,6 +653,16 @@ void interpretert::execute_function_call()
     function=f_it;
     next_PC=f_it->second.body.instructions.begin();    
   }
+  else if(!interactive)
+  {
+    // the return value is non-deterministic
+    if(return_value_address!=0)
+    {
+      std::vector<mp_integer> rhs;
+      read_input(function_call.lhs().type(), rhs);
+      assign(return_value_address, rhs);
+    }
+  }
   else
     throw "no body for "+id2string(identifier);
 }
@@ -530,7 +694,7 @@ void interpretert::build_memory_map()
     build_memory_map(it->second);
     
   // for the locals
-  stack_pointer=memory.size();
+  stack_pointer=stack_base=memory.size();
 }
 
 /*******************************************************************\
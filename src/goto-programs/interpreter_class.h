@@ -1,4 +1,9 @@
+#ifndef CPROVER_GOTO_PROGRAMS_INTERPRETER_CLASS_H
+#define CPROVER_GOTO_PROGRAMS_INTERPRETER_CLASS_H
+
 #include <stack>
+#include <list>
+#include <map>
 
 #include <util/arith_tools.h>
 
@@ -20,11 +25,36 @@ public:
     const goto_functionst &_goto_functions):
     symbol_table(_symbol_table),
     ns(_symbol_table),
-    goto_functions(_goto_functions)
+    goto_functions(_goto_functions),
+    interactive(true),
+    missing_inputs(0)
   {
   }
   
   void operator()();
+
+  // Non-interactive execution, e.g., for replaying a counterexample.
+  // Non-deterministic choices are resolved by taking the values
+  // recorded for the instruction in 'inputs', in order.
+  typedef std::list<exprt> input_valuest;
+  typedef std::map<goto_programt::const_targett, input_valuest> input_mapt;
+  input_mapt inputs;
+
+  typedef enum { END_OF_PROGRAM, STOP_REACHED,
+                 ASSUMPTION_VIOLATED, STEP_LIMIT } run_resultt;
+
+  // Runs from the entry point until 'stop' is executed. With
+  // 'stop_on_violation' set, 'stop' must be an assertion, and
+  // we only stop once it is violated.
+  run_resultt run(
+    goto_programt::const_targett stop,
+    bool stop_on_violation,
+    unsigned max_steps);
+
+  goto_programt::const_targett get_PC() const { return PC; }
+  
+  // number of non-deterministic choices not found in 'inputs'
+  unsigned get_missing_inputs() const { return missing_inputs; }
   
   friend class simplify_evaluatet;
 
@@ -89,6 +119,13 @@ protected:
   goto_programt::const_targett PC, next_PC;
   bool done;
   
+  bool interactive;
+  unsigned missing_inputs;
+  unsigned stack_base;
+  
+  void reset();
+  void read_input(const typet &type, std::vector<mp_integer> &dest);
+  
   bool evaluate_boolean(const exprt &expr) const
   {
     std::vector<mp_integer> v;
@@ -105,3 +142,5 @@ protected:
   
   void show_state();
 };
+
+#endif
@@ -17,6 +17,32 @@ Author: Daniel Kroening, kroening@kroening.com
 
 /*******************************************************************\
 
+Function: wrap_around
+
+  Inputs: a value and a type
+
+ Outputs: the value, truncated to the width of the type
+
+ Purpose: the arithmetic on bit-vectors is modular
+
+\*******************************************************************/
+
+static mp_integer wrap_around(
+  const mp_integer &value,
+  const typet &type)
+{
+  if(type.id()==ID_signedbv || type.id()==ID_unsignedbv)
+  {
+    const std::string s=
+      integer2binary(value, to_bitvector_type(type).get_width());
+    return binary2integer(s, type.id()==ID_signedbv);
+  }
+  
+  return value;
+}
+
+/*******************************************************************\
+
 Function: interpretert::evaluate
 
   Inputs:
@@ -124,6 +150,43 @@ void interpretert::evaluate(
       
     dest.clear();
   }
+  else if(expr.id()==ID_array)
+  {
+    bool error=false;
+
+    forall_operands(it, expr)
+    {
+      std::vector<mp_integer> tmp;
+      evaluate(*it, tmp);
+
+      if(tmp.empty())
+        error=true;
+      else
+        dest.insert(dest.end(), tmp.begin(), tmp.end());
+    }
+
+    if(!error)
+      return;
+
+    dest.clear();
+  }
+  else if(expr.id()==ID_array_of)
+  {
+    if(expr.operands().size()!=1)
+      throw "array_of expects one operand";
+
+    std::vector<mp_integer> tmp;
+    evaluate(expr.op0(), tmp);
+
+    unsigned size=get_size(expr.type());
+
+    if(!tmp.empty() && size%tmp.size()==0)
+    {
+      for(unsigned i=0; i<size/tmp.size(); i++)
+        dest.insert(dest.end(), tmp.begin(), tmp.end());
+      return;
+    }
+  }
   else if(expr.id()==ID_equal ||
           expr.id()==ID_notequal ||
           expr.id()==ID_le ||
@@ -251,7 +314,7 @@ void interpretert::evaluate(
         result+=tmp.front();
     }
     
-    dest.push_back(result);
+    dest.push_back(wrap_around(result, expr.type()));
     return;
   }
   else if(expr.id()==ID_mult)
@@ -307,7 +370,7 @@ void interpretert::evaluate(
       }
     }
     
-    dest.push_back(result);
+    dest.push_back(wrap_around(result, expr.type()));
     return;
   }
   else if(expr.id()==ID_minus)
@@ -320,7 +383,7 @@ void interpretert::evaluate(
     evaluate(expr.op1(), tmp1);
 
     if(tmp0.size()==1 && tmp1.size()==1)
-      dest.push_back(tmp0.front()-tmp1.front());
+      dest.push_back(wrap_around(tmp0.front()-tmp1.front(), expr.type()));
     return;
   }
   else if(expr.id()==ID_div)
@@ -333,7 +396,28 @@ void interpretert::evaluate(
     evaluate(expr.op1(), tmp1);
 
     if(tmp0.size()==1 && tmp1.size()==1)
-      dest.push_back(tmp0.front()/tmp1.front());
+    {
+      if(tmp1.front()==0)
+        throw "division by zero";
+      dest.push_back(wrap_around(tmp0.front()/tmp1.front(), expr.type()));
+    }
+    return;
+  }
+  else if(expr.id()==ID_mod)
+  {
+    if(expr.operands().size()!=2)
+      throw "% expects two operands";
+
+    std::vector<mp_integer> tmp0, tmp1;
+    evaluate(expr.op0(), tmp0);
+    evaluate(expr.op1(), tmp1);
+
+    if(tmp0.size()==1 && tmp1.size()==1)
+    {
+      if(tmp1.front()==0)
+        throw "division by zero";
+      dest.push_back(tmp0.front()%tmp1.front());
+    }
     return;
   }
   else if(expr.id()==ID_unary_minus)
@@ -345,7 +429,82 @@ void interpretert::evaluate(
     evaluate(expr.op0(), tmp0);
 
     if(tmp0.size()==1)
-      dest.push_back(-tmp0.front());
+      dest.push_back(wrap_around(-tmp0.front(), expr.type()));
+    return;
+  }
+  else if((expr.id()==ID_bitand ||
+           expr.id()==ID_bitor ||
+           expr.id()==ID_bitxor ||
+           expr.id()==ID_bitnot) &&
+          (expr.type().id()==ID_signedbv ||
+           expr.type().id()==ID_unsignedbv))
+  {
+    if(expr.operands().empty())
+      throw id2string(expr.id())+" expects at least one operand";
+
+    std::size_t width=to_bitvector_type(expr.type()).get_width();
+    std::string result;
+
+    forall_operands(it, expr)
+    {
+      std::vector<mp_integer> tmp;
+      evaluate(*it, tmp);
+
+      if(tmp.size()!=1)
+        throw "failed to evaluate operand of "+id2string(expr.id());
+
+      std::string op=integer2binary(tmp.front(), width);
+
+      if(result.empty())
+        result=op;
+      else
+        for(std::size_t i=0; i<width; i++)
+        {
+          bool a=result[i]=='1', b=op[i]=='1';
+          bool r=expr.id()==ID_bitand?(a && b):
+                 expr.id()==ID_bitor?(a || b):(a!=b);
+          result[i]=r?'1':'0';
+        }
+    }
+
+    if(expr.id()==ID_bitnot)
+      for(std::size_t i=0; i<width; i++)
+        result[i]=result[i]=='1'?'0':'1';
+
+    dest.push_back(binary2integer(result, expr.type().id()==ID_signedbv));
+    return;
+  }
+  else if(expr.id()==ID_shl || expr.id()==ID_lshr)
+  {
+    if(expr.operands().size()!=2)
+      throw id2string(expr.id())+" expects two operands";
+
+    std::vector<mp_integer> tmp0, tmp1;
+    evaluate(expr.op0(), tmp0);
+    evaluate(expr.op1(), tmp1);
+
+    if(tmp0.size()==1 && tmp1.size()==1)
+    {
+      mp_integer value=tmp0.front();
+
+      if(expr.id()==ID_shl)
+        dest.push_back(
+          wrap_around(value*power(2, tmp1.front()), expr.type()));
+      else if(expr.type().id()==ID_signedbv ||
+              expr.type().id()==ID_unsignedbv)
+      {
+        // logical shift: operate on the unsigned representation
+        const std::string s=integer2binary(
+          value, to_bitvector_type(expr.type()).get_width());
+        dest.push_back(
+          wrap_around(
+            binary2integer(s, false)/power(2, tmp1.front()),
+            expr.type()));
+      }
+      else
+        dest.push_back(value/power(2, tmp1.front()));
+    }
+
     return;
   }
   else if(expr.id()==ID_address_of)
@@ -397,7 +556,8 @@ void interpretert::evaluate(
         dest.push_back(binary2integer(s, false));        
         return;
       }
-      else if(expr.type().id()==ID_bool)
+      else if(expr.type().id()==ID_bool ||
+              expr.type().id()==ID_c_bool)
       {
         dest.push_back(value!=0);
         return;
@@ -419,6 +579,10 @@ void interpretert::evaluate(
     return;
   }
 
+  if(!interactive)
+    throw "failed to evaluate expression: "+
+          from_expr(ns, function->first, expr);
+
   std::cout << "!! failed to evaluate expression: "
             << from_expr(ns, function->first, expr)
             << std::endl;
@@ -509,6 +673,10 @@ mp_integer interpretert::evaluate_address(const exprt &expr) const
     return evaluate_address(expr.op0())+offset;
   }
   
+  if(!interactive)
+    throw "failed to evaluate address: "+
+          from_expr(ns, function->first, expr);
+
   std::cout << "!! failed to evaluate address: "
             << from_expr(ns, function->first, expr)
             << std::endl;
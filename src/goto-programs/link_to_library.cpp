@@ -11,6 +11,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "link_to_library.h"
 #include "compute_called_functions.h"
 #include "goto_convert_functions.h"
+#include "goto_convert_cache.h"
 
 /*******************************************************************\
 
@@ -46,9 +47,10 @@ Function: link_to_library
 
 \*******************************************************************/
 
-void link_to_library(
+static void link_to_library(
   symbol_tablet &symbol_table,
   goto_functionst &goto_functions,
+  goto_convert_cachet *cache,
   message_handlert &message_handler)
 {
   // this needs a fixedpoint, as library functions
@@ -88,6 +90,42 @@ void link_to_library(
     
     // done?
     if(missing_functions.empty()) break;
+
+    // the cache saves us the front-end for the models it has
+    std::map<irep_idt, std::string> keys;
+    
+    if(cache!=NULL)
+    {
+      for(std::set<irep_idt>::iterator
+          it=missing_functions.begin();
+          it!=missing_functions.end();
+          ) // no it++
+      {
+        symbol_tablet::symbolst::const_iterator s_it=
+          symbol_table.symbols.find(*it);
+        std::string key=cprover_library_key(*it);
+
+        if(s_it==symbol_table.symbols.end() ||
+           s_it->second.value.is_not_nil() ||
+           key.empty())
+        {
+          it++;
+          continue;
+        }
+
+        if(!cache->lookup_library(
+             *it, key, symbol_table, goto_functions.function_map[*it]))
+        {
+          added_functions.insert(*it);
+          missing_functions.erase(it++);
+        }
+        else
+        {
+          keys[*it]=key;
+          it++;
+        }
+      }
+    }
     
     add_cprover_library(missing_functions, symbol_table, message_handler);
 
@@ -103,5 +141,63 @@ void link_to_library(
       added_functions.insert(*it);
     }
     
+    for(std::map<irep_idt, std::string>::const_iterator
+        it=keys.begin();
+        it!=keys.end();
+        it++)
+    {
+      const goto_functionst::goto_functiont &f=
+        goto_functions.function_map[it->first];
+
+      if(f.body_available() &&
+         cache->store_library(it->first, it->second, symbol_table, f))
+      {
+        messaget message(message_handler);
+        message.warning() << "failed to store library function `"
+                          << it->first << "' in cache"
+                          << messaget::eom;
+      }
+    }
   }
 }
+
+/*******************************************************************\
+
+Function: link_to_library
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void link_to_library(
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions,
+  message_handlert &message_handler)
+{
+  link_to_library(symbol_table, goto_functions, NULL, message_handler);
+}
+
+/*******************************************************************\
+
+Function: link_to_library
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void link_to_library(
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions,
+  goto_convert_cachet &cache,
+  message_handlert &message_handler)
+{
+  link_to_library(symbol_table, goto_functions, &cache, message_handler);
+}
@@ -22,4 +22,12 @@ void link_to_library(
   goto_modelt &,
   message_handlert &);
 
+// takes library models from the cache where possible,
+// and stores those that needed translation
+void link_to_library(
+  symbol_tablet &,
+  goto_functionst &,
+  class goto_convert_cachet &,
+  message_handlert &);
+
 #endif
@@ -0,0 +1,232 @@
+/*******************************************************************\
+
+Module: Validation of Traces by Concrete Execution
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+
+#include <util/i2string.h>
+#include <util/std_code.h>
+
+#include "validate_goto_trace.h"
+
+/*******************************************************************\
+
+Function: validate_goto_tracet::is_input
+
+  Inputs: a step of a trace
+
+ Outputs: whether the interpreter needs the value of the step
+
+ Purpose: the values of declarations, of non-deterministic
+          assignments, and of calls to functions without body
+          are chosen by the solver; everything else is computed
+
+\*******************************************************************/
+
+bool validate_goto_tracet::is_input(const goto_trace_stept &step) const
+{
+  if(step.is_decl())
+    return true;
+
+  if(!step.is_assignment())
+    return false;
+
+  const goto_programt::instructiont &instruction=*step.pc;
+
+  if(instruction.is_assign())
+  {
+    const exprt &rhs=to_code_assign(instruction.code).rhs();
+
+    return rhs.id()==ID_side_effect &&
+           to_side_effect_expr(rhs).get_statement()==ID_nondet;
+  }
+  else if(instruction.is_function_call())
+  {
+    const exprt &function=
+      to_code_function_call(instruction.code).function();
+
+    if(function.id()!=ID_symbol)
+      return false;
+
+    goto_functionst::function_mapt::const_iterator f_it=
+      goto_functions.function_map.find(
+        to_symbol_expr(function).get_identifier());
+
+    return f_it==goto_functions.function_map.end() ||
+           !f_it->second.body_available();
+  }
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: validate_goto_tracet::operator()
+
+  Inputs: a trace that ends in a violated assertion, or in
+          a location that is to be reached
+
+ Outputs: whether the concrete execution agrees with the trace
+
+ Purpose:
+
+\*******************************************************************/
+
+validate_goto_tracet::resultt validate_goto_tracet::operator()(
+  const goto_tracet &goto_trace)
+{
+  reason.clear();
+
+  if(goto_trace.steps.empty())
+  {
+    reason="empty trace";
+    return INCONCLUSIVE;
+  }
+
+  const goto_trace_stept &last_step=goto_trace.steps.back();
+  bool is_violation=last_step.is_assert() && !last_step.cond_value;
+  
+  // the values chosen for non-deterministic assignments,
+  // declarations and calls to functions without body
+  interpretert::input_mapt &inputs=interpreter.inputs;
+  inputs.clear();
+
+  for(goto_tracet::stepst::const_iterator
+      it=goto_trace.steps.begin();
+      it!=goto_trace.steps.end();
+      it++)
+  {
+    if(it->thread_nr!=0)
+    {
+      reason="trace has multiple threads";
+      return INCONCLUSIVE;
+    }
+
+    if(is_input(*it) &&
+       it->full_lhs_value.is_not_nil())
+      inputs[it->pc].push_back(it->full_lhs_value);
+  }
+  
+  interpretert::run_resultt run_result;
+
+  try
+  {
+    run_result=interpreter.run(last_step.pc, is_violation, max_steps);
+  }
+  
+  catch(const char *e)
+  {
+    reason=e;
+    return INCONCLUSIVE;
+  }
+
+  catch(const std::string &e)
+  {
+    reason=e;
+    return INCONCLUSIVE;
+  }
+  
+  switch(run_result)
+  {
+  case interpretert::STOP_REACHED:
+    return VALID;
+
+  case interpretert::END_OF_PROGRAM:
+    reason=is_violation?"assertion not violated":"location not reached";
+    break;
+
+  case interpretert::ASSUMPTION_VIOLATED:
+    reason="assumption violated at "+
+           interpreter.get_PC()->source_location.as_string();
+    break;
+
+  case interpretert::STEP_LIMIT:
+    reason="exceeded "+i2string(max_steps)+" steps";
+    return INCONCLUSIVE;
+
+  default:
+    assert(false);
+  }
+
+  // we made up values the trace does not have
+  if(interpreter.get_missing_inputs()!=0)
+  {
+    reason+=", "+i2string(interpreter.get_missing_inputs())+
+            " input(s) missing from trace";
+    return INCONCLUSIVE;
+  }
+  
+  return SPURIOUS;
+}
+
+/*******************************************************************\
+
+Function: validate_goto_tracet::operator()
+
+  Inputs: a name for the trace and the trace
+
+ Outputs: whether the concrete execution agrees with the trace
+
+ Purpose: replay a trace by concrete execution and report
+
+\*******************************************************************/
+
+validate_goto_tracet::resultt validate_goto_tracet::operator()(
+  const std::string &name,
+  const goto_tracet &goto_trace)
+{
+  resultt result=(*this)(goto_trace);
+
+  status() << name << ": " << as_string(result);
+  if(!reason.empty())
+    status() << " (" << reason << ")";
+  status() << eom;
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: validate_goto_traces
+
+  Inputs: the program, the traces with their names, what the
+          traces are called in the messages
+
+ Outputs:
+
+ Purpose: replay the traces by concrete execution and report
+
+\*******************************************************************/
+
+void validate_goto_traces(
+  const symbol_tablet &symbol_table,
+  const goto_functionst &goto_functions,
+  const named_goto_tracest &goto_traces,
+  const std::string &what,
+  message_handlert &message_handler)
+{
+  validate_goto_tracet validate_goto_trace(symbol_table, goto_functions);
+  validate_goto_trace.set_message_handler(message_handler);
+
+  messaget message(message_handler);
+  message.status() << messaget::eom;
+  message.status() << "** Validating " << what
+                   << " by concrete execution" << messaget::eom;
+
+  unsigned validated=0;
+
+  for(named_goto_tracest::const_iterator
+      it=goto_traces.begin();
+      it!=goto_traces.end();
+      it++)
+    if(validate_goto_trace(it->first, *it->second)==
+       validate_goto_tracet::VALID)
+      validated++;
+
+  message.status() << "** " << validated << " of " << goto_traces.size()
+                   << " " << what << " validated" << messaget::eom;
+}
@@ -0,0 +1,89 @@
+/*******************************************************************\
+
+Module: Validation of Traces by Concrete Execution
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_PROGRAMS_VALIDATE_GOTO_TRACE_H
+#define CPROVER_GOTO_PROGRAMS_VALIDATE_GOTO_TRACE_H
+
+#include <list>
+
+#include <util/message.h>
+
+#include "interpreter_class.h"
+#include "goto_trace.h"
+
+/*******************************************************************\
+
+   Class: validate_goto_tracet
+
+ Purpose: replays the inputs recorded in a trace using the
+          interpreter, and checks that the concrete execution
+          ends up where the trace does; the memory layout is
+          computed once and shared by all traces
+
+\*******************************************************************/
+
+class validate_goto_tracet:public messaget
+{
+public:
+  validate_goto_tracet(
+    const symbol_tablet &_symbol_table,
+    const goto_functionst &_goto_functions):
+    max_steps(1000000),
+    goto_functions(_goto_functions),
+    interpreter(_symbol_table, _goto_functions)
+  {
+  }
+
+  typedef enum { VALID, SPURIOUS, INCONCLUSIVE } resultt;
+  
+  resultt operator()(const goto_tracet &goto_trace);
+
+  // the same, and reports the result under the given name
+  resultt operator()(
+    const std::string &name,
+    const goto_tracet &goto_trace);
+  
+  // explains the last result
+  std::string reason;
+
+  // bound on the number of instructions executed per trace
+  unsigned max_steps;
+
+  static const char *as_string(resultt result)
+  {
+    switch(result)
+    {
+    case VALID: return "VALID";
+    case SPURIOUS: return "SPURIOUS";
+    case INCONCLUSIVE: return "INCONCLUSIVE";
+    default: return "";
+    }
+  }
+
+protected:
+  const goto_functionst &goto_functions;
+  interpretert interpreter;
+
+  bool is_input(const goto_trace_stept &step) const;
+};
+
+// the traces to validate, with the names to report them under
+typedef std::list<std::pair<std::string, const goto_tracet *> >
+  named_goto_tracest;
+
+// replays the traces and reports the result of each one,
+// followed by the number of valid ones; 'what' names the
+// traces in the messages, e.g., "counterexamples"
+void validate_goto_traces(
+  const symbol_tablet &symbol_table,
+  const goto_functionst &goto_functions,
+  const named_goto_tracest &goto_traces,
+  const std::string &what,
+  message_handlert &message_handler);
+
+#endif
@@ -17,7 +17,46 @@ Author: Daniel Kroening, kroening@kroening.com
 
 /*******************************************************************\
 
-Function: get_jar_entry
+Function: jar_filet::open
+
+  Inputs: name of the JAR file
+
+ Outputs: true on error
+
+ Purpose: opens the archive and reads its index
+
+\*******************************************************************/
+
+bool jar_filet::open(const std::string &file_name)
+{
+  close();
+
+  #ifdef HAVE_LIBZIP
+  int zip_error;
+  handle=zip_open(file_name.c_str(), 0, &zip_error);
+
+  if(handle==NULL)
+    return true;
+  
+  std::size_t number_of_files=zip_get_num_entries(handle, 0);
+  entries.reserve(number_of_files);
+  
+  for(std::size_t i=0; i<number_of_files; i++)
+  {
+    std::string name=zip_get_name(handle, i, 0);
+    entries.push_back(name);
+    index.insert(std::pair<std::string, std::size_t>(name, i));
+  }
+  
+  return false;
+  #else
+  return true;
+  #endif
+}
+
+/*******************************************************************\
+
+Function: jar_filet::close
 
   Inputs:
 
@@ -27,30 +66,45 @@ Function: get_jar_entry
 
 \*******************************************************************/
 
+void jar_filet::close()
+{
+  #ifdef HAVE_LIBZIP
+  if(handle!=NULL)
+    zip_close(handle);
+  #endif
+
+  handle=NULL;
+  entries.clear();
+  index.clear();
+}
+
+/*******************************************************************\
+
+Function: jar_filet::get_entry
+
+  Inputs: index of the entry
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
 #define ZIP_READ_SIZE 10000
 
-bool get_jar_entry(
-  const std::string &jar_file,
-  std::size_t index,
+bool jar_filet::get_entry(
+  std::size_t i,
   std::vector<char> &dest)
 {
   #ifdef HAVE_LIBZIP
-  int zip_error;
-  
-  struct zip *zip=
-    zip_open(jar_file.c_str(), 0, &zip_error);
-    
-  if(zip==NULL)
-    return true; // error
-    
+  if(handle==NULL)
+    return true;
+
   struct zip_file *zip_file=
-    zip_fopen_index(zip, index, 0);
+    zip_fopen_index(handle, i, 0);
   
   if(zip_file==NULL)
-  {
-    zip_close(zip);
     return true; // error
-  }
 
   std::vector<char> buffer;
   buffer.resize(ZIP_READ_SIZE);
@@ -65,7 +119,6 @@ bool get_jar_entry(
   }
 
   zip_fclose(zip_file);    
-  zip_close(zip);
   
   return false;
   #else
@@ -75,84 +128,48 @@ bool get_jar_entry(
 
 /*******************************************************************\
 
-Function: get_jar_index
+Function: jar_filet::get_entry
 
-  Inputs:
+  Inputs: name of the entry
 
- Outputs:
+ Outputs: true on error
 
  Purpose:
 
 \*******************************************************************/
 
-bool get_jar_index(
-  const std::string &jar_file,
-  std::vector<std::string> &entries)
+bool jar_filet::get_entry(
+  const std::string &name,
+  std::vector<char> &dest)
 {
-  #ifdef HAVE_LIBZIP
-  int zip_error;
-  struct zip *zip=zip_open(jar_file.c_str(), 0, &zip_error);
+  indext::const_iterator it=index.find(name);
 
-  if(zip==NULL)
+  if(it==index.end())
     return true;
-  
-  std::size_t number_of_files=zip_get_num_entries(zip, 0);
-  
-  for(std::size_t index=0; index<number_of_files; index++)
-  {
-    std::string file_name=zip_get_name(zip, index, 0);
-    entries.push_back(file_name);
-  }
-  
-  zip_close(zip);
-  
-  return false;
-  #else
-  return true;
-  #endif
+
+  return get_entry(it->second, dest);
 }
 
 /*******************************************************************\
 
-Function: get_jar_manifest
+Function: jar_filet::get_manifest
 
   Inputs:
 
- Outputs:
+ Outputs: true on error
 
  Purpose:
 
 \*******************************************************************/
 
-bool get_jar_manifest(
-  const std::string &jar_file,
+bool jar_filet::get_manifest(
   std::map<std::string, std::string> &manifest)
 {
-  std::vector<std::string> entries;
-  if(get_jar_index(jar_file, entries))
-    return true;
-    
-  std::size_t index=0;
-  bool found=false;
-    
-  for(std::vector<std::string>::const_iterator
-      e_it=entries.begin(); e_it!=entries.end(); e_it++)
-  {
-    if(*e_it=="META-INF/MANIFEST.MF")
-    {
-      index=e_it-entries.begin();
-      found=true;
-      break;
-    }
-  }
-
-  if(!found) return true;  
-  
   std::vector<char> dest; 
-  if(get_jar_entry(jar_file, index, dest))
+  if(get_entry("META-INF/MANIFEST.MF", dest))
     return true;
 
-  std::istringstream in(dest.data());
+  std::istringstream in(std::string(dest.begin(), dest.end()));
 
   std::string line;
   while(std::getline(in, line))
@@ -177,3 +194,78 @@ bool get_jar_manifest(
   
   return false;
 }
+
+/*******************************************************************\
+
+Function: get_jar_entry
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool get_jar_entry(
+  const std::string &jar_file,
+  std::size_t index,
+  std::vector<char> &dest)
+{
+  jar_filet jar;
+
+  if(jar.open(jar_file))
+    return true;
+
+  return jar.get_entry(index, dest);
+}
+
+/*******************************************************************\
+
+Function: get_jar_index
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool get_jar_index(
+  const std::string &jar_file,
+  std::vector<std::string> &entries)
+{
+  jar_filet jar;
+
+  if(jar.open(jar_file))
+    return true;
+
+  entries.swap(jar.entries);
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: get_jar_manifest
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool get_jar_manifest(
+  const std::string &jar_file,
+  std::map<std::string, std::string> &manifest)
+{
+  jar_filet jar;
+
+  if(jar.open(jar_file))
+    return true;
+
+  return jar.get_manifest(manifest);
+}
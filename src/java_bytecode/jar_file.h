@@ -13,6 +13,58 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <vector>
 #include <map>
 
+/*******************************************************************\
+
+   Class: jar_filet
+
+ Purpose: an open JAR file; the archive is opened once, not for
+          every entry that is read from it
+
+\*******************************************************************/
+
+class jar_filet
+{
+public:
+  jar_filet():handle(NULL)
+  {
+  }
+
+  ~jar_filet()
+  {
+    close();
+  }
+
+  // returns true on error
+  bool open(const std::string &file_name);
+  void close();
+
+  inline bool is_open() const
+  {
+    return handle!=NULL;
+  }
+
+  // the names of the entries, by index
+  typedef std::vector<std::string> entriest;
+  entriest entries;
+
+  // maps entry names to indices
+  typedef std::map<std::string, std::size_t> indext;
+  indext index;
+
+  // these return true on error
+  bool get_entry(std::size_t index, std::vector<char> &);
+  bool get_entry(const std::string &name, std::vector<char> &);
+  bool get_manifest(std::map<std::string, std::string> &);
+
+protected:
+  struct zip *handle;
+
+private:
+  // not copyable, as we own the handle
+  jar_filet(const jar_filet &);
+  jar_filet &operator=(const jar_filet &);
+};
+
 bool get_jar_index(
   const std::string &jar_file,
   std::vector<std::string> &entries);
@@ -59,9 +59,11 @@ class java_bytecode_convertt:public messaget
 public:
   java_bytecode_convertt(
     symbol_tablet &_symbol_table,
-    message_handlert &_message_handler):
+    message_handlert &_message_handler,
+    const std::set<irep_idt> *_lazy_methods):
     messaget(_message_handler),
-    symbol_table(_symbol_table)
+    symbol_table(_symbol_table),
+    lazy_methods(_lazy_methods)
   {
   }
 
@@ -82,6 +84,9 @@ public:
 protected:
   symbol_tablet &symbol_table;
 
+  // if given, only these methods get a body
+  const std::set<irep_idt> *lazy_methods;
+
   irep_idt current_method;
   unsigned number_of_parameters;
 
@@ -426,7 +431,14 @@ void java_bytecode_convertt::convert(
   current_method=method_symbol.name;
   number_of_parameters=count_java_parameter_slots(parameters);
   tmp_counter=0;
-  method_symbol.value=convert_instructions(m.instructions, code_type);
+
+  if(lazy_methods==NULL ||
+     lazy_methods->count(method_symbol.name)!=0)
+    method_symbol.value=convert_instructions(m.instructions, code_type);
+  else
+    debug() << "Skipping unreachable method "
+            << method_symbol.name << eom;
+
   symbol_table.add(method_symbol);
 }
 
@@ -1430,10 +1442,11 @@ Function: java_bytecode_convert
 bool java_bytecode_convert(
   const java_bytecode_parse_treet &parse_tree,
   symbol_tablet &symbol_table,
-  message_handlert &message_handler)
+  message_handlert &message_handler,
+  const std::set<irep_idt> *lazy_methods)
 {
   java_bytecode_convertt java_bytecode_convert(
-    symbol_table, message_handler);
+    symbol_table, message_handler, lazy_methods);
 
   try
   {
@@ -9,15 +9,19 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_JAVA_BYTECODE_CONVERT_H
 #define CPROVER_JAVA_BYTECODE_CONVERT_H
 
+#include <set>
+
 #include <util/symbol_table.h>
 #include <util/message.h>
 
 #include "java_bytecode_parse_tree.h"
 
+// only the methods in lazy_methods get a body, unless it is NULL
 bool java_bytecode_convert(
   const java_bytecode_parse_treet &parse_tree,
   symbol_tablet &symbol_table,
-  message_handlert &message_handler);
+  message_handlert &message_handler,
+  const std::set<irep_idt> *lazy_methods=NULL);
 
 #endif
 
@@ -8,6 +8,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/symbol_table.h>
 #include <util/suffix.h>
+#include <util/config.h>
 
 #include "java_bytecode_language.h"
 #include "java_bytecode_convert.h"
@@ -18,6 +19,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "java_entry_point.h"
 #include "java_bytecode_parser.h"
 #include "java_class_loader.h"
+#include "java_lazy_methods.h"
 #include "jar_file.h"
 
 #include "expr2java.h"
@@ -124,7 +126,12 @@ bool java_bytecode_languaget::parse(
   else
     assert(false);
 
-  java_class_loader(main_class);
+  // with lazy methods, we load the rest when we know what's needed
+  if(config.java.lazy_methods)
+    java_class_loader.load_class(main_class);
+  else
+    java_class_loader(main_class);
+
   return false;
 }
              
@@ -144,6 +151,24 @@ bool java_bytecode_languaget::typecheck(
   symbol_tablet &symbol_table,
   const std::string &module)
 {
+  std::set<irep_idt> lazy_methods;
+
+  if(config.java.lazy_methods)
+  {
+    std::vector<irep_idt> entry_classes(1, main_class);
+
+    // are we given a function?
+    std::size_t dot=config.main.rfind('.');
+    if(dot!=std::string::npos)
+      entry_classes.push_back(config.main.substr(0, dot));
+
+    java_lazy_methods(java_class_loader, entry_classes, lazy_methods);
+
+    statistics() << lazy_methods.size() << " reachable methods in "
+                 << java_class_loader.class_map.size() << " classes"
+                 << eom;
+  }
+
   // first convert all
   for(java_class_loadert::class_mapt::const_iterator
       c_it=java_class_loader.class_map.begin();
@@ -156,7 +181,8 @@ bool java_bytecode_languaget::typecheck(
     debug() << "Converting class " << c_it->first << eom;
 
     if(java_bytecode_convert(
-         c_it->second, symbol_table, get_message_handler()))
+         c_it->second, symbol_table, get_message_handler(),
+         config.java.lazy_methods?&lazy_methods:NULL))
       return true;
   }
 
@@ -6,15 +6,45 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
-#include <stack>
 #include <map>
+#include <set>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+
+#ifdef CPROVER_THREAD_SAFE
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#endif
 
 #include <util/suffix.h>
 #include <util/config.h>
 
 #include "java_bytecode_parser.h"
 #include "java_class_loader.h"
-#include "jar_file.h"
+
+/*******************************************************************\
+
+Function: parse_class_file
+
+  Inputs: the contents of a class file
+
+ Outputs: true on error
+
+ Purpose: Class files contain zeros, hence the contents must not
+          be read up to the first zero, as a C string would be.
+
+\*******************************************************************/
+
+static bool parse_class_file(
+  const std::vector<char> &data,
+  java_bytecode_parse_treet &parse_tree,
+  message_handlert &message_handler)
+{
+  std::istringstream istream(std::string(data.begin(), data.end()));
+  return java_bytecode_parse(istream, parse_tree, message_handler);
+}
 
 /*******************************************************************\
 
@@ -31,30 +61,37 @@ Function: java_class_loadert::operator()
 java_bytecode_parse_treet &java_class_loadert::operator()(
   const irep_idt &class_name)
 {
-  std::stack<irep_idt> queue;
+  // we go breadth-first, to have a batch of classes to read
+  std::vector<irep_idt> frontier(1, class_name);
 
-  queue.push(class_name);
+  while(!frontier.empty())
+  {
+    std::vector<irep_idt> todo;
 
-  while(!queue.empty())
-  {  
-    irep_idt c=queue.top();
-    queue.pop();
-    
-    // do we have the class already?
-    if(class_map.find(c)!=class_map.end())
-      continue; // got it already
+    for(std::vector<irep_idt>::const_iterator
+        it=frontier.begin();
+        it!=frontier.end();
+        it++)
+      if(class_map.find(*it)==class_map.end())
+        todo.push_back(*it); // don't have it yet
 
-    debug() << "Reading class " << c << eom;
-      
-    java_bytecode_parse_treet &parse_tree=
-      get_parse_tree(c);
+    load_classes(todo);
+
+    // add any dependencies to the next batch
+    frontier.clear();
 
-    // add any dependencies to queue
-    for(java_bytecode_parse_treet::class_refst::const_iterator
-        it=parse_tree.class_refs.begin();
-        it!=parse_tree.class_refs.end();
+    for(std::vector<irep_idt>::const_iterator
+        it=todo.begin();
+        it!=todo.end();
         it++)
-      queue.push(*it);
+    {
+      const java_bytecode_parse_treet &parse_tree=class_map[*it];
+
+      frontier.insert(
+        frontier.end(),
+        parse_tree.class_refs.begin(),
+        parse_tree.class_refs.end());
+    }
   }
   
   return class_map[class_name];
@@ -62,7 +99,7 @@ java_bytecode_parse_treet &java_class_loadert::operator()(
 
 /*******************************************************************\
 
-Function: java_class_loadert::get_parse_tree
+Function: java_class_loadert::load_class
 
   Inputs:
 
@@ -72,73 +109,210 @@ Function: java_class_loadert::get_parse_tree
 
 \*******************************************************************/
 
-java_bytecode_parse_treet &java_class_loadert::get_parse_tree(
+java_bytecode_parse_treet &java_class_loadert::load_class(
   const irep_idt &class_name)
 {
-  java_bytecode_parse_treet &parse_tree=class_map[class_name];
+  class_mapt::iterator c_it=class_map.find(class_name);
+
+  if(c_it!=class_map.end())
+    return c_it->second;
+
+  debug() << "Reading class " << class_name << eom;
+
+  return get_parse_tree(class_name);
+}
+
+/*******************************************************************\
+
+Function: java_class_loadert::load_classes
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void java_class_loadert::load_classes(const std::vector<irep_idt> &classes)
+{
+  std::vector<irep_idt> todo;
+  std::set<irep_idt> seen;
+
+  for(std::vector<irep_idt>::const_iterator
+      it=classes.begin();
+      it!=classes.end();
+      it++)
+    if(class_map.find(*it)==class_map.end() &&
+       seen.insert(*it).second)
+      todo.push_back(*it);
+
+  #ifdef CPROVER_THREAD_SAFE
+  std::size_t number_of_threads=
+    std::min<std::size_t>(std::thread::hardware_concurrency(), todo.size());
+
+  if(number_of_threads>=2)
+  {
+    // the JAR handles are not thread-safe, so we read first
+    std::vector<std::vector<char> > data(todo.size());
+    std::vector<bool> found(todo.size());
+
+    for(std::size_t i=0; i<todo.size(); i++)
+    {
+      debug() << "Reading class " << todo[i] << eom;
+      found[i]=!get_class_file(todo[i], data[i]);
+    }
+
+    std::vector<java_bytecode_parse_treet> parse_trees(todo.size());
+    std::vector<buffered_message_handlert> handlers(todo.size());
+    std::atomic<std::size_t> next(0);
+
+    for(std::size_t i=0; i<todo.size(); i++)
+      handlers[i].set_verbosity(get_message_handler().get_verbosity());
+
+    std::vector<std::thread> threads;
+
+    for(std::size_t t=0; t<number_of_threads; t++)
+      threads.push_back(std::thread([&]()
+      {
+        for(std::size_t i=next++; i<todo.size(); i=next++)
+        {
+          if(!found[i])
+            continue;
+
+          parse_class_file(data[i], parse_trees[i], handlers[i]);
+        }
+      }));
+
+    for(std::size_t t=0; t<threads.size(); t++)
+      threads[t].join();
+
+    for(std::size_t i=0; i<todo.size(); i++)
+    {
+      handlers[i].flush(get_message_handler());
+
+      java_bytecode_parse_treet &parse_tree=class_map[todo[i]];
+      parse_tree.swap(parse_trees[i]);
+
+      if(!found[i])
+      {
+        warning() << "failed to load class `" << todo[i] << '\'' << eom;
+        parse_tree.parsed_class.name=todo[i];
+      }
+    }
+
+    return;
+  }
+  #endif
+
+  for(std::size_t i=0; i<todo.size(); i++)
+    load_class(todo[i]);
+}
+
+/*******************************************************************\
+
+Function: java_class_loadert::get_class_file
+
+  Inputs: name of a class
 
+ Outputs: true if the class can't be found
+
+ Purpose:
+
+\*******************************************************************/
+
+bool java_class_loadert::get_class_file(
+  const irep_idt &class_name,
+  std::vector<char> &data)
+{
   // in a JAR?
   class_jar_mapt::const_iterator c_j_it=
     class_jar_map.find(class_name);
   
   if(c_j_it!=class_jar_map.end())
   {
-    std::vector<char> data;
-
-    if(get_jar_entry(
-      c_j_it->second.jar_file_name.c_str(), c_j_it->second.index, data))
-      return parse_tree; // error
-  
-    std::istringstream istream(data.data());
+    jar_filet &jar=jar_map[c_j_it->second.jar_file_name];
     
-    java_bytecode_parse(
-      istream,
-      parse_tree,
-      get_message_handler());
-      
-    return parse_tree;
+    if(!jar.is_open() &&
+       jar.open(id2string(c_j_it->second.jar_file_name)))
+      return true;
+
+    return jar.get_entry(c_j_it->second.index, data);
   }
 
+  std::list<std::string> candidates;
+
   // in a given class file?
   class_file_mapt::const_iterator c_f_it=
     class_file_map.find(class_name);
   
   if(c_f_it!=class_file_map.end())
+    candidates.push_back(id2string(c_f_it->second));
+  else
   {
-    java_bytecode_parse(
-      id2string(c_f_it->second),
-      parse_tree,
-      get_message_handler());
-    
-    return parse_tree;
+    // See if we can find a class file in class path
+    for(std::list<std::string>::const_iterator
+        cp_it=config.java.class_path.begin();
+        cp_it!=config.java.class_path.end();
+        cp_it++)
+    {
+      #ifdef _WIN32
+      candidates.push_back(*cp_it+'\\'+id2string(class_name)+".class");
+      #else
+      candidates.push_back(*cp_it+'/'+id2string(class_name)+".class");
+      #endif
+    }
   }
-  
-  // See if we can find a class file in class path
-  
+
   for(std::list<std::string>::const_iterator
-      cp_it=config.java.class_path.begin();
-      cp_it!=config.java.class_path.end();
-      cp_it++)
+      it=candidates.begin();
+      it!=candidates.end();
+      it++)
   {
-    std::string full_path;
-    
-    #ifdef _WIN32
-    full_path=*cp_it+'\\'+id2string(class_name)+".class";
-    #else
-    full_path=*cp_it+'/'+id2string(class_name)+".class";
-    #endif
-  
-    if(!java_bytecode_parse(
-         full_path,
-         parse_tree,
-         get_message_handler()))
-      return parse_tree;
+    std::ifstream in(it->c_str(), std::ios::binary);
+
+    if(in)
+    {
+      data.assign(
+        std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>());
+      return false;
+    }
   }
-    
-  // not found
-  warning() << "failed to load class `" << class_name << '\'' << eom;
-  parse_tree.parsed_class.name=class_name;
-  return parse_tree;  
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: java_class_loadert::get_parse_tree
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+java_bytecode_parse_treet &java_class_loadert::get_parse_tree(
+  const irep_idt &class_name)
+{
+  java_bytecode_parse_treet &parse_tree=class_map[class_name];
+
+  std::vector<char> data;
+
+  if(get_class_file(class_name, data))
+  {
+    // not found
+    warning() << "failed to load class `" << class_name << '\'' << eom;
+    parse_tree.parsed_class.name=class_name;
+    return parse_tree;
+  }
+
+  parse_class_file(data, parse_tree, get_message_handler());
+      
+  return parse_tree;
 }
 
 /*******************************************************************\
@@ -172,19 +346,19 @@ Function: java_class_loadert::add_jar_file
 
 void java_class_loadert::add_jar_file(const irep_idt &file)
 {
-  std::vector<std::string> entries;
+  jar_filet &jar=jar_map[file];
   
-  if(get_jar_index(file.c_str(), entries))
+  if(jar.open(id2string(file)))
   {
     error() << "failed to open JAR file `" << file << "'" << eom;
     return;
   }
   
-  std::size_t number_of_files=entries.size();
+  std::size_t number_of_files=jar.entries.size();
   
   for(std::size_t index=0; index<number_of_files; index++)
   {
-    std::string file_name=entries[index];
+    const std::string &file_name=jar.entries[index];
     
     // does it end on .class?
     if(has_suffix(file_name, ".class"))
@@ -10,16 +10,26 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_JAVA_CLASS_LOADER_H
 
 #include <map>
+#include <vector>
 
 #include <util/message.h>
 
 #include "java_bytecode_parse_tree.h"
+#include "jar_file.h"
 
 class java_class_loadert:public messaget
 {
 public:
+  // loads the class and everything it refers to, transitively
   java_bytecode_parse_treet &operator()(const irep_idt &);
   
+  // loads the given class only, if it isn't loaded yet
+  java_bytecode_parse_treet &load_class(const irep_idt &);
+
+  // loads the given classes only; the class files are parsed
+  // in parallel if irep_idt is thread-safe
+  void load_classes(const std::vector<irep_idt> &);
+
   // maps class names to the parse trees
   typedef std::map<irep_idt, java_bytecode_parse_treet> class_mapt;
   class_mapt class_map;
@@ -46,7 +56,15 @@ protected:
   // maps class names (no .class extension) to class file names
   typedef std::map<irep_idt, irep_idt> class_file_mapt;
   class_file_mapt class_file_map;
+
+  // the JAR files, kept open
+  typedef std::map<irep_idt, jar_filet> jar_mapt;
+  jar_mapt jar_map;
   
+  // get the contents of the class file from JAR, .class files
+  // or the class path; returns true if not found
+  bool get_class_file(const irep_idt &, std::vector<char> &);
+
   // get a parse tree from JAR and then from .class files
   java_bytecode_parse_treet &get_parse_tree(const irep_idt &);
 };
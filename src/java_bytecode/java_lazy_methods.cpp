@@ -0,0 +1,373 @@
+/*******************************************************************\
+
+Module: Loading Classes for the Reachable Methods Only
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <util/prefix.h>
+#include <util/std_expr.h>
+
+#include "java_lazy_methods.h"
+
+/*******************************************************************\
+
+   Class: java_lazy_methodst
+
+ Purpose: a fixed-point over the parse trees: methods are reachable
+          from the entry classes or from the instructions of other
+          reachable methods, and classes are needed if a reachable
+          method refers to them, or if they are a base of a needed
+          class
+
+\*******************************************************************/
+
+class java_lazy_methodst
+{
+public:
+  java_lazy_methodst(
+    java_class_loadert &_java_class_loader,
+    std::set<irep_idt> &_methods):
+    java_class_loader(_java_class_loader),
+    methods(_methods)
+  {
+  }
+
+  void operator()(const std::vector<irep_idt> &entry_classes);
+
+protected:
+  java_class_loadert &java_class_loader;
+  std::set<irep_idt> &methods;
+
+  typedef java_bytecode_parse_treet::classt classt;
+  typedef java_bytecode_parse_treet::methodt methodt;
+  typedef methodt::instructionst instructionst;
+
+  std::set<irep_idt> entry_classes;
+  std::set<irep_idt> needed_classes, pending_classes;
+  std::vector<irep_idt> queue;
+
+  // name:signature of the virtual methods called so far,
+  // which need to be converted in all classes
+  std::set<irep_idt> virtual_methods;
+
+  void need_class(const irep_idt &class_name);
+  void need_type(const typet &type);
+  void class_loaded(const irep_idt &class_name);
+  void method_reached(const irep_idt &identifier);
+  void instructions_reached(const instructionst &instructions);
+
+  static irep_idt method_identifier(const classt &c, const methodt &m)
+  {
+    return "java::"+id2string(c.name)+"."+id2string(m.name)+":"+
+           m.signature;
+  }
+
+  static irep_idt strip_java_prefix(const irep_idt &identifier)
+  {
+    const std::string &s=id2string(identifier);
+    return has_prefix(s, "java::")?s.substr(6, std::string::npos):s;
+  }
+};
+
+/*******************************************************************\
+
+Function: java_lazy_methodst::need_class
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void java_lazy_methodst::need_class(const irep_idt &class_name)
+{
+  if(!class_name.empty() &&
+     needed_classes.insert(class_name).second)
+    pending_classes.insert(class_name);
+}
+
+/*******************************************************************\
+
+Function: java_lazy_methodst::need_type
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void java_lazy_methodst::need_type(const typet &type)
+{
+  if(type.id()==ID_symbol)
+    need_class(strip_java_prefix(type.get(ID_identifier)));
+  else if(type.id()==ID_array || type.id()==ID_pointer)
+    need_type(type.subtype());
+}
+
+/*******************************************************************\
+
+Function: java_lazy_methodst::class_loaded
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void java_lazy_methodst::class_loaded(const irep_idt &class_name)
+{
+  const classt &c=java_class_loader.class_map[class_name].parsed_class;
+
+  // the bases are needed for the layout of the class
+  need_class(c.extends);
+
+  for(classt::implementst::const_iterator
+      it=c.implements.begin();
+      it!=c.implements.end();
+      it++)
+    need_class(*it);
+
+  const bool is_entry_class=entry_classes.count(class_name)!=0;
+
+  for(classt::methodst::const_iterator
+      it=c.methods.begin();
+      it!=c.methods.end();
+      it++)
+  {
+    // static initializers run whenever the class is used
+    if(is_entry_class ||
+       it->name=="<clinit>" ||
+       (!it->is_static &&
+        virtual_methods.count(id2string(it->name)+":"+it->signature)!=0))
+      queue.push_back(method_identifier(c, *it));
+  }
+}
+
+/*******************************************************************\
+
+Function: java_lazy_methodst::method_reached
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void java_lazy_methodst::method_reached(const irep_idt &identifier)
+{
+  if(methods.count(identifier)!=0)
+    return; // done already
+
+  // the identifier is java::class.name:signature,
+  // and names don't contain a dot
+  const std::string s=id2string(strip_java_prefix(identifier));
+  std::size_t colon=s.find(':');
+  std::size_t dot=s.rfind('.', colon);
+
+  if(colon==std::string::npos || dot==std::string::npos)
+    return;
+
+  const irep_idt class_name=s.substr(0, dot);
+  const std::string name=s.substr(dot+1, colon-dot-1);
+  const std::string signature=s.substr(colon+1, std::string::npos);
+
+  java_class_loadert::class_mapt::const_iterator c_it=
+    java_class_loader.class_map.find(class_name);
+
+  if(c_it==java_class_loader.class_map.end())
+  {
+    // get back to it once the class is there
+    need_class(class_name);
+    queue.push_back(identifier);
+    return;
+  }
+
+  methods.insert(identifier);
+
+  const classt &c=c_it->second.parsed_class;
+  const methodt *method=NULL;
+
+  for(classt::methodst::const_iterator
+      it=c.methods.begin();
+      it!=c.methods.end();
+      it++)
+    if(it->name==name && it->signature==signature)
+    {
+      method=&*it;
+      break;
+    }
+
+  if(method==NULL)
+  {
+    // inherited
+    if(!c.extends.empty())
+      queue.push_back(
+        "java::"+id2string(c.extends)+"."+name+":"+signature);
+    return;
+  }
+
+  if(!method->is_static && name!="<init>")
+  {
+    const irep_idt name_signature=name+":"+signature;
+
+    // overrides in classes we have already
+    if(virtual_methods.insert(name_signature).second)
+      for(java_class_loadert::class_mapt::const_iterator
+          it=java_class_loader.class_map.begin();
+          it!=java_class_loader.class_map.end();
+          it++)
+      {
+        const classt &other=it->second.parsed_class;
+
+        for(classt::methodst::const_iterator
+            m_it=other.methods.begin();
+            m_it!=other.methods.end();
+            m_it++)
+          if(!m_it->is_static &&
+             m_it->name==name && m_it->signature==signature)
+            queue.push_back(method_identifier(other, *m_it));
+      }
+  }
+
+  instructions_reached(method->instructions);
+}
+
+/*******************************************************************\
+
+Function: java_lazy_methodst::instructions_reached
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void java_lazy_methodst::instructions_reached(
+  const instructionst &instructions)
+{
+  for(instructionst::const_iterator
+      i_it=instructions.begin();
+      i_it!=instructions.end();
+      i_it++)
+  {
+    for(java_bytecode_parse_treet::instructiont::argst::const_iterator
+        a_it=i_it->args.begin();
+        a_it!=i_it->args.end();
+        a_it++)
+    {
+      const exprt &arg=*a_it;
+
+      if(arg.id()==ID_symbol && arg.type().id()==ID_code)
+        queue.push_back(to_symbol_expr(arg).get_identifier());
+      else if(arg.id()=="fieldref")
+        need_class(strip_java_prefix(arg.get(ID_class)));
+      else if(arg.id()==ID_type)
+        need_type(arg.type());
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: java_lazy_methodst::operator()
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void java_lazy_methodst::operator()(
+  const std::vector<irep_idt> &_entry_classes)
+{
+  entry_classes.insert(_entry_classes.begin(), _entry_classes.end());
+
+  for(std::set<irep_idt>::const_iterator
+      it=entry_classes.begin();
+      it!=entry_classes.end();
+      it++)
+  {
+    // may be loaded already
+    needed_classes.insert(*it);
+    if(java_class_loader.class_map.count(*it)!=0)
+      class_loaded(*it);
+    else
+      pending_classes.insert(*it);
+  }
+
+  while(!pending_classes.empty() || !queue.empty())
+  {
+    if(!pending_classes.empty())
+    {
+      std::vector<irep_idt> batch(
+        pending_classes.begin(), pending_classes.end());
+      pending_classes.clear();
+
+      java_class_loader.load_classes(batch);
+
+      for(std::size_t i=0; i<batch.size(); i++)
+        class_loaded(batch[i]);
+    }
+
+    std::vector<irep_idt> current;
+    current.swap(queue);
+
+    for(std::size_t i=0; i<current.size(); i++)
+      method_reached(current[i]);
+  }
+
+  // stubs for the classes that are only mentioned
+  std::set<irep_idt> stubs;
+
+  for(java_class_loadert::class_mapt::const_iterator
+      it=java_class_loader.class_map.begin();
+      it!=java_class_loader.class_map.end();
+      it++)
+    for(java_bytecode_parse_treet::class_refst::const_iterator
+        r_it=it->second.class_refs.begin();
+        r_it!=it->second.class_refs.end();
+        r_it++)
+      if(java_class_loader.class_map.count(*r_it)==0)
+        stubs.insert(*r_it);
+
+  for(std::set<irep_idt>::const_iterator
+      it=stubs.begin();
+      it!=stubs.end();
+      it++)
+    java_class_loader.class_map[*it].parsed_class.name=*it;
+}
+
+/*******************************************************************\
+
+Function: java_lazy_methods
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void java_lazy_methods(
+  java_class_loadert &java_class_loader,
+  const std::vector<irep_idt> &entry_classes,
+  std::set<irep_idt> &methods)
+{
+  java_lazy_methodst java_lazy_methods(java_class_loader, methods);
+  java_lazy_methods(entry_classes);
+}
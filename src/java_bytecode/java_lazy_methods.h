@@ -0,0 +1,27 @@
+/*******************************************************************\
+
+Module: Loading Classes for the Reachable Methods Only
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_JAVA_LAZY_METHODS_H
+#define CPROVER_JAVA_LAZY_METHODS_H
+
+#include <set>
+#include <vector>
+
+#include "java_class_loader.h"
+
+// Loads the classes needed by the methods reachable from the
+// methods of the given classes, and returns the identifiers
+// of these methods. Classes that are referred to but not needed
+// get stubs.
+
+void java_lazy_methods(
+  java_class_loadert &java_class_loader,
+  const std::vector<irep_idt> &entry_classes,
+  std::set<irep_idt> &methods);
+
+#endif
@@ -8,9 +8,16 @@ Author: Vincent Nimal
 
 #include <util/i2string.h>
 #include <util/graph.h>
+#include <util/union_find.h>
 
 #include <sstream>
 #include <fstream>
+#include <algorithm>
+
+#ifdef CPROVER_THREAD_SAFE
+#include <atomic>
+#include <thread>
+#endif
 
 #ifdef HAVE_GLPK
 #include <glpk.h>
@@ -89,6 +96,15 @@ Function: fence_insertert::preprocess
 void fence_insertert::preprocess() {
   process_cycles_selection();
 
+  /* starts afresh if called again after new cycles were found */
+  po.clear();
+  powr_constraints.clear();
+  poww_constraints.clear();
+  porw_constraints.clear();
+  porr_constraints.clear();
+  com_constraints.clear();
+  constraints_number=0;
+
   cycles_visitor.po_edges(po);
 
   /* TODO: replace lists by sets and carefully count the number of constraints
@@ -237,218 +253,27 @@ void fence_insertert::preprocess() {
 
 /*******************************************************************\
 
-Function: fence_insertert::mip_set_var
+Function: fence_insertert::mip_add_columns
 
-  Inputs:
+  Inputs: MIP variables (edges), and a type of fence
 
  Outputs:
 
- Purpose:
+ Purpose: adds the columns of these fences to the row
 
 \*******************************************************************/
 
-void inline fence_insertert::mip_set_var(ilpt& ilp, 
-  unsigned& i) 
+void fence_insertert::mip_add_columns(
+  mip_rowt &row,
+  const std::set<unsigned> &vars,
+  fence_typet f) const
 {
-#ifdef HAVE_GLPK
-  glp_add_cols(ilp.lp, unique*fence_options);
-  //unsigned i=1;
-  for(; i<=unique*fence_options; i+=fence_options)
-  {
-    const bool has_cost = 1; //(po_plus.find(i)==po_plus.end());
-    /* has_cost == 0 => invisible variable */
-    assert(has_cost); // not useful for this problem
-
-    /* computes the sum of the frequencies of the cycles in which
-       this event appears, if requested */
-    float freq_sum = 0;
-    if(with_freq)
-    {
-      assert(instrumenter.set_of_cycles.size()==freq_table.size());
-      freq_sum += epsilon;
-      for(std::set<event_grapht::critical_cyclet>::const_iterator
-        C_j=instrumenter.set_of_cycles.begin();
-        C_j!=instrumenter.set_of_cycles.end();
-        ++C_j)
-      {
-        /* filters */
-        if(filter_cycles(C_j->id)) continue;
-
-        /* if(C_j->find( col_to_var(i) )!=C_j->end()) */
-        std::list<unsigned>::const_iterator it;
-        for(it = C_j->begin(); it!=C_j->end() && col_to_var(i)!=*it; ++it);
-
-        if(it!=C_j->end())
-          freq_sum += freq_table[C_j->id];
-      }
-    }
-    else
-      freq_sum = 1;
-
-    if(model==Power || model==Unknown) {
-      /* dp variable for e */
-      const std::string name_dp="dp_"+i2string(i);
-      glp_set_col_name(ilp.lp, i, name_dp.c_str());
-      glp_set_col_bnds(ilp.lp, i, GLP_LO, 0.0, 0.0);
-      glp_set_obj_coef(ilp.lp, i, (has_cost?fence_cost(Dp):0)*freq_sum);
-      glp_set_col_kind(ilp.lp, i, GLP_BV);
-
-      /* fence variable for e */
-      const std::string name_f="f_"+i2string(i);
-      glp_set_col_name(ilp.lp, i+1, name_f.c_str());
-      glp_set_col_bnds(ilp.lp, i+1, GLP_LO, 0.0, 0.0);
-      glp_set_obj_coef(ilp.lp, i+1, (has_cost?fence_cost(Fence):0)*freq_sum);
-      glp_set_col_kind(ilp.lp, i+1, GLP_BV);
-
-// Note: uncomment for br and cf fences
-#if 0
-      /* br variable for e */
-      const std::string name_br="br_"+i2string(i);
-      glp_set_col_name(ilp.lp, i+2, name_br.c_str());
-      glp_set_col_bnds(ilp.lp, i+2, GLP_LO, 0.0, 0.0);
-      glp_set_obj_coef(ilp.lp, i+2, (has_cost?fence_cost(Branching):0)*freq_sum);
-      glp_set_col_kind(ilp.lp, i+2, GLP_BV);
-
-      /* cf variable for e */
-      const std::string name_cf="cf_"+i2string(i);
-      glp_set_col_name(ilp.lp, i+3, name_cf.c_str());
-      glp_set_col_bnds(ilp.lp, i+3, GLP_LO, 0.0, 0.0);
-      glp_set_obj_coef(ilp.lp, i+3, (has_cost?fence_cost(Ctlfence):0)*freq_sum);
-      glp_set_col_kind(ilp.lp, i+3, GLP_BV);
-#endif
-
-      if(model==Power) {
-        /* lwf variable for e */
-        const std::string name_lwf="lwf_"+i2string(i);
-        glp_set_col_name(ilp.lp, i+2/*4*/, name_lwf.c_str());
-        glp_set_col_bnds(ilp.lp, i+2/*4*/, GLP_LO, 0.0, 0.0);
-        glp_set_obj_coef(ilp.lp, i+2/*4*/,
-          (has_cost?fence_cost(Lwfence):0)*freq_sum);
-        glp_set_col_kind(ilp.lp, i+2/*4*/, GLP_BV);
-      }
-    }
-    else {
-      /* fence variable for e */
-      const std::string name_f="f_"+i2string(i);
-      glp_set_col_name(ilp.lp, i, name_f.c_str());
-      glp_set_col_bnds(ilp.lp, i, GLP_LO, 0.0, 0.0);
-      glp_set_obj_coef(ilp.lp, i, (has_cost?fence_cost(Fence):0)*freq_sum);
-      glp_set_col_kind(ilp.lp, i, GLP_BV);
-    }
-  }
-#else
-  throw "Sorry, musketeer requires glpk; please recompile\
-    musketeer with glpk.";
-#endif
-}
-
-/*******************************************************************\
-
-Function: fence_insertert::mip_set_cst
-
-  Inputs:
-
- Outputs:
-
- Purpose:
-
-\*******************************************************************/
-
-void inline fence_insertert::mip_set_cst(ilpt& ilp, unsigned& i)
-{
-#ifdef HAVE_GLPK
-  glp_add_rows(ilp.lp, constraints_number);
-  i=1;
-
-  /* first the powr: for all C_j */
-  for(
-    std::list<std::set<unsigned> >::const_iterator c_wr_it =
-      powr_constraints.begin();
-    c_wr_it != powr_constraints.end();
-    ++c_wr_it)
-  {
-    /* for all e */
-    for(unsigned j=1; j<=c_wr_it->size(); ++j)
-    {
-      std::string name="C_"+i2string(i)+"_c_wr_"+i2string(j);
-      glp_set_row_name(ilp.lp, i, name.c_str());
-      glp_set_row_bnds(ilp.lp, i, GLP_LO, 1.0, 0.0); /* >= 1*/
-      ++i;
-    }
-  }
-
-  /* then the poww: for all C_j */
-  for(
-    std::list<std::set<unsigned> >::const_iterator c_ww_it =
-      poww_constraints.begin();
-    c_ww_it != poww_constraints.end();
-    ++c_ww_it)
-  {
-    /* for all e */
-    for(unsigned j=1; j<=c_ww_it->size(); ++j)
-    {
-      std::string name="C_"+i2string(i)+"_c_ww_"+i2string(j);
-      glp_set_row_name(ilp.lp, i, name.c_str());
-      glp_set_row_bnds(ilp.lp, i, GLP_LO, 1.0, 0.0); /* >= 1*/
-      ++i;
-    }
-  }
-
-  /* then the porw: for all C_j */
-  for(
-    std::list<std::set<unsigned> >::const_iterator c_rw_it =
-      porw_constraints.begin();
-    c_rw_it != porw_constraints.end();
-    ++c_rw_it)
-  {
-    /* for all e */
-    for(unsigned j=1; j<=c_rw_it->size(); ++j)
-    {
-      std::string name="C_"+i2string(i)+"_c_rw_"+i2string(j);
-      glp_set_row_name(ilp.lp, i, name.c_str());
-      glp_set_row_bnds(ilp.lp, i, GLP_LO, 1.0, 0.0); /* >= 1*/
-      ++i;
-    }
-  }
-
-  /* and finally the porr: for all C_j */
-  for(
-    std::list<std::set<unsigned> >::const_iterator c_rr_it =
-      porr_constraints.begin();
-    c_rr_it != porr_constraints.end();
-    ++c_rr_it)
-  {
-    /* for all e */
-    for(unsigned j=1; j<=c_rr_it->size(); ++j)
-    {
-      std::string name="C_"+i2string(i)+"_c_rr_"+i2string(j);
-      glp_set_row_name(ilp.lp, i, name.c_str());
-      glp_set_row_bnds(ilp.lp, i, GLP_LO, 1.0, 0.0); /* >= 1*/
-      ++i;
-    }
-  }
-
-  if(model==Power || model==Unknown) {
-    for(
-      std::list<std::set<unsigned> >::const_iterator c_it =
-        com_constraints.begin();
-      c_it != com_constraints.end();
-      ++c_it)
-    {
-      /* for all e */
-      for(unsigned j=1; j<=c_it->size(); ++j)
-      {
-        std::string name="C_"+i2string(i)+"_c_"+i2string(j);
-        glp_set_row_name(ilp.lp, i, name.c_str());
-        glp_set_row_bnds(ilp.lp, i, GLP_LO, 1.0, 0.0); /* >= 1*/
-        ++i;
-      }
-    }
-  }
-#else
-  throw "Sorry, musketeer requires glpk; please recompile\
-    musketeer with glpk.";
-#endif
+  for(std::set<unsigned>::const_iterator
+    it=vars.begin();
+    it!=vars.end();
+    ++it)
+    if(*it>=1 && *it<=unique)
+      row.insert(var_fence_to_col(f, *it));
 }
 
 /*******************************************************************\
@@ -459,17 +284,16 @@ Function: fence_insertert::mip_fill_matrix
 
  Outputs:
 
- Purpose:
+ Purpose: one row per constraint, listing the columns of the fences
+          which satisfy it
 
 \*******************************************************************/
 
-void inline fence_insertert::mip_fill_matrix(ilpt& ilp, unsigned& i,
-  unsigned const_constraints_number, unsigned const_unique)
+void fence_insertert::mip_fill_matrix()
 {
 #ifdef HAVE_GLPK
-  unsigned col=1;
-  unsigned row=1;
-  i=1;
+  mip_rows.clear();
+  mip_rows.reserve(constraints_number);
 
   /* first, powr constraints: for all C_j */
   for(std::list<std::set<unsigned> >::const_iterator
@@ -486,30 +310,10 @@ void inline fence_insertert::mip_fill_matrix(ilpt& ilp, unsigned& i,
       std::set<unsigned> pt_set;
       assert(map_to_e.find(*e_c_it) != map_to_e.end());
       const_graph_visitor.PT(map_to_e.find(*e_c_it)->second, pt_set);
+
       /* sum_e' f_e' */
-      for(col=1; col<=unique*fence_options; ++col)
-      {
-        assert(row<=const_constraints_number);
-        assert(col<=const_unique*fence_options);
-        ilp.imat[i]=row;
-        ilp.jmat[i]=col;
-        if(model==Power || model==Unknown) {
-          if(pt_set.find(col_to_var(col))!=pt_set.end()
-              && col_to_fence(col)==Fence)
-            ilp.vmat[i]=1.0;
-          else
-            ilp.vmat[i]=0.0;
-        }
-        else {
-          if(pt_set.find(col_to_var(col))!=pt_set.end()
-            && col_to_fence(col)==Fence)
-            ilp.vmat[i]=1.0;
-          else
-            ilp.vmat[i]=0.0;
-        }
-        ++i;
-      }
-      ++row;
+      mip_rows.push_back(mip_rowt());
+      mip_add_columns(mip_rows.back(), pt_set, Fence);
     }
   }
 
@@ -528,166 +332,45 @@ void inline fence_insertert::mip_fill_matrix(ilpt& ilp, unsigned& i,
       std::set<unsigned> pt_set;
       assert(map_to_e.find(*e_nc_it) != map_to_e.end());
       const_graph_visitor.PT(map_to_e.find(*e_nc_it)->second, pt_set);
+
       /* sum_e' (f_e' + lwf_e') */
-      for(col=1; col<=unique*fence_options; ++col)
-      {
-        assert(row<=const_constraints_number);
-        assert(col<=const_unique*fence_options);
-        ilp.imat[i]=row;
-        ilp.jmat[i]=col;
-        if(model==Power) {
-          if(pt_set.find(col_to_var(col))!=pt_set.end() 
-              && (col_to_fence(col)==Lwfence || col_to_fence(col)==Fence))
-            ilp.vmat[i]=1.0;
-          else
-            ilp.vmat[i]=0.0;
-        }
-        else {
-          if(pt_set.find(col_to_var(col))!=pt_set.end()
-            && col_to_fence(col)==Fence)
-            ilp.vmat[i]=1.0;
-          else
-            ilp.vmat[i]=0.0;
-        }
-        ++i;
-      }
-      ++row;
+      mip_rows.push_back(mip_rowt());
+      mip_add_columns(mip_rows.back(), pt_set, Fence);
+      if(model==Power)
+        mip_add_columns(mip_rows.back(), pt_set, Lwfence);
     }
   }
 
-  /* then, porw constraints: for all C_j */
-  for(std::list<std::set<unsigned> >::const_iterator
-    e_i=porw_constraints.begin();
-    e_i!=porw_constraints.end();
-    ++e_i)
+  /* then, porw and porr constraints: for all C_j */
+  for(unsigned k=0; k<2; ++k)
   {
-    /* for all e */
-    for(std::set<unsigned>::const_iterator
-      e_nc_it=e_i->begin();
-      e_nc_it!=e_i->end();
-      ++e_nc_it)
-    {
-      std::set<unsigned> pt_set;
-      assert(map_to_e.find(*e_nc_it) != map_to_e.end());
-      const_graph_visitor.PT(map_to_e.find(*e_nc_it)->second, pt_set);
-      /* dp_e + sum_e' (f_e' + lwf_e' + br_e') */
-      for(col=1; col<=unique*fence_options; ++col)
-      {
-        assert(row<=const_constraints_number);
-        assert(col<=const_unique*fence_options);
-        ilp.imat[i]=row;
-        ilp.jmat[i]=col;
-        if(model==Power) {
-          if(col==var_fence_to_col(Dp, *e_nc_it)
-              ||(pt_set.find(col_to_var(col))!=pt_set.end()
-              && (col_to_fence(col)==Lwfence 
-                || col_to_fence(col)==Fence
-#if 0
-                || col_to_fence(col)==Branching
-#endif
-              ))
-            )
-            ilp.vmat[i]=1.0;
-          else
-            ilp.vmat[i]=0.0;
-        }
-        else if (model==Unknown) {
-          if(col==var_fence_to_col(Dp, *e_nc_it)
-              ||(pt_set.find(col_to_var(col))!=pt_set.end()
-              && (col_to_fence(col)==Fence 
-#if 0
-                || col_to_fence(col)==Branching
-#endif
-              ))
-            )
-            ilp.vmat[i]=1.0;
-          else
-            ilp.vmat[i]=0.0;
-        }
-        else {
-          if(pt_set.find(col_to_var(col))!=pt_set.end()
-            && (col_to_fence(col)==Fence
-#if 0
-              || col_to_fence(col)==Branching
-#endif
-            ))
-            ilp.vmat[i]=1.0;
-          else
-            ilp.vmat[i]=0.0;
-        }
-        ++i;
-      }
-      ++row;
-    }
-  }
+    const std::list<std::set<unsigned> > &constraints=
+      (k==0?porw_constraints:porr_constraints);
 
-  /* then, porr constraints: for all C_j */
-  for(std::list<std::set<unsigned> >::const_iterator
-    e_i=porr_constraints.begin();
-    e_i!=porr_constraints.end();
-    ++e_i)
-  {
-    /* for all e */
-    for(std::set<unsigned>::const_iterator
-      e_nc_it=e_i->begin();
-      e_nc_it!=e_i->end();
-      ++e_nc_it)
+    for(std::list<std::set<unsigned> >::const_iterator
+      e_i=constraints.begin();
+      e_i!=constraints.end();
+      ++e_i)
     {
-      std::set<unsigned> pt_set;
-      assert(map_to_e.find(*e_nc_it) != map_to_e.end());
-      const_graph_visitor.PT(map_to_e.find(*e_nc_it)->second, pt_set);
-// uncomment for cf
-#if 0
-      std::set<unsigned> it_set;
-      IT(map_to_e.find(*e_nc_it)->second, it_set);
-#endif
-      /* dp_e + sum_e' (f_e' + lwf_e') + sum_e'' cf_e'') */
-      for(col=1; col<=unique*fence_options; ++col)
+      /* for all e */
+      for(std::set<unsigned>::const_iterator
+        e_nc_it=e_i->begin();
+        e_nc_it!=e_i->end();
+        ++e_nc_it)
       {
-        assert(row<=const_constraints_number);
-        assert(col<=const_unique*fence_options);
-        ilp.imat[i]=row;
-        ilp.jmat[i]=col;
-        if(model==Power) {
-          if(col==var_fence_to_col(Dp, *e_nc_it)
-              ||(pt_set.find(col_to_var(col))!=pt_set.end()
-              && (col_to_fence(col)==Lwfence
-                || col_to_fence(col)==Fence
-              ))
-#if 0
-              ||(it_set.find(col_to_var(col))!=it_set.end()
-              && col_to_fence(col)==Ctlfence)
-#endif
-            )
-            ilp.vmat[i]=1.0;
-          else
-            ilp.vmat[i]=0.0;
-        }
-        else if (model==Unknown) {
-          if(col==var_fence_to_col(Dp, *e_nc_it)
-              ||(pt_set.find(col_to_var(col))!=pt_set.end()
-              && (col_to_fence(col)==Fence
-              ))
-#if 0
-              ||(it_set.find(col_to_var(col))!=it_set.end()
-              && col_to_fence(col)==Ctlfence)
-#endif   
-            )
-            ilp.vmat[i]=1.0;
-          else
-            ilp.vmat[i]=0.0;
-        }
-        else {
-          if(pt_set.find(col_to_var(col))!=pt_set.end()
-            && (col_to_fence(col)==Fence
-            ))
-            ilp.vmat[i]=1.0;
-          else
-            ilp.vmat[i]=0.0;
-        }
-        ++i;
+        std::set<unsigned> pt_set;
+        assert(map_to_e.find(*e_nc_it) != map_to_e.end());
+        const_graph_visitor.PT(map_to_e.find(*e_nc_it)->second, pt_set);
+
+        /* dp_e + sum_e' (f_e' + lwf_e') */
+        mip_rows.push_back(mip_rowt());
+        mip_rowt &row=mip_rows.back();
+        mip_add_columns(row, pt_set, Fence);
+        if(model==Power)
+          mip_add_columns(row, pt_set, Lwfence);
+        if(model==Power || model==Unknown)
+          row.insert(var_fence_to_col(Dp, *e_nc_it));
       }
-      ++row;
     }
   }
 
@@ -705,8 +388,6 @@ void inline fence_insertert::mip_fill_matrix(ilpt& ilp, unsigned& i,
         e_c_it!=e_i->end();
         ++e_c_it)
       {
-        unsigned possibilities_met=0;
-
         std::set<unsigned> ct_set;
         assert( invisible_var.map_to_e.find(*e_c_it)
           != invisible_var.map_to_e.end());
@@ -723,31 +404,14 @@ void inline fence_insertert::mip_fill_matrix(ilpt& ilp, unsigned& i,
           << ct_set.size() << messaget::eom;
 
         /* sum_e' f_e' + sum_e'' lwf_e'' */
-        for(col=1; col<=unique*fence_options; ++col)
-        {
-          assert(row<=const_constraints_number);
-          assert(col<=const_unique*fence_options);
-          ilp.imat[i]=row;
-          ilp.jmat[i]=col;
-          if( (ct_set.find(col_to_var(col))!=ct_set.end()
-            && col_to_fence(col)==Fence)
-            || (ct_not_powr_set.find(col_to_var(col))!=ct_not_powr_set.end()
-              && col_to_fence(col)==Lwfence) )
-          {
-            ilp.vmat[i]=1.0;
-            ++possibilities_met;
-          }
-          else
-            ilp.vmat[i]=0.0;
-          ++i;
-        }
-        ++row;
-        assert(possibilities_met);
+        mip_rows.push_back(mip_rowt());
+        mip_add_columns(mip_rows.back(), ct_set, Fence);
+        if(model==Power)
+          mip_add_columns(mip_rows.back(), ct_not_powr_set, Lwfence);
+        assert(!mip_rows.back().empty());
       }
     }
   }
-  instrumenter.message.debug() << "3: " << i << " row: " << row 
-    << messaget::eom;
 #else
   throw "Sorry, musketeer requires glpk; please recompile\
     musketeer with glpk.";
@@ -756,7 +420,123 @@ void inline fence_insertert::mip_fill_matrix(ilpt& ilp, unsigned& i,
 
 /*******************************************************************\
 
-Function: fence_insertert::solve()
+Function: fence_insertert::mip_set_costs
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: objective coefficient of each column
+
+\*******************************************************************/
+
+void fence_insertert::mip_set_costs()
+{
+  mip_costs.assign(unique*fence_options+1, 0.0);
+
+  for(unsigned var=1; var<=unique; ++var)
+  {
+    /* computes the sum of the frequencies of the cycles in which
+       this event appears, if requested */
+    float freq_sum = 0;
+    if(with_freq)
+    {
+      assert(instrumenter.set_of_cycles.size()==freq_table.size());
+      freq_sum += epsilon;
+      for(std::set<event_grapht::critical_cyclet>::const_iterator
+        C_j=instrumenter.set_of_cycles.begin();
+        C_j!=instrumenter.set_of_cycles.end();
+        ++C_j)
+      {
+        /* filters */
+        if(filter_cycles(C_j->id)) continue;
+
+        /* if(C_j->find(var)!=C_j->end()) */
+        std::list<unsigned>::const_iterator it;
+        for(it = C_j->begin(); it!=C_j->end() && var!=*it; ++it);
+
+        if(it!=C_j->end())
+          freq_sum += freq_table[C_j->id];
+      }
+    }
+    else
+      freq_sum = 1;
+
+    for(unsigned col=(var-1)*fence_options+1; col<=var*fence_options; ++col)
+      mip_costs[col]=fence_cost(col_to_fence(col))*freq_sum;
+  }
+}
+
+/*******************************************************************\
+
+Function: fence_insertert::mip_decompose
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: splits the MIP into the connected components of its columns
+          and rows, which can be solved independently
+
+\*******************************************************************/
+
+void fence_insertert::mip_decompose()
+{
+  const unsigned number_of_columns=unique*fence_options;
+
+  unsigned_union_find columns;
+  columns.resize(number_of_columns+1);
+
+  std::vector<bool> used(number_of_columns+1, false);
+
+  /* a cycle that no fence can break */
+  for(unsigned r=0; r<mip_rows.size(); ++r)
+    if(mip_rows[r].empty())
+      throw "No feasible solution, the system is UNSAT";
+
+  for(unsigned r=0; r<mip_rows.size(); ++r)
+    for(mip_rowt::const_iterator
+      it=mip_rows[r].begin();
+      it!=mip_rows[r].end();
+      ++it)
+    {
+      /* without decomposition, a single system */
+      columns.make_union(decompose?*mip_rows[r].begin():*mip_rows[0].begin(),
+        *it);
+      used[*it]=true;
+    }
+
+  /* components are numbered in the order of their first column */
+  const unsigned none=(unsigned)-1;
+  std::vector<unsigned> component_of(number_of_columns+1, none);
+
+  mip_components.clear();
+
+  for(unsigned col=1; col<=number_of_columns; ++col)
+  {
+    if(!used[col])
+      continue;
+
+    unsigned &c=component_of[columns.find(col)];
+    if(c==none)
+    {
+      c=mip_components.size();
+      mip_components.push_back(mip_componentt());
+    }
+
+    mip_components[c].columns.push_back(col);
+  }
+
+  for(unsigned r=0; r<mip_rows.size(); ++r)
+  {
+    const unsigned c=component_of[columns.find(*mip_rows[r].begin())];
+    mip_components[c].rows.push_back(r);
+  }
+}
+
+/*******************************************************************\
+
+Function: fence_insertert::mip_set_var
 
   Inputs:
 
@@ -766,102 +546,324 @@ Function: fence_insertert::solve()
 
 \*******************************************************************/
 
-void fence_insertert::solve() {
+void fence_insertert::mip_set_var(ilpt& ilp,
+  const mip_componentt& component) const
+{
+#ifdef HAVE_GLPK
+  glp_add_cols(ilp.lp, component.columns.size());
+
+  for(unsigned i=1; i<=component.columns.size(); ++i)
+  {
+    const unsigned col=component.columns[i-1];
+
+    /* fence variable for e */
+    const std::string name=
+      to_string(col_to_fence(col))+"_"+i2string(col_to_var(col));
+    glp_set_col_name(ilp.lp, i, name.c_str());
+    glp_set_col_bnds(ilp.lp, i, GLP_LO, 0.0, 0.0);
+    glp_set_obj_coef(ilp.lp, i, mip_costs[col]);
+    glp_set_col_kind(ilp.lp, i, GLP_BV);
+  }
+#else
+  throw "Sorry, musketeer requires glpk; please recompile\
+    musketeer with glpk.";
+#endif
+}
+
+/*******************************************************************\
+
+Function: fence_insertert::mip_set_cst
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: sets the constraints and their coefficients
+
+\*******************************************************************/
+
+void fence_insertert::mip_set_cst(ilpt& ilp,
+  const mip_componentt& component) const
+{
+#ifdef HAVE_GLPK
+  glp_add_rows(ilp.lp, component.rows.size());
+
+  unsigned mat_size=0;
+  for(unsigned i=0; i<component.rows.size(); ++i)
+    mat_size+=mip_rows[component.rows[i]].size();
+
+  ilp.set_size(mat_size);
+
+  /* tables read from 1 in glpk -- first row/column ignored */
+  unsigned i=1;
+
+  for(unsigned row=1; row<=component.rows.size(); ++row)
+  {
+    const unsigned r=component.rows[row-1];
+
+    std::string name="C_"+i2string(r+1);
+    glp_set_row_name(ilp.lp, row, name.c_str());
+    glp_set_row_bnds(ilp.lp, row, GLP_LO, 1.0, 0.0); /* >= 1*/
+
+    for(mip_rowt::const_iterator
+      it=mip_rows[r].begin();
+      it!=mip_rows[r].end();
+      ++it, ++i)
+    {
+      /* the columns of the component are sorted */
+      const unsigned col=std::lower_bound(component.columns.begin(),
+        component.columns.end(), *it)-component.columns.begin()+1;
+      assert(col<=component.columns.size());
+
+      ilp.imat[i]=row;
+      ilp.jmat[i]=col;
+      ilp.vmat[i]=1.0;
+    }
+  }
+
+  assert(i-1==mat_size);
+#else
+  throw "Sorry, musketeer requires glpk; please recompile\
+    musketeer with glpk.";
+#endif
+}
+
+/*******************************************************************\
+
+Function: fence_insertert::mip_set_incumbent
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: starts from the fences of the previous solution, if any, and
+          covers the remaining constraints with their cheapest fences
+
+\*******************************************************************/
+
+void fence_insertert::mip_set_incumbent(ilpt& ilp,
+  const mip_componentt& component) const
+{
+#ifdef HAVE_GLPK
+  std::vector<double> &x=ilp.incumbent;
+  x.assign(component.columns.size()+1, 0.0);
+
+  for(unsigned i=1; i<=component.columns.size(); ++i)
+  {
+    const unsigned col=component.columns[i-1];
+    const edget &e=map_to_e.find(col_to_var(col))->second;
+
+    std::map<edget, fence_typet>::const_iterator it=fenced_edges.find(e);
+    if(it!=fenced_edges.end() && it->second==col_to_fence(col))
+      x[i]=1.0;
+  }
+
+  for(unsigned row=0; row<component.rows.size(); ++row)
+  {
+    const mip_rowt &r=mip_rows[component.rows[row]];
+
+    bool covered=false;
+    unsigned cheapest=0;
+
+    for(mip_rowt::const_iterator it=r.begin(); it!=r.end() && !covered; ++it)
+    {
+      const unsigned i=std::lower_bound(component.columns.begin(),
+        component.columns.end(), *it)-component.columns.begin()+1;
+
+      covered=(x[i]>=1);
+      if(cheapest==0 || mip_costs[*it]<mip_costs[component.columns[cheapest-1]])
+        cheapest=i;
+    }
+
+    if(!covered)
+      x[cheapest]=1.0;
+  }
+#else
+  throw "Sorry, musketeer requires glpk; please recompile\
+    musketeer with glpk.";
+#endif
+}
+
+/*******************************************************************\
+
+Function: fence_insertert::mip_solve
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: solves a component by branch-and-cut
+
+\*******************************************************************/
+
+void fence_insertert::mip_solve(mip_componentt& component) const
+{
 #ifdef HAVE_GLPK
+  absolute_timet start=current_time();
+
   ilpt ilp;
+  mip_set_var(ilp, component);
+  mip_set_cst(ilp, component);
 
+  /* warm start from the previous solution, if any */
+  if(!fenced_edges.empty())
+    mip_set_incumbent(ilp, component);
+
+  ilp.solve();
+
+  component.status=glp_mip_status(ilp.lp);
+  component.cost=glp_mip_obj_val(ilp.lp);
+
+  component.solution.clear();
+  for(unsigned j=1; j<=component.columns.size(); ++j)
+    if(glp_mip_col_val(ilp.lp, j)>=1)
+      component.solution.insert(component.columns[j-1]);
+
+  component.time=current_time()-start;
+#else
+  throw "Sorry, musketeer requires glpk; please recompile\
+    musketeer with glpk.";
+#endif
+}
+
+/*******************************************************************\
+
+Function: fence_insertert::solve()
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void fence_insertert::solve() {
+#ifdef HAVE_GLPK
   instrumenter.message.statistics() << "po^+ edges considered:"
     << unique << " cycles:" << instrumenter.set_of_cycles.size() 
     << messaget::eom;
 
-  /* sets the variables and coefficients */
-  //nb of po+ considered * types of fences (_e)
-  unsigned i=1;
-  mip_set_var(ilp, i);
-
-  /* sets the constraints */
-  mip_set_cst(ilp, i);
+  /* sets the variables, the constraints and their coefficients */
+  mip_set_costs();
+  mip_fill_matrix();
+  assert(mip_rows.size()==constraints_number);
 
-  instrumenter.message.debug() << "3: " << i << messaget::eom;
-  assert(i-1==constraints_number);
+  mip_decompose();
 
-  const unsigned const_constraints_number=constraints_number;
-  const unsigned const_unique=unique;
- 
-  const unsigned mat_size=const_unique*fence_options*const_constraints_number;
-  instrumenter.message.statistics() << "size of the system: " << mat_size
-    << messaget::eom;
   instrumenter.message.statistics() << "# of constraints: " 
-    << const_constraints_number << messaget::eom;
+    << constraints_number << messaget::eom;
   instrumenter.message.statistics() << "# of variables: " 
-    << const_unique*fence_options << messaget::eom;
-
-  ilp.set_size(mat_size);
+    << unique*fence_options << messaget::eom;
+  instrumenter.message.statistics() << "# of independent systems: " 
+    << mip_components.size() << messaget::eom;
 
 #ifdef DEBUG
   print_vars();
 #endif
 
-  /* fills the constraints coeff */
-  /* tables read from 1 in glpk -- first row/column ignored */
-  mip_fill_matrix(ilp, i, const_constraints_number, const_unique);
+  /* solves the MIPs by branch-and-cut */
+#ifdef CPROVER_THREAD_SAFE
+  /* Note: requires GLPK to be built with thread-local storage */
+  if(mip_components.size()>1)
+  {
+    /* the largest systems first */
+    std::vector<unsigned> schedule(mip_components.size());
+    for(unsigned k=0; k<schedule.size(); ++k)
+      schedule[k]=k;
 
-  instrumenter.message.statistics() << "i: " << i << " mat_size: " << mat_size 
-    << messaget::eom;
-  //assert(i-1==mat_size);
+    std::sort(schedule.begin(), schedule.end(),
+      [&](unsigned a, unsigned b)
+      {
+        return mip_components[a].rows.size()>mip_components[b].rows.size();
+      });
 
-#ifdef DEBUG
-  for(i=1; i<=mat_size; ++i)
-    instrumenter.message.debug() << i << "[" << ilp.imat[i] << "," 
-      << ilp.jmat[i] << "]=" << ilp.vmat[i] << messaget::eom;
-#endif
+    std::atomic<unsigned> next(0);
 
-  /* solves MIP by branch-and-cut */
-  ilp.solve();
+    unsigned number_of_threads=std::thread::hardware_concurrency();
+    if(number_of_threads==0)
+      number_of_threads=1;
+    if(number_of_threads>schedule.size())
+      number_of_threads=schedule.size();
 
-#ifdef DEBUG
-  print_vars();
+    std::vector<std::thread> threads;
+    for(unsigned t=0; t<number_of_threads; ++t)
+      threads.push_back(std::thread([&]()
+      {
+        for(unsigned n=next++; n<schedule.size(); n=next++)
+          mip_solve(mip_components[schedule[n]]);
+      }));
+
+    for(unsigned t=0; t<threads.size(); ++t)
+      threads[t].join();
+  }
+  else
 #endif
+  for(unsigned k=0; k<mip_components.size(); ++k)
+    mip_solve(mip_components[k]);
 
   /* checks optimality */
-  switch(glp_mip_status(ilp.lp)) {
+  int status=GLP_OPT;
+  double cost=0.0;
+  std::set<unsigned> solution;
+
+  for(unsigned k=0; k<mip_components.size(); ++k)
+  {
+    const mip_componentt &component=mip_components[k];
+
+    instrumenter.message.statistics() << "system #" << k << ": "
+      << component.columns.size() << " variables, "
+      << component.rows.size() << " constraints, cost "
+      << component.cost << ", " << component.time << "s"
+      << messaget::eom;
+
+    if(component.status==GLP_UNDEF || component.status==GLP_NOFEAS)
+      status=component.status;
+    else if(component.status==GLP_FEAS && status==GLP_OPT)
+      status=GLP_FEAS;
+
+    cost+=component.cost;
+    solution.insert(component.solution.begin(), component.solution.end());
+  }
+
+  switch(status) {
     case GLP_OPT:
       instrumenter.message.result() << "Optimal solution found" 
         << messaget::eom;
       break;
     case GLP_UNDEF:
-      instrumenter.message.result() << "Solution undefined" << messaget::eom;
-      assert(0);
+      throw "Solution undefined";
     case GLP_FEAS:
       instrumenter.message.result() << "Solution feasible, yet not proven \
         optimal, due to early termination" << messaget::eom;
       break;
     case GLP_NOFEAS:
-      instrumenter.message.result() 
-        << "No feasible solution, the system is UNSAT" << messaget::eom;
-      assert(0);
+      throw "No feasible solution, the system is UNSAT";
   }
 
   event_grapht& egraph=instrumenter.egraph;
 
   /* loads results (x_i) */
   instrumenter.message.statistics() << "minimal cost: " 
-    << glp_mip_obj_val(ilp.lp) << messaget::eom;
-  for(unsigned j=1; j<=const_unique*fence_options; ++j)
+    << cost << messaget::eom;
+  fenced_edges.clear();
+  for(std::set<unsigned>::const_iterator
+    it=solution.begin();
+    it!=solution.end();
+    ++it)
   {
-    if(glp_mip_col_val(ilp.lp, j)>=1)
-    {
-      /* insert that fence */
-      assert(map_to_e.find(col_to_var(j))!=map_to_e.end());
-      const edget& delay = map_to_e.find(col_to_var(j))->second;
-      instrumenter.message.statistics() << delay.first << " -> " 
-        << delay.second << " : " << to_string(col_to_fence(j)) 
-        << messaget::eom;
-      instrumenter.message.statistics() << "(between " 
-        << egraph[delay.first].source_location << " and "
-        << egraph[delay.second].source_location << messaget::eom;
-      fenced_edges.insert(std::pair<edget,fence_typet>(delay, col_to_fence(j)));
-    }
+    const unsigned j=*it;
+
+    /* insert that fence */
+    assert(map_to_e.find(col_to_var(j))!=map_to_e.end());
+    const edget& delay = map_to_e.find(col_to_var(j))->second;
+    instrumenter.message.statistics() << delay.first << " -> " 
+      << delay.second << " : " << to_string(col_to_fence(j)) 
+      << messaget::eom;
+    instrumenter.message.statistics() << "(between " 
+      << egraph[delay.first].source_location << " and "
+      << egraph[delay.second].source_location << messaget::eom;
+    fenced_edges.insert(std::pair<edget,fence_typet>(delay, col_to_fence(j)));
   }
 #else
   throw "Sorry, musketeer requires glpk; please recompile\
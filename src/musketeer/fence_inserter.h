@@ -17,6 +17,9 @@ Author: Vincent Nimal
 
 #include <set>
 #include <map>
+#include <vector>
+
+#include <util/time_stopping.h>
 
 #include "graph_visitor.h"
 #include "cycles_visitor.h"
@@ -85,11 +88,36 @@ protected:
   /* MIP invisible variables (com) */
   mip_vart invisible_var;
 
+  /* MIP constraints, all of the form sum >= 1: each row is the set of
+     the columns with coefficient 1 */
+  typedef std::set<unsigned> mip_rowt;
+  std::vector<mip_rowt> mip_rows;
+  std::vector<double> mip_costs;
+
+  /* the MIP splits into independent problems, one per connected component
+     of the columns and rows */
+  struct mip_componentt
+  {
+    std::vector<unsigned> columns;
+    std::vector<unsigned> rows;
+
+    /* results */
+    std::set<unsigned> solution;
+    int status;
+    double cost;
+    time_periodt time;
+  };
+
+  std::vector<mip_componentt> mip_components;
+
   /* MIP matrix construction */
-  void mip_set_var(ilpt& ilp, unsigned& i);
-  void mip_set_cst(ilpt& ilp, unsigned& i);
-  void mip_fill_matrix(ilpt& ilp, unsigned& i, unsigned const_constraints_number,
-    unsigned const_unique);
+  void mip_fill_matrix();
+  void mip_set_costs();
+  void mip_decompose();
+  void mip_set_var(ilpt& ilp, const mip_componentt& component) const;
+  void mip_set_cst(ilpt& ilp, const mip_componentt& component) const;
+  void mip_set_incumbent(ilpt& ilp, const mip_componentt& component) const;
+  void mip_solve(mip_componentt& component) const;
 
   /* preprocessing (necessary as glpk static) and solving */
   void preprocess();
@@ -100,6 +128,9 @@ protected:
 
   std::string to_string(fence_typet f) const;
 
+  void mip_add_columns(mip_rowt& row, const std::set<unsigned>& vars,
+    fence_typet f) const;
+
   /* for the preprocessing */
   std::set<unsigned> po;
   std::list<std::set<unsigned> > powr_constraints;
@@ -129,7 +160,8 @@ protected:
   /* debug */
   void print_vars() const;
 
-  /* storing final results */
+  /* storing final results; if compute is called again, those of the
+     previous call are the starting point of the next one */
   std::map<edget, fence_typet> fenced_edges;
 
 public:
@@ -137,7 +169,7 @@ public:
     instrumenter(instr), map_to_e(var.map_to_e), map_from_e(var.map_from_e), 
     constraints_number(0), model(TSO),  const_graph_visitor(*this), 
     unique(var.unique), fence_options(0), cycles_visitor(*this), 
-    epsilon(0.001), with_freq(false)
+    epsilon(0.001), with_freq(false), decompose(false)
   {
   }
 
@@ -145,13 +177,17 @@ public:
     instrumenter(instr), map_to_e(var.map_to_e), map_from_e(var.map_from_e),
     constraints_number(0), model(_model),  const_graph_visitor(*this),
     unique(var.unique), fence_options(0), cycles_visitor(*this), 
-    epsilon(0.001), with_freq(false)
+    epsilon(0.001), with_freq(false), decompose(false)
   {
   }
 
   /* do it */
   void compute(); 
 
+  /* solves the independent parts of the MIP separately, and in parallel
+     with CPROVER_THREAD_SAFE */
+  bool decompose;
+
   /* selection methods */
   // Note: process_selection updates the selection of cycles in instrumenter,
   // whereas filter just ignores some
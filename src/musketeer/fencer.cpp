@@ -53,7 +53,8 @@ void fence_weak_memory(
   bool print_graph,
   infer_modet mode,
   message_handlert& message_handler,
-  bool ignore_arrays)
+  bool ignore_arrays,
+  bool decompose_ilp)
 {
   messaget message(message_handler);
 
@@ -146,6 +147,7 @@ void fence_weak_memory(
     case INFER:
     {
       fence_insertert fence_inserter(instrumenter, model);
+      fence_inserter.decompose=decompose_ilp;
       fence_inserter.compute();
       fence_inserter.print_to_file_3();
       break;
@@ -153,6 +155,7 @@ void fence_weak_memory(
     case USER_DEF:
     {
       fence_user_def_insertert fence_inserter(instrumenter, model);
+      fence_inserter.decompose=decompose_ilp;
       fence_inserter.compute();
       fence_inserter.print_to_file_3();
       break;
@@ -160,6 +163,7 @@ void fence_weak_memory(
     case USER_ASSERT:
     {
       fence_assert_insertert fence_inserter(instrumenter, model);
+      fence_inserter.decompose=decompose_ilp;
       fence_inserter.compute();
       fence_inserter.print_to_file_3();
       break;
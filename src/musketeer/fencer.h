@@ -40,6 +40,7 @@ void fence_weak_memory(
   bool print_graph,
   infer_modet mode,
   message_handlert& message_handler,
-  bool ignore_arrays);
+  bool ignore_arrays,
+  bool decompose_ilp);
 
 #endif
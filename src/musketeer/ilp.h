@@ -59,11 +59,48 @@ public:
      vmat.resize(mat_size+1);
   }
 
+  /* a feasible solution (x[1..n]) from which the branch-and-cut starts,
+     if not empty */
+  std::vector<double> incumbent;
+
   void solve() {
     glp_load_matrix(lp, matrix_size, imat.to_array(), 
       jmat.to_array(), vmat.to_array());
+
+    if(!incumbent.empty())
+    {
+      /* the incumbent is given in terms of the original columns, so that
+         we cannot use the presolver, and need the LP relaxation first */
+      glp_smcp simplex_parm;
+      glp_init_smcp(&simplex_parm);
+      simplex_parm.msg_lev=GLP_MSG_OFF;
+
+      if(glp_simplex(lp, &simplex_parm)==0)
+      {
+        glp_iocp warm_parm=parm;
+        warm_parm.presolve=GLP_OFF;
+        warm_parm.cb_func=heuristic;
+        warm_parm.cb_info=this;
+        glp_intopt(lp, &warm_parm);
+        return;
+      }
+    }
+
     glp_intopt(lp, &parm);
   }
+
+protected:
+  /* hands the incumbent over once, at the first occasion */
+  static void heuristic(glp_tree *tree, void *info)
+  {
+    ilpt &ilp=*static_cast<ilpt*>(info);
+
+    if(glp_ios_reason(tree)==GLP_IHEUR && !ilp.incumbent.empty())
+    {
+      glp_ios_heur_sol(tree, &ilp.incumbent[0]);
+      ilp.incumbent.clear();
+    }
+  }
 };
 #else
 class ilpt {};
@@ -414,7 +414,8 @@ void goto_fence_inserter_parse_optionst::instrument_goto_program(
           cmdline.isset("print-graph"),
           infer_mode,
           get_message_handler(),
-          cmdline.isset("ignore-arrays"));
+          cmdline.isset("ignore-arrays"),
+          cmdline.isset("decompose-ilp"));
     }
   }  
 
@@ -494,5 +495,7 @@ void goto_fence_inserter_parse_optionst::help()
     " --max-po-trans <n>           limits the size of pos^+ in terms of pos\n"
     " --ignore-arrays              ignores cycles with multiple accesses to the\n"
     "                              same array\n"
+    " --decompose-ilp              solves the independent parts of the ILP\n"
+    "                              separately (one thread/part with threads)\n"
     "\n";
 }
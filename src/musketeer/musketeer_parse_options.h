@@ -19,6 +19,7 @@ Author:
   "(scc)(one-event-per-cycle)(verbosity):" \
   "(mm):(my-events)(unwind):" \
   "(max-var):(max-po-trans):(ignore-arrays)(remove-function-pointers)" \
+  "(decompose-ilp)" \
   "(cfg-kill)(no-dependencies)(force-loop-duplication)(no-loop-duplication)" \
   "(no-po-rendering)(render-cluster-file)(render-cluster-function)" \
   "(cav11)(version)(const-function-pointer-propagation)(print-graph)" \
@@ -354,7 +354,26 @@ void boolbvt::convert_bitvector(const exprt &expr, bvt &bv)
     bv=prop.new_variables(boolbv_width(expr.type()));
 
     // record
-    functions.record(to_function_application_expr(expr));
+    const function_application_exprt &function_application=
+      to_function_application_expr(expr);
+
+    // the lazy constraints are added after solving,
+    // looking at the values of these literals
+    if(functions.lazy_functions)
+    {
+      std::vector<bvt> arguments;
+
+      forall_expr(it, function_application.arguments())
+      {
+        arguments.push_back(convert_bv(*it));
+        set_frozen(arguments.back());
+      }
+
+      set_frozen(bv);
+      functions.record(function_application, bv, arguments);
+    }
+    else
+      functions.record(function_application);
     
     return;
   }
@@ -757,7 +776,8 @@ void boolbvt::set_to(const exprt &expr, bool value)
     throw "boolbvt::set_to got non-boolean operand";
   }
 
-  if(value)
+  // not inside a context, as this can't be retracted
+  if(value && context_literals.empty())
   {
     if(expr.id()==ID_equal)
     {
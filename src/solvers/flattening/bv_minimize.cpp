@@ -84,6 +84,7 @@ void bv_minimizet::operator()(const minimization_listt &symbols)
 
   prop_minimizet prop_minimize(boolbv);
   prop_minimize.set_message_handler(get_message_handler());
+  prop_minimize.time_limit=time_limit;
   
   for(minimization_listt::const_iterator
       l_it=symbols.begin();
@@ -23,11 +23,15 @@ class bv_minimizet:public messaget
 {
 public:
   explicit bv_minimizet(boolbvt &_boolbv):
+    time_limit(0),
     boolbv(_boolbv)
   {
   }
   
   void operator()(const minimization_listt &objectives);
+
+  // in milliseconds, zero for no limit
+  unsigned time_limit;
   
 protected:
   boolbvt &boolbv;
@@ -118,11 +118,129 @@ bv_pointerst::bv_pointerst(
   const namespacet &_ns,
   propt &_prop):
   boolbvt(_ns, _prop),
-  pointer_logic(_ns)
+  pointer_logic(_ns),
+  pointers_converted(false)
 {
-  object_bits=BV_ADDR_BITS;
-  offset_bits=config.ansi_c.pointer_width-object_bits;
   bits=config.ansi_c.pointer_width;
+  set_object_bits(BV_ADDR_BITS);
+}
+
+/*******************************************************************\
+
+Function: bv_pointerst::set_object_bits
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void bv_pointerst::set_object_bits(unsigned _object_bits)
+{
+  if(_object_bits>=bits)
+    throw "too many addressed objects for the pointer width";
+
+  object_bits=_object_bits;
+  offset_bits=bits-object_bits;
+}
+
+/*******************************************************************\
+
+Function: bv_pointerst::add_objects
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void bv_pointerst::add_objects(const exprt &expr)
+{
+  // symex shares sub-expressions, visit each once
+  if(!objects_visited.insert(&expr.read()).second)
+    return;
+
+  if(expr.id()==ID_address_of &&
+     expr.operands().size()==1)
+    add_objects_rec(expr.op0());
+
+  forall_operands(it, expr)
+    add_objects(*it);
+}
+
+/*******************************************************************\
+
+Function: bv_pointerst::fit_object_bits
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: sizes the object part of the encoding to the objects
+          numbered by add_objects
+
+\*******************************************************************/
+
+void bv_pointerst::fit_object_bits()
+{
+  objects_visited.clear();
+
+  // the pointers converted so far use the current width
+  if(pointers_converted)
+    return;
+
+  // Leave room for as many objects again as have been found.
+  // add_objects has seen every object the conversion will add;
+  // should one be missed, add_addr reports it once it no longer
+  // fits. Null and invalid are among the objects already.
+  mp_integer needed=address_bits(pointer_logic.objects.size())+1;
+
+  // the offset needs a bit at least
+  if(needed>=bits)
+    needed=bits-1;
+
+  set_object_bits(integer2unsigned(needed));
+}
+
+/*******************************************************************\
+
+Function: bv_pointerst::add_objects_rec
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: follows convert_address_of_rec
+
+\*******************************************************************/
+
+void bv_pointerst::add_objects_rec(const exprt &object)
+{
+  if(object.id()==ID_symbol ||
+     object.id()==ID_label ||
+     object.id()==ID_constant ||
+     object.id()==ID_string_constant ||
+     object.id()==ID_array)
+    pointer_logic.add_object(object);
+  else if(object.id()==ID_index &&
+          object.operands().size()==2)
+  {
+    if(ns.follow(object.op0().type()).id()!=ID_pointer)
+      add_objects_rec(object.op0());
+  }
+  else if(object.id()==ID_member &&
+          object.operands().size()==1)
+    add_objects_rec(object.op0());
+  else if(object.id()==ID_if &&
+          object.operands().size()==3)
+  {
+    add_objects_rec(object.op1());
+    add_objects_rec(object.op2());
+  }
 }
 
 /*******************************************************************\
@@ -265,6 +383,8 @@ void bv_pointerst::convert_pointer_type(const exprt &expr, bvt &bv)
   if(!is_ptr(expr.type()))
     throw "convert_pointer_type got non-pointer type";
 
+  pointers_converted=true;
+
   bv.resize(bits);
 
   if(expr.id()==ID_symbol)
@@ -655,6 +775,8 @@ Function: bv_pointerst::encode
 
 void bv_pointerst::encode(unsigned addr, bvt &bv)
 {
+  pointers_converted=true;
+
   bv.resize(bits);
 
   // set offset to zero
@@ -663,7 +785,8 @@ void bv_pointerst::encode(unsigned addr, bvt &bv)
 
   // set variable part
   for(std::size_t i=0; i<object_bits; i++)
-    bv[offset_bits+i]=const_literal((addr&(1<<i))!=0);
+    bv[offset_bits+i]=
+      const_literal(i<sizeof(addr)*8 && ((addr>>i)&1)!=0);
 }
 
 /*******************************************************************\
@@ -772,8 +895,9 @@ void bv_pointerst::add_addr(const exprt &expr, bvt &bv)
 {
   unsigned a=pointer_logic.add_object(expr);
 
-  if(a==(unsigned(1)>>object_bits))
-    throw "too many variables";
+  if(object_bits<sizeof(unsigned)*8 &&
+     a>=(unsigned(1)<<object_bits))
+    throw "too many addressed objects";
 
   encode(a, bv);
 }
@@ -793,6 +917,28 @@ Function: bv_pointerst::do_postponed
 void bv_pointerst::do_postponed(
   const postponedt &postponed)
 {
+  // only compare object part
+  bvt saved_bv=postponed.op;
+  saved_bv.erase(saved_bv.begin(), saved_bv.begin()+offset_bits);
+
+  // A constant object part, e.g., from taking the address
+  // of a variable, leaves only one object to consider.
+  bool constant_object=true;
+  std::size_t constant_number=0;
+
+  for(std::size_t i=0; i<saved_bv.size(); i++)
+  {
+    if(!saved_bv[i].is_constant())
+      constant_object=false;
+    else if(saved_bv[i].is_true())
+    {
+      if(i<sizeof(std::size_t)*8)
+        constant_number|=std::size_t(1)<<i;
+      else
+        constant_object=false;
+    }
+  }
+
   if(postponed.expr.id()==ID_dynamic_object)
   {
     const pointer_logict::objectst &objects=
@@ -805,19 +951,18 @@ void bv_pointerst::do_postponed(
         it!=objects.end();
         it++, number++)
     {
+      if(constant_object && number!=constant_number)
+        continue;
+
       const exprt &expr=*it;
       
       bool is_dynamic=pointer_logic.is_dynamic_object(expr);
       
-      // only compare object part
       bvt bv;
       encode(number, bv);
       
       bv.erase(bv.begin(), bv.begin()+offset_bits);
 
-      bvt saved_bv=postponed.op;
-      saved_bv.erase(saved_bv.begin(), saved_bv.begin()+offset_bits);
-      
       assert(bv.size()==saved_bv.size());
       assert(postponed.bv.size()==1);
       
@@ -841,6 +986,9 @@ void bv_pointerst::do_postponed(
         it!=objects.end();
         it++, number++)
     {
+      if(constant_object && number!=constant_number)
+        continue;
+
       const exprt &expr=*it;
       
       mp_integer object_size;
@@ -861,15 +1009,11 @@ void bv_pointerst::do_postponed(
       else
         continue;
       
-      // only compare object part
       bvt bv;
       encode(number, bv);
       
       bv.erase(bv.begin(), bv.begin()+offset_bits);
 
-      bvt saved_bv=postponed.op;
-      saved_bv.erase(saved_bv.begin(), saved_bv.begin()+offset_bits);
-      
       assert(bv.size()==saved_bv.size());
       assert(postponed.bv.size()>=1);
       
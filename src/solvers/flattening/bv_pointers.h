@@ -21,6 +21,14 @@ public:
 
   virtual void post_process();
 
+  // Numbers the objects whose address is taken in the given
+  // expression. Once all expressions have been added,
+  // fit_object_bits() sizes the object part of the encoding.
+  // Both need to be done before any pointer is converted,
+  // the width is kept otherwise.
+  void add_objects(const exprt &expr);
+  void fit_object_bits();
+
 protected:
   pointer_logict pointer_logic;
 
@@ -48,6 +56,11 @@ protected:
   bool convert_address_of_rec(
     const exprt &expr,
     bvt &bv);
+
+  hash_set_cont<const irept::dt *> objects_visited;
+  bool pointers_converted;
+  void add_objects_rec(const exprt &object);
+  void set_object_bits(unsigned _object_bits);
     
   void offset_arithmetic(bvt &bv, const mp_integer &x);
   void offset_arithmetic(bvt &bv, const mp_integer &factor, const exprt &index);
@@ -12,6 +12,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iostream>
 #endif
 
+#include <cassert>
+
+#include <util/union_find.h>
+
 #include "equality.h"
 #include "bv_utils.h"
 
@@ -102,7 +106,10 @@ literalt equalityt::equality2(const exprt &e1, const exprt &e2)
     if(result==equalities.end())
     {
       l=prop.new_variable();
-      if(freeze_all && !l.is_constant()) prop.set_frozen(l);
+
+      // the lazy constraints are added after solving
+      if((freeze_all || lazy_equalities) && !l.is_constant())
+        prop.set_frozen(l);
       equalities.insert(equalitiest::value_type(u, l));
     }
     else
@@ -187,3 +194,120 @@ void equalityt::add_equality_constraints(const typestructt &typestruct)
   }
 }
 
+
+/*******************************************************************\
+
+Function: equalityt::check_equalities
+
+  Inputs:
+
+ Outputs: true if a constraint was added
+
+ Purpose: add the equality constraints violated by the
+          current satisfying assignment
+
+\*******************************************************************/
+
+bool equalityt::check_equalities()
+{
+  bool progress=false;
+
+  for(typemapt::const_iterator it=typemap.begin();
+      it!=typemap.end(); it++)
+    if(check_equalities(it->second))
+      progress=true;
+
+  return progress;
+}
+
+/*******************************************************************\
+
+Function: equalityt::check_equalities
+
+  Inputs:
+
+ Outputs: true if a constraint was added
+
+ Purpose: merge the elements that are equal in the assignment;
+          an equality that is false within a class contradicts
+          the chain of true equalities that connects its elements
+
+\*******************************************************************/
+
+bool equalityt::check_equalities(const typestructt &typestruct)
+{
+  std::size_t no_elements=typestruct.elements.size();
+
+  unsigned_union_find classes;
+  classes.resize(no_elements);
+
+  // the graph of the true equalities, to explain the classes
+  typedef std::vector<std::pair<unsigned, literalt> > edgest;
+  std::vector<edgest> edges(no_elements);
+
+  for(equalitiest::const_iterator
+      it=typestruct.equalities.begin();
+      it!=typestruct.equalities.end();
+      it++)
+  {
+    if(prop.l_get(it->second).is_true())
+    {
+      unsigned a=it->first.first, b=it->first.second;
+      classes.make_union(a, b);
+      edges[a].push_back(std::make_pair(b, it->second));
+      edges[b].push_back(std::make_pair(a, it->second));
+    }
+  }
+
+  bool progress=false;
+
+  for(equalitiest::const_iterator
+      it=typestruct.equalities.begin();
+      it!=typestruct.equalities.end();
+      it++)
+  {
+    unsigned a=it->first.first, b=it->first.second;
+
+    if(!prop.l_get(it->second).is_false() ||
+       !classes.same_set(a, b))
+      continue;
+
+    // breadth-first search for a shortest path from a to b
+    std::vector<std::pair<unsigned, literalt> > pred(
+      no_elements, std::make_pair(no_elements, const_literal(false)));
+    std::vector<unsigned> queue(1, a);
+    pred[a].first=a;
+
+    for(std::size_t i=0; i<queue.size() && pred[b].first==no_elements; i++)
+    {
+      const edgest &e=edges[queue[i]];
+
+      for(edgest::const_iterator e_it=e.begin(); e_it!=e.end(); e_it++)
+        if(pred[e_it->first].first==no_elements)
+        {
+          pred[e_it->first]=std::make_pair(queue[i], e_it->second);
+          queue.push_back(e_it->first);
+        }
+    }
+
+    assert(pred[b].first!=no_elements);
+
+    // the equalities on the path imply a=b
+    bvt clause;
+    clause.push_back(it->second);
+
+    for(unsigned n=b; n!=a; n=pred[n].first)
+      clause.push_back(!pred[n].second);
+
+    #ifdef DEBUG
+    std::cout << "TRANSITIVITY " << clause.size()-1 << " equalities => "
+              << typestruct.elements_rev.find(a)->second << "="
+              << typestruct.elements_rev.find(b)->second << std::endl;
+    #endif
+
+    prop.lcnf(clause);
+    progress=true;
+  }
+
+  return progress;
+}
@@ -21,17 +21,33 @@ class equalityt:public prop_conv_solvert
 public:
   equalityt(
     const namespacet &_ns,
-    propt &_prop):prop_conv_solvert(_ns, _prop) { }
+    propt &_prop):
+    prop_conv_solvert(_ns, _prop),
+    lazy_equalities(false)
+  {
+  }
 
   virtual literalt equality(const exprt &e1, const exprt &e2);
   
   virtual void post_process()
   {
-    add_equality_constraints();
-    prop_conv_solvert::post_process();
-    typemap.clear(); // if called incrementally, don't do it twice
+    if(lazy_equalities)
+      prop_conv_solvert::post_process();
+    else
+    {
+      add_equality_constraints();
+      prop_conv_solvert::post_process();
+      typemap.clear(); // if called incrementally, don't do it twice
+    }
   }
 
+  // Instead of encoding the equalities up front, check the
+  // satisfying assignment using congruence closure, and add
+  // the transitivity constraints that are violated.
+  // Returns true if any constraint was added.
+  bool lazy_equalities;
+  bool check_equalities();
+
 protected:
   typedef hash_map_cont<const exprt, unsigned, irep_hash> elementst;
   typedef std::map<std::pair<unsigned, unsigned>, literalt> equalitiest;
@@ -51,6 +67,7 @@ protected:
   virtual literalt equality2(const exprt &e1, const exprt &e2);
   virtual void add_equality_constraints();
   virtual void add_equality_constraints(const typestructt &typestruct);
+  bool check_equalities(const typestructt &typestruct);
 };
 
 #endif
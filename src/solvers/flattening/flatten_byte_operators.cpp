@@ -11,11 +11,137 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/std_expr.h>
 #include <util/arith_tools.h>
 #include <util/pointer_offset_size.h>
+#include <util/base_type.h>
+#include <util/hash_cont.h>
 
 #include "flatten_byte_operators.h"
 
 /*******************************************************************\
 
+Function: offset_plus
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: offset+i, folded if the offset is constant
+
+\*******************************************************************/
+
+static exprt offset_plus(const exprt &offset, const mp_integer &i)
+{
+  mp_integer offset_int;
+
+  if(!to_integer(offset, offset_int))
+    return from_integer(offset_int+i, offset.type());
+
+  return plus_exprt(from_integer(i, offset.type()), offset);
+}
+
+/*******************************************************************\
+
+Function: flatten_byte_extract_constant
+
+  Inputs:
+
+ Outputs: nil if there is no fast path
+
+ Purpose: maps a byte extraction with constant offset onto
+          index, member or extractbits, if possible
+
+\*******************************************************************/
+
+static exprt flatten_byte_extract_constant(
+  const exprt &src,
+  const mp_integer &offset,
+  const namespacet &ns)
+{
+  const exprt &root=src.op0();
+  const typet &root_type=ns.follow(root.type());
+  const typet &offset_type=ns.follow(src.op1().type());
+
+  mp_integer width_bits=pointer_offset_bits(src.type(), ns);
+  if(width_bits<=0)
+    return nil_exprt();
+
+  // the full object?
+  if(offset==0 && base_type_eq(src.type(), root.type(), ns))
+    return root;
+
+  if(root_type.id()==ID_array)
+  {
+    const typet &subtype=root_type.subtype();
+    mp_integer element_bits=pointer_offset_bits(subtype, ns);
+
+    // an aligned element?
+    if(element_bits==width_bits &&
+       element_bits%8==0 &&
+       (offset*8)%element_bits==0 &&
+       base_type_eq(src.type(), subtype, ns))
+      return index_exprt(
+        root,
+        from_integer(offset*8/element_bits, offset_type),
+        subtype);
+
+    return nil_exprt();
+  }
+  else if(root_type.id()==ID_struct)
+  {
+    const struct_typet::componentst &components=
+      to_struct_type(root_type).components();
+
+    mp_integer m_offset_bits=0;
+
+    for(struct_typet::componentst::const_iterator
+        it=components.begin();
+        it!=components.end();
+        it++)
+    {
+      mp_integer m_size=pointer_offset_bits(it->type(), ns);
+      if(m_size<=0)
+        break;
+
+      if(offset*8==m_offset_bits &&
+         width_bits==m_size &&
+         base_type_eq(src.type(), it->type(), ns))
+        return member_exprt(root, it->get_name(), it->type());
+
+      m_offset_bits+=m_size;
+    }
+  }
+  else if(root_type.id()==ID_union && offset==0)
+  {
+    const union_typet::componentst &components=
+      to_union_type(root_type).components();
+
+    for(union_typet::componentst::const_iterator
+        it=components.begin();
+        it!=components.end();
+        it++)
+      if(base_type_eq(src.type(), it->type(), ns))
+        return member_exprt(root, it->get_name(), it->type());
+  }
+
+  // extract the bits, if they are all there
+  mp_integer root_bits=pointer_offset_bits(root.type(), ns);
+
+  if(root_bits<0 || offset*8+width_bits>root_bits)
+    return nil_exprt();
+
+  typecast_exprt root_tc(root, bv_typet(integer2unsigned(root_bits)));
+
+  extractbits_exprt extractbits;
+
+  extractbits.src()=root_tc;
+  extractbits.type()=src.type();
+  extractbits.upper()=from_integer(offset*8+width_bits-1, offset_type);
+  extractbits.lower()=from_integer(offset*8, offset_type);
+
+  return extractbits;
+}
+
+/*******************************************************************\
+
 Function: flatten_byte_extract
 
   Inputs:
@@ -53,6 +179,17 @@ exprt flatten_byte_extract(
   std::size_t width_bits=integer2unsigned(size_bits);
 
   std::size_t width_bytes=width_bits/8+(width_bits%8==0?0:1);
+
+  // fast paths for constant offsets
+  mp_integer offset_int;
+  bool constant_offset=!to_integer(src.op1(), offset_int) && offset_int>=0;
+
+  if(constant_offset)
+  {
+    exprt result=flatten_byte_extract_constant(src, offset_int, ns);
+    if(result.is_not_nil())
+      return result;
+  }
   
   const typet &t=src.op0().type();
   
@@ -76,10 +213,9 @@ exprt flatten_byte_extract(
         std::size_t offset_i=
           little_endian?(width_bytes-i-1):i;
         
-        plus_exprt offset(from_integer(offset_i, src.op1().type()), src.op1());
         index_exprt index_expr(subtype);
         index_expr.array()=src.op0();
-        index_expr.index()=offset;
+        index_expr.index()=offset_plus(src.op1(), offset_i);
         op[i]=index_expr;
       }
       
@@ -107,6 +243,28 @@ exprt flatten_byte_extract(
       mp_integer result_width=pointer_offset_size(src.type(), ns);
       mp_integer num_elements=(element_width+result_width-2)/element_width+1;
 
+      // with a constant offset, we know the elements
+      if(constant_offset)
+      {
+        mp_integer first=offset_int/element_width;
+        mp_integer new_offset=offset_int%element_width;
+
+        num_elements=(new_offset+result_width+element_width-1)/element_width;
+
+        concatenation_exprt concat(
+          unsignedbv_typet(integer2unsigned(element_width*8*num_elements)));
+
+        for(mp_integer i=num_elements; i>0; --i)
+          concat.copy_to_operands(
+            index_exprt(root, from_integer(first+i-1, offset_type)));
+
+        exprt tmp(src.id(), src.type());
+        tmp.copy_to_operands(concat, from_integer(new_offset, offset_type));
+
+        // a scalar now, with a constant offset
+        return flatten_byte_extract(tmp, ns);
+      }
+
       // compute new root and offset
       concatenation_exprt concat(
         unsignedbv_typet(integer2unsigned(element_width*8*num_elements)));
@@ -167,6 +325,116 @@ exprt flatten_byte_extract(
 
 /*******************************************************************\
 
+Function: flatten_byte_update_constant
+
+  Inputs:
+
+ Outputs: nil if there is no fast path
+
+ Purpose: maps a byte update with constant offset onto
+          with or concatenation, if possible
+
+\*******************************************************************/
+
+static exprt flatten_byte_update_constant(
+  const exprt &src,
+  const mp_integer &offset,
+  const mp_integer &element_size,
+  const namespacet &ns)
+{
+  const exprt &root=src.op0();
+  const exprt &value=src.op2();
+  const typet &t=ns.follow(root.type());
+  const typet &offset_type=ns.follow(src.op1().type());
+
+  if(t.id()==ID_array)
+  {
+    const typet &subtype=t.subtype();
+    mp_integer sub_size=pointer_offset_size(subtype, ns);
+
+    // an aligned element?
+    if(sub_size==element_size &&
+       offset%sub_size==0 &&
+       base_type_eq(value.type(), subtype, ns))
+      return with_exprt(
+        root, from_integer(offset/sub_size, offset_type), value);
+  }
+  else if(t.id()==ID_struct)
+  {
+    const struct_typet::componentst &components=
+      to_struct_type(t).components();
+
+    mp_integer m_offset_bits=0;
+
+    for(struct_typet::componentst::const_iterator
+        it=components.begin();
+        it!=components.end();
+        it++)
+    {
+      mp_integer m_size=pointer_offset_bits(it->type(), ns);
+      if(m_size<=0)
+        break;
+
+      if(offset*8==m_offset_bits &&
+         element_size*8==m_size &&
+         base_type_eq(value.type(), it->type(), ns))
+      {
+        exprt member_name(ID_member_name);
+        member_name.set(ID_component_name, it->get_name());
+        return with_exprt(root, member_name, value);
+      }
+
+      m_offset_bits+=m_size;
+    }
+  }
+  else if(t.id()==ID_signedbv ||
+          t.id()==ID_unsignedbv ||
+          t.id()==ID_floatbv)
+  {
+    // keep the bits below and above the value
+    std::size_t width=to_bitvector_type(t).get_width();
+    mp_integer lower=offset*8, upper=(offset+element_size)*8;
+
+    if(upper>width ||
+       pointer_offset_bits(value.type(), ns)!=element_size*8)
+      return nil_exprt();
+
+    // the whole of it
+    if(lower==0 && upper==width)
+      return base_type_eq(value.type(), t, ns)?value:nil_exprt();
+
+    concatenation_exprt concatenation(t);
+
+    if(upper<width)
+    {
+      extractbits_exprt extractbits;
+      extractbits.src()=root;
+      extractbits.type()=unsignedbv_typet(width-integer2unsigned(upper));
+      extractbits.upper()=from_integer(width-1, offset_type);
+      extractbits.lower()=from_integer(upper, offset_type);
+      concatenation.move_to_operands(extractbits);
+    }
+
+    concatenation.copy_to_operands(value);
+
+    if(lower>0)
+    {
+      extractbits_exprt extractbits;
+      extractbits.src()=root;
+      extractbits.type()=unsignedbv_typet(integer2unsigned(lower));
+      extractbits.upper()=from_integer(lower-1, offset_type);
+      extractbits.lower()=from_integer(0, offset_type);
+      concatenation.move_to_operands(extractbits);
+    }
+
+    return concatenation;
+  }
+
+  return nil_exprt();
+}
+
+/*******************************************************************\
+
 Function: flatten_byte_update
 
   Inputs:
@@ -189,7 +457,19 @@ exprt flatten_byte_update(
     pointer_offset_size(src.op2().type(), ns);
   
   const typet &t=ns.follow(src.op0().type());
+
+  // fast paths for constant offsets
+  mp_integer offset_int;
+  bool constant_offset=!to_integer(src.op1(), offset_int) && offset_int>=0;
   
+  if(constant_offset && element_size>0)
+  {
+    exprt result=
+      flatten_byte_update_constant(src, offset_int, element_size, ns);
+    if(result.is_not_nil())
+      return result;
+  }
+
   if(t.id()==ID_array)
   {
     const array_typet &array_type=to_array_type(t);
@@ -235,7 +515,7 @@ exprt flatten_byte_update(
             new_value=flatten_byte_extract(byte_extract_expr, ns);
           }
 
-          exprt where=plus_exprt(src.op1(), i_expr);
+          exprt where=offset_plus(src.op1(), i);
             
           with_exprt with_expr;
           with_expr.type()=src.type();
@@ -252,8 +532,20 @@ exprt flatten_byte_update(
       {
         if(element_size==1) // byte-granularity update
         {
-          div_exprt div_offset(src.op1(), from_integer(sub_size, src.op1().type()));
-          mod_exprt mod_offset(src.op1(), from_integer(sub_size, src.op1().type()));
+          exprt div_offset, mod_offset;
+
+          if(constant_offset)
+          {
+            div_offset=from_integer(offset_int/sub_size, src.op1().type());
+            mod_offset=from_integer(offset_int%sub_size, src.op1().type());
+          }
+          else
+          {
+            div_offset=
+              div_exprt(src.op1(), from_integer(sub_size, src.op1().type()));
+            mod_offset=
+              mod_exprt(src.op1(), from_integer(sub_size, src.op1().type()));
+          }
         
           index_exprt index_expr(src.op0(), div_offset, array_type.subtype());
           
@@ -288,24 +580,38 @@ exprt flatten_byte_update(
     if(element_size*8>width)
       throw "flatten_byte_update to update element that is too large";
     
-    // build mask
-    exprt mask=
-      bitnot_exprt(
-        from_integer(power(2, element_size*8)-1, unsignedbv_typet(width)));
-      
     const typet &offset_type=ns.follow(src.op1().type());
     mult_exprt offset_times_eight(src.op1(), from_integer(8, offset_type));
     
-    // shift the mask
-    shl_exprt shl_expr(mask, offset_times_eight);
+    // build mask, shifted to the bytes to be updated
+    shl_exprt shl_expr(
+      from_integer(power(2, element_size*8)-1, unsignedbv_typet(width)),
+      offset_times_eight);
+
+    bitnot_exprt mask(shl_expr);
 
     // do the 'AND'
     bitand_exprt bitand_expr(src.op0(), mask);
 
-    // zero-extend the value
-    concatenation_exprt value_extended(
-      from_integer(0, unsignedbv_typet(width-integer2unsigned(element_size)*8)), 
-      src.op2(), t);
+    // zero-extend the value, unless it has the full width
+    exprt value_extended;
+
+    if(element_size*8<width)
+      value_extended=concatenation_exprt(
+        from_integer(0, unsignedbv_typet(width-integer2unsigned(element_size)*8)), 
+        src.op2(), t);
+    else if(base_type_eq(src.op2().type(), t, ns))
+      value_extended=src.op2();
+    else
+    {
+      // the bits of the value, as the type of the target
+      extractbits_exprt extractbits;
+      extractbits.src()=src.op2();
+      extractbits.type()=t;
+      extractbits.upper()=from_integer(width-1, offset_type);
+      extractbits.lower()=from_integer(0, offset_type);
+      value_extended=extractbits;
+    }
     
     // shift the value
     shl_exprt value_shifted(value_extended, offset_times_eight);
@@ -349,7 +655,7 @@ bool has_byte_operator(const exprt &src)
 
 /*******************************************************************\
 
-Function: flatten_byte_operators
+Function: flatten_byte_operators_rec
 
   Inputs:
 
@@ -359,23 +665,68 @@ Function: flatten_byte_operators
 
 \*******************************************************************/
 
-exprt flatten_byte_operators(const exprt &src, const namespacet &ns)
+// Keyed by the identity of the irep, i.e., by what is shared in
+// memory, as hashing the expressions would walk the whole tree.
+typedef hash_map_cont<const irept::dt *, exprt> flatten_cachet;
+
+static exprt flatten_byte_operators_rec(
+  const exprt &src,
+  const namespacet &ns,
+  flatten_cachet &cache)
 {
+  if(!src.has_operands())
+    return src;
+
+  // shared sub-expressions are flattened once
+  flatten_cachet::const_iterator c_it=cache.find(&src.read());
+  if(c_it!=cache.end())
+    return c_it->second;
+
+  // only touch the operands that change, to preserve sharing;
+  // the ones without byte operators come back as they are
   exprt tmp=src;
-  
-  // destroys any sharing, should use hash table
-  Forall_operands(it, tmp)
+
+  for(std::size_t i=0; i<src.operands().size(); i++)
   {
-    exprt tmp=flatten_byte_operators(*it, ns);
-    it->swap(tmp);
+    const exprt &src_op=src.operands()[i];
+    exprt op=flatten_byte_operators_rec(src_op, ns, cache);
+
+    if(&op.read()!=&src_op.read())
+      tmp.operands()[i].swap(op);
   }
 
+  exprt result;
+
   if(src.id()==ID_byte_update_little_endian ||
      src.id()==ID_byte_update_big_endian)
-    return flatten_byte_update(tmp, ns);
+    result=flatten_byte_update(tmp, ns);
   else if(src.id()==ID_byte_extract_little_endian ||
           src.id()==ID_byte_extract_big_endian)
-    return flatten_byte_extract(tmp, ns);
+    result=flatten_byte_extract(tmp, ns);
   else
-    return tmp;
+    result.swap(tmp);
+
+  // Sub-expressions without byte operators are remembered as well,
+  // as they may be shared many times; the entry shares the irep.
+  cache.insert(std::make_pair(&src.read(), result));
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: flatten_byte_operators
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+exprt flatten_byte_operators(const exprt &src, const namespacet &ns)
+{
+  flatten_cachet cache;
+  return flatten_byte_operators_rec(src, ns, cache);
 }
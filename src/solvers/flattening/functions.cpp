@@ -36,6 +36,33 @@ void functionst::record(
 
 /*******************************************************************\
 
+Function: functionst::record
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void functionst::record(
+  const function_application_exprt &function_application,
+  const bvt &result,
+  const std::vector<bvt> &arguments)
+{
+  record(function_application);
+
+  application_literalst &literals=
+    function_map[function_application.function()].
+      literals[function_application];
+
+  literals.result=result;
+  literals.arguments=arguments;
+}
+
+/*******************************************************************\
+
 Function: functionst::add_function_constraints
 
   Inputs:
@@ -130,3 +157,126 @@ void functionst::add_function_constraints(const function_infot &info)
     }
   }
 }
+
+/*******************************************************************\
+
+Function: functionst::check_function_constraints
+
+  Inputs:
+
+ Outputs: true if a constraint was added
+
+ Purpose: add the functional-consistency constraints violated
+          by the current satisfying assignment
+
+\*******************************************************************/
+
+bool functionst::check_function_constraints()
+{
+  bool progress=false;
+
+  for(function_mapt::iterator it=
+      function_map.begin();
+      it!=function_map.end();
+      it++)
+    if(check_function_constraints(it->second))
+      progress=true;
+
+  return progress;
+}
+
+/*******************************************************************\
+
+Function: functionst::check_function_constraints
+
+  Inputs:
+
+ Outputs: true if a constraint was added
+
+ Purpose: applications with equal argument values form a class;
+          each one must agree with the first one of its class
+
+\*******************************************************************/
+
+bool functionst::check_function_constraints(function_infot &info)
+{
+  if(info.all_constraints_added)
+    return false;
+
+  // the values of the argument bits, and the first
+  // application with these values
+  typedef std::map<std::vector<bool>,
+                   application_literal_mapt::const_iterator> classest;
+  classest classes;
+  bool progress=false;
+
+  for(application_literal_mapt::const_iterator
+      it=info.literals.begin();
+      it!=info.literals.end();
+      it++)
+  {
+    const exprt::operandst &arguments=it->first.arguments();
+    const std::vector<bvt> &argument_literals=it->second.arguments;
+    assert(arguments.size()==argument_literals.size());
+
+    std::vector<bool> values;
+
+    for(std::size_t i=0; i<arguments.size(); i++)
+    {
+      const bvt &bv=argument_literals[i];
+
+      // the bits are compared with those of other applications,
+      // which needs arguments of the same type that have bits
+      bool known=!bv.empty() &&
+        (info.literals.begin()==it ||
+         arguments[i].type()==
+           info.literals.begin()->first.arguments()[i].type());
+
+      for(bvt::const_iterator b_it=bv.begin();
+          known && b_it!=bv.end();
+          b_it++)
+      {
+        tvt value=prop_conv.l_get(*b_it);
+        known=value.is_known();
+        values.push_back(value.is_true());
+      }
+
+      if(!known)
+      {
+        // we can't tell, fall back to Ackermann's reduction
+        add_function_constraints(info);
+        info.all_constraints_added=true;
+        return true;
+      }
+    }
+
+    std::pair<classest::iterator, bool> entry=
+      classes.insert(std::make_pair(values, it));
+
+    if(entry.second)
+      continue;
+
+    const function_application_exprt &first=entry.first->second->first;
+    const bvt &first_result=entry.first->second->second.result;
+    const bvt &result=it->second.result;
+    assert(first_result.size()==result.size());
+
+    bool equal=true;
+
+    for(std::size_t i=0; equal && i<result.size(); i++)
+      equal=prop_conv.l_get(result[i])==prop_conv.l_get(first_result[i]);
+
+    if(equal)
+      continue;
+
+    exprt arguments_equal_expr=
+      arguments_equal(arguments, first.arguments());
+    implies_exprt implication(arguments_equal_expr,
+                              equal_exprt(it->first, first));
+
+    prop_conv.set_to_true(implication);
+    progress=true;
+  }
+
+  return progress;
+}
@@ -9,7 +9,9 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_FUNCTIONS_H
 #define CPROVER_FUNCTIONS_H
 
+#include <map>
 #include <set>
+#include <vector>
 
 #include <util/std_expr.h>
 
@@ -19,7 +21,10 @@ class functionst
 {
 public:
   explicit functionst(prop_convt &_prop_conv):
-    prop_conv(_prop_conv) { }
+    lazy_functions(false),
+    prop_conv(_prop_conv)
+  {
+  }
     
   virtual ~functionst()
   {
@@ -28,19 +33,45 @@ public:
   void record(
     const function_application_exprt &function_application);
 
+  // with lazy_functions, the literals of the result and of the
+  // arguments, which need to be frozen
+  void record(
+    const function_application_exprt &function_application,
+    const bvt &result,
+    const std::vector<bvt> &arguments);
+
   virtual void post_process()
   {
-    add_function_constraints();
+    if(!lazy_functions)
+      add_function_constraints();
   }
+
+  // Instead of Ackermann's reduction, check the satisfying
+  // assignment for congruence, and add the constraints that
+  // are violated. Returns true if any constraint was added.
+  bool lazy_functions;
+  bool check_function_constraints();
   
 protected:
   prop_convt &prop_conv;
 
   typedef std::set<function_application_exprt> applicationst;
   
+  struct application_literalst
+  {
+    bvt result;
+    std::vector<bvt> arguments;
+  };
+
+  typedef std::map<function_application_exprt, application_literalst>
+    application_literal_mapt;
+
   struct function_infot
   {
     applicationst applications;
+    application_literal_mapt literals;
+    bool all_constraints_added;
+    function_infot():all_constraints_added(false) { }
   };
   
   typedef std::map<exprt, function_infot> function_mapt;
@@ -48,6 +79,7 @@ protected:
   
   virtual void add_function_constraints();
   virtual void add_function_constraints(const function_infot &info);
+  bool check_function_constraints(function_infot &info);
 
   exprt arguments_equal(const exprt::operandst &o1,
                         const exprt::operandst &o2);
@@ -115,3 +115,86 @@ bvt float_approximationt::overapproximating_left_shift(
 
   return result;
 }
+
+/*******************************************************************\
+
+Function: float_approximationt::truncate_fraction
+
+  Inputs: a packed floating-point number
+
+ Outputs: the same number with all but the fraction_bits most
+          significant bits of the fraction set to zero
+
+ Purpose:
+
+\*******************************************************************/
+
+bvt float_approximationt::truncate_fraction(const bvt &src)
+{
+  assert(src.size()==spec.width());
+
+  if(fraction_bits==0 || fraction_bits>=spec.f)
+    return src;
+
+  bvt result=src;
+
+  for(unsigned i=0; i<spec.f-fraction_bits; i++)
+    result[i]=const_literal(false);
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: float_approximationt::add_sub
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bvt float_approximationt::add_sub(
+  const bvt &src1,
+  const bvt &src2,
+  bool subtract)
+{
+  return SUB::add_sub(
+    truncate_fraction(src1), truncate_fraction(src2), subtract);
+}
+
+/*******************************************************************\
+
+Function: float_approximationt::mul
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bvt float_approximationt::mul(const bvt &src1, const bvt &src2)
+{
+  return SUB::mul(truncate_fraction(src1), truncate_fraction(src2));
+}
+
+/*******************************************************************\
+
+Function: float_approximationt::div
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bvt float_approximationt::div(const bvt &src1, const bvt &src2)
+{
+  return SUB::div(truncate_fraction(src1), truncate_fraction(src2));
+}
@@ -9,7 +9,7 @@ Author:
 #ifndef CPROVER_FLOAT_APPROXIMATION_H
 #define CPROVER_FLOAT_APPROXIMATION_H
 
-#include <floatbv/float_utils.h>
+#include "float_utils.h"
 
 class float_approximationt:public float_utilst
 {
@@ -17,7 +17,8 @@ public:
   float_approximationt(propt &_prop):
     float_utilst(_prop),
     over_approximate(false),
-    partial_interpretation(false)
+    partial_interpretation(false),
+    fraction_bits(0)
   {
   }
 
@@ -26,9 +27,19 @@ public:
   bool over_approximate;
   bool partial_interpretation;
 
+  // if non-zero, the arithmetic operations only look at the
+  // fraction_bits most significant bits of the fraction of their
+  // operands, and take the remaining bits to be zero
+  unsigned fraction_bits;
+
+  virtual bvt add_sub(const bvt &src1, const bvt &src2, bool subtract);
+  virtual bvt mul(const bvt &src1, const bvt &src2);
+  virtual bvt div(const bvt &src1, const bvt &src2);
+
 protected:
   virtual void normalization_shift(bvt &fraction, bvt &exponent);
   bvt overapproximating_left_shift(const bvt &src, unsigned dist);
+  bvt truncate_fraction(const bvt &src);
 
 private:
   typedef float_utilst SUB;
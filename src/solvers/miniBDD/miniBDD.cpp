@@ -1,5 +1,6 @@
 #include <cassert>
 
+#include <algorithm>
 #include <iostream>
 
 #include "miniBDD.h"
@@ -10,20 +11,18 @@
 namespace miniBDD
 {
 
+// sizes of the tables
+static const std::size_t initial_table_size=1<<10;
+static const std::size_t max_cache_size=1<<20;
+static const std::size_t initial_gc_threshold=1<<14;
+
 void node::remove_reference()
 {
   assert(reference_counter!=0);
   
+  // A node that is no longer referenced stays in the unique table,
+  // and can be revived by mk, until the next garbage collection.
   reference_counter--;
-
-  if(reference_counter==0 && node_number>=2)
-  {
-    mgr::reverse_keyt reverse_key(var, low, high);
-    mgr->reverse_map.erase(reverse_key);
-    low.clear();
-    high.clear();
-    mgr->free.push(this);
-  } 
 }
 
 BDD mgr::Var(const std::string &label)
@@ -31,6 +30,11 @@ BDD mgr::Var(const std::string &label)
   var_table.push_back(var_table_entryt(label));
   true_bdd.node->var=var_table.size()+1;
   false_bdd.node->var=var_table.size()+1;
+
+  // new variables go to the bottom of the order
+  var_to_level.push_back(level_to_var.size());
+  level_to_var.push_back(var_table.size());
+
   return mk(var_table.size(), false_bdd, true_bdd);
 }
 
@@ -48,8 +52,10 @@ void mgr::DumpDot(std::ostream &out, bool suppress_zero) const
   out << "  { node [shape=box,fontsize=24]; \"1\"; }\n"
       << "}\n\n";
       
-  for(unsigned v=0; v<var_table.size(); v++)
+  for(unsigned l=0; l<level_to_var.size(); l++)
   {
+    unsigned v=level_to_var[l]-1;
+
     out << "{ rank=same; "
            "{ node [shape=plaintext,fontname=\"Times Italic\",fontsize=24] \" "
         << var_table[v].label
@@ -66,8 +72,8 @@ void mgr::DumpDot(std::ostream &out, bool suppress_zero) const
 
   out << "{ edge [style = invis];";
 
-  for(unsigned v=0; v<var_table.size(); v++)
-    out << " \" " << var_table[v].label
+  for(unsigned l=0; l<level_to_var.size(); l++)
+    out << " \" " << var_table[level_to_var[l]-1].label
         << " \" ->";
   
   out << " \"T\"; }\n";
@@ -105,12 +111,14 @@ void mgr::DumpTikZ(
   out << "  \\tikzstyle{BDDnode}=[circle,draw=black,"
          "inner sep=0pt,minimum size=5mm]\n";
 
-  for(unsigned v=0; v<var_table.size(); v++)
+  for(unsigned l=0; l<level_to_var.size(); l++)
   {
+    unsigned v=level_to_var[l]-1;
+
     out << "  \\node[";
 
-    if(v!=0)
-      out << "below of=v" << var_table[v-1].label;
+    if(l!=0)
+      out << "below of=v" << var_table[level_to_var[l-1]-1].label;
 
     out << "] (v" << var_table[v].label << ") {$\\mathit{"
         << var_table[v].label << "}$};\n";
@@ -142,7 +150,7 @@ void mgr::DumpTikZ(
 
   out << "  % terminals\n";
   out << "  \\node[draw=black, style=rectangle, below of=v"
-      << var_table.back().label
+      << var_table[level_to_var.back()-1].label
       << ", xshift=1cm] (n1) {$1$};\n";
     
   if(!suppress_zero)
@@ -175,7 +183,7 @@ void mgr::DumpTikZ(
 class apply
 {
 public:
-  inline explicit apply(bool (*_fkt)(bool, bool)):fkt(_fkt)
+  inline apply(bool (*_fkt)(bool, bool), opt _op):fkt(_fkt), op(_op)
   {
   }
   
@@ -183,10 +191,8 @@ public:
 
 protected:
   bool (*fkt)(bool, bool);
+  const opt op;
   BDD APP(const BDD &x, const BDD &y);
-
-  typedef std::map<std::pair<unsigned, unsigned>, BDD> Gt;
-  Gt G;
 };
 
 BDD apply::APP(const BDD &x, const BDD &y)
@@ -194,31 +200,35 @@ BDD apply::APP(const BDD &x, const BDD &y)
   assert(x.is_initialized() && y.is_initialized());
   assert(x.node->mgr==y.node->mgr);
 
-  // dynamic programming
-  std::pair<unsigned, unsigned> key(x.node_number(), y.node_number());  
-  Gt::const_iterator G_it=G.find(key);
-  if(G_it!=G.end()) return G_it->second;
-
   mgr *mgr=x.node->mgr;
-  
-  BDD u;
 
   if(x.is_constant() && y.is_constant())
-    u=BDD(fkt(x.is_true(), y.is_true())?mgr->True():mgr->False());
-  else if(x.var()==y.var())
+    return fkt(x.is_true(), y.is_true())?mgr->True():mgr->False();
+
+  // dynamic programming, all our operators are commutative
+  unsigned a=x.node_number(), b=y.node_number();
+  if(a>b) std::swap(a, b);
+
+  class node *cached=mgr->cache_lookup(op, a, b);
+  if(cached!=0) return BDD(cached);
+
+  BDD u;
+  unsigned x_level=mgr->level(x), y_level=mgr->level(y);
+
+  if(x_level==y_level)
     u=mgr->mk(x.var(),
               APP(x.low(), y.low()),
               APP(x.high(), y.high()));
-  else if(x.var()<y.var())
+  else if(x_level<y_level)
     u=mgr->mk(x.var(),
               APP(x.low(), y),
               APP(x.high(), y));
-  else /* x.var() > y.var() */
+  else /* x_level > y_level */
     u=mgr->mk(y.var(),
               APP(x, y.low()),
               APP(x, y.high()));
 
-  G[key]=u;
+  mgr->cache_insert(op, a, b, u.node);
     
   return u;
 }
@@ -230,7 +240,7 @@ bool equal_fkt(bool x, bool y)
 
 BDD BDD::operator ==(const BDD &other) const
 {
-  return apply(equal_fkt)(*this, other);
+  return apply(equal_fkt, OP_EQUAL)(*this, other);
 }
 
 bool xor_fkt(bool x, bool y)
@@ -240,7 +250,7 @@ bool xor_fkt(bool x, bool y)
 
 BDD BDD::operator ^(const BDD &other) const
 {
-  return apply(xor_fkt)(*this, other);
+  return apply(xor_fkt, OP_XOR)(*this, other);
 }
 
 BDD BDD::operator !() const
@@ -255,7 +265,7 @@ bool and_fkt(bool x, bool y)
 
 BDD BDD::operator &(const BDD &other) const
 {
-  return apply(and_fkt)(*this, other);
+  return apply(and_fkt, OP_AND)(*this, other);
 }
 
 bool or_fkt(bool x, bool y)
@@ -265,20 +275,34 @@ bool or_fkt(bool x, bool y)
 
 BDD BDD::operator |(const BDD &other) const
 {
-  return apply(or_fkt)(*this, other);
+  return apply(or_fkt, OP_OR)(*this, other);
 }
 
-mgr::mgr()
+mgr::mgr():
+  unique_table(initial_table_size, 0),
+  unique_count(0),
+  cache(initial_table_size),
+  gc_threshold(initial_gc_threshold)
 {
   // add true/false nodes
   nodes.push_back(node(this, 0, 0, BDD(), BDD()));
   false_bdd=BDD(&nodes.back());
   nodes.push_back(node(this, 1, 1, BDD(), BDD()));
   true_bdd=BDD(&nodes.back());
+
+  // variables are numbered from 1
+  var_to_level.push_back(0);
 }
 
 mgr::~mgr()
 {
+  // the nodes are destroyed in no particular order,
+  // so drop the references between them first
+  for(nodest::iterator it=nodes.begin(); it!=nodes.end(); it++)
+  {
+    it->low.node=NULL;
+    it->high.node=NULL;
+  }
 }
 
 BDD mgr::mk(unsigned var, const BDD &low, const BDD &high)
@@ -287,46 +311,346 @@ BDD mgr::mk(unsigned var, const BDD &low, const BDD &high)
 
   if(low.node_number()==high.node_number())
     return low;
-  else
+
+  node *n=unique_find(var, low.node_number(), high.node_number());
+
+  if(n!=0)
+    return BDD(n);
+
+  // while sifting, the free nodes may still be listed
+  // in var_nodes, and are not reused
+  const bool sifting=!var_nodes.empty();
+
+  if(!sifting && free.empty() && nodes.size()>=gc_threshold)
+    collect_garbage();
+
+  if(sifting || free.empty())
+  {
+    unsigned new_number=nodes.size();
+    nodes.push_back(node(this, var, new_number, low, high));
+    n=&nodes.back();
+
+    if(sifting)
+      var_nodes[var].push_back(n);
+
+    // grow the computed table with the number of nodes
+    if(nodes.size()>cache.size() && cache.size()<max_cache_size)
+      cache_clear(cache.size()*2);
+  }
+  else // reuse a node, lowest number first
+  {
+    n=free.back();
+    free.pop_back();
+    n->var=var;
+    n->low=low;
+    n->high=high;
+  }
+
+  unique_insert(n);
+  return BDD(n);
+}
+
+node *mgr::unique_find(unsigned var, unsigned low, unsigned high) const
+{
+  std::size_t mask=unique_table.size()-1;
+
+  for(std::size_t i=unique_hash(var, low, high)&mask; ; i=(i+1)&mask)
+  {
+    node *n=unique_table[i];
+
+    if(n==0)
+      return 0;
+
+    if(n->var==var &&
+       n->low.node->node_number==low &&
+       n->high.node->node_number==high)
+      return n;
+  }
+}
+
+void mgr::unique_insert(node *n)
+{
+  // keep the load factor below 1/2
+  if((unique_count+1)*2>unique_table.size())
+    unique_resize(unique_table.size()*2);
+
+  std::size_t mask=unique_table.size()-1;
+  std::size_t i=unique_hash(
+    n->var, n->low.node->node_number, n->high.node->node_number)&mask;
+
+  while(unique_table[i]!=0)
+    i=(i+1)&mask;
+
+  unique_table[i]=n;
+  unique_count++;
+}
+
+void mgr::unique_erase(node *n)
+{
+  std::size_t mask=unique_table.size()-1;
+  std::size_t i=unique_hash(
+    n->var, n->low.node->node_number, n->high.node->node_number)&mask;
+
+  while(unique_table[i]!=n)
+  {
+    assert(unique_table[i]!=0);
+    i=(i+1)&mask;
+  }
+
+  unique_count--;
+
+  // Shift the following entries of the cluster back,
+  // so that no probe sequence is interrupted by the hole.
+  for(std::size_t j=(i+1)&mask; unique_table[j]!=0; j=(j+1)&mask)
+  {
+    const node *m=unique_table[j];
+    std::size_t home=unique_hash(
+      m->var, m->low.node->node_number, m->high.node->node_number)&mask;
+
+    // can m stay where it is?
+    if(i<=j ? (i<home && home<=j) : (i<home || home<=j))
+      continue;
+
+    unique_table[i]=unique_table[j];
+    i=j;
+  }
+
+  unique_table[i]=0;
+}
+
+void mgr::unique_resize(std::size_t size)
+{
+  unique_tablet old_table(size, 0);
+  old_table.swap(unique_table);
+  unique_count=0;
+
+  for(unique_tablet::const_iterator
+      it=old_table.begin(); it!=old_table.end(); it++)
+    if(*it!=0)
+      unique_insert(*it);
+}
+
+void mgr::cache_clear(std::size_t size)
+{
+  cache.clear();
+  cache.resize(size);
+}
+
+void mgr::collect_garbage()
+{
+  // free nodes have no successors
+  std::vector<node *> dead;
+
+  for(nodest::iterator it=nodes.begin()+2; it!=nodes.end(); it++)
+    if(it->reference_counter==0 && it->low.is_initialized())
+      dead.push_back(&*it);
+
+  while(!dead.empty())
+  {
+    node *n=dead.back();
+    dead.pop_back();
+
+    unique_erase(n);
+
+    node *l=n->low.node, *h=n->high.node;
+    n->low.clear();
+    n->high.clear();
+
+    if(l->reference_counter==0 && l->node_number>=2)
+      dead.push_back(l);
+
+    if(h->reference_counter==0 && h->node_number>=2)
+      dead.push_back(h);
+  }
+
+  // compact: release the free nodes at the end
+  while(nodes.size()>2 && !nodes.back().low.is_initialized())
+    nodes.pop_back();
+
+  free.clear();
+
+  for(nodest::reverse_iterator it=nodes.rbegin(); it!=nodes.rend(); it++)
+    if(it->node_number>=2 && !it->low.is_initialized())
+      free.push_back(&*it);
+
+  // the computed table may mention the freed nodes
+  cache_clear(cache.size());
+
+  gc_threshold=std::max(initial_gc_threshold, 2*number_of_nodes());
+}
+
+void mgr::free_unreferenced(node *n)
+{
+  // free the node, and whatever only it referred to
+  std::vector<node *> dead(1, n);
+
+  while(!dead.empty())
   {
-    reverse_keyt reverse_key(var, low, high);
-    reverse_mapt::const_iterator it=reverse_map.find(reverse_key);
+    node *d=dead.back();
+    dead.pop_back();
+
+    unique_erase(d);
+
+    node *l=d->low.node, *h=d->high.node;
+    d->low.clear();
+    d->high.clear();
+    free.push_back(d);
+
+    if(l->reference_counter==0 && l->node_number>=2)
+      dead.push_back(l);
+
+    if(h->reference_counter==0 && h->node_number>=2)
+      dead.push_back(h);
+  }
+}
+
+void mgr::swap_levels(unsigned level)
+{
+  // Exchange the variables at 'level' and 'level+1'.
+  // Every node keeps the function it represents, and thus
+  // the BDDs that refer to it remain valid.
+  assert(level+1<level_to_var.size());
+  assert(!var_nodes.empty());
 
-    if(it!=reverse_map.end())
-      return BDD(it->second);
+  unsigned x=level_to_var[level], y=level_to_var[level+1];
+
+  // mk adds the new x-nodes to var_nodes[x]
+  std::vector<node *> x_nodes, y_nodes;
+  x_nodes.swap(var_nodes[x]);
+  y_nodes.swap(var_nodes[y]);
+
+  // the x-nodes with a y-successor need to be rewritten
+  std::vector<BDD> todo;
+
+  for(std::vector<node *>::const_iterator
+      it=x_nodes.begin(); it!=x_nodes.end(); it++)
+  {
+    node *n=*it;
+
+    if(!n->low.is_initialized())
+      continue; // freed
+
+    if(n->low.var()==y || n->high.var()==y)
+      todo.push_back(BDD(n));
     else
+      var_nodes[x].push_back(n);
+  }
+
+  for(std::vector<BDD>::const_iterator
+      it=todo.begin(); it!=todo.end(); it++)
+  {
+    node &n=*it->node;
+
+    BDD f0=n.low, f1=n.high;
+    BDD f00=f0.var()==y?f0.low():f0, f01=f0.var()==y?f0.high():f0;
+    BDD f10=f1.var()==y?f1.low():f1, f11=f1.var()==y?f1.high():f1;
+
+    unique_erase(&n);
+    n.low=mk(x, f00, f10);
+    n.high=mk(x, f01, f11);
+    n.var=y;
+    unique_insert(&n);
+
+    var_nodes[y].push_back(&n);
+  }
+
+  todo.clear();
+
+  // the y-nodes that only the rewritten nodes referred to
+  // are gone, which keeps number_of_nodes() exact
+  for(std::vector<node *>::const_iterator
+      it=y_nodes.begin(); it!=y_nodes.end(); it++)
+  {
+    node *n=*it;
+
+    if(!n->low.is_initialized())
+      continue; // freed
+
+    if(n->reference_counter==0)
+      free_unreferenced(n);
+    else
+      var_nodes[y].push_back(n);
+  }
+
+  var_to_level[x]=level+1;
+  var_to_level[y]=level;
+  level_to_var[level]=y;
+  level_to_var[level+1]=x;
+}
+
+void mgr::sift(unsigned var)
+{
+  // the nodes of each variable, so that a swap only
+  // visits the nodes of the two levels involved
+  var_nodes.clear();
+  var_nodes.resize(var_table.size()+1);
+
+  for(nodest::iterator it=nodes.begin()+2; it!=nodes.end(); it++)
+    if(it->low.is_initialized())
+      var_nodes[it->var].push_back(&*it);
+
+  // move the variable through all levels, and then
+  // back to the one with the fewest nodes
+  unsigned best_level=var_to_level[var];
+  std::size_t best_size=number_of_nodes();
+  std::size_t max_size=2*best_size;
+
+  while(var_to_level[var]+1<level_to_var.size())
+  {
+    swap_levels(var_to_level[var]);
+
+    if(number_of_nodes()<best_size)
     {
-      node *n;
+      best_size=number_of_nodes();
+      best_level=var_to_level[var];
+    }
+    else if(number_of_nodes()>max_size)
+      break;
+  }
 
-      if(free.empty())
-      {
-        unsigned new_number=nodes.back().node_number+1;
-        nodes.push_back(node(this, var, new_number, low, high));
-        n=&nodes.back();
-      }
-      else // reuse a node
-      {
-        n=free.top();
-        free.pop();
-        n->var=var;
-        n->low=low;
-        n->high=high;
-      }
-      
-      reverse_map[reverse_key]=n;
-      return BDD(n);
+  while(var_to_level[var]>0)
+  {
+    swap_levels(var_to_level[var]-1);
+
+    if(number_of_nodes()<best_size)
+    {
+      best_size=number_of_nodes();
+      best_level=var_to_level[var];
     }
+    else if(number_of_nodes()>max_size)
+      break;
   }
+
+  while(var_to_level[var]<best_level)
+    swap_levels(var_to_level[var]);
+
+  while(var_to_level[var]>best_level)
+    swap_levels(var_to_level[var]-1);
+
+  // compacts the nodes, which the lists would point into
+  var_nodes.clear();
+  collect_garbage();
 }
 
-bool operator < (const mgr::reverse_keyt &x,
-                 const mgr::reverse_keyt &y)
+void mgr::reorder()
 {
-  if(x.var<y.var) return true;
-  if(x.var>y.var) return false;
-  if(x.low<y.low) return true;
-  if(x.low>y.low) return false;
-  return x.high<y.high;
+  collect_garbage();
+
+  // sift the variables with the most nodes first
+  std::vector<std::pair<std::size_t, unsigned> > order;
+
+  for(unsigned v=1; v<=var_table.size(); v++)
+    order.push_back(std::make_pair(0, v));
+
+  for(nodest::const_iterator it=nodes.begin()+2; it!=nodes.end(); it++)
+    if(it->low.is_initialized())
+      order[it->var-1].first++;
+
+  std::sort(order.begin(), order.end());
+
+  for(std::size_t i=order.size(); i!=0; i--)
+    if(order[i-1].first!=0)
+      sift(order[i-1].second);
 }
 
 void mgr::DumpTable(std::ostream &out) const
@@ -357,7 +681,7 @@ class restrictt
 {
 public:
   inline restrictt(const unsigned _var, const bool _value):
-    var(_var), value(_value)
+    var(_var), value(_value), op(_value?OP_RESTRICT1:OP_RESTRICT0)
   {
   }
   
@@ -366,6 +690,7 @@ public:
 protected:
   const unsigned var;
   const bool value;
+  const opt op;
   
   BDD RES(const BDD &u);
 };
@@ -376,15 +701,20 @@ BDD restrictt::RES(const BDD &u)
 
   assert(u.is_initialized());
   mgr *mgr=u.node->mgr;
+
+  unsigned u_level=mgr->level(u), var_level=mgr->var_level(var);
+
+  if(u_level>var_level)
+    return u;
+  else if(u_level==var_level)
+    return value?u.high():u.low();
+
+  class node *cached=mgr->cache_lookup(op, u.node_number(), var);
+  if(cached!=0) return BDD(cached);
   
-  BDD t;
-
-  if(u.var()>var)
-    t=u;
-  else if(u.var()<var)
-    t=mgr->mk(u.var(), RES(u.low()), RES(u.high()));
-  else // u.var()==var
-    t=RES(value?u.high():u.low());
+  BDD t=mgr->mk(u.var(), RES(u.low()), RES(u.high()));
+
+  mgr->cache_insert(op, u.node_number(), var, t.node);
     
   return t;
 }
@@ -394,11 +724,46 @@ BDD restrict(const BDD &u, unsigned var, const bool value)
   return restrictt(var, value)(u);
 }
 
+class existst
+{
+public:
+  inline explicit existst(const unsigned _var):var(_var)
+  {
+  }
+  
+  BDD operator()(const BDD &u) { return EX(u); }
+
+protected:
+  const unsigned var;
+  
+  BDD EX(const BDD &u);
+};
+
+BDD existst::EX(const BDD &u)
+{
+  assert(u.is_initialized());
+  mgr *mgr=u.node->mgr;
+
+  unsigned u_level=mgr->level(u), var_level=mgr->var_level(var);
+
+  if(u_level>var_level)
+    return u;
+  else if(u_level==var_level) // u[var/0] OR u[var/1]
+    return u.low() | u.high();
+
+  class node *cached=mgr->cache_lookup(OP_EXISTS, u.node_number(), var);
+  if(cached!=0) return BDD(cached);
+  
+  BDD t=mgr->mk(u.var(), EX(u.low()), EX(u.high()));
+
+  mgr->cache_insert(OP_EXISTS, u.node_number(), var, t.node);
+    
+  return t;
+}
+
 BDD exists(const BDD &u, const unsigned var)
 {
-  // u[var/0] OR u[var/1]
-  return restrict(u, var, false) |
-         restrict(u, var, true);
+  return existst(var)(u);
 }
 
 BDD substitute(const BDD &t, unsigned var, const BDD &tp)
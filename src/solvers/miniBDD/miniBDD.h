@@ -18,11 +18,10 @@ Author: Daniel Kroening, kroening@kroening.com
 */
 
 #include <cassert>
-#include <list>
+#include <deque>
 #include <vector>
 #include <map>
 #include <string>
-#include <stack>
 
 namespace miniBDD
 {
@@ -77,6 +76,10 @@ public:
   void remove_reference();
 };
 
+// the operations in the computed table
+enum opt { OP_NONE, OP_AND, OP_OR, OP_XOR, OP_EQUAL,
+           OP_RESTRICT0, OP_RESTRICT1, OP_EXISTS };
+
 class mgr
 {
 public:
@@ -95,10 +98,27 @@ public:
   friend class BDD;
   friend class node;
   
-  // create a node (consulting the reverse-map)
+  // create a node (consulting the unique table)
   BDD mk(unsigned var, const BDD &low, const BDD &high);
   
   inline std::size_t number_of_nodes();
+
+  // free the nodes that are no longer referenced
+  void collect_garbage();
+
+  // variable reordering by sifting
+  void reorder();
+
+  // the position of a node's variable in the order,
+  // variables with lower level are closer to the root
+  inline unsigned level(const BDD &) const;
+
+  // the position of a variable in the order
+  inline unsigned var_level(unsigned var) const;
+
+  // the computed table, shared by all operations
+  inline node *cache_lookup(opt op, unsigned a, unsigned b);
+  inline void cache_insert(opt op, unsigned a, unsigned b, node *result);
   
   struct var_table_entryt
   {
@@ -110,25 +130,55 @@ public:
   var_tablet var_table;  
   
 protected:
-  typedef std::list<node> nodest;
+  // node numbers are indices into this
+  typedef std::deque<node> nodest;
   nodest nodes;
   BDD true_bdd, false_bdd;
+
+  // the variable order
+  std::vector<unsigned> var_to_level, level_to_var;
   
-  // this is our reverse-map for nodes
-  struct reverse_keyt
+  // the unique table, open addressing with linear probing
+  typedef std::vector<node *> unique_tablet;
+  unique_tablet unique_table;
+  std::size_t unique_count;
+
+  static inline std::size_t unique_hash(
+    unsigned var, unsigned low, unsigned high);
+  node *unique_find(unsigned var, unsigned low, unsigned high) const;
+  void unique_insert(node *n);
+  void unique_erase(node *n);
+  void unique_resize(std::size_t size);
+
+  // the computed table is lossy: a colliding entry is overwritten
+  struct cache_entryt
   {
-    unsigned var, low, high;
-    inline reverse_keyt(
-      unsigned _var, const BDD &_low, const BDD &_high);
+    opt op;
+    unsigned a, b;
+    node *result;
+    cache_entryt():op(OP_NONE), a(0), b(0), result(0) { }
   };
-  
-  friend bool operator < (const reverse_keyt &x, const reverse_keyt &y);
-  
-  typedef std::map<reverse_keyt, node *> reverse_mapt;
-  reverse_mapt reverse_map;
-  
-  typedef std::stack<node *> freet;
+
+  typedef std::vector<cache_entryt> cachet;
+  cachet cache;
+
+  static inline std::size_t cache_hash(opt op, unsigned a, unsigned b);
+  void cache_clear(std::size_t size);
+
+  // nodes with no references are kept until the next collection,
+  // free nodes are kept sorted, with the lowest number at the end
+  typedef std::vector<node *> freet;
   freet free;
+  std::size_t gc_threshold;
+
+  // the nodes of each variable, only kept while sifting;
+  // freed nodes are dropped lazily
+  typedef std::vector<std::vector<node *> > var_nodest;
+  var_nodest var_nodes;
+
+  void free_unreferenced(node *n);
+  void swap_levels(unsigned level);
+  void sift(unsigned var);
 };
 
 BDD restrict(const BDD &u, unsigned var, const bool value);
@@ -110,8 +110,98 @@ literalt aig_prop_baset::land(literalt a, literalt b)
 
   if(a==neg(b)) return const_literal(false);
   if(a==b) return a;
+
+  literalt result;
+  if(rewrite_and(a, b, result) || rewrite_and(b, a, result))
+    return result;
   
-  return dest.new_and_node(a, b);
+  return new_and_node(a, b);
+}
+
+/*******************************************************************\
+
+Function: aig_prop_baset::new_and_node
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: returns the existing node for a AND b, if any
+
+\*******************************************************************/
+
+literalt aig_prop_baset::new_and_node(literalt a, literalt b)
+{
+  std::pair<and_hasht::iterator, bool> entry=
+    and_hash.insert(std::make_pair(and_key(a, b), 0u));
+
+  if(!entry.second)
+    return literalt(entry.first->second, false);
+
+  literalt l=dest.new_and_node(a, b);
+  entry.first->second=l.var_no();
+  return l;
+}
+
+/*******************************************************************\
+
+Function: aig_prop_baset::rewrite_and
+
+  Inputs: non-constant literals a and b
+
+ Outputs: true if a AND b can be expressed without a new node
+
+ Purpose: two-level simplification, for b being an AND node
+
+\*******************************************************************/
+
+bool aig_prop_baset::rewrite_and(literalt a, literalt b, literalt &result)
+{
+  const aigt::nodet &node=dest.get_node(b);
+
+  if(!node.is_and())
+    return false;
+
+  if(!b.sign())
+  {
+    // a & (a & x) = a & x
+    if(node.a==a || node.b==a)
+    {
+      result=b;
+      return true;
+    }
+
+    // a & (!a & x) = false
+    if(node.a==neg(a) || node.b==neg(a))
+    {
+      result=const_literal(false);
+      return true;
+    }
+  }
+  else
+  {
+    // a & !(!a & x) = a
+    if(node.a==neg(a) || node.b==neg(a))
+    {
+      result=a;
+      return true;
+    }
+
+    // a & !(a & x) = a & !x
+    if(node.a==a)
+    {
+      result=land(a, neg(node.b));
+      return true;
+    }
+
+    if(node.b==a)
+    {
+      result=land(a, neg(node.a));
+      return true;
+    }
+  }
+
+  return false;
 }
 
 /*******************************************************************\
@@ -277,6 +367,225 @@ void aig_prop_baset::set_equal(literalt a, literalt b)
 #endif
 }
 
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::aig_prop_solvert
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+aig_prop_solvert::aig_prop_solvert(propt &_solver):
+  aig_prop_constraintt(aig),
+  solver(_solver),
+  converted_nodes(0),
+  converted_constraints(0)
+{
+  // variable zero isn't a valid literal in the solver
+  aig.new_var_node();
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::can_substitute
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: whether the input variable of 'a' can be replaced by 'b'
+
+\*******************************************************************/
+
+bool aig_prop_solvert::can_substitute(literalt a, literalt b) const
+{
+  if(a.is_constant())
+    return false;
+
+  unsigned v=a.var_no();
+
+  // the gates using it must not have been converted yet,
+  // and we must not create cycles
+  if(v<converted_nodes || !aig.nodes[v].is_var())
+    return false;
+
+  if(!b.is_constant() && b.var_no()>=v)
+    return false;
+
+  return v>=substitution.size() ||
+         substitution[v].var_no()==literalt::unused_var_no();
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::set_equal
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aig_prop_solvert::set_equal(literalt a, literalt b)
+{
+  if(b<a) std::swap(a, b);
+
+  // we replace the one created later
+  if(can_substitute(b, a))
+  {
+    substitution.resize(aig.nodes.size());
+    substitution[b.var_no()]=a^b.sign();
+  }
+  else
+    aig_prop_baset::set_equal(a, b);
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::l_set_to
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aig_prop_solvert::l_set_to(literalt a, bool value)
+{
+  if(can_substitute(a, const_literal(value)))
+  {
+    substitution.resize(aig.nodes.size());
+    substitution[a.var_no()]=const_literal(value^a.sign());
+  }
+  else
+    aig_prop_constraintt::l_set_to(a, value);
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::set_frozen
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aig_prop_solvert::set_frozen(literalt a)
+{
+  if(!a.is_constant())
+    frozen.push_back(a);
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::is_in_conflict
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool aig_prop_solvert::is_in_conflict(literalt a) const
+{
+  literalt l=map_literal(a);
+
+  if(l.is_constant())
+    return l.is_false();
+
+  return solver.is_in_conflict(l);
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::evaluate
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: computes the value of a node from the values of the
+          inputs; with Plaisted-Greenbaum, the solver's value of
+          a gate need not match its inputs
+
+\*******************************************************************/
+
+tvt aig_prop_solvert::evaluate(literalt l) const
+{
+  // 0: not computed yet, otherwise tv_enumt+1
+  if(l.is_constant())
+    return tvt(l.sign());
+
+  values.resize(aig.nodes.size(), 0);
+
+  std::stack<unsigned> stack;
+  stack.push(l.var_no());
+
+  while(!stack.empty())
+  {
+    unsigned n=stack.top();
+
+    if(values[n]!=0)
+    {
+      stack.pop();
+      continue;
+    }
+
+    const aigt::nodet &node=aig.nodes[n];
+
+    tvt result=tvt::unknown();
+
+    if(node.is_var())
+      result=solver.l_get(literalt(n, false));
+    else
+    {
+      bool ready=true;
+
+      if(!node.a.is_constant() && values[node.a.var_no()]==0)
+      {
+        stack.push(node.a.var_no());
+        ready=false;
+      }
+
+      if(!node.b.is_constant() && values[node.b.var_no()]==0)
+      {
+        stack.push(node.b.var_no());
+        ready=false;
+      }
+
+      if(!ready)
+        continue;
+
+      tvt a=node.a.is_constant()?tvt(node.a.sign()):
+        tvt(tvt::tv_enumt(values[node.a.var_no()]-1));
+      tvt b=node.b.is_constant()?tvt(node.b.sign()):
+        tvt(tvt::tv_enumt(values[node.b.var_no()]-1));
+
+      result=(node.a.sign()?!a:a) && (node.b.sign()?!b:b);
+    }
+
+    values[n]=(unsigned char)result.get_value()+1;
+    stack.pop();
+  }
+
+  tvt result(tvt::tv_enumt(values[l.var_no()]-1));
+  return l.sign()?!result:result;
+}
+
 /*******************************************************************\
 
 Function: aig_prop_solvert::l_get
@@ -291,7 +600,13 @@ Function: aig_prop_solvert::l_get
 
 tvt aig_prop_solvert::l_get(literalt a) const
 {
-  return solver.l_get(a);
+  if(a.is_constant())
+    return tvt(a.sign());
+
+  if(a.var_no()>=repr.size())
+    return tvt::unknown(); // not converted
+
+  return evaluate(map_literal(a));
 }
 
 /*******************************************************************\
@@ -312,33 +627,126 @@ propt::resultt aig_prop_solvert::prop_solve()
            << aig.nodes.size() << " nodes" << eom;
   convert_aig();
 
+  values.clear();
+
+  bvt solver_assumptions;
+
+  forall_literals(it, assumptions)
+  {
+    literalt l=map_literal(*it);
+
+    if(l.is_false())
+      return P_UNSATISFIABLE;
+    else if(!l.is_true())
+      solver_assumptions.push_back(l);
+  }
+
+  if(solver.has_set_assumptions())
+    solver.set_assumptions(solver_assumptions);
+
   return solver.prop_solve();
 }
 
 /*******************************************************************\
 
-Function: aig_prop_solvert::compute_phase
+Function: aig_prop_solvert::compute_repr
 
-  Inputs: Two vectors of bools of size aig.nodes.size()
+  Inputs:
 
- Outputs: These vectors filled in with per node phase information
+ Outputs:
 
- Purpose: Compute the phase information needed for Plaisted-Greenbaum encoding
+ Purpose: determine the literal encoding each of the new nodes,
+          after substitution, constant propagation and merging of
+          structurally equal gates
 
 \*******************************************************************/
 
-void aig_prop_solvert::compute_phase(
-  std::vector<bool> &n_pos,
-  std::vector<bool> &n_neg)
+void aig_prop_solvert::compute_repr()
 {
-  std::stack<literalt> queue;
+  repr.resize(aig.nodes.size());
+  substitution.resize(aig.nodes.size());
+
+  unsigned substituted=0, merged=0;
+
+  for(unsigned n=converted_nodes; n<aig.nodes.size(); n++)
+  {
+    aigt::nodet &node=aig.nodes[n];
+    literalt self(n, false);
+
+    if(node.is_var())
+    {
+      // the target has a smaller number, and is done already
+      if(substitution[n].var_no()!=literalt::unused_var_no())
+      {
+        repr[n]=map_literal(substitution[n]);
+        substituted++;
+      }
+      else
+        repr[n]=self;
+
+      continue;
+    }
+
+    literalt a=map_literal(node.a), b=map_literal(node.b);
+
+    if(a.is_false() || b.is_false() || a==neg(b))
+      repr[n]=const_literal(false);
+    else if(a.is_true())
+      repr[n]=b;
+    else if(b.is_true() || a==b)
+      repr[n]=a;
+    else
+    {
+      std::pair<and_hasht::iterator, bool> entry=
+        and_hash.insert(std::make_pair(and_key(a, b), n));
+
+      if(entry.first->second<n)
+      {
+        repr[n]=literalt(entry.first->second, false);
+        merged++;
+        continue;
+      }
+
+      entry.first->second=n;
+      node.make_and(a, b);
+      repr[n]=self;
+      continue;
+    }
+
+    merged++;
+  }
+
+  if(substituted!=0 || merged!=0)
+    statistics() << "AIG: " << substituted << " variables substituted, "
+                 << merged << " gates simplified or merged" << eom;
+
+  converted_nodes=aig.nodes.size();
+}
+
+/*******************************************************************\
+
+Function: aig_prop_solvert::require
 
-  // Get phases of constraints
-  for(aig_plus_constraintst::constraintst::const_iterator
-      c_it=aig.constraints.begin();
-      c_it!=aig.constraints.end();
-      c_it++)
-    queue.push(*c_it);
+  Inputs: a literal that is constrained
+
+ Outputs:
+
+ Purpose: Compute the phase information needed for Plaisted-Greenbaum
+          encoding, and count the uses of the nodes in the cone
+
+\*******************************************************************/
+
+void aig_prop_solvert::require(literalt root)
+{
+  if(root.is_constant()) return;
+
+  if(root.sign())
+    ++n_usage_count[root.var_no()];
+  else
+    ++p_usage_count[root.var_no()];
+
+  std::stack<literalt> queue;
+  queue.push(root);
 
   while(!queue.empty())
   {
@@ -349,159 +757,79 @@ void aig_prop_solvert::compute_phase(
 
     bool sign=l.sign();
     unsigned var_no=l.var_no();
+    unsigned char phase=sign?PHASE_NEG:PHASE_POS;
     
     // already set?
-    if(sign?n_neg[var_no]:n_pos[var_no]) continue; // done already
-    
-    // set
-    sign?n_neg[var_no]=1:n_pos[var_no]=1;
+    if(phase_required[var_no]&phase) continue; // done already
     
     const aigt::nodet &node=aig.nodes[var_no];
 
     if(node.is_and())
     {
+      // first time in the cone?
+      if(phase_required[var_no]==0)
+      {
+        if(node.a.sign())
+          ++n_usage_count[node.a.var_no()];
+        else
+          ++p_usage_count[node.a.var_no()];
+
+        if(node.b.sign())
+          ++n_usage_count[node.b.var_no()];
+        else
+          ++p_usage_count[node.b.var_no()];
+      }
+
       queue.push(node.a^sign);
       queue.push(node.b^sign);
     }    
+
+    phase_required[var_no]|=phase;
   }  
-  
-  // Count
-  unsigned pos_only=0, neg_only=0, mixed=0;
-  
-  for(unsigned n=0; n<aig.nodes.size(); n++)
-  {
-    if(aig.nodes[n].is_and())
-    {
-      if(n_neg[n] && n_pos[n])
-        mixed++;
-      else if(n_pos[n])
-        pos_only++;
-      else if(n_neg[n])
-        neg_only++;
-    }
-  }
-  
-  statistics() << "Pos only: " << pos_only << "\n"
-               << "Neg only: " << neg_only << "\n"
-               << "Mixed: " << mixed << eom;
 }
 
-
 /*******************************************************************\
 
-Function: aig_prop_solvert::usage_count
+Function: aig_prop_solvert::statistics_phases
 
-  Inputs: Two vectors of unsigned of size aig.nodes.size()
+  Inputs:
 
- Outputs: These vectors filled in with per node usage information
+ Outputs:
 
- Purpose: Compact encoding for single usage variable
+ Purpose:
 
 \*******************************************************************/
 
-void aig_prop_solvert::usage_count(
-  std::vector<unsigned> &p_usage_count,
-  std::vector<unsigned> &n_usage_count)
+void aig_prop_solvert::statistics_phases()
 {
-  for(aig_plus_constraintst::constraintst::const_iterator
-      c_it=aig.constraints.begin();
-      c_it!=aig.constraints.end();
-      c_it++)
-  {
-    if (!((*c_it).is_constant()))
-    {
-      if ((*c_it).sign()) {
-        ++n_usage_count[(*c_it).var_no()];
-      } else {
-        ++p_usage_count[(*c_it).var_no()];
-      }
-
-    }
-  }
-
-  for (unsigned n=0; n<aig.nodes.size(); n++)
-  {
-    const aigt::nodet &node=aig.nodes[n];
-
-    if (node.is_and()) {
-      if (node.a.sign()) {
-        ++n_usage_count[node.a.var_no()];
-      } else {
-        ++p_usage_count[node.a.var_no()];
-      }
-
-      if (node.b.sign()) {
-        ++n_usage_count[node.b.var_no()];
-      } else {
-        ++p_usage_count[node.b.var_no()];
-      }
-
-    }
-  }
-
-
-  #if 1
-  // Compute stats
-  unsigned unused = 0;
-  unsigned usedOncePositive = 0;
-  unsigned usedOnceNegative = 0;
-  unsigned usedTwicePositive = 0;
-  unsigned usedTwiceNegative = 0;
-  unsigned usedTwiceMixed = 0;
-  unsigned usedThreeTimes = 0;
-  unsigned usedMore = 0;
-
-  for (unsigned n=0; n<aig.nodes.size(); n++)
+  unsigned pos_only=0, neg_only=0, mixed=0, unused=0;
+  
+  for(unsigned n=0; n<aig.nodes.size(); n++)
   {
-    switch (p_usage_count[n] + n_usage_count[n])
+    if(aig.nodes[n].is_and() && repr[n]==literalt(n, false))
     {
-    case 0: ++unused; break;
-    case 1:
-      if(p_usage_count[n] == 1)
-        ++usedOncePositive;
-      else 
-        ++usedOnceNegative;
-      break;
-
-    case 2 :
-      if (p_usage_count[n] >= 2)
-      {
-        ++usedTwicePositive;
-      } 
-      else if (n_usage_count[n] >= 2)
-      {
-        ++usedTwiceNegative;
-      }
+      if(phase_required[n]==(PHASE_POS|PHASE_NEG))
+        mixed++;
+      else if(phase_required[n]==PHASE_POS)
+        pos_only++;
+      else if(phase_required[n]==PHASE_NEG)
+        neg_only++;
       else
-      {
-        assert(p_usage_count[n] == 1 && n_usage_count[n] == 1);
-        ++usedTwiceMixed;
-      }
-      break;
-    case 3: ++usedThreeTimes; break;
-    default: ++usedMore; break;
+        unused++;
     }
   }
-
-  statistics() << "Unused: " << unused << " "
-               << "Used once: " << usedOncePositive + usedOnceNegative
-               << " (P: " << usedOncePositive
-               << ", N: " << usedOnceNegative << ") "
-               << "Used twice: " << usedTwicePositive + usedTwiceNegative + usedTwiceMixed
-               << " (P: " << usedTwicePositive
-               << ", N: " << usedTwiceNegative
-               << ", M: " << usedTwiceMixed << ") "
-               << "Used three times: " << usedThreeTimes << " "
-               << "Used more: " << usedMore
-               << eom;
-  #endif
+  
+  statistics() << "Pos only: " << pos_only << "\n"
+               << "Neg only: " << neg_only << "\n"
+               << "Mixed: " << mixed << "\n"
+               << "Not in cone: " << unused << eom;
 }
 
 /*******************************************************************\
 
 Function: aig_prop_solvert::convert_node
 
-  Inputs: The node to convert, the phases required and the usage counts.
+  Inputs: The node to convert, and the phases required.
 
  Outputs: The node converted to CNF in the solver object.
 
@@ -512,212 +840,210 @@ Function: aig_prop_solvert::convert_node
 void aig_prop_solvert::convert_node(
   unsigned n,
   const aigt::nodet &node,
-  bool n_pos, bool n_neg,
-  std::vector<unsigned> &p_usage_count,
-  std::vector<unsigned> &n_usage_count)
+  bool n_pos, bool n_neg)
 {
-  if (p_usage_count[n] > 0 || n_usage_count[n] > 0)
-  {
-    literalt o=literalt(n, false);
-    bvt body(2);
-    body[0]=node.a;
-    body[1]=node.b;
+  literalt o=literalt(n, false);
+  bvt body(2);
+  body[0]=node.a;
+  body[1]=node.b;
 
 #ifdef USE_AIG_COMPACT
-    // Inline positive literals
-    // This should remove the overhead introduced by land and lor for bvt
+  // Inline positive literals
+  // This should remove the overhead introduced by land and lor for bvt
+  
+  for(bvt::size_type i = 0; i < body.size(); i++)
+  {
+    literalt l = body[i];
     
-    for (bvt::size_type i = 0; i < body.size(); i++)
-    {
-      literalt l = body[i];
+    if (!l.sign() &&                      // Used positively...
+        aig.nodes[l.var_no()].is_and() && // ... is a gate ...
+        p_usage_count[l.var_no()] == 1 && // ... only used here ...
+        n_usage_count[l.var_no()] == 0 &&
+        phase_done[l.var_no()] == 0) {    // ... and not converted.
       
-      if (!l.sign() &&                      // Used positively...
-          aig.nodes[l.var_no()].is_and() && // ... is a gate ...
-          p_usage_count[l.var_no()] == 1 && // ... only used here.
-          n_usage_count[l.var_no()] == 0) {
-        
-        const aigt::nodet &rep = aig.nodes[l.var_no()];
-        body[i] = rep.a;
-        body.push_back(rep.b);
-        --i;                         // Repeat the process
-        --p_usage_count[l.var_no()]; // Supress generation of inlined node
-      }
+      const aigt::nodet &rep = aig.nodes[l.var_no()];
+      body[i] = rep.a;
+      body.push_back(rep.b);
+      --i;                                // Repeat the process
+      inlined[l.var_no()] = true;         // Supress generation of inlined node
     }
+  }
 
-    // TODO : Could check the array for duplicates / complementary literals
-    // but this should be found by the SAT preprocessor.
-    // TODO : Likewise could find things that are constrained, esp the output
-    // and backwards constant propagate.  Again may not be worth it.
-
-    // lxor and lselect et al. are difficult to express in AIGs.
-    // Doing so introduces quite a bit of overhead.
-    // This should recognise the AIGs they produce and
-    // handle them in a more efficient way.
-    
-    // Recognise something of the form:
-    //
-    //  neg(o) = lor(land(a,b), land(neg(a),c))
-    //      o  = land(lneg(land(a,b)), lneg(land(neg(a),c)))
-    // 
-    // Note that lxor and lselect generate the negation of this
-    // but will still be recognised because the negation is
-    // recorded where it is used
+  // lxor and lselect et al. are difficult to express in AIGs.
+  // Doing so introduces quite a bit of overhead.
+  // This should recognise the AIGs they produce and
+  // handle them in a more efficient way.
+  
+  // Recognise something of the form:
+  //
+  //  neg(o) = lor(land(a,b), land(neg(a),c))
+  //      o  = land(lneg(land(a,b)), lneg(land(neg(a),c)))
+  // 
+  // Note that lxor and lselect generate the negation of this
+  // but will still be recognised because the negation is
+  // recorded where it is used
+  
+  if(body.size() == 2 && body[0].sign() && body[1].sign())
+  {
+    const aigt::nodet &left = aig.nodes[body[0].var_no()];
+    const aigt::nodet &right = aig.nodes[body[1].var_no()];
     
-    if(body.size() == 2 && body[0].sign() && body[1].sign())
+    if(left.is_and() && right.is_and())
     {
-      const aigt::nodet &left = aig.nodes[body[0].var_no()];
-      const aigt::nodet &right = aig.nodes[body[1].var_no()];
-      
-      if(left.is_and() && right.is_and())
+      if(left.a == neg(right.a))
       {
-        if(left.a == neg(right.a))
+        if (p_usage_count[body[0].var_no()] == 0 &&
+            n_usage_count[body[0].var_no()] == 1 &&
+            phase_done[body[0].var_no()] == 0 &&
+            p_usage_count[body[1].var_no()] == 0 &&
+            n_usage_count[body[1].var_no()] == 1 &&
+            phase_done[body[1].var_no()] == 0)
         {
-          if (p_usage_count[body[0].var_no()] == 0 &&
-              n_usage_count[body[0].var_no()] == 1 &&
-              p_usage_count[body[1].var_no()] == 0 &&
-              n_usage_count[body[1].var_no()] == 1)
+          bvt lits(3);
+
+          if (n_neg)
           {
-            bvt lits(3);
-
-            if (n_neg)
-            {
-              lits[0] = left.a;
-              lits[1] = right.b;
-              lits[2] = o;
-              solver.lcnf(lits);
-              
-              lits[0] = neg(left.a);
-              lits[1] = left.b;
-              lits[2] = o;
-              solver.lcnf(lits);
-            }
-
-            if (n_pos)
-            {
-              lits[0] = left.a;
-              lits[1] = neg(right.b);
-              lits[2] = neg(o);
-              solver.lcnf(lits);
-              
-              lits[0] = neg(left.a);
-              lits[1] = neg(left.b);
-              lits[2] = neg(o);
-              solver.lcnf(lits);
-            }
-
-            // Supress generation
-            --n_usage_count[body[0].var_no()];
-            --n_usage_count[body[1].var_no()];
+            lits[0] = left.a;
+            lits[1] = right.b;
+            lits[2] = o;
+            solver.lcnf(lits);
             
-            return;
+            lits[0] = neg(left.a);
+            lits[1] = left.b;
+            lits[2] = o;
+            solver.lcnf(lits);
+          }
+
+          if (n_pos)
+          {
+            lits[0] = left.a;
+            lits[1] = neg(right.b);
+            lits[2] = neg(o);
+            solver.lcnf(lits);
+            
+            lits[0] = neg(left.a);
+            lits[1] = neg(left.b);
+            lits[2] = neg(o);
+            solver.lcnf(lits);
           }
-        }
-      }      
-    }
 
+          // Supress generation
+          inlined[body[0].var_no()] = true;
+          inlined[body[1].var_no()] = true;
+          
+          return;
+        }
+      }
+    }      
+  }
 
-    // Likewise, carry has an improved encoding which is generated
-    // by the CNF encoding
-    if (body.size() == 3 && body[0].sign() && body[1].sign() && body[2].sign())
-    {
-      const aigt::nodet &left = aig.nodes[body[0].var_no()];
-      const aigt::nodet &mid = aig.nodes[body[1].var_no()];
-      const aigt::nodet &right = aig.nodes[body[2].var_no()];
+  // Likewise, carry has an improved encoding which is generated
+  // by the CNF encoding
+  if (body.size() == 3 && body[0].sign() && body[1].sign() && body[2].sign())
+  {
+    const aigt::nodet &left = aig.nodes[body[0].var_no()];
+    const aigt::nodet &mid = aig.nodes[body[1].var_no()];
+    const aigt::nodet &right = aig.nodes[body[2].var_no()];
+
+    if (left.is_and() && mid.is_and() && right.is_and()) {
+      if (p_usage_count[body[0].var_no()] == 0 &&
+          n_usage_count[body[0].var_no()] == 1 &&
+          phase_done[body[0].var_no()] == 0 &&
+          p_usage_count[body[1].var_no()] == 0 &&
+          n_usage_count[body[1].var_no()] == 1 &&
+          phase_done[body[1].var_no()] == 0 &&
+          p_usage_count[body[2].var_no()] == 0 &&
+          n_usage_count[body[2].var_no()] == 1 &&
+          phase_done[body[2].var_no()] == 0) {
+
+        literalt a = left.a;
+        literalt b = left.b;
+        literalt c = mid.a;
+
+        if (a == right.b && b == mid.b && c == right.a) {
+
+          // A (negative) carry -- 1 if at most one input is 1
+          bvt lits(3);
+
+          if (n_neg)
+          {
+            lits[0] = a;
+            lits[1] = b;
+            lits[2] = o;
+            solver.lcnf(lits);
+
+            lits[0] = a;
+            lits[1] = c;
+            lits[2] = o;
+            solver.lcnf(lits);
+            
+            lits[0] = b;
+            lits[1] = c;
+            lits[2] = o;
+            solver.lcnf(lits);
+          }
 
-      if (left.is_and() && mid.is_and() && right.is_and()) {
-        if (p_usage_count[body[0].var_no()] == 0 &&
-            n_usage_count[body[0].var_no()] == 1 &&
-            p_usage_count[body[1].var_no()] == 0 &&
-            n_usage_count[body[1].var_no()] == 1 &&
-            p_usage_count[body[2].var_no()] == 0 &&
-            n_usage_count[body[2].var_no()] == 1) {
-
-          literalt a = left.a;
-          literalt b = left.b;
-          literalt c = mid.a;
-
-          if (a == right.b && b == mid.b && c == right.a) {
-
-            // A (negative) carry -- 1 if at most one input is 1
-            bvt lits(3);
-
-            if (n_neg)
-            {
-              lits[0] = a;
-              lits[1] = b;
-              lits[2] = o;
-              solver.lcnf(lits);
-
-              lits[0] = a;
-              lits[1] = c;
-              lits[2] = o;
-              solver.lcnf(lits);
-              
-              lits[0] = b;
-              lits[1] = c;
-              lits[2] = o;
-              solver.lcnf(lits);
-            }
-
-            if (n_pos)
-            {
-              lits[0] = neg(a);
-              lits[1] = neg(b);
-              lits[2] = neg(o);
-              solver.lcnf(lits);
-
-              lits[0] = neg(a);
-              lits[1] = neg(c);
-              lits[2] = neg(o);
-              solver.lcnf(lits);
-              
-              lits[0] = neg(b);
-              lits[1] = neg(c);
-              lits[2] = neg(o);
-              solver.lcnf(lits);
-            }
-
-            // Supress generation
-            --n_usage_count[body[0].var_no()];
-            --n_usage_count[body[1].var_no()];
-            --n_usage_count[body[2].var_no()];
+          if (n_pos)
+          {
+            lits[0] = neg(a);
+            lits[1] = neg(b);
+            lits[2] = neg(o);
+            solver.lcnf(lits);
+
+            lits[0] = neg(a);
+            lits[1] = neg(c);
+            lits[2] = neg(o);
+            solver.lcnf(lits);
             
-            return;
+            lits[0] = neg(b);
+            lits[1] = neg(c);
+            lits[2] = neg(o);
+            solver.lcnf(lits);
           }
+
+          // Supress generation
+          inlined[body[0].var_no()] = true;
+          inlined[body[1].var_no()] = true;
+          inlined[body[2].var_no()] = true;
+          
+          return;
         }
       }
     }
+  }
 
-    // TODO : these special cases are fragile and could be improved.
-    // They don't handle cases where the construction is partially constant
-    // folded.  Also the usage constraints are sufficient for improvement
-    // but reductions may still be possible with looser restrictions.
+  // TODO : these special cases are fragile and could be improved.
+  // They don't handle cases where the construction is partially constant
+  // folded.  Also the usage constraints are sufficient for improvement
+  // but reductions may still be possible with looser restrictions.
 #endif
 
-    if(n_pos)
-    {
-      bvt lits(2);
-      lits[1]=neg(o);
-      
-      forall_literals(it, body)
-      {
-        lits[0]=pos(*it);
-        solver.lcnf(lits);
-      }
-    }
+  if(n_pos)
+  {
+    bvt lits(2);
+    lits[1]=neg(o);
     
-    if(n_neg)
+    forall_literals(it, body)
     {
-      bvt lits;
-      
-      forall_literals(it, body)
-        lits.push_back(neg(*it));
-
-      lits.push_back(pos(o));
+      lits[0]=pos(*it);
       solver.lcnf(lits);
     }
+  }
+  
+  if(n_neg)
+  {
+    bvt lits;
+    
+    forall_literals(it, body)
+      lits.push_back(neg(*it));
 
+    lits.push_back(pos(o));
+    solver.lcnf(lits);
   }
+
+  // these are referred to directly, and thus need their own clauses
+  forall_literals(it, body)
+    inlined[it->var_no()]=false;
 }
 
 /*******************************************************************\
@@ -738,51 +1064,65 @@ void aig_prop_solvert::convert_aig()
   while(solver.no_variables()<=aig.nodes.size())
     solver.new_variable();
 
-  // Usage count for inlining
+  compute_repr();
 
-  std::vector<unsigned> p_usage_count;
-  std::vector<unsigned> n_usage_count;
+  phase_required.resize(aig.nodes.size(), 0);
+  phase_done.resize(aig.nodes.size(), 0);
   p_usage_count.resize(aig.nodes.size(), 0);
   n_usage_count.resize(aig.nodes.size(), 0);
+  inlined.resize(aig.nodes.size(), false);
 
-  this->usage_count(p_usage_count, n_usage_count);
+  // 2. Get the phases of the new constraints and assumptions;
+  // the gates outside of their cone are never encoded
+  for(aig_plus_constraintst::constraintst::size_type
+      c=converted_constraints;
+      c<aig.constraints.size();
+      c++)
+    require(map_literal(aig.constraints[c]));
 
+  forall_literals(it, assumptions)
+    require(map_literal(*it));
 
   #ifdef USE_PG
-  // Get phases
-  std::vector<bool> n_pos, n_neg;
-  n_pos.resize(aig.nodes.size(), false);
-  n_neg.resize(aig.nodes.size(), false);
-
-  this->compute_phase(n_pos, n_neg);
+  statistics_phases();
   #endif
 
-
-  // 2. Do nodes
+  // 3. Do nodes, users before the nodes they use
   for(unsigned n = aig.nodes.size() - 1; n != 0; n--)
   {
-    if(aig.nodes[n].is_and())
-      {
+    if(!aig.nodes[n].is_and() || repr[n]!=literalt(n, false))
+      continue;
+
+    // Gates inlined into their only user need no clauses,
+    // unless they have been used elsewhere since.
+    if(inlined[n] && p_usage_count[n]+n_usage_count[n]<=1)
+      continue;
+
 #ifdef USE_PG
-        convert_node(n, aig.nodes[n], n_pos[n], n_neg[n], p_usage_count, n_usage_count);
+    unsigned char todo=phase_required[n]&~phase_done[n];
 #else
-        convert_node(n, aig.nodes[n], true, true, p_usage_count, n_usage_count);
+    unsigned char todo=phase_required[n]?
+                       (PHASE_POS|PHASE_NEG)&~phase_done[n]:0;
 #endif
-      }
+
+    if(todo!=0)
+    {
+      convert_node(n, aig.nodes[n], todo&PHASE_POS, todo&PHASE_NEG);
+      phase_done[n]|=todo;
+    }
   }
   // Skip zero as it is not used or a valid literal
 
-  
-  // 3. Do constraints
-  for(aig_plus_constraintst::constraintst::const_iterator
-      c_it=aig.constraints.begin();
-      c_it!=aig.constraints.end();
-      c_it++)
+  // 4. Do constraints
+  for(; converted_constraints<aig.constraints.size(); converted_constraints++)
+    solver.l_set_to_true(map_literal(aig.constraints[converted_constraints]));
+
+  forall_literals(it, frozen)
   {
-    solver.l_set_to(*c_it, true);
+    literalt l=map_literal(*it);
+    if(!l.is_constant())
+      solver.set_frozen(l);
   }
 
-  // HACK!
-  aig.nodes.clear();
-
+  frozen.clear();
 }
@@ -10,8 +10,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_PROPSOLVE_AIG_PROP_H
 
 #include <cassert>
+#include <vector>
 
 #include <util/threeval.h>
+#include <util/hash_cont.h>
 #include <solvers/prop/prop.h>
 
 #include "aig.h"
@@ -61,6 +63,19 @@ public:
 
 protected:
   aigt &dest;
+
+  // structural hashing: AND nodes with the same inputs are shared
+  typedef hash_map_cont<unsigned long long, unsigned> and_hasht;
+  and_hasht and_hash;
+
+  static inline unsigned long long and_key(literalt a, literalt b)
+  {
+    if(b<a) std::swap(a, b);
+    return ((unsigned long long)a.get()<<32)|b.get();
+  }
+
+  literalt new_and_node(literalt a, literalt b);
+  bool rewrite_and(literalt a, literalt b, literalt &result);
 };
 
 class aig_prop_constraintt:public aig_prop_baset
@@ -86,14 +101,18 @@ public:
   }
 };
 
+// Records the gates, and generates CNF for them when solving:
+// input variables that are set equal to another literal are
+// substituted, gates that become structurally equal are merged,
+// and only the gates in the cone of the constraints are encoded,
+// in the polarities they are used in (Plaisted-Greenbaum).
+// Further gates and constraints may be added between calls to
+// prop_solve; only the missing clauses are generated then.
+
 class aig_prop_solvert:public aig_prop_constraintt
 {
 public:
-  explicit inline aig_prop_solvert(propt &_solver):
-    aig_prop_constraintt(aig),
-    solver(_solver)
-  {
-  }
+  explicit aig_prop_solvert(propt &_solver);
   
   aig_plus_constraintst aig;
 
@@ -103,6 +122,27 @@ public:
 
   virtual tvt l_get(literalt a) const;
   virtual resultt prop_solve();
+
+  virtual void set_equal(literalt a, literalt b);
+  virtual void l_set_to(literalt a, bool value);
+
+  virtual void set_assumptions(const bvt &_assumptions)
+  {
+    assumptions=_assumptions;
+  }
+
+  virtual bool has_set_assumptions() const
+  {
+    return solver.has_set_assumptions();
+  }
+
+  virtual bool has_is_in_conflict() const
+  {
+    return solver.has_is_in_conflict();
+  }
+
+  virtual bool is_in_conflict(literalt a) const;
+  virtual void set_frozen(literalt a);
   
   virtual void set_message_handler(message_handlert &m)
   {
@@ -112,11 +152,42 @@ public:
   
 protected:
   propt &solver;
+
+  // what has been handed to the solver already
+  aigt::nodest::size_type converted_nodes;
+  aig_plus_constraintst::constraintst::size_type converted_constraints;
+  bvt assumptions, frozen;
+
+  // input variables replaced by an equivalent literal
+  std::vector<literalt> substitution;
+
+  // the literal that encodes each node
+  std::vector<literalt> repr;
+
+  inline literalt map_literal(literalt l) const
+  {
+    return l.is_constant()?l:repr[l.var_no()]^l.sign();
+  }
+
+  bool can_substitute(literalt a, literalt b) const;
+  void compute_repr();
+
+  // the polarities the nodes are needed in, and those
+  // that have been converted
+  enum { PHASE_POS=1, PHASE_NEG=2 };
+  std::vector<unsigned char> phase_required, phase_done;
+  std::vector<unsigned> p_usage_count, n_usage_count;
+  std::vector<bool> inlined;
+
+  void require(literalt l);
   
   void convert_aig();
-  void usage_count(std::vector<unsigned> &p_usage_count, std::vector<unsigned> &n_usage_count);
-  void compute_phase(std::vector<bool> &n_pos, std::vector<bool> &n_neg);
-  void convert_node(unsigned n, const aigt::nodet &node, bool n_pos, bool n_neg, std::vector<unsigned> &p_usage_count, std::vector<unsigned> &n_usage_count);
+  void convert_node(unsigned n, const aigt::nodet &node, bool n_pos, bool n_neg);
+  void statistics_phases();
+
+  // the values of the nodes in the model, evaluated on demand
+  mutable std::vector<unsigned char> values;
+  tvt evaluate(literalt l) const;
 };
 
 #endif
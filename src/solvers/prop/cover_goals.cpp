@@ -7,6 +7,7 @@ Author: Daniel Kroening, kroening@kroening.com
 \*******************************************************************/
 
 #include <util/threeval.h>
+#include <util/std_expr.h>
 
 #include "literal_expr.h"
 #include "cover_goals.h"
@@ -62,6 +63,51 @@ void cover_goalst::mark()
   
 /*******************************************************************\
 
+Function: cover_goalst::has_open
+
+  Inputs: whether to look at dominated or non-dominated goals
+
+ Outputs: true iff there is such a goal that is neither covered
+          nor known to be infeasible
+
+ Purpose:
+
+\*******************************************************************/
+
+bool cover_goalst::has_open(bool dominated) const
+{
+  for(std::list<goalt>::const_iterator
+      g_it=goals.begin();
+      g_it!=goals.end();
+      g_it++)
+    if(!g_it->covered && !g_it->infeasible &&
+       g_it->dominated==dominated)
+      return true;
+
+  return false;
+}
+
+/*******************************************************************\
+
+Function: cover_goalst::new_literal
+
+  Inputs:
+
+ Outputs: a fresh, frozen literal
+
+ Purpose:
+
+\*******************************************************************/
+
+literalt cover_goalst::new_literal()
+{
+  literalt l=prop_conv.new_variable();
+  prop_conv.set_frozen(l);
+  return l;
+}
+
+/*******************************************************************\
+
 Function: cover_goalst::constaint
 
   Inputs:
@@ -111,26 +157,21 @@ void cover_goalst::freeze_goal_variables()
 
 /*******************************************************************\
 
-Function: cover_goalst::operator()
+Function: cover_goalst::cover_with_clauses
 
   Inputs:
 
  Outputs:
 
- Purpose: Try to cover all goals
+ Purpose: Add a disjunction of the remaining goals as clause
+          in every round
 
 \*******************************************************************/
 
-void cover_goalst::operator()()
+void cover_goalst::cover_with_clauses()
 {
-  _iterations=_number_covered=0;
-  
   decision_proceduret::resultt dec_result;
   
-  // We use incremental solving, so need to freeze some variables
-  // to prevent them from being eliminated.      
-  freeze_goal_variables();
-
   do
   {
     // We want (at least) one of the remaining goals, please!
@@ -158,3 +199,148 @@ void cover_goalst::operator()()
         number_covered()<size());
 }
 
+/*******************************************************************\
+
+Function: cover_goalst::cover_with_assumptions
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Add  activation -> OR_i (goal_i & !disabled_i)  once,
+          and select the goals of each round by assumptions
+
+\*******************************************************************/
+
+void cover_goalst::cover_with_assumptions()
+{
+  exprt::operandst disjuncts;
+
+  for(std::list<goalt>::iterator
+      g_it=goals.begin();
+      g_it!=goals.end();
+      g_it++)
+  {
+    if(g_it->condition.is_false())
+    {
+      g_it->infeasible=true;
+      _number_infeasible++;
+      continue;
+    }
+
+    g_it->disabled=new_literal();
+
+    disjuncts.push_back(
+      and_exprt(literal_exprt(g_it->condition),
+                literal_exprt(!g_it->disabled)));
+  }
+
+  activation=new_literal();
+
+  prop_conv.set_to_true(
+    implies_exprt(literal_exprt(activation), disjunction(disjuncts)));
+    
+  const bool use_conflict=prop_conv.has_is_in_conflict();
+
+  while(number_covered()+number_infeasible()<size())
+  {
+    _iterations++;
+
+    // Dominated goals are only worth a call to the solver
+    // once nothing else is left.
+    bool include_dominated=!has_open(false);
+
+    // pick the batch, and switch off everything else
+    bvt assumptions;
+    assumptions.push_back(activation);
+
+    std::vector<goalt *> batch;
+
+    for(std::list<goalt>::iterator
+        g_it=goals.begin();
+        g_it!=goals.end();
+        g_it++)
+    {
+      if(g_it->infeasible) continue;
+
+      if(!g_it->covered &&
+         (include_dominated || !g_it->dominated) &&
+         (batch_size==0 || batch.size()<batch_size))
+        batch.push_back(&*g_it);
+      else
+        assumptions.push_back(g_it->disabled);
+    }
+
+    prop_conv.set_assumptions(assumptions);
+    
+    decision_proceduret::resultt dec_result=prop_conv.dec_solve();
+    
+    if(dec_result==decision_proceduret::D_SATISFIABLE)
+    {
+      // mark the goals we got, and notify observers
+      mark();
+    }
+    else if(dec_result==decision_proceduret::D_UNSATISFIABLE)
+    {
+      // None of the batch can be covered. Neither can any
+      // open goal whose switch did not take part in the conflict.
+      for(std::vector<goalt *>::const_iterator
+          b_it=batch.begin();
+          b_it!=batch.end();
+          b_it++)
+      {
+        (*b_it)->infeasible=true;
+        _number_infeasible++;
+      }
+
+      if(use_conflict)
+      {
+        for(std::list<goalt>::iterator
+            g_it=goals.begin();
+            g_it!=goals.end();
+            g_it++)
+          if(!g_it->covered && !g_it->infeasible &&
+             !prop_conv.is_in_conflict(g_it->disabled))
+          {
+            g_it->infeasible=true;
+            _number_infeasible++;
+          }
+      }
+    }
+    else
+    {
+      error() << "decision procedure has failed" << eom;
+      break;
+    }
+  }
+
+  // leave the formula as we found it
+  prop_conv.set_assumptions(bvt());
+  prop_conv.set_to_false(literal_exprt(activation));
+}
+
+/*******************************************************************\
+
+Function: cover_goalst::operator()
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Try to cover all goals
+
+\*******************************************************************/
+
+void cover_goalst::operator()()
+{
+  _iterations=_number_covered=_number_infeasible=0;
+  
+  // We use incremental solving, so need to freeze some variables
+  // to prevent them from being eliminated.      
+  freeze_goal_variables();
+
+  if(prop_conv.has_set_assumptions())
+    cover_with_assumptions();
+  else
+    cover_with_clauses();
+}
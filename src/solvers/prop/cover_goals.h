@@ -20,6 +20,15 @@ Author: Daniel Kroening, kroening@kroening.com
  Purpose: Try to cover some given set of goals incrementally.
           This can be seen as a heuristic variant of
           SAT-based set-cover. No minimality guarantee.
+          If the solver supports assumptions, the disjunction
+          of the goals is added once, and goals are switched
+          off by assumptions; the clause database thus stays
+          the same across rounds, and is left reusable once we
+          are done. Goals are aimed for in batches, and the
+          failed assumptions of an UNSAT round tell us which
+          goals outside of the batch are infeasible as well.
+          Dominated goals (those implied by some other goal)
+          are only aimed for once the others are exhausted.
 
 \*******************************************************************/
 
@@ -27,6 +36,8 @@ class cover_goalst:public messaget
 {
 public:
   explicit inline cover_goalst(prop_convt &_prop_conv):
+    batch_size(0),
+    _number_covered(0), _number_infeasible(0), _iterations(0),
     prop_conv(_prop_conv)
   {
   }
@@ -41,14 +52,25 @@ public:
   {
     literalt condition;
     bool covered;
+    bool dominated;
+
+    // shown to be impossible to cover
+    bool infeasible;
+
+    // switched off by assuming this
+    literalt disabled;
     
-    goalt():covered(false)
+    goalt():covered(false), dominated(false), infeasible(false)
     {
     }
   };
 
   typedef std::list<goalt> goalst;
   goalst goals;
+
+  // maximum number of goals aimed for in one round,
+  // zero for no limit; requires solver support for assumptions
+  unsigned batch_size;
   
   // statistics
 
@@ -57,6 +79,11 @@ public:
     return _number_covered;
   }
   
+  inline unsigned number_infeasible() const
+  {
+    return _number_infeasible;
+  }
+  
   inline unsigned iterations() const
   {
     return _iterations;
@@ -69,10 +96,11 @@ public:
   
   // managing the goals
 
-  inline void add(const literalt condition)
+  inline void add(const literalt condition, bool dominated=false)
   {
     goals.push_back(goalt());
     goals.back().condition=condition;
+    goals.back().dominated=dominated;
   }
   
   // register an observer if you want to be told
@@ -90,16 +118,22 @@ public:
   }
   
 protected:
-  unsigned _number_covered, _iterations;
+  unsigned _number_covered, _number_infeasible, _iterations;
   prop_convt &prop_conv;
 
   typedef std::vector<observert *> observerst;
   observerst observers;
 
+  literalt activation;
+
 private:
   void mark();
   void constraint();
   void freeze_goal_variables();
+  void cover_with_clauses();
+  void cover_with_assumptions();
+  literalt new_literal();
+  bool has_open(bool dominated) const;
 };
 
 #endif
@@ -121,6 +121,195 @@ literalt prop_minimizet::constraint()
 
 /*******************************************************************\
 
+Function: prop_minimizet::limit_reached
+
+  Inputs:
+
+ Outputs: true iff the time or the iteration limit has been
+          exceeded
+
+ Purpose:
+
+\*******************************************************************/
+
+bool prop_minimizet::limit_reached()
+{
+  if(iteration_limit!=0 && _iterations>=iteration_limit)
+  {
+    if(!_timed_out)
+      warning() << "minimization iteration limit reached" << eom;
+  }
+  else if(time_limit==0 ||
+          (current_time()-start_time).get_t()<time_limit)
+    return false;
+  else if(!_timed_out)
+    warning() << "minimization time limit reached" << eom;
+
+  _timed_out=true;
+  return true;
+}
+
+/*******************************************************************\
+
+Function: prop_minimizet::solve
+
+  Inputs: assumptions
+
+ Outputs:
+
+ Purpose: Run the solver once
+
+\*******************************************************************/
+
+decision_proceduret::resultt prop_minimizet::solve(
+  const bvt &assumptions)
+{
+  _iterations++;
+
+  prop_conv.set_assumptions(assumptions);
+  decision_proceduret::resultt dec_result=prop_conv.dec_solve();
+
+  last_was_SAT=(dec_result==decision_proceduret::D_SATISFIABLE);
+
+  if(dec_result!=decision_proceduret::D_SATISFIABLE &&
+     dec_result!=decision_proceduret::D_UNSATISFIABLE)
+    error() << "decision procedure failed" << eom;
+
+  return dec_result;
+}
+
+/*******************************************************************\
+
+Function: prop_minimizet::minimize_linear
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Improve on at least one of the objectives of the
+          current weight per round, until that is impossible
+
+\*******************************************************************/
+
+void prop_minimizet::minimize_linear()
+{
+  while(!limit_reached())
+  {
+    // We want to improve on one of the objectives, please!
+    literalt c=constraint();
+  
+    if(c.is_false())
+      return;
+
+    switch(solve(bvt(1, c)))
+    {
+    case decision_proceduret::D_UNSATISFIABLE:
+      return;
+
+    case decision_proceduret::D_SATISFIABLE:
+      fix_objectives(); // fix the ones we got
+      break;
+
+    default:
+      return;
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: prop_minimizet::minimize_core_guided
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Satisfy a maximal subset of the objectives of the
+          current weight, using the failed assumptions
+
+\*******************************************************************/
+
+void prop_minimizet::minimize_core_guided()
+{
+  std::vector<objectivet> &entry=current->second;
+
+  // objectives with a constant condition need no solver
+  std::vector<objectivet *> open, relaxed;
+
+  for(std::vector<objectivet>::iterator
+      o_it=entry.begin();
+      o_it!=entry.end();
+      ++o_it)
+  {
+    if(o_it->fixed || o_it->condition.is_true())
+      continue;
+    else if(o_it->condition.is_false())
+    {
+      _number_satisfied++;
+      _value+=current->first;
+      o_it->fixed=true;
+    }
+    else
+      open.push_back(&*o_it);
+  }
+
+  // assume all open objectives, relaxing one per core
+  while(!open.empty())
+  {
+    if(limit_reached()) return;
+
+    bvt assumptions;
+    assumptions.reserve(open.size());
+
+    for(std::vector<objectivet *>::const_iterator
+        o_it=open.begin();
+        o_it!=open.end();
+        o_it++)
+      assumptions.push_back(!(*o_it)->condition);
+
+    decision_proceduret::resultt dec_result=solve(assumptions);
+
+    if(dec_result==decision_proceduret::D_SATISFIABLE)
+    {
+      fix_objectives();
+      break;
+    }
+    else if(dec_result!=decision_proceduret::D_UNSATISFIABLE)
+      return;
+
+    std::vector<objectivet *>::iterator o_it=open.begin();
+
+    while(o_it!=open.end() &&
+          !prop_conv.is_in_conflict((*o_it)->condition))
+      o_it++;
+
+    // no objective in the core: we cannot improve any further
+    if(o_it==open.end())
+      return;
+
+    relaxed.push_back(*o_it);
+    open.erase(o_it);
+  }
+
+  // The objectives in a core are not necessarily unsatisfiable
+  // on their own; retry them, which makes the result maximal.
+  for(std::vector<objectivet *>::const_iterator
+      r_it=relaxed.begin();
+      r_it!=relaxed.end();
+      r_it++)
+  {
+    if((*r_it)->fixed) continue;
+
+    if(limit_reached()) return;
+
+    if(solve(bvt(1, !(*r_it)->condition))==
+       decision_proceduret::D_SATISFIABLE)
+      fix_objectives();
+  }
+}
+
+/*******************************************************************\
+
 Function: prop_minimizet::operator()
 
   Inputs:
@@ -138,61 +327,32 @@ void prop_minimizet::operator()()
 
   _iterations=_number_satisfied=0;
   _value=0;
-  bool last_was_SAT=false;
+  _timed_out=false;
+  last_was_SAT=false;
+  start_time=current_time();
+
+  const bool core_guided=prop_conv.has_is_in_conflict();
   
   // go from high weights to low ones
   for(current=objectives.rbegin();
-      current!=objectives.rend();
+      current!=objectives.rend() && !limit_reached();
       current++)
   {
     status() << "weight " << current->first << eom;
 
-    decision_proceduret::resultt dec_result;
-    do
-    {  
-      // We want to improve on one of the objectives, please!
-      literalt c=constraint();
-    
-      if(c.is_false())
-        dec_result=decision_proceduret::D_UNSATISFIABLE;
-      else
-      {
-        _iterations++;
-
-        bvt assumptions;
-        assumptions.push_back(c);
-        prop_conv.set_assumptions(assumptions);
-        dec_result=prop_conv.dec_solve();
-    
-        switch(dec_result)
-        {
-        case decision_proceduret::D_UNSATISFIABLE:
-          last_was_SAT=false;
-          break;
-
-        case decision_proceduret::D_SATISFIABLE:
-          last_was_SAT=true;
-          fix_objectives(); // fix the ones we got
-          break;
-
-        default:
-          error() << "decision procedure failed" << eom;
-          last_was_SAT=false;
-          return;
-        }
-      }
-    }
-    while(dec_result!=decision_proceduret::D_UNSATISFIABLE);
+    if(core_guided)
+      minimize_core_guided();
+    else
+      minimize_linear();
   }
   
+  bvt assumptions; // no assumptions
+  prop_conv.set_assumptions(assumptions);
+
   if(!last_was_SAT)
   {
     // We don't have a satisfying assignment to work with.
     // Run solver again to get one.
-
-    bvt assumptions; // no assumptions
-    prop_conv.set_assumptions(assumptions);
     prop_conv.dec_solve();
   }
 }
-
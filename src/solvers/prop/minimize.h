@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <map>
 
 #include <util/message.h>
+#include <util/time_stopping.h>
 
 #include "prop_conv.h"
 
@@ -22,19 +23,39 @@ Author: Daniel Kroening, kroening@kroening.com
  Purpose: Computes a satisfying assignment of minimal cost
           according to a const function using incremental SAT
 
+          Objectives are handled by decreasing weight. Within
+          one weight, if the solver reports failed assumptions,
+          we assume all remaining objectives at once and relax
+          one objective of each unsatisfiable core; the relaxed
+          ones are retried one by one at the end. Otherwise, we
+          ask for an improvement on any objective per round.
+          Satisfied objectives are fixed by unit clauses only,
+          so learnt clauses carry over between iterations.
+
 \*******************************************************************/
 
 class prop_minimizet:public messaget
 {
 public:
   explicit inline prop_minimizet(prop_convt &_prop_conv):
-    _number_objectives(0),
+    time_limit(0),
+    iteration_limit(0),
+    _iterations(0), _number_satisfied(0), _number_objectives(0),
+    _value(0),
+    _timed_out(false),
     prop_conv(_prop_conv)
   {
   }
 
   void operator()();
 
+  // in milliseconds, zero for no limit; once exceeded, we
+  // stop with the best assignment found so far
+  unsigned time_limit;
+
+  // the same for the number of solver calls
+  unsigned iteration_limit;
+
   // statistics
 
   inline unsigned number_satisfied() const
@@ -52,6 +73,11 @@ public:
     return _number_objectives;
   }
   
+  inline bool timed_out() const
+  {
+    return _timed_out;
+  }
+  
   // managing the objectives
   
   typedef long long signed int weightt;
@@ -79,10 +105,18 @@ public:
 protected:
   unsigned _iterations, _number_satisfied, _number_objectives;
   weightt _value;
+  bool _timed_out;
   prop_convt &prop_conv;
 
+  absolute_timet start_time;
+  bool last_was_SAT;
+
   literalt constraint();
   void fix_objectives();
+  decision_proceduret::resultt solve(const bvt &assumptions);
+  bool limit_reached();
+  void minimize_linear();
+  void minimize_core_guided();
   
   objectivest::reverse_iterator current;
 };
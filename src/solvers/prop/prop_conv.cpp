@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/std_expr.h>
 #include <util/symbol.h>
+#include <util/i2string.h>
 #include <util/threeval.h>
 
 #include "prop.h"
@@ -57,6 +58,78 @@ void prop_convt::set_assumptions(const bvt &)
 
 /*******************************************************************\
 
+Function: prop_convt::new_variable
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: a symbol that is unique to this solver stands for the
+          literal where there is no propositional solver to ask
+
+\*******************************************************************/
+
+literalt prop_convt::new_variable()
+{
+  symbol_exprt symbol(
+    "prop_convt::\\variable#"+i2string(variable_count++),
+    bool_typet());
+
+  return convert(symbol);
+}
+
+/*******************************************************************\
+
+Function: prop_convt::push
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: opens a context guarded by a fresh literal, throws
+          if the back-end does not support contexts
+
+\*******************************************************************/
+
+void prop_convt::push()
+{
+  // the back-ends without contexts would ignore the literal
+  if(!has_push_pop())
+    throw "decision procedure does not support push/pop";
+
+  literalt l=new_variable();
+  set_frozen(l);
+  context_literals.push_back(l);
+}
+
+/*******************************************************************\
+
+Function: prop_convt::pop
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: disables the constraints of the innermost context for good
+
+\*******************************************************************/
+
+void prop_convt::pop()
+{
+  assert(!context_literals.empty());
+
+  literalt l=context_literals.back();
+  context_literals.pop_back();
+
+  // this must hold outside of any context
+  bvt open_contexts;
+  open_contexts.swap(context_literals);
+  set_to_false(literal_exprt(l));
+  open_contexts.swap(context_literals);
+}
+
+/*******************************************************************\
+
 Function: prop_convt::set_frozen
 
   Inputs:
@@ -504,6 +577,14 @@ void prop_conv_solvert::set_to(const exprt &expr, bool value)
     msg+=expr.to_string();
     throw msg;
   }
+
+  // inside a context, the constraint needs to be retractable
+  if(!context_literals.empty())
+  {
+    literalt l=convert(expr);
+    prop.lcnf(!context_literals.back(), value?l:!l);
+    return;
+  }
   
   bool boolean=true;
 
@@ -596,6 +677,24 @@ void prop_conv_solvert::set_to(const exprt &expr, bool value)
 
 /*******************************************************************\
 
+Function: prop_conv_solvert::set_assumptions
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void prop_conv_solvert::set_assumptions(const bvt &_assumptions)
+{
+  assumptions=_assumptions;
+  prop.set_assumptions(_assumptions);
+}
+
+/*******************************************************************\
+
 Function: prop_conv_solvert::ignoring
 
   Inputs:
@@ -655,8 +754,21 @@ decision_proceduret::resultt prop_conv_solvert::dec_solve()
 
   print(7, "Solving with "+prop.solver_text());
 
+  // the constraints of the open contexts are in effect
+  if(!context_literals.empty())
+  {
+    bvt all_assumptions=assumptions;
+    all_assumptions.insert(
+      all_assumptions.end(),
+      context_literals.begin(), context_literals.end());
+    prop.set_assumptions(all_assumptions);
+  }
+
   propt::resultt result=prop.prop_solve();
 
+  if(!context_literals.empty())
+    prop.set_assumptions(assumptions);
+
   switch(result)
   {
    case propt::P_SATISFIABLE: return D_SATISFIABLE;
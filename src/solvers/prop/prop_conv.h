@@ -9,6 +9,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_PROP_CONV_H
 #define CPROVER_PROP_CONV_H
 
+#include <cassert>
 #include <string>
 #include <map>
 
@@ -29,7 +30,8 @@ class prop_convt:public decision_proceduret
 public:
   explicit prop_convt(
     const namespacet &_ns):
-    decision_proceduret(_ns) { }
+    decision_proceduret(_ns),
+    variable_count(0) { }
   virtual ~prop_convt() { }
 
   // conversion to handle
@@ -45,6 +47,9 @@ public:
   // specialised variant of get
   virtual tvt l_get(literalt a) const=0;
   
+  // a fresh literal, which no expression is converted to
+  virtual literalt new_variable();
+
   // incremental solving
   virtual void set_frozen(literalt a);
   virtual void set_frozen(const bvt &);
@@ -55,6 +60,24 @@ public:
   // returns true if an assumption is in the final conflict
   virtual bool is_in_conflict(literalt l) const;  
   virtual bool has_is_in_conflict() const { return false; }
+
+  // contexts, by means of activation literals: while a context is
+  // open, set_to(e) adds "context_literal() => e", and the solver
+  // assumes the literals of all open contexts
+  virtual void push();
+  virtual void pop();
+  virtual bool has_push_pop() const { return has_set_assumptions(); }
+
+  // for failed-assumption queries with is_in_conflict
+  literalt context_literal() const
+  {
+    assert(!context_literals.empty());
+    return context_literals.back();
+  }
+  
+protected:
+  bvt context_literals;
+  unsigned variable_count;
 };
 
 //
@@ -89,10 +112,11 @@ public:
   using prop_convt::set_frozen;
   virtual tvt l_get(literalt a) const { return prop.l_get(a); }
   virtual void set_frozen(literalt a) { prop.set_frozen(a); }
-  virtual void set_assumptions(const bvt &_assumptions) { prop.set_assumptions(_assumptions); }
+  virtual void set_assumptions(const bvt &_assumptions);
   virtual bool has_set_assumptions() const { return prop.has_set_assumptions(); }
   virtual void set_all_frozen() { freeze_all = true; }
   virtual literalt convert(const exprt &expr);
+  virtual literalt new_variable() { return prop.new_variable(); }
   virtual bool is_in_conflict(literalt l) const { return prop.is_in_conflict(l); }
   virtual bool has_is_in_conflict() const { return prop.has_is_in_conflict(); }
 
@@ -134,6 +158,9 @@ protected:
   
   virtual void ignoring(const exprt &expr);
 
+  // the assumptions, without those of the contexts
+  bvt assumptions;
+
   // deliberately protected now to protect lower-level API
   propt &prop;
 };
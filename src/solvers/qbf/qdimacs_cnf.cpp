@@ -154,11 +154,16 @@ void qdimacs_cnft::copy_to(qdimacs_cnft &cnf) const
       it++)
     cnf.add_quantifier(*it);
 
+  bvt clause;
+
   for(clausest::const_iterator
       it=clauses.begin();
       it!=clauses.end();
       it++)
-    cnf.lcnf(*it);
+  {
+    clause.assign(it->begin(), it->end());
+    cnf.lcnf(clause);
+  }
 }
 
 /*******************************************************************\
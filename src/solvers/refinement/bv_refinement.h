@@ -33,6 +33,8 @@ public:
   // enable/disable refinements
   bool do_array_refinement;
   bool do_arithmetic_refinement;
+  // start floating-point arithmetic at a low precision
+  bool do_float_approximation;
   
   using bv_pointerst::is_in_conflict;
 
@@ -60,8 +62,11 @@ protected:
 
     // the kind of under- or over-approximation    
     unsigned under_state, over_state;
+
+    // the precision of the floating-point approximation, if any
+    unsigned fraction_bits;
     
-    approximationt():under_state(0), over_state(0)
+    approximationt():under_state(0), over_state(0), fraction_bits(0)
     {
     }
     
@@ -80,6 +85,7 @@ protected:
   void check_SAT(approximationt &approximation);
   void check_UNSAT(approximationt &approximation);
   void initialize(approximationt &approximation);
+  void approximate_float_op(approximationt &approximation);
   void get_values(approximationt &approximation);
   bool is_in_conflict(approximationt &approximation);
   
@@ -30,12 +30,17 @@ bv_refinementt::bv_refinementt(
   bv_pointerst(_ns, _prop),
   max_node_refinement(5),
   do_array_refinement(true),
-  do_arithmetic_refinement(true)
+  do_arithmetic_refinement(true),
+  do_float_approximation(false)
 {
   // check features we need
   assert(prop.has_set_assumptions());
   assert(prop.has_set_to());
   assert(prop.has_is_in_conflict());
+
+  // equalities and uninterpreted functions are refined
+  lazy_equalities=true;
+  functions.lazy_functions=true;
 }
 
 /*******************************************************************\
@@ -139,6 +144,9 @@ decision_proceduret::resultt bv_refinementt::prop_solve()
 {
   // this puts the underapproximations into effect
   bvt assumptions = parent_assumptions;
+  assumptions.insert(
+    assumptions.end(),
+    context_literals.begin(), context_literals.end());
 
   for(approximationst::const_iterator
       a_it=approximations.begin();
@@ -183,6 +191,18 @@ void bv_refinementt::check_SAT()
   
   arrays_overapproximated();
 
+  if(check_equalities())
+  {
+    debug() << "BV-Refinement: transitivity of equality violated" << eom;
+    progress=true;
+  }
+
+  if(functions.check_function_constraints())
+  {
+    debug() << "BV-Refinement: functional consistency violated" << eom;
+    progress=true;
+  }
+
   for(approximationst::iterator
       a_it=approximations.begin();
       a_it!=approximations.end();
@@ -15,12 +15,14 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <langapi/language_util.h>
 
 #include <solvers/floatbv/float_utils.h>
+#include <solvers/floatbv/float_approximation.h>
 
 #include "bv_refinement.h"
 
 // Parameters
 #define MAX_INTEGER_UNDERAPPROX 3
 #define MAX_FLOAT_UNDERAPPROX 10
+#define MIN_FLOAT_FRACTION_BITS 4
 
 /*******************************************************************\
 
@@ -81,7 +83,79 @@ void bv_refinementt::convert_floatbv_op(const exprt &expr, bvt &bv)
      expr.operands().size()!=3)
     return SUB::convert_floatbv_op(expr, bv);
 
-  add_approximation(expr, bv);
+  approximationt &a=add_approximation(expr, bv);
+
+  // start with the operands cut to a few bits of fraction
+  if(do_float_approximation &&
+     (expr.id()==ID_floatbv_plus ||
+      expr.id()==ID_floatbv_minus ||
+      expr.id()==ID_floatbv_mult ||
+      expr.id()==ID_floatbv_div))
+  {
+    a.under_assumptions.clear();
+    a.fraction_bits=MIN_FLOAT_FRACTION_BITS;
+    approximate_float_op(a);
+  }
+}
+
+/*******************************************************************\
+
+Function: bv_refinementt::approximate_float_op
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: encodes the operation on the operands cut to a.fraction_bits
+          bits of fraction, under the assumption of a fresh literal;
+          once the full precision is reached, the exact operation
+
+\*******************************************************************/
+
+void bv_refinementt::approximate_float_op(approximationt &a)
+{
+  // the previous approximation is not needed any longer
+  for(unsigned i=0; i<a.under_assumptions.size(); i++)
+    prop.l_set_to_false(a.under_assumptions[i]);
+
+  a.under_assumptions.clear();
+
+  float_approximationt float_utils(prop);
+  float_utils.spec=to_floatbv_type(ns.follow(a.expr.type()));
+  float_utils.set_rounding_mode(a.op2_bv);
+
+  if(a.fraction_bits<float_utils.spec.f)
+    float_utils.fraction_bits=a.fraction_bits;
+  else
+  {
+    // full precision, for good
+    a.fraction_bits=0;
+    a.over_state=MAX_STATE;
+  }
+
+  bvt r;
+
+  if(a.expr.id()==ID_floatbv_plus)
+    r=float_utils.add(a.op0_bv, a.op1_bv);
+  else if(a.expr.id()==ID_floatbv_minus)
+    r=float_utils.sub(a.op0_bv, a.op1_bv);
+  else if(a.expr.id()==ID_floatbv_mult)
+    r=float_utils.mul(a.op0_bv, a.op1_bv);
+  else if(a.expr.id()==ID_floatbv_div)
+    r=float_utils.div(a.op0_bv, a.op1_bv);
+  else
+    assert(0);
+
+  assert(r.size()==a.result_bv.size());
+
+  if(a.fraction_bits==0)
+    bv_utils.set_equal(r, a.result_bv);
+  else
+  {
+    literalt approximation=prop.new_variable();
+    bv_utils.cond_implies_equal(approximation, r, a.result_bv);
+    a.under_assumptions.push_back(approximation);
+  }
 }
 
 /*******************************************************************\
@@ -311,7 +385,13 @@ void bv_refinementt::check_SAT(approximationt &a)
   
     //if(a.over_state==1) { debug() << "DISAGREEMENT!\n"; exit(1); }
     
-    if(a.over_state<max_node_refinement)
+    if(a.fraction_bits!=0)
+    {
+      // the precision is too low for this operation
+      a.fraction_bits*=2;
+      approximate_float_op(a);
+    }
+    else if(a.over_state<max_node_refinement)
     {
       bvt r;
       float_utilst float_utils(prop);
@@ -465,6 +545,16 @@ void bv_refinementt::check_UNSAT(approximationt &a)
 
   assert(!a.under_assumptions.empty());
 
+  if(a.fraction_bits!=0)
+  {
+    // the proof relies on the low precision of this operation
+    a.fraction_bits*=2;
+    approximate_float_op(a);
+    a.under_state++;
+    progress=true;
+    return;
+  }
+
   a.under_assumptions.clear();
 
   if(a.expr.type().id()==ID_floatbv)
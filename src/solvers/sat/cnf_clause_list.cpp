@@ -25,12 +25,10 @@ Function: cnf_clause_listt::lcnf
 
 void cnf_clause_listt::lcnf(const bvt &bv)
 {
-  bvt new_bv;
-
-  if(process_clause(bv, new_bv))
+  if(process_clause(bv, tmp))
     return;
     
-  clauses.push_back(new_bv);
+  clauses.push_back(tmp);
 }
 
 /*******************************************************************\
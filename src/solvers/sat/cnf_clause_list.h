@@ -9,7 +9,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_PROP_CNF_CLAUSE_LIST_H
 #define CPROVER_PROP_CNF_CLAUSE_LIST_H
 
-#include <list>
+#include <vector>
 
 #include <util/threeval.h>
 
@@ -36,25 +36,144 @@ public:
   virtual resultt prop_solve() { return P_ERROR; }
   
   virtual size_t no_clauses() const { return clauses.size(); }
+
+  // The clauses are kept back-to-back in a single array of
+  // literals, with the offset of each clause into it.
+  class clausest
+  {
+  public:
+    // a clause, as a range in the array of literals
+    class clauset
+    {
+    public:
+      clauset():_begin(NULL), _end(NULL)
+      {
+      }
+
+      clauset(const literalt *b, const literalt *e):_begin(b), _end(e)
+      {
+      }
+
+      const literalt *begin() const { return _begin; }
+      const literalt *end() const { return _end; }
+      size_t size() const { return _end-_begin; }
+      bool empty() const { return _begin==_end; }
+
+      const literalt &operator[](size_t i) const
+      {
+        return _begin[i];
+      }
+
+    protected:
+      const literalt *_begin, *_end;
+    };
+
+    class const_iterator
+    {
+    public:
+      const_iterator(const clausest &_clauses, size_t _index):
+        clauses(&_clauses), index(_index)
+      {
+      }
+
+      clauset operator*() const { return (*clauses)[index]; }
+
+      const clauset *operator->() const
+      {
+        current=(*clauses)[index];
+        return &current;
+      }
+
+      const_iterator &operator++() { ++index; return *this; }
+      const_iterator operator++(int)
+      {
+        const_iterator tmp=*this;
+        ++index;
+        return tmp;
+      }
+
+      bool operator==(const const_iterator &other) const
+      {
+        return index==other.index;
+      }
+
+      bool operator!=(const const_iterator &other) const
+      {
+        return index!=other.index;
+      }
+
+    protected:
+      const clausest *clauses;
+      size_t index;
+      mutable clauset current;
+    };
+
+    typedef const_iterator iterator;
+
+    clausest():offsets(1, 0)
+    {
+    }
+
+    size_t size() const { return offsets.size()-1; }
+    bool empty() const { return size()==0; }
+
+    // the total number of literals
+    size_t no_literals() const { return literals.size(); }
+
+    const_iterator begin() const { return const_iterator(*this, 0); }
+    const_iterator end() const { return const_iterator(*this, size()); }
+
+    clauset operator[](size_t i) const
+    {
+      const literalt *base=literals.empty()?NULL:&literals.front();
+      return clauset(base+offsets[i], base+offsets[i+1]);
+    }
+
+    void push_back(const bvt &clause)
+    {
+      literals.insert(literals.end(), clause.begin(), clause.end());
+      offsets.push_back(literals.size());
+    }
+
+    void clear()
+    {
+      literals.clear();
+      offsets.resize(1);
+    }
+
+    bool operator==(const clausest &other) const
+    {
+      return offsets==other.offsets && literals==other.literals;
+    }
+
+  protected:
+    std::vector<literalt> literals;
+    std::vector<size_t> offsets;
+  };
   
-  typedef std::list<bvt> clausest;
-  
-  clausest &get_clauses() { return clauses; }
+  const clausest &get_clauses() const { return clauses; }
   
+  // replays the clauses into another solver
   void copy_to(cnft &cnf) const
   {
     cnf.set_no_variables(_no_variables);
+
+    bvt clause;
+
     for(clausest::const_iterator
         it=clauses.begin();
         it!=clauses.end();
         it++)
-      cnf.lcnf(*it);
+    {
+      clause.assign(it->begin(), it->end());
+      cnf.lcnf(clause);
+    }
   }
 
-  static size_t hash_clause(const bvt &bv)
+  static size_t hash_clause(const clausest::clauset &clause)
   {
     size_t result=0;
-    for(bvt::const_iterator it=bv.begin(); it!=bv.end(); it++)
+    for(const literalt *it=clause.begin(); it!=clause.end(); it++)
       result=((result<<2)^it->get())-result;
 
     return result;
@@ -71,6 +190,7 @@ public:
   
 protected:
   clausest clauses;
+  bvt tmp;
 };
 
 // CNF given as a list of clauses
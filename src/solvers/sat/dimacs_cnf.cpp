@@ -6,9 +6,18 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
 #include "dimacs_cnf.h"
 
-#include <iostream>
+// the width of the problem line reserved by dimacs_cnf_dumpt,
+// enough for two 64-bit numbers
+#define PROBLEM_LINE_WIDTH 48
+
+// the buffer is handed to the stream once it exceeds this
+#define DIMACS_BUFFER_SIZE (1<<16)
 
 /*******************************************************************\
 
@@ -38,8 +47,101 @@ Function: dimacs_cnf_dumpt::dimacs_cnf_dumpt
 
 \*******************************************************************/
 
-dimacs_cnf_dumpt::dimacs_cnf_dumpt(std::ostream &_out):out(_out)
+dimacs_cnf_dumpt::dimacs_cnf_dumpt(
+  std::ostream &_out,
+  bool _problem_line):
+  out(_out),
+  writer(_out),
+  clause_count(0),
+  problem_line(_problem_line),
+  problem_line_pos(0)
+{
+  if(problem_line)
+  {
+    std::streampos pos=out.tellp();
+
+    if(pos==std::streampos(-1))
+      problem_line=false; // can't come back to it
+    else
+    {
+      problem_line_pos=pos;
+
+      // a comment, should finish() never be called
+      out << 'c' << std::string(PROBLEM_LINE_WIDTH-1, ' ') << '\n';
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: dimacs_writert::dimacs_writert
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+dimacs_writert::dimacs_writert(std::ostream &_out):out(_out)
+{
+  buffer.reserve(DIMACS_BUFFER_SIZE+1024);
+}
+
+/*******************************************************************\
+
+Function: dimacs_writert::flush
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void dimacs_writert::flush()
+{
+  if(buffer.empty())
+    return;
+
+  out.write(buffer.data(), buffer.size());
+  buffer.clear();
+}
+
+/*******************************************************************\
+
+Function: dimacs_writert::write_int
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: appends a number, without going through the locale
+          machinery of the stream
+
+\*******************************************************************/
+
+void dimacs_writert::write_int(int i)
 {
+  char digits[12];
+  unsigned p=sizeof(digits);
+
+  // negate as unsigned, for INT_MIN
+  unsigned u=i<0?0u-unsigned(i):unsigned(i);
+
+  do
+  {
+    digits[--p]='0'+u%10;
+    u/=10;
+  }
+  while(u!=0);
+
+  if(i<0)
+    digits[--p]='-';
+
+  buffer.append(digits+p, sizeof(digits)-p);
 }
 
 /*******************************************************************\
@@ -81,7 +183,7 @@ void dimacs_cnft::write_problem_line(std::ostream &out)
 
 /*******************************************************************\
 
-Function: write_dimacs_clause
+Function: dimacs_writert::write_clause
 
   Inputs:
 
@@ -91,9 +193,9 @@ Function: write_dimacs_clause
 
 \*******************************************************************/
 
-static void write_dimacs_clause(
-  const bvt &clause,
-  std::ostream &out,
+void dimacs_writert::write_clause(
+  const literalt *begin,
+  const literalt *end,
   bool break_lines)
 {
   // The DIMACS CNF format allows line breaks in clauses:
@@ -106,14 +208,20 @@ static void write_dimacs_clause(
   // However, the SAT competition format does not allow line
   // breaks in clauses, so we offer both options. 
 
-  for(size_t j=0; j<clause.size(); j++)
+  size_t j=0;
+
+  for(const literalt *it=begin; it!=end; it++, j++)
   {
-    out << clause[j].dimacs() << " ";
+    write_int(it->dimacs());
+    buffer+=' ';
     // newline to avoid overflow in sat checkers
-    if((j&15)==0 && j!=0 && break_lines) out << "\n";
+    if((j&15)==0 && j!=0 && break_lines) buffer+='\n';
   }
 
-  out << "0" << "\n";
+  buffer+="0\n";
+
+  if(buffer.size()>=DIMACS_BUFFER_SIZE)
+    flush();
 }
 
 /*******************************************************************\
@@ -130,9 +238,11 @@ Function: dimacs_cnft::write_clauses
 
 void dimacs_cnft::write_clauses(std::ostream &out)
 {
+  dimacs_writert writer(out);
+
   for(clausest::const_iterator it=clauses.begin();
       it!=clauses.end(); it++)
-    write_dimacs_clause(*it, out, break_lines);
+    writer.write_clause(it->begin(), it->end(), break_lines);
 }
 
 /*******************************************************************\
@@ -149,6 +259,44 @@ Function: dimacs_cnf_dumpt::lcnf
 
 void dimacs_cnf_dumpt::lcnf(const bvt &bv)
 {
-  write_dimacs_clause(bv, out, true);
+  if(process_clause(bv, tmp))
+    return;
+
+  const literalt *begin=tmp.empty()?NULL:&tmp.front();
+  writer.write_clause(begin, begin+tmp.size(), true);
+  clause_count++;
 }
 
+/*******************************************************************\
+
+Function: dimacs_cnf_dumpt::finish
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: writes any buffered clauses, and fills in the problem line
+
+\*******************************************************************/
+
+void dimacs_cnf_dumpt::finish()
+{
+  writer.flush();
+
+  if(!problem_line)
+    return;
+
+  std::streampos end=out.tellp();
+
+  // We start counting at 1, thus there is one variable fewer.
+  std::ostringstream line;
+  line << "p cnf " << (no_variables()-1) << " " << clause_count;
+
+  std::string s=line.str();
+  assert(s.size()<PROBLEM_LINE_WIDTH);
+  s.resize(PROBLEM_LINE_WIDTH, ' ');
+
+  out.seekp(problem_line_pos);
+  out << s;
+  out.seekp(end);
+}
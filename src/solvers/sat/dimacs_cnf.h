@@ -10,9 +10,33 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_DIMACS_CNF_H
 
 #include <iosfwd>
+#include <string>
 
 #include "cnf_clause_list.h"
 
+// Formats DIMACS clauses into a buffer of its own, which is
+// handed to the stream in large blocks.
+
+class dimacs_writert
+{
+public:
+  explicit dimacs_writert(std::ostream &_out);
+  ~dimacs_writert() { flush(); }
+
+  void write_clause(
+    const literalt *begin,
+    const literalt *end,
+    bool break_lines);
+
+  void flush();
+
+protected:
+  std::ostream &out;
+  std::string buffer;
+
+  void write_int(int i);
+};
+
 class dimacs_cnft:public cnf_clause_listt
 {
 public:
@@ -35,10 +59,17 @@ protected:
   bool break_lines;
 };
 
+// Writes the clauses as they are added, without keeping them.
+// The problem line needs the final counts; if asked for, a
+// placeholder is written first, and filled in by finish(),
+// which requires a seekable stream.
+
 class dimacs_cnf_dumpt:public cnft
 {
 public:
-  explicit dimacs_cnf_dumpt(std::ostream &_out);
+  explicit dimacs_cnf_dumpt(
+    std::ostream &_out,
+    bool _problem_line=false);
   virtual ~dimacs_cnf_dumpt() { }
  
   virtual const std::string solver_text()
@@ -60,11 +91,20 @@ public:
   
   virtual size_t no_clauses() const
   {
-    return 0;
+    return clause_count;
   }
 
+  void finish();
+
+  std::ostream &get_out() { return out; }
+
 protected:
   std::ostream &out;
+  dimacs_writert writer;
+  size_t clause_count;
+  bool problem_line;
+  std::streamoff problem_line_pos;
+  bvt tmp;
 };
 
 #endif
@@ -21,3 +21,9 @@ Author: Daniel Kroening, kroening@kroening.com
 #error "I expected to have MiniSat 2"
 #endif
 #endif
+
+#ifdef SATCHECK_CADICAL
+#ifndef HAVE_CADICAL
+#error "I expected to have CaDiCaL"
+#endif
+#endif
@@ -19,6 +19,7 @@ Author: Daniel Kroening, kroening@kroening.com
 //#define SATCHECK_PRECOSAT
 //#define SATCHECK_PICOSAT
 //#define SATCHECK_LINGELING
+//#define SATCHECK_CADICAL
 
 #if defined SATCHECK_ZCHAFF
 
@@ -69,6 +70,13 @@ typedef satcheck_picosatt satcheck_no_simplifiert;
 typedef satcheck_lingelingt satcheckt;
 typedef satcheck_lingelingt satcheck_no_simplifiert;
 
+#elif defined SATCHECK_CADICAL
+
+#include "satcheck_cadical.h"
+
+typedef satcheck_cadicalt satcheckt;
+typedef satcheck_cadicalt satcheck_no_simplifiert;
+
 #elif defined SATCHECK_GLUCOSE
 
 #include "satcheck_glucose.h"
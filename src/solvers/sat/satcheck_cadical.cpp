@@ -0,0 +1,298 @@
+/*******************************************************************\
+
+Module:
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+
+#include <util/i2string.h>
+#include <util/threeval.h>
+
+#include "satcheck_cadical.h"
+
+#include <cadical.hpp>
+
+#ifndef HAVE_CADICAL
+#error "Expected HAVE_CADICAL"
+#endif
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::satcheck_cadicalt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+satcheck_cadicalt::satcheck_cadicalt():
+  solver(new CaDiCaL::Solver)
+{
+  solver->set("quiet", 1);
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::~satcheck_cadicalt
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+satcheck_cadicalt::~satcheck_cadicalt()
+{
+  delete solver;
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::solver_text
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+const std::string satcheck_cadicalt::solver_text()
+{
+  return std::string("CaDiCaL ")+CaDiCaL::Solver::version();
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::l_get
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+tvt satcheck_cadicalt::l_get(literalt a) const
+{
+  if(a.is_constant())
+    return tvt(a.sign());
+
+  // the model is gone once clauses have been added
+  if(status!=SAT)
+    return tvt(tvt::tv_enumt::TV_UNKNOWN);
+
+  if(int(a.var_no())>solver->vars())
+    return tvt(tvt::tv_enumt::TV_UNKNOWN);
+
+  const int val=solver->val(a.dimacs());
+
+  if(val>0)
+    return tvt(true);
+  else if(val<0)
+    return tvt(false);
+  else
+    return tvt(tvt::tv_enumt::TV_UNKNOWN);
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::lcnf
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_cadicalt::lcnf(const bvt &bv)
+{
+  if(process_clause(bv, tmp))
+    return;
+
+  forall_literals(it, tmp)
+    solver->add(it->dimacs());
+
+  solver->add(0);
+
+  clause_counter++;
+
+  if(status==SAT || status==UNSAT)
+    status=INIT;
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::prop_solve
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+propt::resultt satcheck_cadicalt::prop_solve()
+{
+  assert(status!=ERROR);
+
+  // We start counting at 1, thus there is one variable fewer.
+  {
+    std::string msg=
+      i2string(no_variables()-1)+" variables, "+
+      i2string(clause_counter)+" clauses";
+    messaget::status() << msg << messaget::eom;
+  }
+  
+  std::string msg;
+
+  // assumptions only last for one call
+  forall_literals(it, assumptions)
+    solver->assume(it->dimacs());
+
+  const int res=solver->solve();
+
+  if(res==10)
+  {
+    msg="SAT checker: instance is SATISFIABLE";
+    messaget::status() << msg << messaget::eom;
+    status=SAT;
+    return P_SATISFIABLE;
+  }
+  else if(res==20)
+  {
+    msg="SAT checker: instance is UNSATISFIABLE";
+    messaget::status() << msg << messaget::eom;
+    status=UNSAT;
+    return P_UNSATISFIABLE;
+  }
+
+  msg="SAT checker: solving interrupted";
+  messaget::error() << msg << messaget::eom;
+  status=ERROR;
+  return P_ERROR;
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::set_assignment
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_cadicalt::set_assignment(literalt a, bool value)
+{
+  assert(false);
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::set_assumptions
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_cadicalt::set_assumptions(const bvt &bv)
+{
+  assumptions=bv;
+
+  forall_literals(it, assumptions)
+    assert(!it->is_constant());
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::set_frozen
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: keeps the variable from being eliminated by inprocessing
+
+\*******************************************************************/
+
+void satcheck_cadicalt::set_frozen(literalt a)
+{
+  if(!a.is_constant() && !solver->frozen(a.var_no()))
+    solver->freeze(a.var_no());
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::set_melted
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void satcheck_cadicalt::set_melted(literalt a)
+{
+  if(!a.is_constant() && solver->frozen(a.var_no()))
+    solver->melt(a.var_no());
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::is_in_conflict
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Returns true if an assumed literal is in conflict if the
+ formula is UNSAT.
+
+\*******************************************************************/
+
+bool satcheck_cadicalt::is_in_conflict(literalt a) const
+{
+  assert(!a.is_constant());
+  assert(status==UNSAT);
+  return solver->failed(a.dimacs());
+}
+
+/*******************************************************************\
+
+Function: satcheck_cadicalt::write_proof
+
+  Inputs: name of the proof file
+
+ Outputs: true on error
+
+ Purpose:
+
+\*******************************************************************/
+
+bool satcheck_cadicalt::write_proof(const std::string &filename)
+{
+  assert(clause_counter==0);
+  return !solver->trace_proof(filename.c_str());
+}
@@ -0,0 +1,51 @@
+/*******************************************************************\
+
+Module:
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_SATCHECK_CADICAL_H
+#define CPROVER_SATCHECK_CADICAL_H
+
+#include "cnf.h"
+
+namespace CaDiCaL
+{
+  class Solver;
+}
+
+class satcheck_cadicalt:public cnf_solvert
+{
+public:
+  satcheck_cadicalt();
+  virtual ~satcheck_cadicalt();
+
+  virtual const std::string solver_text();
+  virtual resultt prop_solve();
+  virtual tvt l_get(literalt a) const;
+
+  virtual void lcnf(const bvt &bv);
+  virtual void set_assignment(literalt a, bool value);
+
+  virtual void set_assumptions(const bvt &_assumptions);
+  virtual bool has_set_assumptions() const { return true; }
+  virtual bool has_is_in_conflict() const { return true; }
+  virtual bool is_in_conflict(literalt a) const;
+  virtual void set_frozen(literalt a);
+
+  // allows a frozen variable to be eliminated again
+  void set_melted(literalt a);
+
+  // writes a DRAT proof to the given file;
+  // must be called before any clause is added
+  bool write_proof(const std::string &filename);
+
+protected:
+  CaDiCaL::Solver *solver;
+  bvt assumptions;
+  bvt tmp;
+};
+
+#endif
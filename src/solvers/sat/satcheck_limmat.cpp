@@ -119,7 +119,7 @@ Function: satcheck_limmatt::copy_cnf
 
 void satcheck_limmatt::copy_cnf()
 {
-  for(clausest::iterator it=clauses.begin();
+  for(clausest::const_iterator it=clauses.begin();
       it!=clauses.end();
       it++)
       //it=clauses.erase(it))
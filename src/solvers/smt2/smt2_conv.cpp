@@ -141,15 +141,31 @@ void smt2_convt::write_footer(std::ostream &out)
 {
   out << "\n";
   
-  // add the assumptions, if any
-  if(!assumptions.empty())
+  // add the assumptions, if any, and those of the open contexts;
+  // these go to the given stream, not into the formula
+  bvt all_assumptions=assumptions;
+  all_assumptions.insert(
+    all_assumptions.end(),
+    context_literals.begin(), context_literals.end());
+
+  if(!all_assumptions.empty())
   {
     out << "; assumptions\n";
 
-    forall_literals(it, assumptions)
+    forall_literals(it, all_assumptions)
     {
+      if(it->is_true())
+        continue;
+
       out << "(assert ";
-      convert_literal(*it);
+
+      if(it->is_false())
+        out << "false";
+      else if(it->sign())
+        out << "(not |B" << it->var_no() << "|)";
+      else
+        out << "|B" << it->var_no() << "|";
+
       out << ")" << "\n";
     }
   }
@@ -860,6 +876,7 @@ literalt smt2_convt::convert(const exprt &expr)
 
   out << "\n";
 
+  define_shared_terms(expr);
   find_symbols(expr);
   
   literalt l(no_boolean_variables, false);
@@ -1073,6 +1090,19 @@ Function: smt2_convt::convert_expr
 
 void smt2_convt::convert_expr(const exprt &expr)
 {
+  // shared sub-terms are referred to by name,
+  // unless we are underneath a binder
+  if(binder_depth==0 && !shared_terms.empty())
+  {
+    shared_termst::const_iterator s_it=shared_terms.find(&expr.read());
+
+    if(s_it!=shared_terms.end() && s_it->second.name!=irep_idt())
+    {
+      out << '|' << s_it->second.name << '|';
+      return;
+    }
+  }
+
   // huge monster case split over expression id
   if(expr.id()==ID_symbol)
   {
@@ -1952,7 +1982,9 @@ void smt2_convt::convert_expr(const exprt &expr)
     convert_type(bound.type());
     out << ")) ";
 
+    binder_depth++;
     convert_expr(expr.op1());
+    binder_depth--;
 
     out << ")";
   }
@@ -1999,7 +2031,9 @@ void smt2_convt::convert_expr(const exprt &expr)
     out << ' ';
     convert_expr(let_expr.value());
     out << ")) ";
+    binder_depth++;
     convert_expr(let_expr.where());
+    binder_depth--;
     out << ')'; // let
   }
   else if(expr.id()==ID_constraint_select_one)
@@ -4478,6 +4512,30 @@ void smt2_convt::set_to(const exprt &expr, bool value)
   out << "\n";
 
   assert(expr.type().id()==ID_bool);
+
+  // inside a context, the constraint needs to be retractable
+  if(!context_literals.empty())
+  {
+    define_shared_terms(expr);
+    find_symbols(expr);
+
+    out << "; set_to " << (value?"true":"false") << " in context\n"
+        << "(assert (=> ";
+    convert_literal(context_literals.back());
+    out << " ";
+
+    if(!value)
+    {
+      out << "(not ";
+      convert_expr(expr);
+      out << ")";
+    }
+    else
+      convert_expr(expr);
+
+    out << "))" << "\n";
+    return;
+  }
   
   // special treatment for "set_to(a=b, true)" where
   // a is a new symbol
@@ -4498,6 +4556,7 @@ void smt2_convt::set_to(const exprt &expr, bool value)
 
         id.type=equal_expr.lhs().type();
         find_symbols(id.type);
+        define_shared_terms(equal_expr.rhs());
         find_symbols(equal_expr.rhs());
 
         std::string smt2_identifier=convert_identifier(identifier);
@@ -4516,6 +4575,7 @@ void smt2_convt::set_to(const exprt &expr, bool value)
     }
   }
 
+  define_shared_terms(expr);
   find_symbols(expr);
 
   #if 0
@@ -4554,6 +4614,16 @@ Function: smt2_convt::find_symbols
 
 void smt2_convt::find_symbols(const exprt &expr)
 {
+  // the symbols in a term that has been defined
+  // have been declared already
+  if(!shared_terms.empty())
+  {
+    shared_termst::const_iterator s_it=shared_terms.find(&expr.read());
+
+    if(s_it!=shared_terms.end() && s_it->second.name!=irep_idt())
+      return;
+  }
+
   // recursive call on type
   find_symbols(expr.type());
 
@@ -5289,3 +5359,148 @@ exprt smt2_convt::substitute_let(
 
   return expr;
 }
+
+/*******************************************************************\
+
+Function: smt2_convt::is_shareable
+
+  Inputs:
+
+ Outputs: true if the term may be given a name using define-fun
+
+ Purpose:
+
+\*******************************************************************/
+
+bool smt2_convt::is_shareable(const exprt &expr) const
+{
+  // leaves are cheaper to print than to name
+  if(!expr.has_operands() ||
+     expr.id()==ID_constant)
+    return false;
+
+  // we only name terms of scalar sorts, which
+  // convert_expr handles in any position
+  const typet &type=expr.type();
+
+  return type.id()==ID_bool ||
+         type.id()==ID_signedbv ||
+         type.id()==ID_unsignedbv ||
+         type.id()==ID_bv ||
+         type.id()==ID_c_bool ||
+         type.id()==ID_fixedbv ||
+         type.id()==ID_floatbv ||
+         type.id()==ID_pointer;
+}
+
+/*******************************************************************\
+
+Function: smt2_convt::collect_shared_terms
+
+  Inputs:
+
+ Outputs: the shareable sub-terms, in post-order
+
+ Purpose: counts the occurrences of the sub-terms of an expression
+
+\*******************************************************************/
+
+void smt2_convt::collect_shared_terms(
+  const exprt &expr,
+  term_countst &counts,
+  std::vector<const exprt *> &order)
+{
+  // don't look underneath binders, or at objects
+  if(expr.id()==ID_forall ||
+     expr.id()==ID_exists ||
+     expr.id()==ID_let ||
+     expr.id()==ID_address_of ||
+     expr.id()==ID_constant)
+    return;
+
+  if(!is_shareable(expr))
+  {
+    forall_operands(it, expr)
+      collect_shared_terms(*it, counts, order);
+    return;
+  }
+
+  const irept::dt *key=&expr.read();
+
+  shared_termst::const_iterator s_it=shared_terms.find(key);
+
+  if(s_it!=shared_terms.end())
+  {
+    // Defined already, or seen in an earlier query, in which
+    // case its sub-terms have been counted back then.
+    if(s_it->second.name==irep_idt() && counts[key]++==0)
+      order.push_back(&expr);
+
+    return;
+  }
+
+  // seen before in this query?
+  if(counts[key]++!=0)
+    return;
+
+  forall_operands(it, expr)
+    collect_shared_terms(*it, counts, order);
+
+  order.push_back(&expr);
+}
+
+/*******************************************************************\
+
+Function: smt2_convt::define_shared_terms
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: emits a define-fun for any sub-term of the given
+          expression that has been seen before
+
+\*******************************************************************/
+
+void smt2_convt::define_shared_terms(const exprt &expr)
+{
+  term_countst counts;
+  std::vector<const exprt *> order;
+
+  collect_shared_terms(expr, counts, order);
+
+  for(std::vector<const exprt *>::const_iterator
+      it=order.begin();
+      it!=order.end();
+      it++)
+  {
+    const exprt &term=**it;
+    const irept::dt *key=&term.read();
+
+    std::pair<shared_termst::iterator, bool> entry=
+      shared_terms.insert(std::make_pair(key, shared_termt()));
+
+    shared_termt &shared_term=entry.first->second;
+
+    if(entry.second)
+      shared_term.expr=term;
+
+    // only used once so far?
+    if(entry.second && counts[key]<2)
+      continue;
+
+    // this stops at the terms that have a name
+    find_symbols(term);
+
+    irep_idt name="T"+i2string(no_shared_terms++);
+
+    out << "(define-fun |" << name << "| () ";
+    convert_type(term.type());
+    out << " ";
+    convert_expr(term);
+    out << ")" << "\n";
+
+    // from now on, use the name
+    shared_term.name=name;
+  }
+}
@@ -49,6 +49,8 @@ public:
     solver(_solver),
     boolbv_width(_ns),
     let_id_count(0),
+    no_shared_terms(0),
+    binder_depth(0),
     pointer_logic(_ns),
     no_boolean_variables(0)
   {
@@ -205,6 +207,32 @@ protected:
     exprt &expr,
     const seen_expressionst &map);
 
+  // Term sharing. Sub-terms are identified by their irep, i.e.,
+  // we share what is shared in memory, which is what symex
+  // produces; hashing structurally would walk the whole tree.
+  // A term seen a second time, in the same or in a later query,
+  // is given a name using define-fun, which is then used by
+  // all subsequent queries.
+  struct shared_termt
+  {
+    exprt expr; // keeps the irep alive
+    irep_idt name;
+  };
+
+  typedef hash_map_cont<const irept::dt *, shared_termt> shared_termst;
+  shared_termst shared_terms;
+  unsigned no_shared_terms;
+  unsigned binder_depth;
+
+  typedef hash_map_cont<const irept::dt *, unsigned> term_countst;
+
+  bool is_shareable(const exprt &) const;
+  void define_shared_terms(const exprt &);
+  void collect_shared_terms(
+    const exprt &,
+    term_countst &,
+    std::vector<const exprt *> &order);
+
   // Parsing solver responses  
   constant_exprt parse_literal(const irept &, const typet &type);
   exprt parse_struct(const irept &s, const struct_typet &type);
@@ -117,8 +117,11 @@ decision_proceduret::resultt smt2_dect::dec_solve()
   // we write the problem into a file
   smt2_temp_filet smt2_temp_file;
   
-  // copy from string buffer into file
-  smt2_temp_file.temp_out << stringstream.str();
+  // copy from string buffer into file, without
+  // making a copy of the buffer; the header ensures
+  // that there is something to copy
+  stringstream.seekg(0);
+  smt2_temp_file.temp_out << stringstream.rdbuf();
 
   // this finishes up and closes the SMT2 file
   write_footer(smt2_temp_file.temp_out);
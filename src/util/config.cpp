@@ -968,6 +968,8 @@ bool configt::set(const cmdlinet &cmdline)
       set_classpath("."); // default
   }
 
+  java.lazy_methods=cmdline.isset("lazy-methods");
+
   if(cmdline.isset("include"))
     ansi_c.include_files=cmdline.get_values("include");
 
@@ -138,6 +138,13 @@ public:
   struct javat
   {
     std::list<std::string> class_path;
+
+    // only convert the methods reachable from the entry point
+    bool lazy_methods;
+
+    javat():lazy_methods(false)
+    {
+    }
   } java;
 
   // this is the function to start executing
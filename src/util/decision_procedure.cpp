@@ -27,3 +27,37 @@ bool decision_proceduret::in_core(const exprt &expr)
   assert(false);
   return true;
 }
+
+/*******************************************************************\
+
+Function: decision_proceduret::push
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: opens a context
+
+\*******************************************************************/
+
+void decision_proceduret::push()
+{
+  throw decision_procedure_text()+" does not support push/pop";
+}
+
+/*******************************************************************\
+
+Function: decision_proceduret::pop
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: retracts the constraints of the innermost context
+
+\*******************************************************************/
+
+void decision_proceduret::pop()
+{
+  throw decision_procedure_text()+" does not support push/pop";
+}
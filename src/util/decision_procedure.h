@@ -49,6 +49,12 @@ public:
     return dec_solve();
   }
 
+  // incremental solving: the constraints added after push()
+  // are retracted by the matching pop()
+  virtual void push();
+  virtual void pop();
+  virtual bool has_push_pop() const { return false; }
+
   // old-style, will go away  
   virtual bool in_core(const exprt &expr);
   
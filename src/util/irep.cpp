@@ -156,8 +156,9 @@ void irept::remove_ref(dt *old_data)
   std::cout << "R: " << old_data << " " << old_data->ref_count << std::endl;
   #endif
   
-  old_data->ref_count--;
-  if(old_data->ref_count==0)
+  // decrement and test must be one step if
+  // the reference count is atomic
+  if(--old_data->ref_count==0)
   {
     #ifdef IREP_DEBUG
     std::cout << "D: " << pretty() << std::endl;
@@ -203,9 +204,8 @@ void irept::nonrecursive_destructor(dt *old_data)
     if(d==&empty_d) continue;
     
     assert(d->ref_count!=0);
-    d->ref_count--;
 
-    if(d->ref_count==0)
+    if(--d->ref_count==0)
     {
       stack.reserve(stack.size()+
                     d->named_sub.size()+
@@ -26,6 +26,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <map>
 #endif
 
+#ifdef SHARING
+#include "ref_count.h"
+#endif
+
 #ifdef USE_DSTRING
 #include "dstring.h"
 #endif
@@ -266,7 +270,7 @@ public:
     friend class irept;
 
     #ifdef SHARING
-    unsigned ref_count;
+    ref_countt ref_count;
     #endif
 
     #ifdef USE_DSTRING
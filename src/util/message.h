@@ -13,6 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <string>
 #include <iosfwd>
 #include <sstream>
+#include <vector>
 
 #include "source_location.h"
 
@@ -72,6 +73,28 @@ protected:
   std::ostream &out;
 };
 
+// keeps the messages of a thread of its own, to be
+// printed once the thread is done
+class buffered_message_handlert:public message_handlert
+{
+public:
+  virtual void print(unsigned level, const std::string &message)
+  {
+    messages.push_back(std::pair<unsigned, std::string>(level, message));
+  }
+
+  void flush(message_handlert &dest)
+  {
+    for(std::size_t i=0; i<messages.size(); i++)
+      dest.print(messages[i].first, messages[i].second);
+
+    messages.clear();
+  }
+
+protected:
+  std::vector<std::pair<unsigned, std::string> > messages;
+};
+
 class message_clientt
 {
 public:
@@ -0,0 +1,95 @@
+/*******************************************************************\
+
+Module: Reference Counters
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#ifndef CPROVER_REF_COUNT_H
+#define CPROVER_REF_COUNT_H
+
+// Define CPROVER_THREAD_SAFE (e.g., via CXXFLAGS) to share
+// ireps and identifiers between threads. Reference counts are
+// then maintained atomically, which costs some performance in
+// single-threaded use.
+
+#ifdef CPROVER_THREAD_SAFE
+
+#include <atomic>
+
+/*******************************************************************\
+
+   Class: ref_countt
+
+ Purpose: A reference counter that can be updated concurrently.
+          A copy of the counter is a new counter with the same
+          value; it does not share the original's state.
+
+\*******************************************************************/
+
+class ref_countt
+{
+public:
+  inline ref_countt(unsigned _value=0):value(_value)
+  {
+  }
+
+  inline ref_countt(const ref_countt &other):
+    value(other.value.load(std::memory_order_relaxed))
+  {
+  }
+
+  inline ref_countt &operator=(const ref_countt &other)
+  {
+    value.store(other.value.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+    return *this;
+  }
+
+  inline ref_countt &operator=(unsigned _value)
+  {
+    value.store(_value, std::memory_order_relaxed);
+    return *this;
+  }
+
+  inline operator unsigned() const
+  {
+    return value.load(std::memory_order_acquire);
+  }
+
+  // Taking a new reference needs no ordering:
+  // the caller holds one already.
+  inline unsigned operator++()
+  {
+    return value.fetch_add(1, std::memory_order_relaxed)+1;
+  }
+
+  inline unsigned operator++(int)
+  {
+    return value.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Dropping one must make all writes to the object visible to
+  // the thread that ends up deleting it.
+  inline unsigned operator--()
+  {
+    return value.fetch_sub(1, std::memory_order_acq_rel)-1;
+  }
+
+  inline unsigned operator--(int)
+  {
+    return value.fetch_sub(1, std::memory_order_acq_rel);
+  }
+
+protected:
+  std::atomic<unsigned> value;
+};
+
+#else
+
+typedef unsigned ref_countt;
+
+#endif
+
+#endif
@@ -11,6 +11,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <cassert>
 
+#include "ref_count.h"
+
 template<typename T>
 class reference_counting
 {
@@ -76,7 +78,7 @@ protected:
   class dt:public T
   {
   public:
-    unsigned ref_count;
+    ref_countt ref_count;
 
     dt():ref_count(1)
     {
@@ -120,8 +122,7 @@ void reference_counting<T>::remove_ref(dt *old_d)
   std::cout << "R: " << old_d << " " << old_d->ref_count << std::endl;
   #endif
   
-  old_d->ref_count--;
-  if(old_d->ref_count==0)
+  if(--old_d->ref_count==0)
   {
     #ifdef REFERENCE_COUNTING_DEBUG
     std::cout << "DELETING " << old_d << std::endl;
@@ -62,7 +62,15 @@ Function: string_containert::string_containert
 void initialize_string_container();
 
 string_containert::string_containert()
+  #ifdef CPROVER_THREAD_SAFE
+  :next_no(0), blocks(max_blocks)
+  #endif
 {
+  #ifdef CPROVER_THREAD_SAFE
+  for(std::size_t i=0; i<blocks.size(); i++)
+    blocks[i].store(NULL, std::memory_order_relaxed);
+  #endif
+
   // pre-allocate empty string -- this gets index 0
   get("");
 
@@ -84,8 +92,126 @@ Function: string_containert::~string_containert
 
 string_containert::~string_containert()
 {
+  #ifdef CPROVER_THREAD_SAFE
+  for(std::size_t i=0; i<blocks.size(); i++)
+    delete[] blocks[i].load(std::memory_order_relaxed);
+  #endif
+}
+
+#ifdef CPROVER_THREAD_SAFE
+
+/*******************************************************************\
+
+Function: string_containert::set_entry
+
+  Inputs: a new number and its string
+
+ Outputs:
+
+ Purpose: Make a string available by number
+
+\*******************************************************************/
+
+void string_containert::set_entry(unsigned no, const std::string *s)
+{
+  std::size_t b=no>>block_bits;
+
+  if(b>=blocks.size())
+    throw "string container is full";
+
+  blockt block=blocks[b].load(std::memory_order_acquire);
+
+  if(block==NULL)
+  {
+    std::lock_guard<std::mutex> lock(blocks_mutex);
+
+    block=blocks[b].load(std::memory_order_relaxed);
+
+    if(block==NULL)
+    {
+      block=new const std::string *[block_size];
+      blocks[b].store(block, std::memory_order_release);
+    }
+  }
+
+  block[no&(block_size-1)]=s;
+}
+
+/*******************************************************************\
+
+Function: string_containert::get
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+unsigned string_containert::get(const string_ptrt &string_ptr)
+{
+  shardt &shard=shards[string_ptr_hash()(string_ptr)%shard_count];
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  hash_tablet::iterator it=shard.hash_table.find(string_ptr);
+  
+  if(it!=shard.hash_table.end())
+    return it->second;
+
+  unsigned r=next_no++;
+
+  // these are stable
+  shard.string_list.push_back(std::string(string_ptr.s, string_ptr.len));
+  string_ptrt result(shard.string_list.back());
+
+  // Publish the entry before the number can be found via the
+  // table; whoever gets the number from another thread has
+  // synchronized with us.
+  set_entry(r, &shard.string_list.back());
+
+  shard.hash_table[result]=r;
+
+  return r;
+}
+
+/*******************************************************************\
+
+Function: string_containert::get
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+unsigned string_containert::get(const char *s)
+{
+  return get(string_ptrt(s));
+}
+
+/*******************************************************************\
+
+Function: string_containert::get
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+unsigned string_containert::get(const std::string &s)
+{
+  return get(string_ptrt(s));
 }
 
+#else
+
 /*******************************************************************\
 
 Function: string_containert::get
@@ -155,3 +281,5 @@ unsigned string_containert::get(const std::string &s)
 
   return r;
 }
+
+#endif
@@ -12,6 +12,11 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <list>
 #include <vector>
 
+#ifdef CPROVER_THREAD_SAFE
+#include <atomic>
+#include <mutex>
+#endif
+
 #include "hash_cont.h"
 #include "string_hash.h"
 
@@ -62,28 +67,64 @@ public:
   // the pointer is guaranteed to be stable  
   inline const char *c_str(size_t no) const
   {
-    return string_vector[no]->c_str();
+    return get_string(no).c_str();
   }
   
   // the reference is guaranteed to be stable
   inline const std::string &get_string(size_t no) const
   {
+    #ifdef CPROVER_THREAD_SAFE
+    return *blocks[no>>block_bits].load(std::memory_order_acquire)
+                  [no&(block_size-1)];
+    #else
     return *string_vector[no];
+    #endif
   }
   
 protected:
   // the 'unsigned' ought to be size_t
   typedef hash_map_cont<string_ptrt, unsigned, string_ptr_hash> hash_tablet;
-  hash_tablet hash_table;
   
   unsigned get(const char *s);
   unsigned get(const std::string &s);
   
   typedef std::list<std::string> string_listt;
+
+  #ifdef CPROVER_THREAD_SAFE
+  // The table is split into shards by hash value, each with
+  // its own lock. Numbers come from a single counter, and map
+  // to strings via blocks that are never moved, so that looking
+  // up a string by number needs no lock.
+  
+  enum { shard_count=61, block_bits=12, block_size=1<<block_bits,
+         max_blocks=1<<16 };
+
+  struct shardt
+  {
+    std::mutex mutex;
+    hash_tablet hash_table;
+    string_listt string_list;
+  };
+  
+  shardt shards[shard_count];
+
+  std::atomic<unsigned> next_no;
+
+  // each block holds block_size entries
+  typedef const std::string **blockt;
+  std::vector<std::atomic<blockt> > blocks;
+  std::mutex blocks_mutex;
+
+  unsigned get(const string_ptrt &string_ptr);
+  void set_entry(unsigned no, const std::string *s);
+
+  #else
+  hash_tablet hash_table;
   string_listt string_list;
   
   typedef std::vector<std::string *> string_vectort;
   string_vectort string_vector;
+  #endif
 };
 
 // an ugly global object
@@ -0,0 +1,254 @@
+/*******************************************************************\
+
+Module: Test for the AIG simplification in front of a SAT solver
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <solvers/sat/satcheck.h>
+#include <solvers/prop/aig_prop.h>
+
+// the truth table of a literal over all assignments to the inputs
+#define INPUTS 6
+typedef unsigned long long tablet;
+const tablet all_assignments=~0ull;
+
+class networkt
+{
+public:
+  explicit networkt(aig_prop_solvert &_prop):prop(_prop)
+  {
+    literals.push_back(const_literal(true));
+    tables.push_back(all_assignments);
+  }
+
+  aig_prop_solvert &prop;
+
+  // the inputs, the gates, and their truth tables
+  bvt inputs, literals;
+  std::vector<tablet> tables;
+
+  void add_input(unsigned i)
+  {
+    // the assignments with bit i set
+    tablet table=0;
+    for(unsigned k=0; k<(1u<<INPUTS); k++)
+      if(k&(1u<<i))
+        table|=1ull<<k;
+
+    inputs.push_back(prop.new_variable());
+    add(inputs.back(), table);
+  }
+
+  void add(literalt l, tablet table)
+  {
+    literals.push_back(l);
+    tables.push_back(table);
+  }
+
+  unsigned pick() const
+  {
+    return rand()%literals.size();
+  }
+
+  literalt literal(unsigned i, bool sign) const
+  {
+    return literals[i]^sign;
+  }
+
+  tablet table(unsigned i, bool sign) const
+  {
+    return sign?~tables[i]:tables[i];
+  }
+
+  void add_gate();
+};
+
+/*******************************************************************\
+
+Function: networkt::add_gate
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: adds a random gate on the literals so far
+
+\*******************************************************************/
+
+void networkt::add_gate()
+{
+  unsigned a=pick(), b=pick(), c=pick();
+  bool sa=rand()%2, sb=rand()%2, sc=rand()%2;
+  literalt la=literal(a, sa), lb=literal(b, sb), lc=literal(c, sc);
+  tablet ta=table(a, sa), tb=table(b, sb), tc=table(c, sc);
+
+  switch(rand()%7)
+  {
+  case 0: add(prop.land(la, lb), ta&tb); break;
+  case 1: add(prop.lor(la, lb), ta|tb); break;
+  case 2: add(prop.lxor(la, lb), ta^tb); break;
+  case 3: add(prop.lequal(la, lb), ~(ta^tb)); break;
+  case 4: add(prop.limplies(la, lb), ~ta|tb); break;
+  case 5: add(prop.lselect(la, lb, lc), (ta&tb)|(~ta&tc)); break;
+  default:
+    {
+      bvt bv;
+      bv.push_back(la);
+      bv.push_back(lb);
+      bv.push_back(lc);
+      add(prop.land(bv), ta&tb&tc);
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: check_network
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: grows a random network, and adds constraints and
+          assumptions to it; after each step, the solver's verdict
+          is compared with an enumeration of the input assignments,
+          and the model with the truth tables
+
+\*******************************************************************/
+
+void check_network(unsigned &sat, unsigned &unsat)
+{
+  satcheckt satcheck;
+  aig_prop_solvert prop(satcheck);
+  networkt network(prop);
+
+  tablet constraints=all_assignments;
+
+  // some of the inputs are created between calls to the solver
+  unsigned next_input=0;
+  while(next_input<INPUTS/2)
+    network.add_input(next_input++);
+
+  for(unsigned step=0; step<10; step++)
+  {
+    if(next_input<INPUTS && rand()%2)
+      network.add_input(next_input++);
+
+    for(unsigned i=rand()%8; i!=0; i--)
+      network.add_gate();
+
+    // a constraint, every other step, as they add up quickly
+    unsigned a=network.pick(), b=network.pick();
+    bool sa=rand()%2, sb=rand()%2;
+
+    switch(rand()%6)
+    {
+    case 0:
+      prop.l_set_to(network.literal(a, sa), true);
+      constraints&=network.table(a, sa);
+      break;
+
+    case 1:
+      // this substitutes if a or b is an input
+      prop.set_equal(network.literal(a, sa), network.literal(b, sb));
+      constraints&=~(network.table(a, sa)^network.table(b, sb));
+      break;
+
+    case 2:
+      {
+        bvt clause;
+        clause.push_back(network.literal(a, sa));
+        clause.push_back(network.literal(b, sb));
+        prop.lcnf(clause);
+      }
+      constraints&=network.table(a, sa)|network.table(b, sb);
+      break;
+
+    default:;
+    }
+
+    // assumptions hold for this call only
+    bvt assumptions;
+    tablet assumed=constraints;
+
+    for(unsigned i=rand()%3; i!=0; i--)
+    {
+      unsigned c=network.pick();
+      bool sc=rand()%2;
+      assumptions.push_back(network.literal(c, sc));
+      assumed&=network.table(c, sc);
+    }
+
+    prop.set_assumptions(assumptions);
+
+    // only the assignments to the inputs created so far count
+    tablet mask=0;
+    for(unsigned k=0; k<(1u<<next_input); k++)
+      mask|=1ull<<k;
+
+    propt::resultt result=prop.prop_solve();
+
+    if((assumed&mask)==0)
+    {
+      assert(result==propt::P_UNSATISFIABLE);
+      unsat++;
+      continue;
+    }
+
+    assert(result==propt::P_SATISFIABLE);
+    sat++;
+
+    // the assignment to the inputs
+    unsigned k=0;
+    for(unsigned i=0; i<network.inputs.size(); i++)
+    {
+      tvt value=prop.l_get(network.inputs[i]);
+      assert(value.is_known());
+      if(value.is_true())
+        k|=1u<<i;
+    }
+
+    assert((assumed>>k)&1);
+
+    // every gate has the value of its truth table
+    for(unsigned i=0; i<network.literals.size(); i++)
+      assert(prop.l_get(network.literals[i])==
+             tvt(bool((network.tables[i]>>k)&1)));
+  }
+}
+
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+int main()
+{
+  srand(1);
+
+  unsigned sat=0, unsat=0;
+
+  for(unsigned i=0; i<1000; i++)
+    check_network(sat, unsat);
+
+  std::cout << sat << " SAT, " << unsat << " UNSAT\n";
+
+  // both verdicts need to be covered
+  assert(sat!=0 && unsat!=0);
+
+  return 0;
+}
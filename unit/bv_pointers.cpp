@@ -0,0 +1,123 @@
+/*******************************************************************\
+
+Module: Test for sizing the object part of the pointer encoding
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <iostream>
+
+#include <util/config.h>
+#include <util/i2string.h>
+#include <util/namespace.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+
+#include <solvers/sat/satcheck.h>
+#include <solvers/flattening/bv_pointers.h>
+#include <solvers/flattening/pointer_logic.h>
+
+class test_bv_pointerst:public bv_pointerst
+{
+public:
+  test_bv_pointerst(const namespacet &_ns, propt &_prop):
+    bv_pointerst(_ns, _prop)
+  {
+  }
+
+  unsigned get_object_bits() const { return object_bits; }
+};
+
+/*******************************************************************\
+
+Function: address_of_objects
+
+  Inputs: the number of objects
+
+ Outputs: a pointer that may point to any of them
+
+ Purpose:
+
+\*******************************************************************/
+
+exprt address_of_objects(unsigned n)
+{
+  const signedbv_typet int_type(32);
+
+  exprt result=address_of_exprt(symbol_exprt("o0", int_type));
+
+  for(unsigned i=1; i<n; i++)
+    result=if_exprt(
+      symbol_exprt("c"+i2string(i), bool_typet()),
+      address_of_exprt(symbol_exprt("o"+i2string(i), int_type)),
+      result);
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: check_objects
+
+  Inputs: the number of objects
+
+ Outputs: the number of object bits
+
+ Purpose: the pointers to distinct objects differ
+
+\*******************************************************************/
+
+unsigned check_objects(unsigned n)
+{
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+  satcheckt satcheck;
+  test_bv_pointerst solver(ns, satcheck);
+
+  const exprt p=address_of_objects(n);
+  const signedbv_typet int_type(32);
+  const address_of_exprt last(symbol_exprt("o"+i2string(n-1), int_type));
+
+  solver.add_objects(p);
+  solver.fit_object_bits();
+
+  // p is the last object, which only its own case gives
+  solver.set_to_true(equal_exprt(p, last));
+  assert(solver()==decision_proceduret::D_SATISFIABLE);
+
+  solver.set_to_false(symbol_exprt("c"+i2string(n-1), bool_typet()));
+  assert(solver()==decision_proceduret::D_UNSATISFIABLE);
+
+  return solver.get_object_bits();
+}
+
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: few objects take fewer bits than the default, many take
+          more
+
+\*******************************************************************/
+
+int main()
+{
+  config.ansi_c.set_LP64();
+
+  // null, invalid and 3 objects
+  const unsigned few=check_objects(3);
+  assert(few<BV_ADDR_BITS);
+
+  const unsigned many=check_objects(1000);
+  assert(many>BV_ADDR_BITS);
+
+  std::cout << "object bits: " << few << ", " << many << '\n';
+
+  return 0;
+}
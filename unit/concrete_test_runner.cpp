@@ -0,0 +1,104 @@
+/*******************************************************************\
+
+Module: Test for running fitness tests in evaluator processes
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+#include <util/arith_tools.h>
+#include <util/std_expr.h>
+#include <util/std_types.h>
+
+#include <cegis/genetic/concrete_test_runner.h>
+
+/*******************************************************************\
+
+Function: test_source
+
+  Inputs:
+
+ Outputs: a test that passes iff the counterexample value plus the
+          single instruction's opcode is even, and that crashes
+          for the value 13
+
+\*******************************************************************/
+
+std::string test_source()
+{
+  return
+    "#define " CEGIS_PREFIX "first_prog_offset 1\n"
+    "struct " CEGIS_PREFIX "instructiont\n"
+    "{\n"
+    "  unsigned char opcode, op0, op1, op2;\n"
+    "};\n\n"
+    "int " CONCRETE_TEST_FUNC "(const int argc, const char * const argv[])\n"
+    "{\n"
+    "  " CEGIS_PREFIX "ce_value_init();\n"
+    "  const long x=" CEGIS_PREFIX "ce_value();\n"
+    "  " CEGIS_PREFIX "deserialise_init();\n"
+    "  " CEGIS_PREFIX "declare_prog(prog, prog_size);\n"
+    "  if (x == 13) *(volatile int *)0=0;\n"
+    "  return (x + prog[0].opcode) % 2;\n"
+    "}\n";
+}
+
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+int main()
+{
+  concrete_test_runnert runner(test_source);
+
+  program_individualt::instructiont instr;
+  instr.opcode=1;
+  program_individualt odd;
+  odd.programs.push_back(program_individualt::programt(1, instr));
+  odd.fitness=0;
+  instr.opcode=2;
+  program_individualt even;
+  even.programs.push_back(program_individualt::programt(1, instr));
+  even.fitness=0;
+
+  // many tests, so that the batches do not fit into a pipe
+  const unsigned num_tests=10000;
+  std::vector<int> results(num_tests, -1);
+
+  for (unsigned round=0; round < 2; ++round)
+  {
+    for (unsigned i=0; i < num_tests; ++i)
+    {
+      concrete_test_runnert::counterexamplet ce;
+      ce["x"]=from_integer(i, unsignedbv_typet(32));
+      runner.run_test(i % 2 ? odd : even, ce);
+      runner.run_test(even, ce, [&results, i](const bool success)
+      { results[i]=success;});
+    }
+    runner.join();
+
+    for (unsigned i=0; i < num_tests; ++i)
+      assert(results[i] == (i % 2 == 0));
+  }
+
+  // odd values with an odd opcode pass, even values with an even one,
+  // except for the crash on 13
+  assert(odd.fitness == 2 * (num_tests / 2 - 1));
+  assert(even.fitness == num_tests);
+
+  std::cout << "odd: " << odd.fitness << ", even: " << even.fitness << '\n';
+
+  return 0;
+}
@@ -0,0 +1,72 @@
+/*******************************************************************\
+
+Module: Test for covering goals incrementally
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <iostream>
+
+#include <util/namespace.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+
+#include <solvers/sat/satcheck.h>
+#include <solvers/flattening/boolbv.h>
+#include <solvers/prop/cover_goals.h>
+
+/*******************************************************************\
+
+Function: cover
+
+  Inputs: a solver and a symbol
+
+ Outputs: the number of goals covered
+
+ Purpose: covers the symbol being true and being false
+
+\*******************************************************************/
+
+unsigned cover(prop_convt &solver, const irep_idt &identifier)
+{
+  literalt l=solver.convert(symbol_exprt(identifier, bool_typet()));
+
+  cover_goalst cover_goals(solver);
+  cover_goals.add(l);
+  cover_goals.add(!l);
+  cover_goals();
+
+  assert(cover_goals.number_infeasible()==0);
+  return cover_goals.number_covered();
+}
+
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: a second cover_goalst on the same solver does not see
+          the literals that the first one switched off
+
+\*******************************************************************/
+
+int main()
+{
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+  satcheckt satcheck;
+  boolbvt solver(ns, satcheck);
+
+  assert(cover(solver, "x")==2);
+  assert(cover(solver, "y")==2);
+  assert(cover(solver, "x")==2);
+
+  std::cout << "cover_goals ok\n";
+
+  return 0;
+}
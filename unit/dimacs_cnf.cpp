@@ -0,0 +1,232 @@
+/*******************************************************************\
+
+Module: Test for writing DIMACS CNF while the clauses are generated
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <solvers/sat/dimacs_cnf.h>
+
+/*******************************************************************\
+
+Function: add_clauses
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: adds the same pseudo-random clauses to both formulas,
+          more than fit into the buffer of the writer
+
+\*******************************************************************/
+
+void add_clauses(cnft &a, cnft &b)
+{
+  const unsigned variables=1000;
+
+  for(unsigned i=0; i<variables; i++)
+  {
+    a.new_variable();
+    b.new_variable();
+  }
+
+  srand(1);
+
+  for(unsigned i=0; i<20000; i++)
+  {
+    bvt clause;
+
+    for(unsigned j=rand()%5; j!=0; j--)
+      clause.push_back(literalt(1+rand()%variables, rand()%2));
+
+    a.lcnf(clause);
+    b.lcnf(clause);
+  }
+}
+
+/*******************************************************************\
+
+Function: count_clauses
+
+  Inputs: DIMACS text without the problem line
+
+ Outputs: the number of clauses
+
+ Purpose: every clause is terminated by 0, whatever the lines
+
+\*******************************************************************/
+
+std::size_t count_clauses(const std::string &text)
+{
+  std::istringstream in(text);
+  std::size_t count=0;
+  int literal;
+
+  while(in >> literal)
+    if(literal==0)
+      count++;
+
+  assert(in.eof());
+
+  return count;
+}
+
+/*******************************************************************\
+
+Function: problem_line_clauses
+
+  Inputs: a problem line
+
+ Outputs: the number of clauses it announces
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t problem_line_clauses(const std::string &problem_line)
+{
+  std::istringstream in(problem_line);
+  std::string p, cnf;
+  std::size_t variables, clauses;
+
+  in >> p >> cnf >> variables >> clauses;
+  assert(in && p=="p" && cnf=="cnf");
+
+  return clauses;
+}
+
+/*******************************************************************\
+
+Function: check_break_lines
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: clauses with more than 16 literals are wrapped onto
+          several lines, which the clause count must not follow
+
+\*******************************************************************/
+
+class line_breaking_cnft:public dimacs_cnft
+{
+public:
+  line_breaking_cnft() { break_lines=true; }
+};
+
+void check_break_lines()
+{
+  line_breaking_cnft cnf;
+
+  for(unsigned i=0; i<100; i++)
+    cnf.new_variable();
+
+  for(unsigned size=1; size<=50; size++)
+  {
+    bvt clause;
+    for(unsigned j=0; j<size; j++)
+      clause.push_back(literalt(1+j, size%2));
+    cnf.lcnf(clause);
+  }
+
+  std::ostringstream out;
+  cnf.write_dimacs_cnf(out);
+
+  const std::string &text=out.str();
+  const std::size_t eol=text.find('\n');
+  const std::string clauses=text.substr(eol+1);
+
+  assert(cnf.no_clauses()==50);
+  assert(problem_line_clauses(text.substr(0, eol))==50);
+  assert(count_clauses(clauses)==50);
+
+  // there are more lines than clauses
+  std::size_t lines=0;
+  for(std::size_t i=0; i<clauses.size(); i++)
+    if(clauses[i]=='\n')
+      lines++;
+
+  assert(lines>50);
+}
+
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: compares the streamed clauses with those written
+          by dimacs_cnft from memory
+
+\*******************************************************************/
+
+int main()
+{
+  const char *file_name="dimacs_cnf.cnf";
+
+  dimacs_cnft cnf;
+  std::ostringstream expected;
+
+  // with the problem line, filled in by finish()
+  {
+    std::ofstream out(file_name);
+    dimacs_cnf_dumpt dump(out, true);
+
+    add_clauses(cnf, dump);
+    cnf.write_dimacs_cnf(expected);
+
+    assert(dump.no_clauses()==cnf.no_clauses());
+    dump.finish();
+  }
+
+  std::ifstream in(file_name);
+  std::string problem_line;
+  std::getline(in, problem_line);
+  std::ostringstream clauses;
+  clauses << in.rdbuf();
+  in.close();
+  remove(file_name);
+
+  const std::string &e=expected.str();
+  const std::string expected_problem_line=e.substr(0, e.find('\n'));
+
+  // padded with blanks
+  assert(problem_line.size()>=expected_problem_line.size());
+  assert(problem_line.compare(
+           0, expected_problem_line.size(), expected_problem_line)==0);
+  assert(problem_line.find_first_not_of(
+           ' ', expected_problem_line.size())==std::string::npos);
+
+  assert(clauses.str()==e.substr(expected_problem_line.size()+1));
+
+  // the problem line has the number of clauses that are written
+  assert(problem_line_clauses(problem_line)==cnf.no_clauses());
+  assert(count_clauses(clauses.str())==cnf.no_clauses());
+
+  // without the problem line, the stream need not be seekable
+  {
+    dimacs_cnft cnf2;
+    std::ostringstream out;
+    dimacs_cnf_dumpt dump(out);
+
+    add_clauses(cnf2, dump);
+    dump.finish();
+
+    assert(out.str()==clauses.str());
+  }
+
+  check_break_lines();
+
+  std::cout << expected_problem_line << '\n';
+
+  return 0;
+}
@@ -0,0 +1,181 @@
+/*******************************************************************\
+
+Module: Test for lowering byte operators
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <util/arith_tools.h>
+#include <util/byte_operators.h>
+#include <util/config.h>
+#include <util/namespace.h>
+#include <util/pointer_offset_size.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+
+#include <solvers/sat/satcheck.h>
+#include <solvers/flattening/boolbv.h>
+#include <solvers/flattening/flatten_byte_operators.h>
+
+/*******************************************************************\
+
+Function: equivalent
+
+  Inputs:
+
+ Outputs: true if the lowered expression equals the original one
+          whenever the offset is within bounds
+
+ Purpose: compares with the native encoding of byte operators
+
+\*******************************************************************/
+
+bool equivalent(
+  const exprt &expr,
+  const exprt &offset,
+  const mp_integer &max_offset,
+  const namespacet &ns)
+{
+  const exprt lowered=flatten_byte_operators(expr, ns);
+
+  satcheckt satcheck;
+  boolbvt solver(ns, satcheck);
+
+  solver.set_to_true(binary_relation_exprt(
+    offset, ID_le, from_integer(max_offset, offset.type())));
+  solver.set_to_true(notequal_exprt(lowered, expr));
+
+  return solver()==decision_proceduret::D_UNSATISFIABLE;
+}
+
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: random byte_extract and byte_update expressions on
+          scalars, arrays and a struct, with constant and
+          variable offsets
+
+\*******************************************************************/
+
+int main()
+{
+  config.ansi_c.set_LP64();
+
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+
+  const unsignedbv_typet u8(8), u16(16), u32(32);
+  const unsignedbv_typet offset_type(64);
+
+  std::vector<typet> roots;
+  roots.push_back(u32);
+  roots.push_back(unsignedbv_typet(64));
+  roots.push_back(array_typet(u8, from_integer(4, offset_type)));
+  roots.push_back(array_typet(u16, from_integer(4, offset_type)));
+  roots.push_back(array_typet(u32, from_integer(2, offset_type)));
+
+  struct_typet struct_type;
+  struct_type.components().push_back(struct_typet::componentt("a", u16));
+  struct_type.components().push_back(struct_typet::componentt("b", u8));
+  struct_type.components().push_back(struct_typet::componentt("c", u8));
+  struct_type.components().push_back(struct_typet::componentt("d", u32));
+  roots.push_back(struct_type);
+
+  std::vector<typet> values;
+  values.push_back(u8);
+  values.push_back(u16);
+  values.push_back(u32);
+
+  srand(1);
+
+  unsigned count=0;
+
+  for(unsigned i=0; i<500; i++)
+  {
+    const typet &root_type=roots[rand()%roots.size()];
+    const typet &value_type=values[rand()%values.size()];
+
+    mp_integer root_size=pointer_offset_size(root_type, ns);
+    mp_integer value_size=pointer_offset_size(value_type, ns);
+
+    if(value_size>root_size)
+      continue;
+
+    const mp_integer max_offset=root_size-value_size;
+    const symbol_exprt root("root", root_type);
+    const symbol_exprt variable_offset("offset", offset_type);
+
+    exprt offset=variable_offset;
+    if(rand()%2)
+      offset=from_integer(rand()%integer2unsigned(max_offset+1), offset_type);
+
+    // the lowering does little endian only
+    exprt expr;
+
+    if(rand()%2)
+      expr=byte_extract_exprt(
+        ID_byte_extract_little_endian,
+        root, offset, value_type);
+    else if(root_type.id()==ID_struct)
+    {
+      // structs can only be updated member by member
+      const struct_typet::componentt &c=
+        struct_type.components()[rand()%struct_type.components().size()];
+      expr=byte_update_exprt(
+        ID_byte_update_little_endian,
+        root,
+        from_integer(
+          member_offset(struct_type, c.get_name(), ns), offset_type),
+        symbol_exprt("value", c.type()));
+    }
+    else
+    {
+      // arrays of wider elements can only be updated byte by
+      // byte, or element by element
+      mp_integer offset_int;
+
+      if(root_type.id()==ID_array &&
+         pointer_offset_size(root_type.subtype(), ns)!=1 &&
+         value_size!=1 &&
+         (to_integer(offset, offset_int) ||
+          offset_int%value_size!=0 ||
+          root_type.subtype()!=value_type))
+        continue;
+
+      expr=byte_update_exprt(
+        ID_byte_update_little_endian,
+        root, offset, symbol_exprt("value", value_type));
+    }
+
+    assert(equivalent(expr, variable_offset, max_offset, ns));
+    count++;
+  }
+
+  // sharing is preserved, and shared byte operators are lowered once
+  exprt shared=byte_extract_exprt(
+    ID_byte_extract_little_endian,
+    symbol_exprt("root", roots[3]),
+    symbol_exprt("offset", offset_type),
+    u16);
+
+  for(unsigned level=0; level<64; level++)
+    shared=plus_exprt(shared, shared);
+
+  const exprt lowered=flatten_byte_operators(shared, ns);
+  assert(&lowered.op0().read()==&lowered.op1().read());
+
+  std::cout << count << " expressions\n";
+
+  return 0;
+}
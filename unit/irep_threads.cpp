@@ -0,0 +1,120 @@
+/*******************************************************************\
+
+Module: Stress test for sharing identifiers and ireps among threads
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <util/irep.h>
+#include <util/i2string.h>
+#include <util/time_stopping.h>
+
+const unsigned strings_per_thread=100000;
+const unsigned shared_strings=1000;
+const unsigned copies_per_thread=1000000;
+
+// interns private and shared strings, and checks they map back
+void intern(unsigned thread)
+{
+  for(unsigned i=0; i<strings_per_thread; i++)
+  {
+    std::string own="t"+i2string(thread)+"_"+i2string(i);
+    irep_idt own_id(own);
+    assert(id2string(own_id)==own);
+
+    std::string shared="shared_"+i2string(i%shared_strings);
+    irep_idt shared_id(shared);
+    assert(id2string(shared_id)==shared);
+    assert(irep_idt(shared)==shared_id);
+  }
+}
+
+// copies, modifies and drops ireps that all threads share
+void share(const std::vector<irept> &ireps, unsigned thread)
+{
+  for(unsigned i=0; i<copies_per_thread; i++)
+  {
+    const irept &original=ireps[(i+thread)%ireps.size()];
+    irept copy=original;
+    irept other=copy;
+
+    if(i%16==0)
+    {
+      // forces a copy of the shared node, which must not
+      // be visible through any other reference to it
+      other.set("thread", thread);
+      assert(copy.get("thread").empty());
+      assert(id2string(other.get("thread"))==i2string(thread));
+      assert(copy==original);
+      assert(other.get("value")==original.get("value"));
+    }
+
+    assert(copy.id()==original.id());
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  #ifdef CPROVER_THREAD_SAFE
+  unsigned threads=std::thread::hardware_concurrency();
+  if(argc>=2) threads=atoi(argv[1]);
+  // sharing needs contention to be tested at all
+  if(threads<2) threads=2;
+  #else
+  std::cout << "Built without CPROVER_THREAD_SAFE; using one thread\n";
+  unsigned threads=1;
+  #endif
+
+  std::vector<irept> ireps;
+  for(unsigned i=0; i<64; i++)
+  {
+    irept irep("node"+i2string(i));
+    irep.get_sub().push_back(irept("leaf"));
+    irep.set("value", i);
+    ireps.push_back(irep);
+  }
+
+  {
+    absolute_timet start=current_time();
+
+    std::vector<std::thread> workers;
+    for(unsigned t=0; t<threads; t++)
+      workers.push_back(std::thread(intern, t));
+    for(unsigned t=0; t<threads; t++)
+      workers[t].join();
+
+    std::cout << "Interning: " << threads << " thread(s), "
+              << (current_time()-start) << "s\n";
+  }
+
+  {
+    absolute_timet start=current_time();
+
+    std::vector<std::thread> workers;
+    for(unsigned t=0; t<threads; t++)
+      workers.push_back(std::thread(share, std::cref(ireps), t));
+    for(unsigned t=0; t<threads; t++)
+      workers[t].join();
+
+    std::cout << "Sharing: " << threads << " thread(s), "
+              << (current_time()-start) << "s\n";
+  }
+
+  // none of the modifications may have reached the originals
+  for(unsigned i=0; i<ireps.size(); i++)
+  {
+    assert(ireps[i].id()==irep_idt("node"+i2string(i)));
+    assert(ireps[i].get("thread").empty());
+    assert(ireps[i].get("value")==irep_idt(i2string(i)));
+    assert(ireps[i].get_sub().size()==1);
+  }
+
+  return 0;
+}
@@ -1,86 +1,331 @@
+/*******************************************************************\
+
+Module: Test for the BDD library
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <cstdlib>
 #include <iostream>
+#include <vector>
 
 #include <solvers/miniBDD/miniBDD.h>
 
 using namespace miniBDD;
 
-void test1()
+// the truth table of a BDD over all assignments to the variables
+#define VARIABLES 5
+typedef unsigned tablet;
+const tablet all_assignments=~0u;
+
+class functionst
 {
-  mgr mgr;
-
-  BDD x=mgr.Var("x");
-  BDD y=mgr.Var("y");
-  BDD z=mgr.Var("z");
-  BDD f=(x&y&z)|(!x&!y&z);
-  y.clear();
-  x.clear();
-  z.clear();
-
-  //mgr.DumpDot(std::cout);
-  mgr.DumpTikZ(std::cout);
+public:
+  explicit functionst(mgr &_mgr):bdd_mgr(_mgr)
+  {
+    for(unsigned i=0; i<VARIABLES; i++)
+    {
+      char label[]={ char('a'+i), 0 };
+      vars.push_back(bdd_mgr.Var(label));
+    }
+
+    for(unsigned i=0; i<VARIABLES; i++)
+    {
+      stept s;
+      s.op=VAR;
+      s.a=i;
+      s.b=0;
+      add(s);
+    }
+  }
+
+  mgr &bdd_mgr;
+  std::vector<BDD> vars;
+
+  // how each function was built, to build it again
+  typedef enum { VAR, NOT, AND, OR, XOR, EQUAL } opt;
+  struct stept
+  {
+    opt op;
+    unsigned a, b;
+  };
+
+  std::vector<stept> steps;
+  std::vector<BDD> functions;
+  std::vector<tablet> tables;
+
+  BDD build(const stept &s, const std::vector<BDD> &f) const
+  {
+    switch(s.op)
+    {
+    case VAR: return vars[s.a];
+    case NOT: return !f[s.a];
+    case AND: return f[s.a]&f[s.b];
+    case OR: return f[s.a]|f[s.b];
+    case XOR: return f[s.a]^f[s.b];
+    default: return f[s.a]==f[s.b];
+    }
+  }
+
+  tablet table(const stept &s) const
+  {
+    switch(s.op)
+    {
+    case VAR:
+      {
+        // the assignments with bit a set
+        tablet t=0;
+        for(unsigned k=0; k<(1u<<VARIABLES); k++)
+          if(k&(1u<<s.a))
+            t|=1u<<k;
+        return t;
+      }
+    case NOT: return ~tables[s.a];
+    case AND: return tables[s.a]&tables[s.b];
+    case OR: return tables[s.a]|tables[s.b];
+    case XOR: return tables[s.a]^tables[s.b];
+    default: return ~(tables[s.a]^tables[s.b]);
+    }
+  }
+
+  void add(const stept &s)
+  {
+    steps.push_back(s);
+    functions.push_back(build(s, functions));
+    tables.push_back(table(s));
+  }
+
+  void add_random()
+  {
+    stept s;
+    s.op=opt(1+rand()%5);
+    s.a=pick();
+    s.b=pick();
+    add(s);
+  }
+
+  unsigned pick() const
+  {
+    // one that is still there
+    unsigned i;
+    do i=rand()%functions.size(); while(!functions[i].is_initialized());
+    return i;
+  }
+
+  bool evaluate(const BDD &f, unsigned k) const;
+  void check() const;
+  void check_rebuild() const;
+};
+
+/*******************************************************************\
+
+Function: functionst::evaluate
+
+  Inputs: a BDD and an assignment to the variables
+
+ Outputs: the value of the BDD
+
+ Purpose: follows the path for the assignment, checking the order
+
+\*******************************************************************/
+
+bool functionst::evaluate(const BDD &f, unsigned k) const
+{
+  BDD u=f;
+
+  while(!u.is_constant())
+  {
+    assert(bdd_mgr.level(u.low())>bdd_mgr.level(u));
+    assert(bdd_mgr.level(u.high())>bdd_mgr.level(u));
+    assert(u.low().node_number()!=u.high().node_number());
+
+    unsigned i=u.var()-1;
+    assert(i<VARIABLES);
+    u=(k&(1u<<i))?u.high():u.low();
+  }
+
+  return u.is_true();
 }
 
-void test2()
+/*******************************************************************\
+
+Function: functionst::check
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the functions have their truth tables, and the same
+          function is the same node
+
+\*******************************************************************/
+
+void functionst::check() const
 {
-  mgr mgr;
-  
-  BDD a=mgr.Var("a");
-  BDD b=mgr.Var("b");
-  BDD c=mgr.Var("c");
-  BDD d=mgr.Var("d");
-  
-  BDD final=(a == b) & (c == d);  
+  for(unsigned i=0; i<functions.size(); i++)
+  {
+    if(!functions[i].is_initialized())
+      continue;
 
-  a.clear();
-  b.clear();
-  c.clear();
-  d.clear();
+    for(unsigned k=0; k<(1u<<VARIABLES); k++)
+      assert(evaluate(functions[i], k)==bool((tables[i]>>k)&1));
+
+    assert(functions[i].is_true()==(tables[i]==all_assignments));
+    assert(functions[i].is_false()==(tables[i]==0));
 
-  mgr.DumpTikZ(std::cout, true);
+    for(unsigned j=0; j<i; j++)
+      if(functions[j].is_initialized())
+        assert((tables[i]==tables[j])==
+               (functions[i].node_number()==functions[j].node_number()));
+  }
 }
 
-void test3()
+/*******************************************************************\
+
+Function: functionst::check_rebuild
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: building the functions again yields the same nodes
+
+\*******************************************************************/
+
+void functionst::check_rebuild() const
 {
-  mgr mgr;
-  
-  BDD final=mgr.Var("x") & mgr.Var("y");
+  std::vector<BDD> again;
+
+  for(unsigned i=0; i<steps.size(); i++)
+  {
+    again.push_back(build(steps[i], again));
+
+    if(functions[i].is_initialized())
+      assert(again[i].node_number()==functions[i].node_number());
+  }
+}
+
+/*******************************************************************\
+
+Function: check_random
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: random functions, before and after garbage collection
+          and reordering
+
+\*******************************************************************/
+
+void check_random()
+{
+  mgr bdd_mgr;
+  functionst f(bdd_mgr);
+
+  for(unsigned i=0; i<200; i++)
+    f.add_random();
+
+  // the same function, built differently
+  f.add(f.steps[VARIABLES+rand()%200]);
+
+  f.check();
+  f.check_rebuild();
+
+  // drop some of the functions
+  for(unsigned i=VARIABLES; i<f.functions.size(); i++)
+    if(rand()%2)
+      f.functions[i].clear();
+
+  bdd_mgr.collect_garbage();
+  f.check();
+  f.check_rebuild();
+
+  bdd_mgr.reorder();
+  f.check();
+  f.check_rebuild();
 
-  mgr.DumpDot(std::cout);
-  //mgr.DumpTikZ(std::cout);
-  //mgr.DumpTable(std::cout);
+  // and more functions in the new order
+  for(unsigned i=0; i<50; i++)
+    f.add_random();
+
+  f.check();
+  bdd_mgr.reorder();
+  f.check();
+  f.check_rebuild();
 }
 
-#include <langapi/language_util.h>
-#include <langapi/mode.h>
-#include <ansi-c/ansi_c_language.h>
+/*******************************************************************\
+
+Function: check_reorder
+
+  Inputs:
 
-#include <util/std_expr.h>
-#include <util/symbol_table.h>
-#include <util/namespace.h>
+ Outputs:
 
-#include <solvers/prop/bdd_expr.h>
+ Purpose: sifting finds an order that is linear for
+          a pairwise comparison, which is exponential in
+          the initial one
 
-void test4()
+\*******************************************************************/
+
+void check_reorder()
 {
-  register_language(new_ansi_c_language);
+  mgr bdd_mgr;
+
+  const unsigned n=6;
+  std::vector<BDD> a, b;
 
-  symbol_exprt a("a", bool_typet());
-  symbol_exprt b("b", bool_typet());
+  for(unsigned i=0; i<n; i++)
+    a.push_back(bdd_mgr.Var("a"));
 
-  or_exprt o(and_exprt(a, b), not_exprt(a));
+  for(unsigned i=0; i<n; i++)
+    b.push_back(bdd_mgr.Var("b"));
 
-  symbol_tablet symbol_table;
-  namespacet ns(symbol_table);
+  BDD equal=bdd_mgr.True();
+  for(unsigned i=0; i<n; i++)
+    equal=equal&(a[i]==b[i]);
 
-  std::cout << from_expr(ns, "", o) << std::endl;
+  a.clear();
+  b.clear();
+
+  bdd_mgr.collect_garbage();
+  std::size_t before=bdd_mgr.number_of_nodes();
 
-  bdd_exprt t(ns);
-  t.from_expr(o);
+  bdd_mgr.reorder();
+  std::size_t after=bdd_mgr.number_of_nodes();
 
-  std::cout << from_expr(ns, "", t.as_expr()) << std::endl;
+  // 3 nodes per pair, and the terminals
+  assert(after==3*n+2);
+  assert(before>after);
+
+  std::cout << "reordering: " << before << " -> " << after << " nodes\n";
 }
 
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
 int main()
 {
-  test3();
+  srand(1);
+
+  for(unsigned i=0; i<100; i++)
+    check_random();
+
+  check_reorder();
+
+  std::cout << "BDDs ok\n";
+
+  return 0;
 }
@@ -0,0 +1,120 @@
+/*******************************************************************\
+
+Module: Test for the propositional minimizer and its limits
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <iostream>
+
+#include <util/namespace.h>
+#include <util/symbol_table.h>
+
+#include <solvers/sat/satcheck.h>
+#include <solvers/prop/prop_conv.h>
+#include <solvers/prop/minimize.h>
+
+/*******************************************************************\
+
+Function: minimize_path
+
+  Inputs: number of variables, time limit in milliseconds,
+          limit on the solver calls
+
+ Outputs: the number of solver calls
+
+ Purpose: Minimizes the variables on a path subject to
+          x_i | x_i+1, and checks that the assignment is
+          a model, and is maximal unless a limit was hit
+
+\*******************************************************************/
+
+unsigned minimize_path(
+  unsigned n,
+  unsigned time_limit,
+  unsigned iteration_limit)
+{
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+  satcheckt satcheck;
+  prop_conv_solvert prop_conv(ns, satcheck);
+
+  propt &prop=satcheck;
+
+  bvt x;
+  for(unsigned i=0; i<n; i++)
+  {
+    x.push_back(prop.new_variable());
+    prop.set_frozen(x.back());
+  }
+
+  for(unsigned i=0; i+1<n; i++)
+    prop.lcnf(x[i], x[i+1]);
+
+  prop_minimizet prop_minimize(prop_conv);
+  prop_minimize.time_limit=time_limit;
+  prop_minimize.iteration_limit=iteration_limit;
+  assert(!prop_minimize.timed_out());
+
+  for(unsigned i=0; i<n; i++)
+    prop_minimize.objective(x[i]);
+
+  prop_minimize();
+
+  // we always get a model
+  for(unsigned i=0; i+1<n; i++)
+    assert(prop_conv.l_get(x[i]).is_true() ||
+           prop_conv.l_get(x[i+1]).is_true());
+
+  if(iteration_limit!=0)
+    assert(prop_minimize.iterations()<=iteration_limit);
+
+  if(!prop_minimize.timed_out())
+  {
+    // no variable can be set to false in addition
+    for(unsigned i=0; i<n; i++)
+      if(prop_conv.l_get(x[i]).is_true())
+        assert((i>0 && prop_conv.l_get(x[i-1]).is_false()) ||
+               (i+1<n && prop_conv.l_get(x[i+1]).is_false()));
+  }
+
+  std::cout << n << " variables: " << prop_minimize.number_satisfied()
+            << " of " << prop_minimize.size() << " objectives in "
+            << prop_minimize.iterations() << " iteration(s)"
+            << (prop_minimize.timed_out()?", timed out":"") << '\n';
+
+  return prop_minimize.iterations();
+}
+
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+int main()
+{
+  // no limit: at least one improvement, and the
+  // call that shows there is no further one
+  unsigned iterations=minimize_path(100, 0, 0);
+  assert(iterations>=2);
+
+  // generous limits do not change the result
+  assert(minimize_path(100, 60000, 0)==iterations);
+  assert(minimize_path(100, 0, iterations)==iterations);
+
+  // we stop after the given number of solver calls,
+  // with a model nevertheless
+  assert(minimize_path(100, 0, 1)==1);
+  assert(minimize_path(20000, 0, 1)==1);
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+/*******************************************************************\
+
+Module: Test for push/pop contexts of the propositional back-end
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <iostream>
+
+#include <util/arith_tools.h>
+#include <util/namespace.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+
+#include <solvers/sat/satcheck.h>
+#include <solvers/flattening/boolbv.h>
+#include <solvers/smt1/smt1_dec.h>
+
+/*******************************************************************\
+
+Function: check_contexts
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: A contradiction added in a context makes the formula
+          UNSAT until the context is popped
+
+\*******************************************************************/
+
+void check_contexts()
+{
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+  satcheckt satcheck;
+  boolbvt solver(ns, satcheck);
+
+  assert(solver.has_push_pop());
+
+  const unsignedbv_typet type(32);
+  const symbol_exprt x("x", type);
+  const symbol_exprt b("b", bool_typet());
+
+  // outside of any context, for good
+  solver.set_to_true(or_exprt(b, equal_exprt(x, from_integer(1, type))));
+  assert(solver()==decision_proceduret::D_SATISFIABLE);
+
+  // an outer context that is consistent
+  solver.push();
+  solver.set_to_false(b);
+  assert(solver()==decision_proceduret::D_SATISFIABLE);
+  assert(solver.get(x)==from_integer(1, type));
+
+  // an inner context that is not
+  solver.push();
+  solver.set_to_true(equal_exprt(x, from_integer(2, type)));
+  assert(solver()==decision_proceduret::D_UNSATISFIABLE);
+
+  if(solver.has_is_in_conflict())
+    assert(solver.is_in_conflict(solver.context_literal()));
+
+  // the inner context is gone, the outer one still holds
+  solver.pop();
+  assert(solver()==decision_proceduret::D_SATISFIABLE);
+  assert(solver.get(b).is_false());
+  assert(solver.get(x)==from_integer(1, type));
+
+  // the equality must not have bound x for good
+  solver.pop();
+  solver.set_to_true(equal_exprt(x, from_integer(3, type)));
+  assert(solver()==decision_proceduret::D_SATISFIABLE);
+  assert(solver.get(b).is_true());
+  assert(solver.get(x)==from_integer(3, type));
+}
+
+/*******************************************************************\
+
+Function: check_unsupported
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: A back-end that would ignore the context literals
+          refuses to open a context
+
+\*******************************************************************/
+
+void check_unsupported()
+{
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+  smt1_dect solver(ns, "push_pop", "", "QF_AUFBV", smt1_dect::GENERIC);
+
+  assert(!solver.has_push_pop());
+
+  bool thrown=false;
+
+  try
+  {
+    solver.push();
+  }
+
+  catch(const char *)
+  {
+    thrown=true;
+  }
+
+  assert(thrown);
+}
+
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+int main()
+{
+  check_contexts();
+  check_unsupported();
+
+  std::cout << "push/pop ok\n";
+
+  return 0;
+}
@@ -0,0 +1,96 @@
+/*******************************************************************\
+
+Module: Test for incremental queries on an encoded scratch program
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <iostream>
+
+#include <util/arith_tools.h>
+#include <util/config.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+
+#include <goto-instrument/accelerate/scratch_program.h>
+
+/*******************************************************************\
+
+Function: add_symbol
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+symbol_exprt add_symbol(
+  symbol_tablet &symbol_table,
+  const irep_idt &name,
+  const typet &type)
+{
+  symbolt symbol;
+  symbol.name=name;
+  symbol.base_name=name;
+  symbol.type=type;
+  symbol.mode=ID_C;
+  symbol.is_lvalue=true;
+  symbol_table.add(symbol);
+  return symbol.symbol_expr();
+}
+
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Two paths, told apart by the distinguishers d1 and d2,
+          are blocked one after the other, as the path enumerator
+          does, while the encoding is kept
+
+\*******************************************************************/
+
+int main()
+{
+  config.ansi_c.set_LP64();
+
+  symbol_tablet symbol_table;
+  const unsignedbv_typet type(32);
+  const symbol_exprt d1=add_symbol(symbol_table, "d1", bool_typet());
+  const symbol_exprt d2=add_symbol(symbol_table, "d2", bool_typet());
+  const symbol_exprt x=add_symbol(symbol_table, "x", type);
+
+  scratch_programt program(symbol_table);
+  program.assume(or_exprt(d1, d2));
+  program.assign(x, if_exprt(d1, from_integer(1, type), from_integer(2, type)));
+  program.add_instruction(ASSERT)->guard=false_exprt();
+  program.encode();
+
+  // either path is feasible, and the assumption does not stick
+  assert(program.check_sat_assuming(d1));
+  assert(program.eval(x)==from_integer(1, type));
+  assert(program.check_sat_assuming(not_exprt(d1)));
+  assert(program.eval(x)==from_integer(2, type));
+
+  // block the first path
+  program.add_constraint(not_exprt(d1));
+  assert(!program.check_sat_assuming(d1));
+  assert(program.check_sat_assuming(d2));
+  assert(program.eval(x)==from_integer(2, type));
+
+  // block the second path: nothing is left
+  program.add_constraint(not_exprt(d2));
+  assert(!program.check_sat_assuming(true_exprt()));
+  assert(!program.check_sat_assuming(d2));
+
+  std::cout << "blocked both paths\n";
+
+  return 0;
+}
@@ -0,0 +1,189 @@
+/*******************************************************************\
+
+Module: Test for sharing terms in the SMT2 output
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+#include <util/arith_tools.h>
+#include <util/namespace.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+
+#include <solvers/smt2/smt2_conv.h>
+
+/*******************************************************************\
+
+Function: count
+
+  Inputs:
+
+ Outputs: the number of occurrences of a string
+
+ Purpose:
+
+\*******************************************************************/
+
+unsigned count(const std::string &s, const std::string &what)
+{
+  unsigned result=0;
+
+  for(std::size_t p=s.find(what);
+      p!=std::string::npos;
+      p=s.find(what, p+1))
+    result++;
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: binder_body
+
+  Inputs:
+
+ Outputs: the text of the first quantifier
+
+ Purpose:
+
+\*******************************************************************/
+
+std::string binder_body(const std::string &s)
+{
+  std::size_t begin=s.find("(forall");
+  assert(begin!=std::string::npos);
+
+  unsigned depth=0;
+
+  for(std::size_t p=begin; p<s.size(); p++)
+    if(s[p]=='(')
+      depth++;
+    else if(s[p]==')' && --depth==0)
+      return s.substr(begin, p+1-begin);
+
+  assert(false);
+  return "";
+}
+
+/*******************************************************************\
+
+Function: check_definitions
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: every name is defined once, before it is used
+
+\*******************************************************************/
+
+void check_definitions(const std::string &s)
+{
+  for(unsigned i=0; ; i++)
+  {
+    std::ostringstream name;
+    name << "|T" << i << "|";
+
+    std::size_t def=s.find("(define-fun "+name.str());
+
+    if(def==std::string::npos)
+    {
+      assert(s.find(name.str())==std::string::npos);
+      break;
+    }
+
+    assert(count(s, "(define-fun "+name.str())==1);
+    assert(s.find(name.str())==def+std::string("(define-fun ").size());
+  }
+}
+
+/*******************************************************************\
+
+Function: main
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+int main()
+{
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+
+  const unsignedbv_typet type(32);
+  const symbol_exprt x("x", type), y("y", type), i("i", type);
+  const exprt zero=from_integer(0, type);
+
+  // a term that doubles in size with each level, printed as a tree
+  {
+    std::ostringstream out;
+    smt2_convt smt2(ns, "", "", "QF_BV", smt2_convt::GENERIC, out);
+
+    exprt t=x;
+    for(unsigned level=0; level<64; level++)
+      t=plus_exprt(t, t);
+
+    smt2.set_to_true(equal_exprt(t, y));
+
+    const std::string s=out.str();
+    assert(s.size()<100000);
+    assert(count(s, "(define-fun |T")==63);
+    check_definitions(s);
+  }
+
+  // terms repeated in later queries are named
+  {
+    std::ostringstream out;
+    smt2_convt smt2(ns, "", "", "QF_BV", smt2_convt::GENERIC, out);
+
+    const mult_exprt u(x, y);
+    smt2.set_to_true(notequal_exprt(u, zero));
+    smt2.set_to_true(notequal_exprt(u, x));
+    smt2.set_to_true(notequal_exprt(u, y));
+
+    // printed once as a term, once in the definition
+    const std::string s=out.str();
+    assert(count(s, "(bvmul |x| |y|)")==2);
+    assert(count(s, "(define-fun |T")==1);
+    check_definitions(s);
+  }
+
+  // no names underneath binders
+  {
+    std::ostringstream out;
+    smt2_convt smt2(ns, "", "", "BV", smt2_convt::GENERIC, out);
+
+    // u is named outside of the quantifier,
+    // v contains the bound variable
+    const mult_exprt u(x, y);
+    const plus_exprt v(i, u);
+    smt2.set_to_true(notequal_exprt(u, zero));
+    smt2.set_to_true(notequal_exprt(u, x));
+
+    exprt forall(ID_forall, bool_typet());
+    forall.copy_to_operands(i, and_exprt(
+      equal_exprt(v, v),
+      notequal_exprt(u, y)));
+    smt2.set_to_true(forall);
+
+    const std::string s=out.str();
+    const std::string body=binder_body(s);
+    assert(count(body, "|T")==0);
+    assert(count(body, "(bvadd |i| (bvmul |x| |y|))")==2);
+    assert(count(s, "(define-fun |T")==1);
+    check_definitions(s);
+  }
+
+  std::cout << "sharing ok\n";
+
+  return 0;
+}